@@ -1,6 +1,7 @@
 #ifndef CAFFE_BASE_HPP_
 #define CAFFE_BASE_HPP_
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -62,6 +63,16 @@ CAFFE_API bool GPUAvailable();
  * \param device GPU device id, -1 for CPU
  */
 CAFFE_API void SetMode(DeviceMode mode, int device);
+/*!
+ * \brief set the number of threads the CPU layers of the calling thread run
+ *  on, like SetMode it only applies to the calling thread. Nets with
+ *  parallel_branches set also run independent layers on them
+ * \param num_threads number of threads, the calling thread included, 1 runs
+ *  the layers on the calling thread only
+ */
+CAFFE_API void SetNumThreads(int num_threads);
+/*! \brief number of threads the CPU layers of the calling thread run on */
+CAFFE_API int GetNumThreads();
 
 //// ThreadLocal Memory Pool API
 
@@ -76,6 +87,14 @@ CAFFE_API MemPoolState MemPoolGetState();
 /*! \brief clear unused memory pool in current thread */
 CAFFE_API void MemPoolClear();
 
+//// Layer Cost API
+
+struct LayerCost {
+  int64_t macs;  // multiply-accumulates of one forward pass
+  int64_t bytes_read;  // bytes of bottoms and parameters read
+  int64_t bytes_written;  // bytes of tops written
+};
+
 }  // namespace caffe
 
 #endif  // CAFFE_COMMON_HPP_
@@ -1,6 +1,8 @@
 #ifndef CAFFE_BLOB_HPP_
 #define CAFFE_BLOB_HPP_
 
+#include <stdint.h>
+
 #include <algorithm>
 #include <string>
 #include <vector>
@@ -18,7 +20,8 @@ class SyncedMemory;
 class CAFFE_API Blob {
 public:
 	Blob()
-		: data_(), diff_(), count_(0), capacity_(0) {}
+		: data_(), diff_(), data_offset_(0), count_(0), capacity_(0),
+		int8_(false) {}
 
 	/// @brief Deprecated; use <code>Blob(const vector<int>& shape)</code>.
 	explicit Blob(const int num, const int channels, const int height,
@@ -221,6 +224,17 @@ public:
 	void FromProto(const BlobProto& proto, bool reshape = true);
 	void ToProto(BlobProto* proto, bool write_diff = false) const;
 
+	/**
+	* @brief Returns true if the data was loaded quantized to int8, see
+	*        BlobProto.int8_data, which leaves no float data to read.
+	*        Reshape or FromProto of float data make it float again.
+	*/
+	inline bool is_int8() const { return int8_; }
+	/// @brief the int8 data, see is_int8
+	const int8_t* cpu_int8_data() const;
+	/// @brief the scale of the int8 data of each slice of the first axis
+	const real_t* cpu_int8_scale() const;
+
 	/**
 	* @brief Set the data_ shared_ptr to point to the SyncedMemory holding the
 	*        data_ of Blob other -- useful in Layer%s which simply perform a copy
@@ -231,6 +245,24 @@ public:
 	*/
 	void ShareData(const Blob& other);
 	/**
+	* @brief Set the data_ shared_ptr to point to a SyncedMemory that may be
+	*        larger than this Blob -- useful when Net lets several blobs whose
+	*        lifetimes do not overlap reuse the same memory.
+	*
+	* The Blob will allocate its own memory again if it is later reshaped to
+	* a larger count.
+	*/
+	void ShareData(const shared_ptr<SyncedMemory>& data, int offset = 0);
+	/**
+	* @brief Make this Blob a view of its count() elements of Blob other
+	*        starting at offset -- useful when Net lets a layer write its
+	*        output right into a part of another Blob.
+	*
+	* Like above, the Blob leaves the view if it is later reshaped to a larger
+	* count.
+	*/
+	void ShareData(const Blob& other, int offset);
+	/**
 	* @brief Set the diff_ shared_ptr to point to the SyncedMemory holding the
 	*        diff_ of Blob other -- useful in Layer%s which simply perform a copy
 	*        in their Forward pass.
@@ -244,15 +276,20 @@ public:
 
 	//++
 	int capacity() const { return capacity_; }
+	/// @brief offset of the first element in the SyncedMemory returned by data()
+	int data_offset() const { return data_offset_; }
 	std::string name() { return name_; }
 	void set_name(std::string name) { name_ = name; }
 protected:
 	shared_ptr<SyncedMemory> data_;
 	shared_ptr<SyncedMemory> diff_;
 	shared_ptr<SyncedMemory> shape_data_;
+	int data_offset_;
 	vector<int> shape_;
 	int count_;
 	int capacity_;
+	/// @brief data_ holds the scales then the values of the int8 data
+	bool int8_;
 	//++
 	std::string name_;
 	//
@@ -11,6 +11,8 @@
 #define CAFFE_API
 #endif
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
@@ -55,6 +57,19 @@ CAFFE_API int CaffeNetCreate(const char *net_path,
                              const char *model_path,
                              NetHandle *net);
 
+/*!
+ * \brief create network sharing the weights of another one, and the weights
+ *  packed from them, both may be used by different threads at the same time
+ *  and destroyed in any order
+ * \param net_path path to network prototxt file
+ * \param other network whose weights are shared
+ * \param net output NetHandle
+ * \return return code, 0 for success, -1 for failed
+ */
+CAFFE_API int CaffeNetCreateShared(const char *net_path,
+                                   NetHandle other,
+                                   NetHandle *net);
+
 /*! \brief destroy network */
 CAFFE_API int CaffeNetDestroy(NetHandle net);
 /*!
@@ -106,8 +121,24 @@ CAFFE_API int CaffeNetListParam(NetHandle net,
                                 int *n,
                                 const char ***names,
                                 BlobHandle **params);
+/*!
+ * \brief list the cost of one forward pass of every layer for the current
+ *        shapes, layers fused into another one cost nothing
+ * \param net net handle
+ * \param n number of layers
+ * \param names list of string to layer names
+ * \param macs list of multiply-accumulates
+ * \param bytes_read list of bytes read from bottoms and parameters
+ * \param bytes_written list of bytes written to tops
+ */
+CAFFE_API int CaffeNetListLayerCost(NetHandle net,
+                                    int *n,
+                                    const char ***names,
+                                    int64_t **macs,
+                                    int64_t **bytes_read,
+                                    int64_t **bytes_written);
 
-// Profiler, don't enable Profiler in multi-thread Env
+// Profiler, every thread records its own scopes into one dump
 
 /*!
  * \brief enable profiler
@@ -145,6 +176,12 @@ CAFFE_API int CaffeGPUAvailable();
  * \param device GPU device id, -1 for CPU
  */
 CAFFE_API int CaffeSetMode(int mode, int device);
+/*!
+ * \brief set the number of threads CPU layers run on, only applies to the
+ *  calling thread like CaffeSetMode
+ * \param num_threads number of threads, 1 for the calling thread only
+ */
+CAFFE_API int CaffeSetNumThreads(int num_threads);
 /*!
  * \brief return last API error info
  * \note  this function is thread safe
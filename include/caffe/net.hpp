@@ -13,6 +13,7 @@ namespace caffe {
 
 class Layer;
 class NetParameter;
+class ThreadPool;
 
 /**
  * @brief Connects Layer%s together into a directed acyclic graph (DAG)
@@ -41,7 +42,12 @@ public:
 	* networks, note that (1) computing from one layer to another might entail
 	* extra computation on unrelated branches, and (2) computation starting in
 	* the middle may be incorrect if all of the layers of a fan-in are not
-	* included.
+	* included. (3) With NetParameter.fuse_layers, a residual Eltwise fused
+	* into the Convolution feeding it sums in place over its shortcut, so a
+	* range starting after the layer writing the shortcut and up to the
+	* Convolution must come before the Convolution ran again, and one starting
+	* after the Convolution and up to the Eltwise after it did. Other starts
+	* in there are refused.
 	*/
 	real_t ForwardFromTo(int start, int end);
 
@@ -54,9 +60,29 @@ public:
 	void Reshape();
 
 	
+	/// @brief Load weights from a caffemodel or a flat weight file.
 	void CopyTrainedLayersFrom(const string trained_filename);
 	void CopyTrainedLayersFromBinaryProto(const string trained_filename);
+	/**
+	* @brief Map a flat weight file written by ConvertToFlatWeights and let
+	*        the parameters use it without a copy. Pages of the file are read
+	*        when first used and shared by all nets mapping it. The weights
+	*        each net packs for its layers are its own, map the file once and
+	*        ShareTrainedLayersWith to share those too.
+	*/
+	void CopyTrainedLayersFromFlat(const string trained_filename);
 	void CopyTrainedLayersFrom(const NetParameter& param);
+	/**
+	* @brief Share the parameters of the layers with the same name in other
+	*        instead of holding a copy, e.g. for one net per worker thread.
+	*
+	* Parameters are read only while running, so nets sharing them may run at
+	* the same time, and share the weights their layers pack or quantize for
+	* the gemm. Loading weights into either net changes both. The parameters this net
+	* allocated go back to the memory pool of the calling thread, see
+	* MemPoolClear. In GPU mode the nets must run on one device.
+	*/
+	void ShareTrainedLayersWith(const Net* other);
 
 	/// @brief returns the network name.
 	inline const string& name() const { return name_; }
@@ -152,7 +178,19 @@ public:
 	bool has_layer(const string& layer_name) const;
 	const shared_ptr<Layer > layer_by_name(const string& layer_name) const;
 	const vector<string>& param_names() const { return param_display_names_; }
+	/// @brief Returns the multiply-accumulates and bytes moved by one Forward
+	/// of layer i for the current shapes, nothing for layers fused into another.
+	LayerCost layer_cost(int i) const;
+	/// @brief Whether layer i is run by the layer it is fused into.
+	bool layer_fused(int i) const;
 protected:
+	/// @brief Run layer i, in a profiler scope when profiling.
+	void ForwardLayer(int i);
+	/// @brief Run layers start to end, independent ones at the same time on
+	/// the threads of pool.
+	void ForwardBranches(int start, int end, ThreadPool* pool);
+	/// @brief Find the layers each layer must run before.
+	void BuildLayerGraph();
 	// Helpers for Init.
 	/// @brief Append a new top blob to the net.
 	void AppendTop(const NetParameter& param, const int layer_id,
@@ -165,6 +203,28 @@ protected:
 	/// @brief Append a new parameter blob to the net.
 	void AppendParam(const NetParameter& param, const int layer_id,
 		const int param_id);
+	/// @brief Group blobs sharing the same memory and find the reusable ones.
+	void AnalyzeMemory();
+	/// @brief Let intermediate blobs with disjoint lifetimes share memory.
+	void PlanMemory();
+	/// @brief Back the temporary blobs of all layers with shared workspaces.
+	void ShareTempBlobs();
+	/// @brief Let the tops of Split layers share data with their bottom.
+	void ShareSplitBlobs();
+	/// @brief Run in-place activations as epilogues of the layer feeding them
+	/// and residual Eltwise sums inside the Convolution feeding them, see
+	/// NetParameter.fuse_layers.
+	void FuseEpilogues();
+	/// @brief Let the Convolution feeding an Eltwise SUM add its result onto
+	/// the other input, return false if that is not safe.
+	bool FuseResidual(int layer_id, const vector<int>& producer);
+	/// @brief Bind the blobs of the residuals found by FuseResidual onto the
+	/// shortcut they accumulate into.
+	void ShareResidualBlobs();
+	/// @brief Find the Concat inputs that can be written into the output.
+	void FindConcatViews();
+	/// @brief Bind the inputs found by FindConcatViews into their Concat output.
+	void ShareConcatBlobs();
 
 	/// @brief The network name
 	string name_;
@@ -172,6 +232,8 @@ protected:
 	/// @brief Individual layers in the net
 	vector<shared_ptr<Layer > > layers_;
 	vector<string> layer_names_;
+	/// Profiler scope name of each layer, "name (type)".
+	vector<string> layer_scope_names_;
 	std::map<string, int> layer_names_index_;
 	vector<bool> layer_need_backward_;
 	/// @brief the blobs storing intermediate results between the layer.
@@ -220,11 +282,85 @@ protected:
 	vector<bool> has_params_decay_;
 	/// The bytes of memory used by this net
 	size_t memory_used_;
+	/// Whether intermediate blobs may share memory.
+	bool optimize_memory_;
+	/// Whether layers of independent branches run at the same time.
+	bool parallel_branches_;
+	/// Whether a Forward of the whole net ran since the shapes changed, so
+	/// all the memory of the net is allocated.
+	bool warmed_up_;
+	/// The layers reading or writing memory that each layer touches before
+	/// them, fused layers are left out.
+	vector<vector<int> > layer_successors_;
+	/// The memory group of each blob, blobs in the same group alias each
+	/// other. -1 marks blobs that must keep their own memory.
+	vector<int> blob_memory_ids_;
+	/// (layer id, bottom id) of the Concat inputs living in the Concat output,
+	/// outer Concats first.
+	vector<std::pair<int, int> > concat_views_;
+	/// The layer each layer is fused into, or -1. Activations are run by it in
+	/// CPU mode only, residual Eltwise layers in both modes.
+	vector<int> layer_fused_into_;
+	/// (layer id, bottom id) of the shortcut of each fused Eltwise, and the
+	/// blobs moved onto it: the Convolution output, the Eltwise output and the
+	/// blobs sharing that.
+	vector<std::pair<int, int> > residual_views_;
+	vector<vector<int> > residual_blob_ids_;
+	/// The first layer writing the shortcut of each fused Eltwise, and whether
+	/// the shortcut holds the sum since the Convolution ran.
+	vector<int> residual_producers_;
+	vector<bool> residual_summed_;
 	/// Whether to compute and display debug info for the net.
 	bool debug_info_;
 	/// The root net that actually holds the shared layers in data parallelism
 	DISABLE_COPY_AND_ASSIGN(Net);
 };
+
+/*!
+ * \brief fold BatchNorm, BN, Scale and Bias layers into the weights of the
+ *        Convolution, ConvolutionDepthwise, Deconvolution or InnerProduct
+ *        layer feeding them, see tools/fuse_bn.cpp
+ * \param param_file network prototxt
+ * \param trained_file network caffemodel
+ * \param out_param_file prototxt of the folded network
+ * \param out_trained_file caffemodel of the folded network
+ * \return number of layers folded
+ */
+CAFFE_API int FoldBatchNorm(const string& param_file, const string& trained_file,
+                            const string& out_param_file,
+                            const string& out_trained_file);
+
+/*!
+ * \brief convert a caffemodel to a flat weight file, whose weights are mapped
+ *        into memory rather than parsed when loaded, see
+ *        tools/convert_weights.cpp and Net::CopyTrainedLayersFromFlat
+ * \param trained_file network caffemodel
+ * \param out_trained_file flat weight file
+ */
+CAFFE_API void ConvertToFlatWeights(const string& trained_file,
+                                   const string& out_trained_file);
+
+/*!
+ * \brief calibrate the int8 inference of the Convolution,
+ *        ConvolutionDepthwise and InnerProduct layers: the network runs over
+ *        the inputs and the range of the input of each such layer is written
+ *        as its quantization_param, see tools/calibrate.cpp
+ * \param param_file network prototxt
+ * \param trained_file network caffemodel
+ * \param input_files BlobProto of the input of the network, each a sample
+ *        of the inputs to calibrate with, networks of several inputs are
+ *        not supported
+ * \param out_param_file prototxt of the int8 network
+ * \param out_trained_file caffemodel of the int8 network, with the weights
+ *        of the quantized layers in int8, which load without a float copy
+ * \return number of layers quantized
+ */
+CAFFE_API int CalibrateInt8(const string& param_file,
+                            const string& trained_file,
+                            const vector<string>& input_files,
+                            const string& out_param_file,
+                            const string& out_trained_file);
+
 }  // namespace caffe
 
 #endif  // CAFFE_NET_HPP_
@@ -1,6 +1,8 @@
 #ifndef CAFFE_PROFILER_HPP_
 #define CAFFE_PROFILER_HPP_
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -9,7 +11,7 @@
 namespace caffe {
 
 /*!
- * \brief Profiler for Caffe, don't enable Profiler in Multi-thread Env
+ * \brief Profiler for Caffe
  *  This class is used to profile a range of source code as a scope.
  *  The basic usage is like below.
  *
@@ -22,39 +24,37 @@ namespace caffe {
  * ```
  *
  * Scope represents a range of source code. Nested scope is also supported.
- * Dump profile into a json file, then we can view the data from google chrome
- * in chrome://tracing/
+ * Every thread records its scopes into a buffer of its own without locking,
+ * TurnON and TurnOFF apply to all threads. Dump profile into a json file with
+ * one tid per thread, then we can view the data from google chrome in
+ * chrome://tracing/
  */
 class CAFFE_API Profiler {
 public:
   /*! \brief get global instance */
   static Profiler *Get();
   /*!
-   * \brief start a scope
+   * \brief start a scope on the calling thread
    * \param name scope name
+   * \param args json object shown with the scope, like {"macs": 10}
    */
-  void ScopeStart(const char *name);
+  void ScopeStart(const char *name, const char *args = NULL);
   /*!
-   * \brief end a scope
+   * \brief end the innermost scope of the calling thread, a scope started
+   *  before TurnOFF is still recorded
    */
   void ScopeEnd();
   /*!
-   * \brief dump profile data
+   * \brief dump profile data of all threads, their scopes must be closed
    * \param fn file name
    */
   void DumpProfile(const char *fn) const;
   /*! \brief turn on profiler */
-  void TurnON() {
-    CHECK_EQ(state_, kNotRunning) << "Profile is already running.";
-    state_ = kRunning;
-  }
-  /*! \brief turn off profiler */
-  void TurnOFF() {
-    CHECK_EQ(state_, kRunning) << "Profile is not running.";
-    CHECK(scope_stack_.empty()) << "Profile scope stack is not empty, with size = "
-        << scope_stack_.size();
-    state_ = kNotRunning;
-  }
+  void TurnON();
+  /*! \brief turn off profiler, scopes of the calling thread must be closed */
+  void TurnOFF();
+  /*! \brief whether the profiler is recording scopes */
+  bool IsRunning() const { return state_ == kRunning; }
   /*! \brief timestamp, return in microseconds */
   uint64_t Now() const;
 
@@ -69,18 +69,22 @@ private:
   };
   struct Scope {
     std::string name;
+    std::string args;
     uint64_t start_microsec = 0;
     uint64_t end_microsec = 0;
   };
-  typedef std::shared_ptr<Scope> ScopePtr;
-  /*! \brief scope stack for nested scope */
-  std::vector<ScopePtr> scope_stack_;
-  /*! \brief all scopes used in profile, not including scopes in stack */
-  std::vector<ScopePtr> scopes_;
+  /*! \brief scopes recorded by one thread */
+  struct ThreadProfile;
+  /*! \brief get the scopes of the calling thread */
+  ThreadProfile *GetThreadProfile();
+  /*! \brief scopes of all threads that used the profiler, in order of use */
+  std::vector<ThreadProfile*> threads_;
+  /*! \brief guard threads_ */
+  mutable std::mutex mutex_;
   /*! \brief init timestamp */
   uint64_t init_;
   /*! \brief profile state */
-  State state_;
+  std::atomic<State> state_;
 };  // class Profiler
 
 }  // namespace
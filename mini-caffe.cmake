@@ -4,8 +4,12 @@ option(USE_CUDA "Use CUDA support" OFF)
 option(USE_CUDNN "Use CUDNN support" OFF)
 option(USE_JAVA "Use JAVA support" OFF)
 
-# select BLAS
+# select BLAS: openblas, blas or internal, the gemm of src/util/gemm.cpp
 set(BLAS "openblas" CACHE STRING "Selected BLAS library")
+if(BLAS STREQUAL "internal")
+  add_definitions(-DUSE_INTERNAL_BLAS)
+  message(STATUS "Use internal gemm for blas library")
+endif()
 
 include(${CMAKE_CURRENT_LIST_DIR}/cmake/Cuda.cmake)
 
@@ -25,8 +29,10 @@ if(MSVC)
                       ${CMAKE_CURRENT_LIST_DIR}/3rdparty/include/google
                       ${CMAKE_CURRENT_LIST_DIR}/include)
   link_directories(${CMAKE_CURRENT_LIST_DIR}/3rdparty/lib)
-  list(APPEND Caffe_LINKER_LIBS debug libprotobufd optimized libprotobuf
-                                libopenblas)
+  list(APPEND Caffe_LINKER_LIBS debug libprotobufd optimized libprotobuf)
+  if(NOT BLAS STREQUAL "internal")
+    list(APPEND Caffe_LINKER_LIBS libopenblas)
+  endif()
 elseif(ANDROID)
   # TODO https://github.com/android-ndk/ndk/issues/105
   set(CMAKE_CXX_STANDARD_LIBRARIES "${CMAKE_CXX_STANDARD_LIBRARIES} -nodefaultlibs -lgcc -lc -lm -ldl")
@@ -34,7 +40,10 @@ elseif(ANDROID)
     include_directories(${CMAKE_CURRENT_LIST_DIR}/include
                         ${ANDROID_EXTRA_LIBRARY_PATH}/include)
     link_directories(${ANDROID_EXTRA_LIBRARY_PATH}/lib)
-    list(APPEND Caffe_LINKER_LIBS openblas protobuf log)
+    list(APPEND Caffe_LINKER_LIBS protobuf log)
+    if(NOT BLAS STREQUAL "internal")
+      list(APPEND Caffe_LINKER_LIBS openblas)
+    endif()
   else(ANDROID_EXTRA_LIBRARY_PATH)
     message(FATAL_ERROR "ANDROID_EXTRA_LIBRARY_PATH must be set.")
   endif(ANDROID_EXTRA_LIBRARY_PATH)
@@ -48,7 +57,7 @@ else(MSVC)
   if(BLAS STREQUAL "openblas")
     list(APPEND Caffe_LINKER_LIBS openblas)
     message(STATUS "Use OpenBLAS for blas library")
-  else()
+  elseif(NOT BLAS STREQUAL "internal")
     list(APPEND Caffe_LINKER_LIBS blas)
     message(STATUS "Use BLAS for blas library")
   endif()
@@ -66,6 +75,33 @@ file(GLOB CAFFE_SRC_UTIL ${CMAKE_CURRENT_LIST_DIR}/src/util/*.hpp
 file(GLOB CAFFE_SRC_PROTO ${CMAKE_CURRENT_LIST_DIR}/src/proto/caffe.pb.h
                           ${CMAKE_CURRENT_LIST_DIR}/src/proto/caffe.pb.cc)
 
+# gemm kernels of wider instruction sets, only run where the CPU has them
+if(CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|i.86|x86)$")
+  if(MSVC)
+    set_source_files_properties(${CMAKE_CURRENT_LIST_DIR}/src/util/gemm_avx2.cpp
+                                PROPERTIES COMPILE_FLAGS "/arch:AVX2")
+    set_source_files_properties(${CMAKE_CURRENT_LIST_DIR}/src/util/gemm_avx512.cpp
+                                PROPERTIES COMPILE_FLAGS "/arch:AVX512")
+    set_source_files_properties(${CMAKE_CURRENT_LIST_DIR}/src/util/gemm_avx512vnni.cpp
+                                PROPERTIES COMPILE_FLAGS "/arch:AVX512")
+  elseif(CMAKE_COMPILER_IS_GNUCXX OR (CMAKE_CXX_COMPILER_ID MATCHES "Clang"))
+    set_source_files_properties(${CMAKE_CURRENT_LIST_DIR}/src/util/gemm_avx2.cpp
+                                PROPERTIES COMPILE_FLAGS "-mavx2 -mfma")
+    set_source_files_properties(${CMAKE_CURRENT_LIST_DIR}/src/util/gemm_avx512.cpp
+                                PROPERTIES COMPILE_FLAGS "-mavx512f")
+    set_source_files_properties(${CMAKE_CURRENT_LIST_DIR}/src/util/gemm_avx512vnni.cpp
+                                PROPERTIES COMPILE_FLAGS "-mavx512f -mavx512bw -mavx512vnni")
+  endif()
+endif()
+
+# the clamps of the int8 quantization only vectorize if they may not trap
+if(CMAKE_COMPILER_IS_GNUCXX OR (CMAKE_CXX_COMPILER_ID MATCHES "Clang"))
+  set_property(SOURCE ${CMAKE_CURRENT_LIST_DIR}/src/util/gemm.cpp
+                      ${CMAKE_CURRENT_LIST_DIR}/src/util/gemm_avx2.cpp
+                      ${CMAKE_CURRENT_LIST_DIR}/src/util/gemm_avx512vnni.cpp
+               APPEND_STRING PROPERTY COMPILE_FLAGS " -fno-trapping-math")
+endif()
+
 # cpp code
 set(CAFFE_COMPILE_CODE ${CAFFE_INCLUDE}
                        ${CAFFE_SRC}
@@ -1,7 +1,7 @@
 # coding = utf-8
 """Mini-Caffe: A minimal runtime core of Caffe, Forward only and GPU support"""
 from .net import Net
-from .base import check_gpu_available, set_runtime_mode
+from .base import check_gpu_available, set_runtime_mode, set_num_threads
 from .craft import LayerCrafter
 from .profiler import Profiler
 
@@ -128,3 +128,16 @@ def set_runtime_mode(mode, device_id=-1):
     """
     assert mode == 0 or mode == 1
     check_call(LIB.CaffeSetMode(mode, device_id))
+
+
+def set_num_threads(num_threads):
+    """set the number of threads CPU layers run on, only applies to the
+    calling thread like set_runtime_mode
+
+    Parameters
+    ----------
+    num_threads: int
+        number of threads, 1 for the calling thread only
+    """
+    assert num_threads >= 1
+    check_call(LIB.CaffeSetNumThreads(num_threads))
@@ -21,13 +21,19 @@ class Net(object):
         ----------
         prototxt: string
             caffe network prototxt file path
-        caffemodel: string
-            caffe network caffemodel file path
+        caffemodel: string or Net
+            caffe network caffemodel file path, or a net whose weights are
+            shared instead of loaded again, packed weights included
         """
         self.handle = NetHandle()
-        check_call(LIB.CaffeNetCreate(c_str(prototxt),
-                                      c_str(caffemodel),
-                                      ctypes.byref(self.handle)))
+        if isinstance(caffemodel, Net):
+            check_call(LIB.CaffeNetCreateShared(c_str(prototxt),
+                                                caffemodel.handle,
+                                                ctypes.byref(self.handle)))
+        else:
+            check_call(LIB.CaffeNetCreate(c_str(prototxt),
+                                          c_str(caffemodel),
+                                          ctypes.byref(self.handle)))
 
     def __del__(self):
         """destruct object
@@ -96,6 +102,32 @@ class Net(object):
             params[layer_name].append((name, param))
         return params
 
+    @property
+    def layer_costs(self):
+        """return the cost of one forward pass of every layer for the current shapes,
+        layers fused into another one cost nothing
+
+        Returns
+        -------
+        costs: list((layer_name, macs, bytes_read, bytes_written))
+            multiply-accumulates and bytes moved by every layer in order
+        """
+        ctypes_n = ctypes.c_int32()
+        ctypes_names = ctypes.POINTER(ctypes.c_char_p)()
+        ctypes_macs = ctypes.POINTER(ctypes.c_int64)()
+        ctypes_bytes_read = ctypes.POINTER(ctypes.c_int64)()
+        ctypes_bytes_written = ctypes.POINTER(ctypes.c_int64)()
+        check_call(LIB.CaffeNetListLayerCost(self.handle, ctypes.byref(ctypes_n),
+                                             ctypes.byref(ctypes_names),
+                                             ctypes.byref(ctypes_macs),
+                                             ctypes.byref(ctypes_bytes_read),
+                                             ctypes.byref(ctypes_bytes_written)))
+        costs = []
+        for i in range(ctypes_n.value):
+            costs.append((py_str(ctypes_names[i]), ctypes_macs[i],
+                          ctypes_bytes_read[i], ctypes_bytes_written[i]))
+        return costs
+
     def mark_output(self, name):
         """mark network internal blob as output, you need to mark it if you need the data,
         and the blob is not an output blob, otherwise you may get the wrong result
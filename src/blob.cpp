@@ -1,3 +1,4 @@
+#include <cstring>
 #include <vector>
 
 #include <google/protobuf/io/coded_stream.h>
@@ -37,10 +38,12 @@ namespace caffe {
 			shape_[i] = shape[i];
 			shape_data[i] = shape[i];
 		}
-		if (count_ > capacity_) {
+		if (count_ > capacity_ || int8_) {
 			capacity_ = count_;
 			data_.reset(new SyncedMemory(capacity_ * sizeof(real_t)));
+			data_offset_ = 0;
 			diff_.reset(new SyncedMemory(capacity_ * sizeof(real_t)));
+			int8_ = false;
 		}
 	}
 
@@ -60,13 +63,13 @@ namespace caffe {
 	Blob::Blob(const int num, const int channels, const int height,
 		const int width)
 		// capacity_ must be initialized before calling Reshape
-		: capacity_(0) {
+		: data_offset_(0), capacity_(0), int8_(false) {
 		Reshape(num, channels, height, width);
 	}
 
 	Blob::Blob(const vector<int>& shape)
 		// capacity_ must be initialized before calling Reshape
-		: capacity_(0) {
+		: data_offset_(0), capacity_(0), int8_(false) {
 		Reshape(shape);
 	}
 
@@ -77,12 +80,14 @@ namespace caffe {
 
 	const real_t* Blob::cpu_data() const {
 		CHECK(data_);
-		return (const real_t*)data_->cpu_data();
+		CHECK(!int8_) << "float data of an int8 blob";
+		return (const real_t*)data_->cpu_data() + data_offset_;
 	}
 	 
 	const real_t* Blob::gpu_data() const {
 		CHECK(data_);
-		return (const real_t*)data_->gpu_data();
+		CHECK(!int8_) << "float data of an int8 blob";
+		return (const real_t*)data_->gpu_data() + data_offset_;
 	}
 
 	 
@@ -100,13 +105,15 @@ namespace caffe {
 	 
 	real_t* Blob::mutable_cpu_data() {
 		CHECK(data_);
-		return static_cast<real_t*>(data_->mutable_cpu_data());
+		CHECK(!int8_) << "float data of an int8 blob";
+		return static_cast<real_t*>(data_->mutable_cpu_data()) + data_offset_;
 	}
 
 	 
 	real_t* Blob::mutable_gpu_data() {
 		CHECK(data_);
-		return static_cast<real_t*>(data_->mutable_gpu_data());
+		CHECK(!int8_) << "float data of an int8 blob";
+		return static_cast<real_t*>(data_->mutable_gpu_data()) + data_offset_;
 	}
 
 	 
@@ -125,6 +132,27 @@ namespace caffe {
 	void Blob::ShareData(const Blob& other) {
 		CHECK_EQ(count_, other.count());
 		data_ = other.data();
+		data_offset_ = other.data_offset();
+		int8_ = other.is_int8();
+	}
+
+	 
+	void Blob::ShareData(const shared_ptr<SyncedMemory>& data, int offset) {
+		CHECK(data);
+		CHECK_GE(offset, 0);
+		CHECK_GE(data->size(), (offset + count_) * sizeof(real_t));
+		data_ = data;
+		data_offset_ = offset;
+		// grow out of the shared memory on the next larger Reshape
+		capacity_ = count_;
+		int8_ = false;
+	}
+
+	void Blob::ShareData(const Blob& other, int offset) {
+		CHECK(!other.is_int8());
+		CHECK_GE(offset, 0);
+		CHECK_LE(offset + count_, other.count());
+		ShareData(other.data(), other.data_offset() + offset);
 	}
 
 	 
@@ -172,8 +200,7 @@ namespace caffe {
 					static_cast<real_t*>(diff_->mutable_gpu_data()));
 			}
 			else {
-				caffe_copy(count_, source.gpu_data(),
-					static_cast<real_t*>(data_->mutable_gpu_data()));
+				caffe_copy(count_, source.gpu_data(), mutable_gpu_data());
 			}
 			break;
 		case Caffe::CPU:
@@ -182,8 +209,7 @@ namespace caffe {
 					static_cast<real_t*>(diff_->mutable_cpu_data()));
 			}
 			else {
-				caffe_copy(count_, source.cpu_data(),
-					static_cast<real_t*>(data_->mutable_cpu_data()));
+				caffe_copy(count_, source.cpu_data(), mutable_cpu_data());
 			}
 			break;
 		default:
@@ -192,6 +218,22 @@ namespace caffe {
 	}
 
 	 
+	static void CopyField(const google::protobuf::RepeatedField<float>& field,
+		real_t* out) {
+		if (field.size() > 0) {
+			memcpy(out, field.data(), field.size() * sizeof(real_t));
+		}
+	}
+
+	static void CopyField(const google::protobuf::RepeatedField<double>& field,
+		real_t* out) {
+		const double* in = field.data();
+		const int size = field.size();
+		for (int i = 0; i < size; ++i) {
+			out[i] = static_cast<real_t>(in[i]);
+		}
+	}
+
 	void Blob::FromProto(const BlobProto& proto, bool reshape) {
 		if (reshape) {
 			vector<int> shape;
@@ -216,33 +258,40 @@ namespace caffe {
 		else {
 			CHECK(ShapeEquals(proto)) << "shape mismatch (reshape not set)";
 		}
-		// copy data
+		if (proto.has_int8_data()) {
+			// the scales, then the values, in place of the float data
+			CHECK_GT(num_axes(), 0);
+			CHECK_EQ(count_, proto.int8_data().size());
+			CHECK_EQ(shape(0), proto.int8_scale_size());
+			const size_t scale_size = shape(0) * sizeof(real_t);
+			data_.reset(new SyncedMemory(scale_size + count_));
+			data_offset_ = 0;
+			int8_ = true;
+			char* data = static_cast<char*>(data_->mutable_cpu_data());
+			CopyField(proto.int8_scale(), reinterpret_cast<real_t*>(data));
+			memcpy(data + scale_size, proto.int8_data().data(), count_);
+			return;
+		}
+		if (int8_) {
+			Reshape(shape_);
+		}
+		// copy data, the repeated fields are contiguous
 		real_t* data_vec = mutable_cpu_data();
 		if (proto.double_data_size() > 0) {
 			CHECK_EQ(count_, proto.double_data_size());
-			for (int i = 0; i < count_; ++i) {
-				data_vec[i] = proto.double_data(i);
-			}
+			CopyField(proto.double_data(), data_vec);
 		}
 		else {
 			CHECK_EQ(count_, proto.data_size());
-			for (int i = 0; i < count_; ++i) {
-				data_vec[i] = proto.data(i);
-			}
+			CopyField(proto.data(), data_vec);
 		}
 		if (proto.double_diff_size() > 0) {
 			CHECK_EQ(count_, proto.double_diff_size());
-			real_t* diff_vec = mutable_cpu_diff();
-			for (int i = 0; i < count_; ++i) {
-				diff_vec[i] = proto.double_diff(i);
-			}
+			CopyField(proto.double_diff(), mutable_cpu_diff());
 		}
 		else if (proto.diff_size() > 0) {
 			CHECK_EQ(count_, proto.diff_size());
-			real_t* diff_vec = mutable_cpu_diff();
-			for (int i = 0; i < count_; ++i) {
-				diff_vec[i] = proto.diff(i);
-			}
+			CopyField(proto.diff(), mutable_cpu_diff());
 		}
 	}
 
@@ -253,36 +302,58 @@ namespace caffe {
 		}
 		proto->clear_data();
 		proto->clear_diff();
-		const float* data_vec = cpu_data();
-		for (int i = 0; i < count_; ++i) {
-			proto->add_data(data_vec[i]);
+		proto->clear_int8_data();
+		proto->clear_int8_scale();
+		if (int8_) {
+			proto->mutable_int8_scale()->Resize(shape(0), 0);
+			memcpy(proto->mutable_int8_scale()->mutable_data(), cpu_int8_scale(),
+				shape(0) * sizeof(real_t));
+			proto->set_int8_data(reinterpret_cast<const char*>(cpu_int8_data()),
+				count_);
+			return;
+		}
+		proto->mutable_data()->Resize(count_, 0);
+		if (count_ > 0) {
+			memcpy(proto->mutable_data()->mutable_data(), cpu_data(),
+				count_ * sizeof(real_t));
 		}
 		if (write_diff) {
-			const float* diff_vec = cpu_diff();
-			for (int i = 0; i < count_; ++i) {
-				proto->add_diff(diff_vec[i]);
+			proto->mutable_diff()->Resize(count_, 0);
+			if (count_ > 0) {
+				memcpy(proto->mutable_diff()->mutable_data(), cpu_diff(),
+					count_ * sizeof(real_t));
 			}
 		}
 	}
 
+	const int8_t* Blob::cpu_int8_data() const {
+		return reinterpret_cast<const int8_t*>(cpu_int8_scale() + shape(0));
+	}
+
+	const real_t* Blob::cpu_int8_scale() const {
+		CHECK(data_);
+		CHECK(int8_) << "not an int8 blob";
+		return static_cast<const real_t*>(data_->cpu_data());
+	}
+
 const int* BlobInt::cpu_data() const {
   CHECK(data_);
-  return static_cast<const int*>(data_->cpu_data());
+  return static_cast<const int*>(data_->cpu_data()) + data_offset_;
 }
 
 int* BlobInt::mutable_cpu_data() {
   CHECK(data_);
-  return static_cast<int*>(data_->mutable_cpu_data());
+  return static_cast<int*>(data_->mutable_cpu_data()) + data_offset_;
 }
 
 const int* BlobInt::gpu_data() const {
   CHECK(data_);
-  return static_cast<const int*>(data_->gpu_data());
+  return static_cast<const int*>(data_->gpu_data()) + data_offset_;
 }
 
 int* BlobInt::mutable_gpu_data() {
   CHECK(data_);
-  return static_cast<int*>(data_->mutable_gpu_data());
+  return static_cast<int*>(data_->mutable_gpu_data()) + data_offset_;
 }
 
 shared_ptr<Blob> ReadBlobFromFile(const string& file) {
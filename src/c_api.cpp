@@ -65,6 +65,15 @@ int CaffeNetCreate(const char *net_path, const char *model_path,
   API_END();
 }
 
+int CaffeNetCreateShared(const char *net_path, NetHandle other,
+                         NetHandle *net) {
+  API_BEGIN();
+  caffe::Net *net_ = new caffe::Net(net_path);
+  net_->ShareTrainedLayersWith(static_cast<caffe::Net*>(other));
+  *net = static_cast<NetHandle>(net_);
+  API_END();
+}
+
 int CaffeNetDestroy(NetHandle net) {
   API_BEGIN();
   delete static_cast<caffe::Net*>(net);
@@ -191,6 +200,42 @@ int CaffeNetListParam(NetHandle net, int *n, const char ***names, BlobHandle **p
   API_END();
 }
 
+struct LayerCostEntry {
+  std::vector<const char*> vec_charp;
+  std::vector<int64_t> vec_macs;
+  std::vector<int64_t> vec_bytes_read;
+  std::vector<int64_t> vec_bytes_written;
+};
+
+typedef ThreadLocalStore<LayerCostEntry> LayerCostStore;
+
+int CaffeNetListLayerCost(NetHandle net, int *n, const char ***names,
+                          int64_t **macs, int64_t **bytes_read,
+                          int64_t **bytes_written) {
+  API_BEGIN();
+  caffe::Net *net_ = static_cast<caffe::Net*>(net);
+  const auto &names_ = net_->layer_names();
+  const int num = names_.size();
+  auto *ret = LayerCostStore::Get();
+  ret->vec_charp.resize(num);
+  ret->vec_macs.resize(num);
+  ret->vec_bytes_read.resize(num);
+  ret->vec_bytes_written.resize(num);
+  for (int i = 0; i < num; i++) {
+    const caffe::LayerCost cost = net_->layer_cost(i);
+    ret->vec_charp[i] = names_[i].c_str();
+    ret->vec_macs[i] = cost.macs;
+    ret->vec_bytes_read[i] = cost.bytes_read;
+    ret->vec_bytes_written[i] = cost.bytes_written;
+  }
+  *n = num;
+  *names = ret->vec_charp.data();
+  *macs = ret->vec_macs.data();
+  *bytes_read = ret->vec_bytes_read.data();
+  *bytes_written = ret->vec_bytes_written.data();
+  API_END();
+}
+
 int CaffeGPUAvailable() {
 #ifdef USE_CUDA
   return 1;
@@ -211,6 +256,12 @@ int CaffeSetMode(int mode, int device) {
   API_END();
 }
 
+int CaffeSetNumThreads(int num_threads) {
+  API_BEGIN();
+  caffe::SetNumThreads(num_threads);
+  API_END();
+}
+
 // Helper
 
 struct ErrorEntry {
@@ -1,6 +1,7 @@
 #include "caffe/base.hpp"
 #include "./common.hpp"
 #include "./thread_local.hpp"
+#include "./util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -12,7 +13,7 @@ Caffe& Caffe::Get() {
 #ifndef USE_CUDA
 
 Caffe::Caffe()
-  : mode_(Caffe::CPU) { }
+  : mode_(Caffe::CPU), num_threads_(1) { }
 
 Caffe::~Caffe() { }
 
@@ -33,7 +34,7 @@ int Caffe::FindDevice(const int start_id) {
 #else  // Normal GPU + CPU Caffe.
 
 Caffe::Caffe()
-    : cublas_handle_(NULL), mode_(Caffe::CPU) {
+    : cublas_handle_(NULL), mode_(Caffe::CPU), num_threads_(1) {
   // Try to create a cublas handler, and report an error if failed (but we will
   // keep the program running as one might just want to run CPU code).
   if (cublasCreate(&cublas_handle_) != CUBLAS_STATUS_SUCCESS) {
@@ -124,6 +125,15 @@ const char* cublasGetErrorString(cublasStatus_t error) {
 
 #endif  // USE_CUDA
 
+void Caffe::set_num_threads(int num_threads) {
+  CHECK_GE(num_threads, 1) << "Invalid number of threads: " << num_threads;
+  if (num_threads == Get().num_threads_) {
+    return;
+  }
+  Get().num_threads_ = num_threads;
+  Get().thread_pool_.reset(num_threads > 1 ? new ThreadPool(num_threads) : NULL);
+}
+
 bool GPUAvailable() {
 #ifdef USE_CUDA
   return true;
@@ -147,4 +157,12 @@ void SetMode(DeviceMode mode, int device) {
   }
 }
 
+void SetNumThreads(int num_threads) {
+  Caffe::set_num_threads(num_threads);
+}
+
+int GetNumThreads() {
+  return Caffe::num_threads();
+}
+
 }  // namespace caffe
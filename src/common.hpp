@@ -70,6 +70,8 @@ void classname::funcname##_##gpu(const vector<Blob*>& bottom,          \
 
 namespace caffe {
 
+class ThreadPool;
+
 // A singleton class to hold common caffe stuff, such as the handler that
 // caffe is going to use for cublas, curand, etc.
 class Caffe {
@@ -100,12 +102,20 @@ class Caffe {
   // Search from start_id to the highest possible device ordinal,
   // return the ordinal of the first available device.
   static int FindDevice(const int start_id = 0);
+  // Returns the number of threads CPU layers run on.
+  inline static int num_threads() { return Get().num_threads_; }
+  // Sets the number of threads CPU layers run on, the calling thread included.
+  static void set_num_threads(int num_threads);
+  // Returns the thread pool of the CPU layers, NULL for a single thread.
+  inline static ThreadPool* thread_pool() { return Get().thread_pool_.get(); }
 
  protected:
 #ifdef USE_CUDA
   cublasHandle_t cublas_handle_;
 #endif
   Brew mode_;
+  int num_threads_;
+  std::unique_ptr<ThreadPool> thread_pool_;
 
  private:
   friend ThreadLocalStore<Caffe>;
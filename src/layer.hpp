@@ -30,7 +30,8 @@ class Layer {
    * layer.
    */
   explicit Layer(const LayerParameter& param)
-      : layer_param_(param) {
+      : layer_param_(param), accumulate_top_(false), channel_block_(0),
+        bottom_channel_block_(0) {
     // Set phase and copy blobs (if there are any).
     if (layer_param_.blobs_size() > 0) {
       blobs_.resize(layer_param_.blobs_size());
@@ -115,9 +116,118 @@ class Layer {
   inline void Forward(const vector<Blob*>& bottom,
                       const vector<Blob*>& top);
 
-  /*! \brief get internal temporary blobs to share memory */
+  /*!
+   * \brief get internal temporary blobs to share memory
+   *  Net lets temporary blobs of different layers share memory, so the layer
+   *  must write them before reading in every Forward and must not keep data
+   *  in them across calls (e.g. all-ones multipliers filled in Reshape).
+   */
   virtual std::vector<Blob*> GetTempBlobs() { return {}; }
 
+  /**
+   * @brief Returns the multiply-accumulates and the bytes moved by one Forward
+   *        for the current shapes. By default there are no multiply-accumulates,
+   *        the bottoms and parameters are read once and the tops written once.
+   */
+  virtual LayerCost GetCost(const vector<Blob*>& bottom,
+                            const vector<Blob*>& top) const {
+    LayerCost cost = {0, 0, 0};
+    for (int i = 0; i < bottom.size(); ++i) {
+      cost.bytes_read += bottom[i]->count() * sizeof(real_t);
+    }
+    for (int i = 0; i < blobs_.size(); ++i) {
+      cost.bytes_read += blobs_[i]->count() * sizeof(real_t);
+    }
+    for (int i = 0; i < top.size(); ++i) {
+      cost.bytes_written += top[i]->count() * sizeof(real_t);
+    }
+    return cost;
+  }
+
+  /**
+   * @brief Returns true if the layer can run in place as an epilogue of the
+   *        layer producing its bottom, see ForwardEpilogue_cpu.
+   */
+  virtual bool CanRunAsEpilogue() const { return false; }
+  /**
+   * @brief Applies the layer in place to channels x inner_dim values of its
+   *        bottom at data, value i belongs to channel
+   *        channel_offset + i / inner_dim.
+   */
+  virtual void ForwardEpilogue_cpu(real_t* data, int channels, int inner_dim,
+                                   int channel_offset) {
+    NOT_IMPLEMENTED;
+  }
+  /**
+   * @brief Returns true if Forward_cpu runs the layers added by AddEpilogue on
+   *        the output while it is still hot in cache.
+   */
+  virtual bool AcceptsEpilogue() const { return false; }
+  /**
+   * @brief Lets the layer run another layer on its output, Net then skips that
+   *        layer in CPU mode.
+   */
+  virtual void AddEpilogue(Layer* layer) {
+    CHECK(AcceptsEpilogue() && layer->CanRunAsEpilogue());
+    epilogues_.push_back(layer);
+  }
+  bool has_epilogues() const { return !epilogues_.empty(); }
+  /**
+   * @brief Returns true if Forward can add its result onto the data already
+   *        in its top, see AccumulateTop.
+   */
+  virtual bool AcceptsResidual() const { return false; }
+  /**
+   * @brief Makes Forward add its result onto the top instead of overwriting
+   *        it, Net points the top at the residual to add before the
+   *        epilogues run.
+   */
+  void AccumulateTop() {
+    CHECK(AcceptsResidual() && epilogues_.empty());
+    accumulate_top_ = true;
+  }
+
+  /**
+   * @brief Returns true if the layer works the same on any layout of the
+   *        channels its bottoms share, like element wise layers, its tops
+   *        then have that layout too.
+   */
+  virtual bool IsLayoutAgnostic() const { return false; }
+  /**
+   * @brief Returns true if Forward_cpu runs on bottoms and tops blocked in
+   *        channels of block, see SetChannelBlock.
+   */
+  virtual bool AcceptsChannelBlock(int block) const { return false; }
+  /**
+   * @brief Like AcceptsChannelBlock, for the shapes of the bottoms, which
+   *        Net knows before SetUp, NULL if it does not.
+   */
+  virtual bool AcceptsChannelBlock(int block,
+                                   const vector<const Blob*>& bottom) const {
+    return AcceptsChannelBlock(block);
+  }
+  /**
+   * @brief Returns true if the tops may be blocked in channels while the
+   *        bottoms stay NCHW, like for a convolution of the 3 channels of
+   *        an image.
+   */
+  virtual bool AcceptsPlainBottoms() const { return false; }
+  /**
+   * @brief Makes Forward_cpu read the bottoms and write the tops blocked in
+   *        channels, N x C / block x H x W x block, while their shapes stay
+   *        (N, C, H, W), or tells a layout agnostic layer. Net calls it
+   *        before SetUp, 0 is plain NCHW, as are the bottoms if
+   *        plain_bottoms.
+   */
+  void SetChannelBlock(int block, bool plain_bottoms = false) {
+    CHECK(block == 0 || IsLayoutAgnostic() || AcceptsChannelBlock(block));
+    CHECK(!plain_bottoms || AcceptsPlainBottoms());
+    channel_block_ = block;
+    bottom_channel_block_ = plain_bottoms ? 0 : block;
+  }
+  int channel_block() const { return channel_block_; }
+  int bottom_channel_block() const { return bottom_channel_block_; }
+
   /**
    * @brief Returns the vector of learnable parameter blobs.
    */
@@ -200,6 +310,26 @@ class Layer {
   LayerParameter layer_param_;
   /** The vector that stores the learnable parameters as a set of blobs. */
   vector<shared_ptr<Blob> > blobs_;
+  /** The layers run on the output in Forward_cpu, see AddEpilogue. */
+  vector<Layer*> epilogues_;
+  /** Whether Forward adds its result onto the top, see AccumulateTop. */
+  bool accumulate_top_;
+  /** The channel block of the tops, see SetChannelBlock. */
+  int channel_block_;
+  /** The channel block of the bottoms. */
+  int bottom_channel_block_;
+
+  /**
+   * @brief Runs the epilogues on channels x inner_dim values of the output,
+   *        from channel channel_offset on.
+   */
+  void ForwardEpilogues_cpu(real_t* data, int channels, int inner_dim,
+                            int channel_offset = 0) {
+    for (int i = 0; i < epilogues_.size(); ++i) {
+      epilogues_[i]->ForwardEpilogue_cpu(data, channels, inner_dim,
+                                         channel_offset);
+    }
+  }
 
   /** @brief Using the CPU device, compute the layer output. */
   virtual void Forward_cpu(const vector<Blob*>& bottom,
@@ -237,6 +237,17 @@ void BaseConvolutionLayer::Reshape(const vector<Blob*>& bottom,
     }
   }
   col_buffer_.Reshape(col_buffer_shape_);
+  // im2col takes a pass over a buffer kernel_dim_ times the size of the
+  // output for the gemm to pack it again, pack it once from the image, also
+  // 1x1 when the image is blocked in channels
+  pack_image_ = !reverse_dimensions() && (!is_1x1_ || channel_block_) &&
+                group_ == 1 && num_spatial_axes_ == 2 && !force_nd_im2col_ &&
+                GetGemmKernel() != NULL;
+  CHECK(pack_image_ || !channel_block_);
+  if (IsQuantized(this->layer_param_)) {
+    CHECK(!reverse_dimensions() && num_spatial_axes_ == 2 && !force_nd_im2col_)
+        << "Only 2D Convolution runs in int8";
+  }
   bottom_dim_ = bottom[0]->count(channel_axis_);
   top_dim_ = top[0]->count(channel_axis_);
   num_kernels_im2col_ = conv_in_channels_ * conv_out_spatial_dim_;
@@ -251,10 +262,48 @@ void BaseConvolutionLayer::Reshape(const vector<Blob*>& bottom,
   }
 }
 
+LayerCost BaseConvolutionLayer::GetCost(const vector<Blob*>& bottom,
+                                        const vector<Blob*>& top) const {
+  LayerCost cost = Layer::GetCost(bottom, top);
+  // one conv_out_channels_ x conv_out_spatial_dim_ x kernel_dim_ gemm split
+  // in groups per image, the same for the reversed dimensions of Deconvolution
+  cost.macs = static_cast<int64_t>(bottom.size()) * num_ * conv_out_channels_ *
+      conv_out_spatial_dim_ * kernel_dim_;
+  if (accumulate_top_) {
+    for (int i = 0; i < top.size(); ++i) {
+      cost.bytes_read += top[i]->count() * sizeof(real_t);
+    }
+  }
+  return cost;
+}
+
 void BaseConvolutionLayer::forward_cpu_gemm(const real_t* input,
                                             const real_t* weights,
                                             real_t* output,
                                             bool skip_im2col) {
+  // the weights of the layer are packed once, not by BLAS in every call
+  const vector<PackedMatrix>* packed = NULL;
+  if (weights == this->blobs_[0]->cpu_data()) {
+    packed = &packed_weights_.Get(*this->blobs_[0], group_, false,
+                                  conv_out_channels_ / group_, kernel_dim_,
+                                  pack_image_ && channel_block_ != 0);
+  }
+  if (pack_image_ && packed && !packed->empty()) {
+    const int* kernel = kernel_shape_.cpu_data();
+    const int* pad = pad_.cpu_data();
+    const int* stride = stride_.cpu_data();
+    const int* dilation = dilation_.cpu_data();
+    const int* shape = conv_input_shape_.cpu_data();
+    caffe_cpu_gemm_packed((*packed)[0], conv_out_spatial_dim_,
+        [&](int k0, int kc, int n0, int n1, int nr, real_t* out) {
+          im2col_pack_cpu(input, conv_in_channels_, shape[1], shape[2],
+              kernel[0], kernel[1], pad[0], pad[1], stride[0], stride[1],
+              dilation[0], dilation[1], k0, kc, n0, n1, nr, out,
+              bottom_channel_block_);
+        }, static_cast<real_t>(accumulate_top_ ? 1 : 0), output,
+        channel_block_);
+    return;
+  }
   const real_t* col_buff = input;
   if (!is_1x1_) {
     if (!skip_im2col) {
@@ -263,20 +312,73 @@ void BaseConvolutionLayer::forward_cpu_gemm(const real_t* input,
     col_buff = col_buffer_.cpu_data();
   }
   for (int g = 0; g < group_; ++g) {
+    if (packed && !packed->empty()) {
+      caffe_cpu_gemm_packed((*packed)[g], CblasNoTrans, conv_out_spatial_dim_,
+        col_buff + col_offset_ * g, static_cast<real_t>(accumulate_top_ ? 1 : 0),
+        output + output_offset_ * g);
+      continue;
+    }
     caffe_cpu_gemm(CblasNoTrans, CblasNoTrans, conv_out_channels_ / group_,
       conv_out_spatial_dim_, kernel_dim_,
       static_cast<real_t>(1), weights + weight_offset_ * g, col_buff + col_offset_ * g,
-      static_cast<real_t>(0), output + output_offset_ * g);
+      static_cast<real_t>(accumulate_top_ ? 1 : 0),
+      output + output_offset_ * g);
   }
 }
 
 void BaseConvolutionLayer::forward_cpu_bias(real_t* output,
                                             const real_t* bias) {
+  if (channel_block_) {
+    const int block = channel_block_;
+    for (int c0 = 0; c0 < num_output_; c0 += block) {
+      for (int j = 0; j < out_spatial_dim_; ++j) {
+        for (int b = 0; b < block; ++b) {
+          output[b] += bias[c0 + b];
+        }
+        output += block;
+      }
+    }
+    return;
+  }
   caffe_cpu_gemm(CblasNoTrans, CblasNoTrans, num_output_,
     out_spatial_dim_, 1, static_cast<real_t>(1), bias, bias_multiplier_.cpu_data(),
     static_cast<real_t>(1), output);
 }
 
+void BaseConvolutionLayer::forward_cpu_int8(const real_t* input,
+                                            real_t* output) {
+  const QuantizationParameter& quantization =
+      this->layer_param_.quantization_param();
+  const real_t scale = quantization.bottom_scale();
+  const int zero_point = quantization.bottom_zero_point();
+  const vector<QuantizedMatrix>& quantized = quantized_weights_.Get(
+      *this->blobs_[0], group_, false, conv_out_channels_ / group_,
+      kernel_dim_);
+  // the image quantized once, its col buffer packed straight from it
+  static thread_local vector<uint8_t> quantized_input;
+  quantized_input.resize(bottom_dim_);
+  QuantizeUint8(bottom_dim_, input, scale, zero_point, &quantized_input[0]);
+  const int* kernel = kernel_shape_.cpu_data();
+  const int* pad = pad_.cpu_data();
+  const int* stride = stride_.cpu_data();
+  const int* dilation = dilation_.cpu_data();
+  const int* shape = conv_input_shape_.cpu_data();
+  const int channels = conv_in_channels_ / group_;
+  const real_t* bias = bias_term_ ? this->blobs_[1]->cpu_data() : NULL;
+  for (int g = 0; g < group_; ++g) {
+    const uint8_t* image = &quantized_input[0] +
+        static_cast<size_t>(g) * channels * shape[1] * shape[2];
+    caffe_cpu_gemm_int8(quantized[g], conv_out_spatial_dim_,
+        [&](int n0, int n1, int nr, uint8_t* out) {
+          im2col_pack_int8(image, channels, shape[1], shape[2],
+              kernel[0], kernel[1], pad[0], pad[1], stride[0], stride[1],
+              dilation[0], dilation[1], zero_point, n0, n1, nr, out);
+        }, scale, zero_point,
+        bias ? bias + g * conv_out_channels_ / group_ : NULL,
+        accumulate_top_, output + output_offset_ * g, false);
+  }
+}
+
 void BaseConvolutionLayer::backward_cpu_gemm(const real_t* output,
                                              const real_t* weights,
                                              real_t* input) {
@@ -310,7 +412,8 @@ void BaseConvolutionLayer::forward_gpu_gemm(const real_t* input,
     caffe_gpu_gemm(CblasNoTrans, CblasNoTrans, conv_out_channels_ / group_,
       conv_out_spatial_dim_, kernel_dim_,
       static_cast<real_t>(1), weights + weight_offset_ * g, col_buff + col_offset_ * g,
-      static_cast<real_t>(0), output + output_offset_ * g);
+      static_cast<real_t>(accumulate_top_ ? 1 : 0),
+      output + output_offset_ * g);
   }
 }
 
@@ -4,7 +4,9 @@
 #include <vector>
 
 #include "../layer.hpp"
+#include "../util/gemm.hpp"
 #include "../util/im2col.hpp"
+#include "../util/quantize.hpp"
 
 namespace caffe {
 
@@ -15,12 +17,18 @@ namespace caffe {
 class BaseConvolutionLayer : public Layer {
  public:
   explicit BaseConvolutionLayer(const LayerParameter& param)
-      : Layer(param) {}
+      : Layer(param), pack_image_(false) {}
   virtual void LayerSetUp(const vector<Blob*>& bottom,
                           const vector<Blob*>& top);
   virtual void Reshape(const vector<Blob*>& bottom,
                        const vector<Blob*>& top);
-  virtual vector<Blob*> GetTempBlobs() { return {&col_buffer_}; }
+  virtual vector<Blob*> GetTempBlobs() {
+    // col_buffer_ is never touched by 1x1 convolution
+    if (is_1x1_ || pack_image_ || IsQuantized(this->layer_param_)) return {};
+    return {&col_buffer_};
+  }
+  virtual LayerCost GetCost(const vector<Blob*>& bottom,
+                            const vector<Blob*>& top) const;
 
   virtual int MinBottomBlobs() const { return 1; }
   virtual int MinTopBlobs() const { return 1; }
@@ -33,6 +41,9 @@ class BaseConvolutionLayer : public Layer {
   void forward_cpu_gemm(const real_t* input, const real_t* weights,
                         real_t* output, bool skip_im2col = false);
   void forward_cpu_bias(real_t* output, const real_t* bias);
+  /// @brief forward_cpu_gemm and forward_cpu_bias in int8, see
+  /// QuantizationParameter
+  void forward_cpu_int8(const real_t* input, real_t* output);
   void backward_cpu_gemm(const real_t* input, const real_t* weights,
                          real_t* output);
 
@@ -84,6 +95,12 @@ class BaseConvolutionLayer : public Layer {
   bool bias_term_;
   bool is_1x1_;
   bool force_nd_im2col_;
+  /// @brief blobs_[0] packed for forward_cpu_gemm
+  PackedWeights packed_weights_;
+  /// @brief im2col straight into the panels of the gemm, not col_buffer_
+  bool pack_image_;
+  /// @brief blobs_[0] quantized for forward_cpu_int8
+  QuantizedWeights quantized_weights_;
 
  private:
   // wrap im2col/col2im so we don't have to remember the (long) argument lists
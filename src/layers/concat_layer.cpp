@@ -59,6 +59,12 @@ void ConcatLayer::Forward_cpu(const vector<Blob*>& bottom,
   for (int i = 0; i < bottom.size(); ++i) {
     const real_t* bottom_data = bottom[i]->cpu_data();
     const int bottom_concat_axis = bottom[i]->shape(concat_axis_);
+    // Net may have let the producer write right into the top
+    if (num_concats_ == 1 &&
+        bottom_data == top_data + offset_concat_axis * concat_input_size_) {
+      offset_concat_axis += bottom_concat_axis;
+      continue;
+    }
     for (int n = 0; n < num_concats_; ++n) {
       caffe_copy(bottom_concat_axis * concat_input_size_,
         bottom_data + n * bottom_concat_axis * concat_input_size_,
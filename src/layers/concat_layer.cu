@@ -33,6 +33,12 @@ void ConcatLayer::Forward_gpu(const vector<Blob*>& bottom,
   for (int i = 0; i < bottom.size(); ++i) {
     const real_t* bottom_data = bottom[i]->gpu_data();
     const int bottom_concat_axis = bottom[i]->shape(concat_axis_);
+    // Net may have let the producer write right into the top
+    if (num_concats_ == 1 &&
+        bottom_data == top_data + offset_concat_axis * concat_input_size_) {
+      offset_concat_axis += bottom_concat_axis;
+      continue;
+    }
     const int bottom_concat_size = bottom_concat_axis * concat_input_size_;
     const int nthreads = bottom_concat_size * num_concats_;
     Concat  // NOLINT_NEXT_LINE(whitespace/operators)
@@ -23,6 +23,15 @@ class ConcatLayer : public Layer {
   virtual const char* type() const { return "Concat"; }
   virtual int MinBottomBlobs() const { return 1; }
   virtual int ExactNumTopBlobs() const { return 1; }
+  /// @brief blocks of channels stay whole along num and channels of 4 axes
+  virtual bool IsLayoutAgnostic() const {
+    const ConcatParameter& concat_param = this->layer_param_.concat_param();
+    if (concat_param.has_concat_dim()) {
+      return concat_param.concat_dim() <= 1;
+    }
+    const int axis = concat_param.axis();
+    return axis == 0 || axis == 1 || axis == -4 || axis == -3;
+  }
 
  protected:
   /**
@@ -3,6 +3,8 @@
 
 #include "../filler.hpp"
 #include "./conv_dw_layer.hpp"
+#include "../util/gemm.hpp"
+#include "../util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -65,6 +67,10 @@ void ConvolutionDepthwiseLayer::LayerSetUp(const vector<Blob*>& bottom,
     dilation_h_ = 1;
     dilation_w_ = 1;
   }
+  if (conv_param.has_num_output()) {
+    CHECK_EQ(conv_param.num_output(), bottom[0]->channels())
+        << "ConvolutionDepthwise has one output channel per input channel";
+  }
   vector<int> weight_shape(4);
   weight_shape[0] = bottom[0]->channels();
   weight_shape[1] = 1;
@@ -101,54 +107,361 @@ void ConvolutionDepthwiseLayer::Reshape(const vector<Blob*>& bottom,
   top[0]->Reshape(top_shape);
 }
 
+// Output rows of stride 1 narrower than this are convolved as one row across
+// the padded plane, too short for the vectors otherwise. The outputs computed
+// over the padding between them are dropped.
+static const int kDepthwiseJoinWidth = 32;
+
+// Copies an input plane into padded_height x padded_width with its padding
+// filled in. Rows of stride 2 hold the even columns followed by the odd ones,
+// so every tap of DepthwiseRow3x3 reads its columns in order.
+static void PadPlane(const real_t* input, int height, int width, int pad_h,
+                     int pad_w, int stride, int padded_height,
+                     int padded_width, real_t* padded) {
+  for (int h = 0; h < padded_height; ++h) {
+    real_t* row = padded + h * padded_width;
+    const int h_in = h - pad_h;
+    if (h_in < 0 || h_in >= height) {
+      std::fill(row, row + padded_width, real_t(0));
+      continue;
+    }
+    const real_t* input_row = input + h_in * width;
+    if (stride == 1) {
+      const int lo = std::min(pad_w, padded_width);
+      const int hi = std::max(lo, std::min(padded_width, width + pad_w));
+      std::fill(row, row + lo, real_t(0));
+      std::copy(input_row, input_row + hi - lo, row + lo);
+      std::fill(row + hi, row + padded_width, real_t(0));
+      continue;
+    }
+    auto at = [&](int w) {
+      const int w_in = w - pad_w;
+      return w_in >= 0 && w_in < width ? input_row[w_in] : real_t(0);
+    };
+    const int pairs = padded_width / 2;
+    real_t* even = row;
+    real_t* odd = row + pairs + 1;
+    // columns 2 * w and 2 * w + 1 both lie in the input for w in [lo, hi)
+    const int lo = std::min(pairs, (pad_w + 1) / 2);
+    const int hi = std::max(lo, std::min(pairs, (width + pad_w) / 2));
+    const real_t* columns = input_row - pad_w;
+    for (int w = 0; w < lo; ++w) {
+      even[w] = at(2 * w);
+      odd[w] = at(2 * w + 1);
+    }
+    for (int w = lo; w < hi; ++w) {
+      even[w] = columns[2 * w];
+      odd[w] = columns[2 * w + 1];
+    }
+    for (int w = hi; w < pairs; ++w) {
+      even[w] = at(2 * w);
+      odd[w] = at(2 * w + 1);
+    }
+    even[pairs] = at(2 * pairs);
+  }
+}
+
 void ConvolutionDepthwiseLayer::Forward_cpu(const vector<Blob*>& bottom,
                                             const vector<Blob*>& top) {
+  switch (channel_block_) {
+  case 4: Forward_blocked_cpu<4>(bottom, top); return;
+  case 8: Forward_blocked_cpu<8>(bottom, top); return;
+  case 16: Forward_blocked_cpu<16>(bottom, top); return;
+  }
+  if (IsQuantized(this->layer_param_)) {
+    Forward_int8_cpu(bottom, top);
+    return;
+  }
   const int num = top[0]->num();
   const int channels = top[0]->channels();
   const int top_height = top[0]->height();
   const int top_width = top[0]->width();
   const int bottom_height = bottom[0]->height();
   const int bottom_width = bottom[0]->width();
+  const int kernel_h = kernel_h_, kernel_w = kernel_w_;
+  const int stride_h = stride_h_, stride_w = stride_w_;
+  const int pad_h = pad_h_, pad_w = pad_w_;
+  const int dilation_h = dilation_h_, dilation_w = dilation_w_;
   const real_t* bottom_data = bottom[0]->cpu_data();
   const real_t* weight_data_base = this->blobs_[0]->cpu_data();
+  const real_t* bias_data = this->layer_param_.convolution_param().bias_term() ?
+      this->blobs_[1]->cpu_data() : NULL;
+  real_t* top_data_base = top[0]->mutable_cpu_data();
+  const int top_dim = top_height * top_width;
+  const int bottom_dim = bottom_height * bottom_width;
+  // 3x3 of stride 1 or 2 runs the SIMD rows of the gemm kernel on a padded
+  // copy of the plane, the rest checks every tap against the padding
+  const GemmKernel* kernel = GetGemmKernel();
+  const bool row3x3 = kernel != NULL && kernel_h == 3 && kernel_w == 3 &&
+      dilation_h == 1 && dilation_w == 1 && stride_h == stride_w &&
+      stride_h <= 2;
+  const int padded_height = (top_height - 1) * stride_h + kernel_h;
+  const int padded_width = (top_width - 1) * stride_w + kernel_w;
+  const bool join_rows = stride_w == 1 && top_width < kDepthwiseJoinWidth;
+  const int mid = stride_w == 1 ? 1 : top_width + 1;
+  const int right = stride_w == 1 ? 2 : 1;
+  const int grain = parallel_grain(
+      static_cast<int64_t>(top_dim) * kernel_h * kernel_w);
+  // every (n, c) plane of the output on its own
+  parallel_for(0, num * channels, [&](int begin, int end) {
+    vector<real_t> padded;
+    if (row3x3) {
+      padded.resize((join_rows ? 2 : 1) * padded_height * padded_width);
+    }
+    for (int i = begin; i < end; ++i) {
+      const int c = i % channels;
+      const real_t* input = bottom_data + static_cast<size_t>(i) * bottom_dim;
+      const real_t* weight_data = weight_data_base + c * kernel_h * kernel_w;
+      const real_t bias = bias_data ? bias_data[c] : 0;
+      real_t* top_data = top_data_base + static_cast<size_t>(i) * top_dim;
+      if (row3x3) {
+        PadPlane(input, bottom_height, bottom_width, pad_h, pad_w, stride_w,
+                 padded_height, padded_width, &padded[0]);
+        if (join_rows) {
+          real_t* joined = &padded[padded_height * padded_width];
+          kernel->depthwise3x3(&padded[0], padded_width, mid, right,
+                               weight_data, bias,
+                               (top_height - 1) * padded_width + top_width,
+                               joined);
+          for (int h = 0; h < top_height; ++h) {
+            std::copy(joined + h * padded_width,
+                      joined + h * padded_width + top_width,
+                      top_data + h * top_width);
+          }
+        } else {
+          for (int h = 0; h < top_height; ++h) {
+            kernel->depthwise3x3(&padded[h * stride_h * padded_width],
+                                 padded_width, mid, right, weight_data, bias,
+                                 top_width, top_data + h * top_width);
+          }
+        }
+        // the epilogues run on the plane while it is in cache
+        this->ForwardEpilogues_cpu(top_data, 1, top_dim, c);
+        continue;
+      }
+      for (int h = 0; h < top_height; ++h) {
+        for (int w = 0; w < top_width; ++w) {
+          real_t value = bias;
+          for (int kh = 0; kh < kernel_h; ++kh) {
+            const int h_in = h * stride_h - pad_h + kh * dilation_h;
+            if (h_in < 0 || h_in >= bottom_height) continue;
+            const real_t* input_row = input + h_in * bottom_width;
+            const real_t* weight_row = weight_data + kh * kernel_w;
+            for (int kw = 0; kw < kernel_w; ++kw) {
+              const int w_in = w * stride_w - pad_w + kw * dilation_w;
+              if (w_in >= 0 && w_in < bottom_width) {
+                value += weight_row[kw] * input_row[w_in];
+              }
+            }
+          }
+          top_data[h * top_width + w] = value;
+        }
+      }
+      this->ForwardEpilogues_cpu(top_data, 1, top_dim, c);
+    }
+  }, grain);
+}
+
+// Blocked in channels every tap is B channels in a row of the input and of
+// the weights, rearranged to (C / B) x kernel_h x kernel_w x B, so the loop
+// over them is as wide as the vectors with no padded copy of the plane.
+template<int B>
+void ConvolutionDepthwiseLayer::Forward_blocked_cpu(
+    const vector<Blob*>& bottom, const vector<Blob*>& top) {
+  const int num = top[0]->num();
+  const int channels = top[0]->channels();
+  const int top_height = top[0]->height();
+  const int top_width = top[0]->width();
+  const int bottom_height = bottom[0]->height();
+  const int bottom_width = bottom[0]->width();
+  const int kernel_h = kernel_h_, kernel_w = kernel_w_;
+  const int stride_h = stride_h_, stride_w = stride_w_;
+  const int pad_h = pad_h_, pad_w = pad_w_;
+  const int dilation_h = dilation_h_, dilation_w = dilation_w_;
+  const int taps = kernel_h * kernel_w;
+  const real_t* weight = this->blobs_[0]->cpu_data();
+  const real_t* bias = this->layer_param_.convolution_param().bias_term() ?
+      this->blobs_[1]->cpu_data() : NULL;
+  vector<real_t> weight_blocked(channels * taps);
+  for (int c = 0; c < channels; ++c) {
+    for (int t = 0; t < taps; ++t) {
+      weight_blocked[(c / B * taps + t) * B + c % B] = weight[c * taps + t];
+    }
+  }
+  const real_t* bottom_data = bottom[0]->cpu_data();
   real_t* top_data = top[0]->mutable_cpu_data();
-  for (int n = 0; n < num; ++n) {
-    for (int c = 0; c < channels; ++c) {
+  const int top_dim = top_height * top_width;
+  const int bottom_dim = bottom_height * bottom_width;
+  const int grain = parallel_grain(
+      static_cast<int64_t>(top_dim) * B * taps);
+  // every (n, c / B) plane of the output on its own
+  parallel_for(0, num * channels / B, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      const int cb = i % (channels / B);
+      const real_t* input = bottom_data + static_cast<size_t>(i) * bottom_dim * B;
+      const real_t* weight_data = &weight_blocked[cb * taps * B];
+      real_t* output = top_data + static_cast<size_t>(i) * top_dim * B;
       for (int h = 0; h < top_height; ++h) {
+        // the taps that fall in the input
+        const int h0 = h * stride_h - pad_h;
+        const int kh_begin = std::max(0, (-h0 + dilation_h - 1) / dilation_h);
+        const int kh_end = std::min(kernel_h,
+            (bottom_height - h0 + dilation_h - 1) / dilation_h);
         for (int w = 0; w < top_width; ++w) {
-          const real_t* weight_data = weight_data_base + c * kernel_h_ * kernel_w_;
-          real_t value = 0;
-          for (int kh = 0; kh < kernel_h_; ++kh) {
-            for (int kw = 0; kw < kernel_w_; ++kw) {
-              int h_in = -pad_h_ + h * stride_h_ + kh * dilation_h_;
-              int w_in = -pad_w_ + w * stride_w_ + kw * dilation_w_;
-              if ((h_in >= 0) && (h_in < bottom_height) && (w_in >= 0) && (w_in < bottom_width)) {
-                int offset = ((n * channels + c) * bottom_height + h_in) * bottom_width + w_in;
-                value += (*weight_data) * bottom_data[offset];
+          const int w0 = w * stride_w - pad_w;
+          const int kw_begin = std::max(0,
+              (-w0 + dilation_w - 1) / dilation_w);
+          const int kw_end = std::min(kernel_w,
+              (bottom_width - w0 + dilation_w - 1) / dilation_w);
+          real_t value[B];
+          for (int b = 0; b < B; ++b) {
+            value[b] = bias ? bias[cb * B + b] : 0;
+          }
+          for (int kh = kh_begin; kh < kh_end; ++kh) {
+            const real_t* input_row =
+                input + (h0 + kh * dilation_h) * bottom_width * B;
+            for (int kw = kw_begin; kw < kw_end; ++kw) {
+              const real_t* in = input_row + (w0 + kw * dilation_w) * B;
+              const real_t* k = weight_data + (kh * kernel_w + kw) * B;
+              for (int b = 0; b < B; ++b) {
+                value[b] += k[b] * in[b];
               }
-              ++weight_data;
             }
           }
-          *top_data++ = value;
+          real_t* out = output + (h * top_width + w) * B;
+          for (int b = 0; b < B; ++b) {
+            out[b] = value[b];
+          }
         }
       }
+      // only epilogues blind to the channel follow a blocked layer, see
+      // Layer::IsLayoutAgnostic
+      this->ForwardEpilogues_cpu(output, B, top_dim, cb * B);
+    }
+  }, grain);
+}
+
+// The input plane is quantized into a padded copy of int16 less the zero
+// point, so the padding is 0. Its rows are split by their remainder of
+// stride_h and its columns by their remainder of stride_w, so that each tap
+// sees output (h, w) at h * row_width + w from where it starts: runs of whole
+// output rows, widened to row_width, go to the depthwise_row of the
+// GemmKernelInt8 at once. It sums the int16 products into int32, scaled back
+// to float.
+void ConvolutionDepthwiseLayer::Forward_int8_cpu(const vector<Blob*>& bottom,
+                                                 const vector<Blob*>& top) {
+  const int num = top[0]->num();
+  const int channels = top[0]->channels();
+  const int top_height = top[0]->height();
+  const int top_width = top[0]->width();
+  const int bottom_height = bottom[0]->height();
+  const int bottom_width = bottom[0]->width();
+  const int kernel_h = kernel_h_, kernel_w = kernel_w_;
+  const int stride_h = stride_h_, stride_w = stride_w_;
+  const int pad_h = pad_h_, pad_w = pad_w_;
+  const int dilation_h = dilation_h_, dilation_w = dilation_w_;
+  const int taps = kernel_h * kernel_w;
+  const QuantizationParameter& quantization =
+      this->layer_param_.quantization_param();
+  const real_t inv_scale = 1 / quantization.bottom_scale();
+  const int zero_point = quantization.bottom_zero_point();
+  const QuantizedMatrix& quantized =
+      quantized_weights_.Get(*this->blobs_[0], 1, false, channels, taps)[0];
+  vector<int16_t> weight(channels * taps);
+  for (int c = 0; c < channels; ++c) {
+    for (int t = 0; t < taps; ++t) {
+      weight[c * taps + t] = quantized.value(c, t);
+    }
+  }
+  const real_t* bias = this->layer_param_.convolution_param().bias_term() ?
+      this->blobs_[1]->cpu_data() : NULL;
+  const real_t* bottom_data = bottom[0]->cpu_data();
+  real_t* top_data = top[0]->mutable_cpu_data();
+  const int top_dim = top_height * top_width;
+  const int bottom_dim = bottom_height * bottom_width;
+  const int padded_height = (top_height - 1) * stride_h +
+                            (kernel_h - 1) * dilation_h + 1;
+  const int padded_width = (top_width - 1) * stride_w +
+                           (kernel_w - 1) * dilation_w + 1;
+  // padded (y, x) at ((y % stride_h) * phase_height + y / stride_h) *
+  // row_width + x % stride_w * phase_width + x / stride_w
+  const int phase_height = (padded_height + stride_h - 1) / stride_h;
+  const int phase_width = (padded_width + stride_w - 1) / stride_w;
+  const int row_width = stride_w * phase_width;
+  // the columns of the input within the padded row
+  const int valid_width = std::max(0, std::min(bottom_width,
+                                               padded_width - pad_w));
+  vector<int> tap_offset(taps);
+  for (int kh = 0; kh < kernel_h; ++kh) {
+    for (int kw = 0; kw < kernel_w; ++kw) {
+      const int y = kh * dilation_h, x = kw * dilation_w;
+      tap_offset[kh * kernel_w + kw] =
+          (y % stride_h * phase_height + y / stride_h) * row_width +
+          x % stride_w * phase_width + x / stride_w;
     }
   }
-  if (this->layer_param_.convolution_param().bias_term()) {
-    top_data = top[0]->mutable_cpu_data();
-    for (int n = 0; n < num; ++n) {
-      const real_t* bias_data = this->blobs_[1]->cpu_data();
-      for (int c = 0; c < channels; ++c) {
-        for (int h = 0; h < top_height; ++h) {
+  // output rows at a time, for the int32 sums to stay in cache
+  const int chunk_rows = std::max(1, 1024 / row_width);
+  const GemmKernelInt8* kernel = GetGemmKernelInt8();
+  const int grain = parallel_grain(static_cast<int64_t>(top_dim) * taps);
+  // every (n, c) plane of the output on its own
+  parallel_for(0, num * channels, [&](int begin, int end) {
+    // a row more for the widened runs of the last rows to read zeros
+    vector<int16_t> padded((stride_h * phase_height + 1) * row_width);
+    vector<int16_t> plane(bottom_dim);
+    vector<const int16_t*> in(taps);
+    vector<int32_t> acc(chunk_rows * row_width);
+    for (int i = begin; i < end; ++i) {
+      const int c = i % channels;
+      kernel->quantize_int16(bottom_dim, bottom_data + static_cast<size_t>(i) *
+                             bottom_dim, inv_scale, zero_point, &plane[0]);
+      for (int y = 0; y < stride_h * phase_height; ++y) {
+        int16_t* row = &padded[(y % stride_h * phase_height + y / stride_h) *
+                               row_width];
+        const int y_in = y - pad_h;
+        std::fill(row, row + row_width, 0);
+        if (y >= padded_height || y_in < 0 || y_in >= bottom_height) {
+          continue;
+        }
+        const int16_t* in_row = &plane[y_in * bottom_width];
+        if (stride_w == 1) {
+          std::copy(in_row, in_row + valid_width, row + pad_w);
+          continue;
+        }
+        // columns [lo, hi) of each phase from the input, the rest padding
+        for (int phase = 0; phase < stride_w; ++phase) {
+          int16_t* out = row + phase * phase_width;
+          const int first = pad_w - phase;
+          const int lo = std::max(0, (first + stride_w - 1) / stride_w);
+          const int hi = std::min(phase_width,
+              (first + valid_width + stride_w - 1) / stride_w);
+          for (int x = lo; x < hi; ++x) {
+            out[x] = in_row[x * stride_w - first];
+          }
+        }
+      }
+      const int16_t* weight_data = &weight[c * taps];
+      const real_t scale = quantized.scales()[c] * quantization.bottom_scale();
+      const real_t shift = bias ? bias[c] : 0;
+      real_t* output = top_data + static_cast<size_t>(i) * top_dim;
+      for (int h0 = 0; h0 < top_height; h0 += chunk_rows) {
+        const int rows = std::min(chunk_rows, top_height - h0);
+        for (int t = 0; t < taps; ++t) {
+          in[t] = &padded[tap_offset[t] + h0 * row_width];
+        }
+        kernel->depthwise_row(&in[0], weight_data, taps, rows * row_width,
+                              &acc[0]);
+        for (int h = 0; h < rows; ++h) {
+          const int32_t* sums = &acc[h * row_width];
+          real_t* out = output + (h0 + h) * top_width;
           for (int w = 0; w < top_width; ++w) {
-            *top_data += *bias_data;
-            ++top_data;
+            out[w] = sums[w] * scale + shift;
           }
         }
-        ++bias_data;
       }
+      this->ForwardEpilogues_cpu(output, 1, top_dim, c);
     }
-  }
+  }, grain);
 }
 
 #ifndef USE_CUDA
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "../layer.hpp"
+#include "../util/quantize.hpp"
 
 namespace caffe {
 
@@ -18,12 +19,31 @@ class ConvolutionDepthwiseLayer : public Layer {
   virtual inline int ExactNumBottomBlobs() const { return 1; }
   virtual inline int ExactNumTopBlobs() const { return 1; }
   virtual inline const char* type() const { return "ConvolutionDepthwise"; }
+  virtual LayerCost GetCost(const vector<Blob*>& bottom,
+                            const vector<Blob*>& top) const {
+    LayerCost cost = Layer::GetCost(bottom, top);
+    // one kernel window of its own channel per output value
+    cost.macs = static_cast<int64_t>(top[0]->count()) * kernel_h_ * kernel_w_;
+    return cost;
+  }
+  virtual bool AcceptsEpilogue() const { return true; }
+  virtual bool AcceptsChannelBlock(int block) const {
+    return (block == 4 || block == 8 || block == 16) &&
+           !IsQuantized(this->layer_param_);
+  }
 
  protected:
   virtual void Forward_cpu(const vector<Blob*>& bottom,
                            const vector<Blob*>& top);
   virtual void Forward_gpu(const vector<Blob*>& bottom,
                            const vector<Blob*>& top);
+  /// @brief Forward_cpu on bottom and top blocked in channels of B
+  template<int B>
+  void Forward_blocked_cpu(const vector<Blob*>& bottom,
+                           const vector<Blob*>& top);
+  /// @brief Forward_cpu in int8, see QuantizationParameter
+  void Forward_int8_cpu(const vector<Blob*>& bottom,
+                        const vector<Blob*>& top);
   unsigned int kernel_h_;
   unsigned int kernel_w_;
   unsigned int stride_h_;
@@ -32,6 +52,8 @@ class ConvolutionDepthwiseLayer : public Layer {
   unsigned int pad_w_;
   unsigned int dilation_h_;
   unsigned int dilation_w_;
+  /// @brief blobs_[0] quantized for Forward_int8_cpu, a row per channel
+  QuantizedWeights quantized_weights_;
 };
 
 }  // namespace caffe
@@ -2,6 +2,7 @@
 
 #include "./conv_layer.hpp"
 #include "./conv_dw_layer.hpp"
+#include "./winograd_conv_layer.hpp"
 
 #ifdef USE_CUDNN
 #include "./cudnn/cudnn_conv_layer.hpp"
@@ -24,19 +25,103 @@ void ConvolutionLayer::compute_output_shape() {
   }
 }
 
+void ConvolutionLayer::LayerSetUp(const vector<Blob*>& bottom,
+                                  const vector<Blob*>& top) {
+  BaseConvolutionLayer::LayerSetUp(bottom, top);
+  // one input and one output channel per group, as MobileNet declares its
+  // depthwise layers, is too little for a gemm per channel
+  depthwise_.reset();
+  if (Caffe::mode() == Caffe::CPU && bottom.size() == 1 &&
+      this->channel_axis_ == 1 && this->num_spatial_axes_ == 2 &&
+      !this->force_nd_im2col_ && this->group_ > 1 &&
+      this->channels_ == this->group_ && this->num_output_ == this->group_) {
+    // the weights are C x 1 x kernel_h x kernel_w for both
+    depthwise_.reset(new ConvolutionDepthwiseLayer(this->layer_param_));
+    depthwise_->blobs() = this->blobs_;
+    depthwise_->SetChannelBlock(this->channel_block_,
+        this->bottom_channel_block_ != this->channel_block_);
+    depthwise_->SetUp(bottom, top);
+  }
+}
+
+void ConvolutionLayer::Reshape(const vector<Blob*>& bottom,
+                               const vector<Blob*>& top) {
+  if (depthwise_) {
+    depthwise_->Reshape(bottom, top);
+    return;
+  }
+  BaseConvolutionLayer::Reshape(bottom, top);
+}
+
+vector<Blob*> ConvolutionLayer::GetTempBlobs() {
+  if (depthwise_) return depthwise_->GetTempBlobs();
+  return BaseConvolutionLayer::GetTempBlobs();
+}
+
+void ConvolutionLayer::AddEpilogue(Layer* layer) {
+  BaseConvolutionLayer::AddEpilogue(layer);
+  // the depthwise layer runs them on every plane it computes
+  if (depthwise_) depthwise_->AddEpilogue(layer);
+}
+
+LayerCost ConvolutionLayer::GetCost(const vector<Blob*>& bottom,
+                                    const vector<Blob*>& top) const {
+  if (depthwise_) return depthwise_->GetCost(bottom, top);
+  return BaseConvolutionLayer::GetCost(bottom, top);
+}
+
+bool ConvolutionLayer::AcceptsChannelBlock(int block) const {
+  // the image is packed for the gemm, which stores the output blocked, and
+  // groups run blocked if they are depthwise, which the bottoms tell
+  const ConvolutionParameter& conv_param =
+      this->layer_param_.convolution_param();
+  return (block == 4 || block == 8 || block == 16) &&
+         !IsQuantized(this->layer_param_) &&
+         (conv_param.group() == 1 ||
+          conv_param.group() == conv_param.num_output()) &&
+         conv_param.num_output() % block == 0 &&
+         conv_param.axis() == 1 && !conv_param.force_nd_im2col() &&
+         conv_param.kernel_size_size() <= 2 && GetGemmKernel() != NULL;
+}
+
+bool ConvolutionLayer::AcceptsChannelBlock(
+    int block, const vector<const Blob*>& bottom) const {
+  const int group = this->layer_param_.convolution_param().group();
+  if (!AcceptsChannelBlock(block)) {
+    return false;
+  }
+  // groups are blocked only where LayerSetUp runs them depthwise
+  return group == 1 || (Caffe::mode() == Caffe::CPU && bottom.size() == 1 &&
+                        bottom[0] != NULL && bottom[0]->num_axes() == 4 &&
+                        bottom[0]->channels() == group);
+}
+
 void ConvolutionLayer::Forward_cpu(const vector<Blob*>& bottom,
                                    const vector<Blob*>& top) {
-  const real_t* weight = this->blobs_[0]->cpu_data();
+  if (depthwise_) {
+    depthwise_->Forward(bottom, top);
+    return;
+  }
+  const bool int8 = IsQuantized(this->layer_param_);
+  // int8 weights may have been loaded without float data
+  const real_t* weight = int8 ? NULL : this->blobs_[0]->cpu_data();
   for (int i = 0; i < bottom.size(); ++i) {
     const real_t* bottom_data = bottom[i]->cpu_data();
     real_t* top_data = top[i]->mutable_cpu_data();
     for (int n = 0; n < this->num_; ++n) {
-      this->forward_cpu_gemm(bottom_data + n * this->bottom_dim_, weight,
-          top_data + n * this->top_dim_);
-      if (this->bias_term_) {
+      if (int8) {
+        this->forward_cpu_int8(bottom_data + n * this->bottom_dim_,
+            top_data + n * this->top_dim_);
+      } else {
+        this->forward_cpu_gemm(bottom_data + n * this->bottom_dim_, weight,
+            top_data + n * this->top_dim_);
+      }
+      if (this->bias_term_ && !int8) {
         const real_t* bias = this->blobs_[1]->cpu_data();
         this->forward_cpu_bias(top_data + n * this->top_dim_, bias);
       }
+      this->ForwardEpilogues_cpu(top_data + n * this->top_dim_,
+          this->num_output_, this->out_spatial_dim_);
     }
   }
 }
@@ -65,6 +150,10 @@ static shared_ptr<Layer> CreateLayer(const LayerParameter &param) {
     }
   }
 #endif  // USE_CUDNN
+  if (param.convolution_param().engine() != ConvolutionParameter_Engine_CAFFE) {
+    // falls back to ConvolutionLayer where Winograd doesn't fit
+    return shared_ptr<Layer>(new WinogradConvolutionLayer(param));
+  }
   return shared_ptr<Layer>(new ConvolutionLayer(param));
 }
 
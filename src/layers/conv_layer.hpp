@@ -7,6 +7,8 @@
 
 namespace caffe {
 
+class ConvolutionDepthwiseLayer;
+
 /**
  * @brief Convolves the input image with a bank of learned filters,
  *        and (optionally) adds biases.
@@ -55,11 +57,29 @@ class ConvolutionLayer : public BaseConvolutionLayer {
    *  - bias_term (\b optional, default true). Whether to have a bias.
    *  - engine: convolution has CAFFE (matrix multiplication) and CUDNN (library
    *    kernels + stream parallelism) engines.
+   *
+   *   On CPU a 2D convolution with one input and one output channel per
+   *   group, group == channels == num_output, runs ConvolutionDepthwiseLayer
+   *   on the same blobs instead of a gemm per channel.
    */
   explicit ConvolutionLayer(const LayerParameter& param)
       : BaseConvolutionLayer(param) {}
+  virtual void LayerSetUp(const vector<Blob*>& bottom,
+                          const vector<Blob*>& top);
+  virtual void Reshape(const vector<Blob*>& bottom,
+                       const vector<Blob*>& top);
+  virtual vector<Blob*> GetTempBlobs();
+  virtual LayerCost GetCost(const vector<Blob*>& bottom,
+                            const vector<Blob*>& top) const;
 
   virtual const char* type() const { return "Convolution"; }
+  virtual bool AcceptsEpilogue() const { return this->channel_axis_ == 1; }
+  virtual void AddEpilogue(Layer* layer);
+  virtual bool AcceptsResidual() const { return !depthwise_; }
+  virtual bool AcceptsChannelBlock(int block) const;
+  virtual bool AcceptsChannelBlock(int block,
+                                   const vector<const Blob*>& bottom) const;
+  virtual bool AcceptsPlainBottoms() const { return true; }
 
  protected:
   virtual void Forward_cpu(const vector<Blob*>& bottom,
@@ -68,6 +88,9 @@ class ConvolutionLayer : public BaseConvolutionLayer {
                            const vector<Blob*>& top);
   virtual bool reverse_dimensions() { return false; }
   virtual void compute_output_shape();
+
+  /// @brief runs the depthwise convolution, see LayerSetUp
+  shared_ptr<ConvolutionDepthwiseLayer> depthwise_;
 };
 
 }  // namespace caffe
@@ -22,7 +22,8 @@ void CuDNNConvolutionLayer::Forward_gpu(const vector<Blob*>& bottom,
                   filter_desc_, weight + this->weight_offset_ * g,
                   conv_descs_[i],
                   fwd_algo_[i], workspace[g], workspace_fwd_sizes_[i],
-                  cudnn::dataType<real_t>::zero,
+                  this->accumulate_top_ ? cudnn::dataType<real_t>::one
+                                        : cudnn::dataType<real_t>::zero,
                   top_descs_[i], top_data + top_offset_ * g));
 
       // Bias.
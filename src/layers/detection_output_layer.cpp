@@ -2,6 +2,7 @@
 
 #include "./detection_output_layer.hpp"
 #include "../util/math_functions.hpp"
+#include "../util/thread_pool.hpp"
 
 using std::map;
 using std::pair;
@@ -262,18 +263,18 @@ void DetectionOutputLayer::Forward_cpu(const vector<Blob*>& bottom,
 	  share_location_, num_loc_classes_, background_label_id_,
 	  code_type_, variance_encoded_in_target_, &all_decode_bboxes);
 
-  int num_kept = 0;
-  vector<map<int, vector<int> > > all_indices;
-  for (int i = 0; i < num; ++i) {
-	  const LabelBBox& decode_bboxes = all_decode_bboxes[i];
-	  const map<int, vector<float> >& conf_scores = all_conf_scores[i];
-	  map<int, vector<int> > indices;
-	  int num_det = 0;
-	  for (int c = 0; c < num_classes_; ++c) {
+  // Run nms of every image and class on its own.
+  vector<vector<int> > nms_indices(num * num_classes_);
+  parallel_for(0, num * num_classes_, [&](int begin, int end) {
+	  for (int k = begin; k < end; ++k) {
+		  const int i = k / num_classes_;
+		  const int c = k % num_classes_;
 		  if (c == background_label_id_) {
 			  // Ignore background class.
 			  continue;
 		  }
+		  const LabelBBox& decode_bboxes = all_decode_bboxes[i];
+		  const map<int, vector<float> >& conf_scores = all_conf_scores[i];
 		  if (conf_scores.find(c) == conf_scores.end()) {
 			  // Something bad happened if there are no predictions for current label.
 			  LOG(FATAL) << "Could not find confidence predictions for label " << c;
@@ -287,7 +288,22 @@ void DetectionOutputLayer::Forward_cpu(const vector<Blob*>& bottom,
 		  }
 		  const vector<NormalizedBBox>& bboxes = decode_bboxes.find(label)->second;
 		  ApplyNMSFastEx(bboxes, scores, confidence_threshold_, nms_threshold_,
-			  top_k_, &(indices[c]));
+			  top_k_, &nms_indices[k]);
+	  }
+  });
+
+  int num_kept = 0;
+  vector<map<int, vector<int> > > all_indices;
+  for (int i = 0; i < num; ++i) {
+	  const map<int, vector<float> >& conf_scores = all_conf_scores[i];
+	  map<int, vector<int> > indices;
+	  int num_det = 0;
+	  for (int c = 0; c < num_classes_; ++c) {
+		  if (c == background_label_id_) {
+			  // Ignore background class.
+			  continue;
+		  }
+		  indices[c].swap(nms_indices[i * num_classes_ + c]);
 		  num_det += indices[c].size();
 	  }
 	  if (keep_top_k_ > -1 && num_det > keep_top_k_) {
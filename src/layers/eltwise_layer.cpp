@@ -1,8 +1,10 @@
+#include <algorithm>
 #include <vector>
 #include <cfloat>
 
 #include "./eltwise_layer.hpp"
 #include "../util/math_functions.hpp"
+#include "../util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -36,41 +38,53 @@ void EltwiseLayer::Reshape(const vector<Blob*>& bottom,
 
 void EltwiseLayer::Forward_cpu(const vector<Blob*>& bottom,
                                const vector<Blob*>& top) {
-  int* mask = NULL;
-  const real_t* bottom_data_a = NULL;
-  const real_t* bottom_data_b = NULL;
   const int count = top[0]->count();
   real_t* top_data = top[0]->mutable_cpu_data();
+  // get the data before the chunks, they run on other threads
+  vector<const real_t*> bottom_data(bottom.size());
+  for (int i = 0; i < bottom.size(); ++i) {
+    bottom_data[i] = bottom[i]->cpu_data();
+  }
+  const int grain = parallel_grain(bottom.size());
   switch (op_) {
   case EltwiseParameter_EltwiseOp_PROD:
-    caffe_mul(count, bottom[0]->cpu_data(), bottom[1]->cpu_data(), top_data);
-    for (int i = 2; i < bottom.size(); ++i) {
-      caffe_mul(count, top_data, bottom[i]->cpu_data(), top_data);
-    }
+    parallel_for(0, count, [&](int begin, int end) {
+      const int n = end - begin;
+      caffe_mul(n, bottom_data[0] + begin, bottom_data[1] + begin,
+                top_data + begin);
+      for (int i = 2; i < bottom.size(); ++i) {
+        caffe_mul(n, top_data + begin, bottom_data[i] + begin,
+                  top_data + begin);
+      }
+    }, grain);
     break;
   case EltwiseParameter_EltwiseOp_SUM:
-    caffe_set(count, static_cast<real_t>(0), top_data);
-    // TODO(shelhamer) does BLAS optimize to sum for coeff = 1?
-    for (int i = 0; i < bottom.size(); ++i) {
-      caffe_axpy(count, coeffs_[i], bottom[i]->cpu_data(), top_data);
-    }
+    // no axpy in the chunks, BLAS may run threads of its own
+    parallel_for(0, count, [&](int begin, int end) {
+      const int n = end - begin;
+      caffe_set(n, static_cast<real_t>(0), top_data + begin);
+      for (int i = 0; i < bottom.size(); ++i) {
+        const real_t coeff = coeffs_[i];
+        for (int idx = begin; idx < end; ++idx) {
+          top_data[idx] += coeff * bottom_data[i][idx];
+        }
+      }
+    }, grain);
     break;
   case EltwiseParameter_EltwiseOp_MAX:
-    // Initialize
-    caffe_set(count, static_cast<real_t>(-FLT_MAX), top_data);
-    // bottom 0 & 1
-    bottom_data_a = bottom[0]->cpu_data();
-    bottom_data_b = bottom[1]->cpu_data();
-    for (int idx = 0; idx < count; ++idx) {
-      top_data[idx] = std::max(bottom_data_a[idx], bottom_data_b[idx]);
-    }
-    // bottom 2++
-    for (int blob_idx = 2; blob_idx < bottom.size(); ++blob_idx) {
-      bottom_data_b = bottom[blob_idx]->cpu_data();
-      for (int idx = 0; idx < count; ++idx) {
-        top_data[idx] = std::max(top_data[idx], bottom_data_b[idx]);
+    parallel_for(0, count, [&](int begin, int end) {
+      // bottom 0 & 1
+      for (int idx = begin; idx < end; ++idx) {
+        top_data[idx] = std::max(bottom_data[0][idx], bottom_data[1][idx]);
       }
-    }
+      // bottom 2++
+      for (int blob_idx = 2; blob_idx < bottom.size(); ++blob_idx) {
+        const real_t* bottom_data_b = bottom_data[blob_idx];
+        for (int idx = begin; idx < end; ++idx) {
+          top_data[idx] = std::max(top_data[idx], bottom_data_b[idx]);
+        }
+      }
+    }, grain);
     break;
   default:
     LOG(FATAL) << "Unknown elementwise operation.";
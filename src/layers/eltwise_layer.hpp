@@ -25,6 +25,7 @@ class EltwiseLayer : public Layer {
   virtual const char* type() const { return "Eltwise"; }
   virtual int MinBottomBlobs() const { return 2; }
   virtual int ExactNumTopBlobs() const { return 1; }
+  virtual bool IsLayoutAgnostic() const { return true; }
 
  protected:
   virtual void Forward_cpu(const vector<Blob*>& bottom,
@@ -1,7 +1,9 @@
+#include <cmath>
 #include <algorithm>
 #include <vector>
 
 #include "./elu_layer.hpp"
+#include "../util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -11,10 +13,24 @@ void ELULayer::Forward_cpu(const vector<Blob*>& bottom,
   real_t* top_data = top[0]->mutable_cpu_data();
   const int count = bottom[0]->count();
   real_t alpha = this->layer_param_.elu_param().alpha();
-  for (int i = 0; i < count; ++i) {
-    top_data[i] = std::max(bottom_data[i], static_cast<real_t>(0))
-        + alpha * (exp(std::min(bottom_data[i], static_cast<real_t>(0))) - 1);
-  }
+  parallel_for(0, count, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      top_data[i] = std::max(bottom_data[i], static_cast<real_t>(0))
+          + alpha * (exp(std::min(bottom_data[i], static_cast<real_t>(0))) - 1);
+    }
+  }, parallel_grain(1));
+}
+
+void ELULayer::ForwardEpilogue_cpu(real_t* data, int channels,
+                                   int inner_dim, int channel_offset) {
+  const int count = channels * inner_dim;
+  real_t alpha = this->layer_param_.elu_param().alpha();
+  parallel_for(0, count, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      data[i] = std::max(data[i], static_cast<real_t>(0))
+          + alpha * (exp(std::min(data[i], static_cast<real_t>(0))) - 1);
+    }
+  }, parallel_grain(1));
 }
 
 #ifndef USE_CUDA
@@ -28,6 +28,9 @@ class ELULayer : public NeuronLayer {
       : NeuronLayer(param) {}
 
   virtual const char* type() const { return "ELU"; }
+  virtual bool CanRunAsEpilogue() const { return true; }
+  virtual void ForwardEpilogue_cpu(real_t* data, int channels, int inner_dim,
+                                   int channel_offset);
 
  protected:
   /**
@@ -81,17 +81,55 @@ void InnerProductLayer::Forward_cpu(const vector<Blob*>& bottom,
                                     const vector<Blob*>& top) {
   const real_t* bottom_data = bottom[0]->cpu_data();
   real_t* top_data = top[0]->mutable_cpu_data();
-  const real_t* weight = this->blobs_[0]->cpu_data();
-  caffe_cpu_gemm(CblasNoTrans, transpose_ ? CblasNoTrans : CblasTrans,
-    M_, N_, K_, static_cast<real_t>(1),
-    bottom_data, weight, static_cast<real_t>(0), top_data);
-  if (bias_term_) {
-    caffe_cpu_gemm(CblasNoTrans, CblasNoTrans, M_, N_, 1, static_cast<real_t>(1),
-      bias_multiplier_.cpu_data(),
-      this->blobs_[1]->cpu_data(), static_cast<real_t>(1), top_data);
+  if (IsQuantized(this->layer_param_)) {
+    Forward_int8_cpu(bottom_data, top_data);
+  } else {
+    const vector<PackedMatrix>& packed =
+        packed_weights_.Get(*this->blobs_[0], 1, transpose_, N_, K_);
+    if (!packed.empty()) {
+      // top^T = weight * bottom^T, with the weights packed once as A
+      caffe_cpu_gemm_packed(packed[0], CblasTrans, M_, bottom_data,
+        static_cast<real_t>(0), top_data, CblasTrans);
+    } else {
+      const real_t* weight = this->blobs_[0]->cpu_data();
+      caffe_cpu_gemm(CblasNoTrans, transpose_ ? CblasNoTrans : CblasTrans,
+        M_, N_, K_, static_cast<real_t>(1),
+        bottom_data, weight, static_cast<real_t>(0), top_data);
+    }
+    if (bias_term_) {
+      caffe_cpu_gemm(CblasNoTrans, CblasNoTrans, M_, N_, 1, static_cast<real_t>(1),
+        bias_multiplier_.cpu_data(),
+        this->blobs_[1]->cpu_data(), static_cast<real_t>(1), top_data);
+    }
+  }
+  if (!this->epilogues_.empty()) {
+    for (int m = 0; m < M_; ++m) {
+      this->ForwardEpilogues_cpu(top_data + m * N_, N_, 1);
+    }
   }
 }
 
+void InnerProductLayer::Forward_int8_cpu(const real_t* bottom_data,
+                                         real_t* top_data) {
+  const QuantizationParameter& quantization =
+      this->layer_param_.quantization_param();
+  const real_t scale = quantization.bottom_scale();
+  const int zero_point = quantization.bottom_zero_point();
+  const vector<QuantizedMatrix>& quantized =
+      quantized_weights_.Get(*this->blobs_[0], 1, transpose_, N_, K_);
+  static thread_local vector<uint8_t> quantized_bottom;
+  quantized_bottom.resize(M_ * K_);
+  QuantizeUint8(M_ * K_, bottom_data, scale, zero_point, &quantized_bottom[0]);
+  // top^T = weight * bottom^T, the rows of the bottom are the columns of B
+  const uint8_t* x = &quantized_bottom[0];
+  const int K = K_;
+  caffe_cpu_gemm_int8(quantized[0], M_,
+      [x, K](int n0, int n1, int nr, uint8_t* out) {
+        PackTransposedUint8(x, K, n0, n1, nr, out);
+      }, scale, zero_point, bias_term_ ? this->blobs_[1]->cpu_data() : NULL,
+      false, top_data, true);
+}
+
 #ifndef USE_CUDA
 STUB_GPU(InnerProductLayer);
 #endif
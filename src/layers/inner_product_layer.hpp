@@ -4,6 +4,8 @@
 #include <vector>
 
 #include "../layer.hpp"
+#include "../util/gemm.hpp"
+#include "../util/quantize.hpp"
 
 namespace caffe {
 
@@ -25,12 +27,24 @@ class InnerProductLayer : public Layer {
   virtual const char* type() const { return "InnerProduct"; }
   virtual int ExactNumBottomBlobs() const { return 1; }
   virtual int ExactNumTopBlobs() const { return 1; }
+  virtual LayerCost GetCost(const vector<Blob*>& bottom,
+                            const vector<Blob*>& top) const {
+    LayerCost cost = Layer::GetCost(bottom, top);
+    cost.macs = static_cast<int64_t>(M_) * N_ * K_;
+    return cost;
+  }
+  virtual bool AcceptsEpilogue() const {
+    return this->layer_param_.inner_product_param().axis() == 1;
+  }
 
  protected:
   virtual void Forward_cpu(const vector<Blob*>& bottom,
                            const vector<Blob*>& top);
   virtual void Forward_gpu(const vector<Blob*>& bottom,
                            const vector<Blob*>& top);
+  /// @brief Forward_cpu without the epilogues in int8, see
+  /// QuantizationParameter
+  void Forward_int8_cpu(const real_t* bottom_data, real_t* top_data);
 
   int M_;
   int K_;
@@ -38,6 +52,8 @@ class InnerProductLayer : public Layer {
   bool bias_term_;
   Blob bias_multiplier_;
   bool transpose_;  ///< if true, assume transposed weights
+  PackedWeights packed_weights_;  ///< blobs_[0] packed for Forward_cpu
+  QuantizedWeights quantized_weights_;  ///< blobs_[0] quantized for int8
 };
 
 }  // namespace caffe
@@ -1,7 +1,10 @@
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "./lrn_layer.hpp"
 #include "../util/math_functions.hpp"
+#include "../util/thread_pool.hpp"
 
 #ifdef USE_CUDNN
 #include "./cudnn/cudnn_lcn_layer.hpp"
@@ -111,45 +114,64 @@ void LRNLayer::CrossChannelForward_cpu(const vector<Blob*>& bottom,
   const real_t* bottom_data = bottom[0]->cpu_data();
   real_t* top_data = top[0]->mutable_cpu_data();
   real_t* scale_data = scale_.mutable_cpu_data();
-  // start with the constant value
-  for (int i = 0; i < scale_.count(); ++i) {
-    scale_data[i] = k_;
-  }
-  Blob padded_square(1, channels_ + size_ - 1, height_, width_);
-  real_t* padded_square_data = padded_square.mutable_cpu_data();
-  caffe_set(padded_square.count(), static_cast<real_t>(0), padded_square_data);
+  const int spatial_dim = height_ * width_;
   real_t alpha_over_size = alpha_ / size_;
-  // go through the images
-  for (int n = 0; n < num_; ++n) {
-    // compute the padded square
-    caffe_sqr(channels_ * height_ * width_,
-        bottom_data + bottom[0]->offset(n),
-        padded_square_data + padded_square.offset(0, pre_pad_));
-    // Create the first channel scale
-    for (int c = 0; c < size_; ++c) {
-      caffe_axpy(height_ * width_, alpha_over_size,
-        padded_square_data + padded_square.offset(0, c),
-        scale_data + scale_.offset(n, 0));
-    }
-    for (int c = 1; c < channels_; ++c) {
-      // copy previous scale
-      caffe_copy(height_ * width_,
-        scale_data + scale_.offset(n, c - 1),
-        scale_data + scale_.offset(n, c));
-      // add head
-      caffe_axpy(height_ * width_, alpha_over_size,
-        padded_square_data + padded_square.offset(0, c + size_ - 1),
-        scale_data + scale_.offset(n, c));
-      // subtract tail
-      caffe_axpy(height_ * width_, -alpha_over_size,
-        padded_square_data + padded_square.offset(0, c - 1),
-        scale_data + scale_.offset(n, c));
+  // the scale of a pixel only depends on the channels of that pixel, go
+  // through the pixels of all images
+  parallel_for(0, num_ * spatial_dim, [&](int begin, int end) {
+    for (int i = begin; i < end;) {
+      const int n = i / spatial_dim;
+      const int s = i % spatial_dim;
+      const int len = std::min(spatial_dim - s, end - i);
+      const int offset = n * channels_ * spatial_dim + s;
+      const real_t* bottom_n = bottom_data + offset;
+      real_t* scale_n = scale_data + offset;
+      real_t* top_n = top_data + offset;
+      // Create the first channel scale, channels are padded with pre_pad_
+      // zeros in front
+      for (int k = 0; k < len; ++k) {
+        scale_n[k] = k_;
+      }
+      for (int c = 0; c < size_ - pre_pad_ && c < channels_; ++c) {
+        const real_t* x = bottom_n + c * spatial_dim;
+        for (int k = 0; k < len; ++k) {
+          scale_n[k] += alpha_over_size * (x[k] * x[k]);
+        }
+      }
+      for (int c = 1; c < channels_; ++c) {
+        const int head = c + size_ - 1 - pre_pad_;
+        const int tail = c - 1 - pre_pad_;
+        real_t* scale_c = scale_n + c * spatial_dim;
+        // copy previous scale
+        for (int k = 0; k < len; ++k) {
+          scale_c[k] = scale_c[k - spatial_dim];
+        }
+        // add head
+        if (head < channels_) {
+          const real_t* x = bottom_n + head * spatial_dim;
+          for (int k = 0; k < len; ++k) {
+            scale_c[k] += alpha_over_size * (x[k] * x[k]);
+          }
+        }
+        // subtract tail
+        if (tail >= 0) {
+          const real_t* x = bottom_n + tail * spatial_dim;
+          for (int k = 0; k < len; ++k) {
+            scale_c[k] -= alpha_over_size * (x[k] * x[k]);
+          }
+        }
+      }
+      // In the end, compute output
+      for (int c = 0; c < channels_; ++c) {
+        const int channel_offset = c * spatial_dim;
+        for (int k = 0; k < len; ++k) {
+          top_n[channel_offset + k] = std::pow(scale_n[channel_offset + k],
+              -beta_) * bottom_n[channel_offset + k];
+        }
+      }
+      i += len;
     }
-  }
-
-  // In the end, compute output
-  caffe_powx(scale_.count(), scale_data, -beta_, top_data);
-  caffe_mul(scale_.count(), top_data, bottom_data, top_data);
+  }, parallel_grain(channels_));
 }
 
 void LRNLayer::WithinChannelForward(const vector<Blob*>& bottom,
@@ -22,6 +22,7 @@ class NeuronLayer : public Layer {
 
   virtual int ExactNumBottomBlobs() const { return 1; }
   virtual int ExactNumTopBlobs() const { return 1; }
+  virtual bool IsLayoutAgnostic() const { return true; }
 };
 
 }  // namespace caffe
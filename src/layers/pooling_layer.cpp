@@ -4,6 +4,7 @@
 
 #include "./pooling_layer.hpp"
 #include "../util/math_functions.hpp"
+#include "../util/thread_pool.hpp"
 
 #ifdef USE_CUDNN
 #include "./cudnn/cudnn_pooling_layer.hpp"
@@ -116,18 +117,27 @@ void PoolingLayer::Reshape(const vector<Blob*>& bottom,
 // case?
 void PoolingLayer::Forward_cpu(const vector<Blob*>& bottom,
                                const vector<Blob*>& top) {
+  switch (channel_block_) {
+  case 4: Forward_blocked_cpu<4>(bottom, top); return;
+  case 8: Forward_blocked_cpu<8>(bottom, top); return;
+  case 16: Forward_blocked_cpu<16>(bottom, top); return;
+  }
   const real_t* bottom_data = bottom[0]->cpu_data();
   real_t* top_data = top[0]->mutable_cpu_data();
-  const int top_count = top[0]->count();
   const int bottom_offset = bottom[0]->offset(0, 1);
   const int top_offset = top[0]->offset(0, 1);
+  const int num_planes = bottom[0]->num() * channels_;
+  const int grain = parallel_grain(
+      static_cast<int64_t>(top_offset) * kernel_h_ * kernel_w_);
   // Different pooling methods. We explicitly do the switch outside the for
   // loop to save time, although this results in more code.
   switch (this->layer_param_.pooling_param().pool()) {
   case PoolingParameter_PoolMethod_MAX:
-    // The main loop
-    for (int n = 0; n < bottom[0]->num(); ++n) {
-      for (int c = 0; c < channels_; ++c) {
+    // The main loop, over every (n, c) plane
+    parallel_for(0, num_planes, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        const real_t* bottom_plane = bottom_data + i * bottom_offset;
+        real_t* top_plane = top_data + i * top_offset;
         for (int ph = 0; ph < pooled_height_; ++ph) {
           for (int pw = 0; pw < pooled_width_; ++pw) {
             int hstart = ph * stride_h_ - pad_h_;
@@ -140,24 +150,22 @@ void PoolingLayer::Forward_cpu(const vector<Blob*>& bottom,
             for (int h = hstart; h < hend; ++h) {
               for (int w = wstart; w < wend; ++w) {
                 const int index = h * width_ + w;
-                top_val = max(top_val, bottom_data[index]);
+                top_val = max(top_val, bottom_plane[index]);
               }
             }
             const int pool_index = ph * pooled_width_ + pw;
-            top_data[pool_index] = top_val;
+            top_plane[pool_index] = top_val;
           }
         }
-        // compute offset
-        bottom_data += bottom_offset;
-        top_data += top_offset;
       }
-    }
+    }, grain);
     break;
   case PoolingParameter_PoolMethod_AVE:
-    caffe_set(top_count, 0, top_data);
-    // The main loop
-    for (int n = 0; n < bottom[0]->num(); ++n) {
-      for (int c = 0; c < channels_; ++c) {
+    // The main loop, over every (n, c) plane
+    parallel_for(0, num_planes, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        const real_t* bottom_plane = bottom_data + i * bottom_offset;
+        real_t* top_plane = top_data + i * top_offset;
         for (int ph = 0; ph < pooled_height_; ++ph) {
           for (int pw = 0; pw < pooled_width_; ++pw) {
             int hstart = ph * stride_h_ - pad_h_;
@@ -169,25 +177,80 @@ void PoolingLayer::Forward_cpu(const vector<Blob*>& bottom,
             wstart = max(wstart, 0);
             hend = min(hend, height_);
             wend = min(wend, width_);
+            real_t top_val = 0;
             for (int h = hstart; h < hend; ++h) {
               for (int w = wstart; w < wend; ++w) {
-                top_data[ph * pooled_width_ + pw] += bottom_data[h * width_ + w];
+                top_val += bottom_plane[h * width_ + w];
               }
             }
-            top_data[ph * pooled_width_ + pw] /= pool_size;
+            top_plane[ph * pooled_width_ + pw] = top_val / pool_size;
           }
         }
-        // compute offset
-        bottom_data += bottom_offset;
-        top_data += top_offset;
       }
-    }
+    }, grain);
     break;
   default:
     LOG(FATAL) << "Unknown pooling method.";
   }
 }
 
+// The same pooling on planes of B channels, each pixel holds B channels in a
+// row, the loop over them takes the place of the vector registers.
+template<int B>
+void PoolingLayer::Forward_blocked_cpu(const vector<Blob*>& bottom,
+                                       const vector<Blob*>& top) {
+  const real_t* bottom_data = bottom[0]->cpu_data();
+  real_t* top_data = top[0]->mutable_cpu_data();
+  const int bottom_offset = bottom[0]->offset(0, B);
+  const int top_offset = top[0]->offset(0, B);
+  const int num_planes = bottom[0]->num() * channels_ / B;
+  const int grain = parallel_grain(
+      static_cast<int64_t>(top_offset) * kernel_h_ * kernel_w_);
+  const bool max_pool = this->layer_param_.pooling_param().pool() ==
+                        PoolingParameter_PoolMethod_MAX;
+  parallel_for(0, num_planes, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      const real_t* bottom_plane = bottom_data + i * bottom_offset;
+      real_t* top_plane = top_data + i * top_offset;
+      for (int ph = 0; ph < pooled_height_; ++ph) {
+        for (int pw = 0; pw < pooled_width_; ++pw) {
+          int hstart = ph * stride_h_ - pad_h_;
+          int wstart = pw * stride_w_ - pad_w_;
+          int hend = min(hstart + kernel_h_, height_ + pad_h_);
+          int wend = min(wstart + kernel_w_, width_ + pad_w_);
+          const int pool_size = (hend - hstart) * (wend - wstart);
+          hstart = max(hstart, 0);
+          wstart = max(wstart, 0);
+          hend = min(hend, height_);
+          wend = min(wend, width_);
+          real_t top_val[B];
+          for (int b = 0; b < B; ++b) {
+            top_val[b] = max_pool ? -FLT_MAX : 0;
+          }
+          for (int h = hstart; h < hend; ++h) {
+            for (int w = wstart; w < wend; ++w) {
+              const real_t* in = bottom_plane + (h * width_ + w) * B;
+              if (max_pool) {
+                for (int b = 0; b < B; ++b) {
+                  top_val[b] = max(top_val[b], in[b]);
+                }
+              } else {
+                for (int b = 0; b < B; ++b) {
+                  top_val[b] += in[b];
+                }
+              }
+            }
+          }
+          real_t* out = top_plane + (ph * pooled_width_ + pw) * B;
+          for (int b = 0; b < B; ++b) {
+            out[b] = max_pool ? top_val[b] : top_val[b] / pool_size;
+          }
+        }
+      }
+    }
+  }, grain);
+}
+
 #ifndef USE_CUDA
 STUB_GPU(PoolingLayer);
 #endif
@@ -30,12 +30,20 @@ class PoolingLayer : public Layer {
     return (this->layer_param_.pooling_param().pool() ==
             PoolingParameter_PoolMethod_MAX) ? 2 : 1;
   }
+  virtual bool AcceptsChannelBlock(int block) const {
+    return (block == 4 || block == 8 || block == 16) &&
+           this->layer_param_.top_size() == 1;
+  }
 
  protected:
   virtual void Forward_cpu(const vector<Blob*>& bottom,
                            const vector<Blob*>& top);
   virtual void Forward_gpu(const vector<Blob*>& bottom,
                            const vector<Blob*>& top);
+  /// @brief Forward_cpu on bottom and top blocked in channels of B
+  template<int B>
+  void Forward_blocked_cpu(const vector<Blob*>& bottom,
+                           const vector<Blob*>& top);
 
   int kernel_h_, kernel_w_;
   int stride_h_, stride_w_;
@@ -3,6 +3,7 @@
 
 #include "./prelu_layer.hpp"
 #include "../filler.hpp"
+#include "../util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -62,27 +63,46 @@ void PReLULayer::Forward_cpu(const vector<Blob*>& bottom,
   // always zero.
   if (channel_shared_) {
     const float slop = slope_data[0];
-    for (int i = 0; i < count; ++i) {
-      top_data[i] = std::max(bottom_data[i], static_cast<real_t>(0))
-          + slop * std::min(bottom_data[i], static_cast<real_t>(0));
-    }
+    parallel_for(0, count, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        top_data[i] = std::max(bottom_data[i], static_cast<real_t>(0))
+            + slop * std::min(bottom_data[i], static_cast<real_t>(0));
+      }
+    }, parallel_grain(1));
   }
   else {
+    // every (n, c) plane on its own
     const int num = bottom[0]->num();
-    for (int i = 0; i < num; ++i) {
-      for (int j = 0; j < channels; j++) {
-        const real_t slop = slope_data[j];
+    parallel_for(0, num * channels, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        const real_t slop = slope_data[i % channels];
+        const real_t* bottom_plane = bottom_data + i * dim;
+        real_t* top_plane = top_data + i * dim;
         for (int k = 0; k < dim; k++) {
-          *top_data = std::max(*bottom_data, static_cast<real_t>(0))
-              + slop * std::min(*bottom_data, static_cast<real_t>(0));
-          top_data++;
-          bottom_data++;
+          top_plane[k] = std::max(bottom_plane[k], static_cast<real_t>(0))
+              + slop * std::min(bottom_plane[k], static_cast<real_t>(0));
         }
       }
-    }
+    }, parallel_grain(dim));
   }
 }
 
+void PReLULayer::ForwardEpilogue_cpu(real_t* data, int channels,
+                                     int inner_dim, int channel_offset) {
+  const real_t* slope_data = this->blobs_[0]->cpu_data();
+  parallel_for(0, channels, [&](int begin, int end) {
+    for (int j = begin; j < end; j++) {
+      // if channel_shared, channel index becomes always zero.
+      const real_t slop = slope_data[channel_shared_ ? 0 : channel_offset + j];
+      real_t* channel_data = data + j * inner_dim;
+      for (int k = 0; k < inner_dim; k++) {
+        channel_data[k] = std::max(channel_data[k], static_cast<real_t>(0))
+            + slop * std::min(channel_data[k], static_cast<real_t>(0));
+      }
+    }
+  }, parallel_grain(inner_dim));
+}
+
 #ifndef USE_CUDA
 STUB_GPU(PReLULayer);
 #endif
@@ -35,6 +35,13 @@ class PReLULayer : public NeuronLayer {
                        const vector<Blob*>& top);
 
   virtual const char* type() const { return "PReLU"; }
+  virtual bool CanRunAsEpilogue() const { return true; }
+  virtual void ForwardEpilogue_cpu(real_t* data, int channels, int inner_dim,
+                                   int channel_offset);
+  /// @brief a slope per channel needs to find the channel of every value
+  virtual bool IsLayoutAgnostic() const {
+    return this->layer_param_.prelu_param().channel_shared();
+  }
 
  protected:
   /**
@@ -2,6 +2,7 @@
 #include <vector>
 
 #include "./relu_layer.hpp"
+#include "../util/thread_pool.hpp"
 
 #ifdef USE_CUDNN
 #include "./cudnn/cudnn_relu_layer.hpp"
@@ -16,15 +17,40 @@ void ReLULayer::Forward_cpu(const vector<Blob*>& bottom,
   const int count = bottom[0]->count();
   real_t negative_slope = this->layer_param_.relu_param().negative_slope();
   if (std::abs(negative_slope) < 1e-6) {
-    for (int i = 0; i < count; ++i) {
-      top_data[i] = std::max(bottom_data[i], static_cast<real_t>(0));
-    }
+    parallel_for(0, count, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        top_data[i] = std::max(bottom_data[i], static_cast<real_t>(0));
+      }
+    }, parallel_grain(1));
   }
   else {
-    for (int i = 0; i < count; ++i) {
-      top_data[i] = std::max(bottom_data[i], static_cast<real_t>(0))
-        + negative_slope * std::min(bottom_data[i], static_cast<real_t>(0));
-    }
+    parallel_for(0, count, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        top_data[i] = std::max(bottom_data[i], static_cast<real_t>(0))
+          + negative_slope * std::min(bottom_data[i], static_cast<real_t>(0));
+      }
+    }, parallel_grain(1));
+  }
+}
+
+void ReLULayer::ForwardEpilogue_cpu(real_t* data, int channels,
+                                    int inner_dim, int channel_offset) {
+  const int count = channels * inner_dim;
+  real_t negative_slope = this->layer_param_.relu_param().negative_slope();
+  if (std::abs(negative_slope) < 1e-6) {
+    parallel_for(0, count, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        data[i] = std::max(data[i], static_cast<real_t>(0));
+      }
+    }, parallel_grain(1));
+  }
+  else {
+    parallel_for(0, count, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        data[i] = std::max(data[i], static_cast<real_t>(0))
+          + negative_slope * std::min(data[i], static_cast<real_t>(0));
+      }
+    }, parallel_grain(1));
   }
 }
 
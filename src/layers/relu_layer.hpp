@@ -23,6 +23,9 @@ class ReLULayer : public NeuronLayer {
       : NeuronLayer(param) {}
 
   virtual const char* type() const { return "ReLU"; }
+  virtual bool CanRunAsEpilogue() const { return true; }
+  virtual void ForwardEpilogue_cpu(real_t* data, int channels, int inner_dim,
+                                   int channel_offset);
 
  protected:
   /**
@@ -0,0 +1,58 @@
+#include <vector>
+
+#include "./reorder_layer.hpp"
+#include "../util/thread_pool.hpp"
+
+namespace caffe {
+
+void ReorderLayer::LayerSetUp(const vector<Blob*>& bottom,
+                              const vector<Blob*>& top) {
+  const ReorderParameter& reorder_param = this->layer_param_.reorder_param();
+  bottom_block_ = reorder_param.bottom_channel_block();
+  top_block_ = reorder_param.top_channel_block();
+}
+
+void ReorderLayer::Reshape(const vector<Blob*>& bottom,
+                           const vector<Blob*>& top) {
+  CHECK_EQ(4, bottom[0]->num_axes()) << "Input must have 4 axes, "
+      << "corresponding to (num, channels, height, width)";
+  const int channels = bottom[0]->channels();
+  CHECK(bottom_block_ == 0 || channels % bottom_block_ == 0)
+      << "Channels must be a multiple of the channel block";
+  CHECK(top_block_ == 0 || channels % top_block_ == 0)
+      << "Channels must be a multiple of the channel block";
+  top[0]->ReshapeLike(*bottom[0]);
+}
+
+// start and step of the values of channel c of a plane of dim values
+static inline int ChannelStart(int c, int dim, int block) {
+  return block ? (c / block * dim * block + c % block) : c * dim;
+}
+
+void ReorderLayer::Forward_cpu(const vector<Blob*>& bottom,
+                               const vector<Blob*>& top) {
+  const real_t* bottom_data = bottom[0]->cpu_data();
+  real_t* top_data = top[0]->mutable_cpu_data();
+  const int channels = bottom[0]->channels();
+  const int dim = bottom[0]->count(2);
+  const int bottom_step = bottom_block_ ? bottom_block_ : 1;
+  const int top_step = top_block_ ? top_block_ : 1;
+  // every channel of every image, the images are whole in either layout
+  parallel_for(0, bottom[0]->num() * channels, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      const int n = i / channels;
+      const int c = i % channels;
+      const real_t* in = bottom_data + static_cast<size_t>(n) * channels * dim +
+                         ChannelStart(c, dim, bottom_block_);
+      real_t* out = top_data + static_cast<size_t>(n) * channels * dim +
+                    ChannelStart(c, dim, top_block_);
+      for (int j = 0; j < dim; ++j) {
+        out[j * top_step] = in[j * bottom_step];
+      }
+    }
+  }, parallel_grain(dim));
+}
+
+REGISTER_LAYER_CLASS(Reorder);
+
+}  // namespace caffe
@@ -0,0 +1,39 @@
+#ifndef CAFFE_REORDER_LAYER_HPP_
+#define CAFFE_REORDER_LAYER_HPP_
+
+#include <vector>
+
+#include "../layer.hpp"
+
+namespace caffe {
+
+/**
+ * @brief Copies an (N, C, H, W) blob from one layout of its channels to
+ *        another, NCHW or blocked in channels, see
+ *        NetParameter.channel_block. Net inserts it where layers of
+ *        different layouts meet.
+ */
+class ReorderLayer : public Layer {
+ public:
+  explicit ReorderLayer(const LayerParameter& param)
+      : Layer(param) {}
+  virtual void LayerSetUp(const vector<Blob*>& bottom,
+                          const vector<Blob*>& top);
+  virtual void Reshape(const vector<Blob*>& bottom,
+                       const vector<Blob*>& top);
+
+  virtual inline const char* type() const { return "Reorder"; }
+  virtual inline int ExactNumBottomBlobs() const { return 1; }
+  virtual inline int ExactNumTopBlobs() const { return 1; }
+
+ protected:
+  virtual void Forward_cpu(const vector<Blob*>& bottom,
+                           const vector<Blob*>& top);
+
+  int bottom_block_;
+  int top_block_;
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_REORDER_LAYER_HPP_
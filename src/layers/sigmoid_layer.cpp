@@ -2,6 +2,7 @@
 #include <vector>
 
 #include "./sigmoid_layer.hpp"
+#include "../util/thread_pool.hpp"
 
 #ifdef USE_CUDNN
 #include "./cudnn/cudnn_sigmoid_layer.hpp"
@@ -18,9 +19,21 @@ void SigmoidLayer::Forward_cpu(const vector<Blob*>& bottom,
   const real_t* bottom_data = bottom[0]->cpu_data();
   real_t* top_data = top[0]->mutable_cpu_data();
   const int count = bottom[0]->count();
-  for (int i = 0; i < count; ++i) {
-    top_data[i] = sigmoid(bottom_data[i]);
-  }
+  parallel_for(0, count, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      top_data[i] = sigmoid(bottom_data[i]);
+    }
+  }, parallel_grain(1));
+}
+
+void SigmoidLayer::ForwardEpilogue_cpu(real_t* data, int channels,
+                                       int inner_dim, int channel_offset) {
+  const int count = channels * inner_dim;
+  parallel_for(0, count, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      data[i] = sigmoid(data[i]);
+    }
+  }, parallel_grain(1));
 }
 
 #ifndef USE_CUDA
@@ -1,8 +1,10 @@
 #include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "./softmax_layer.hpp"
 #include "../util/math_functions.hpp"
+#include "../util/thread_pool.hpp"
 
 #ifdef USE_CUDNN
 #include "./cudnn/cudnn_softmax_layer.hpp"
@@ -15,10 +17,6 @@ void SoftmaxLayer::Reshape(const vector<Blob*>& bottom,
   softmax_axis_ =
       bottom[0]->CanonicalAxisIndex(this->layer_param_.softmax_param().axis());
   top[0]->ReshapeLike(*bottom[0]);
-  vector<int> mult_dims(1, bottom[0]->shape(softmax_axis_));
-  sum_multiplier_.Reshape(mult_dims);
-  real_t* multiplier_data = sum_multiplier_.mutable_cpu_data();
-  caffe_set(sum_multiplier_.count(), static_cast<real_t>(1), multiplier_data);
   outer_num_ = bottom[0]->count(0, softmax_axis_);
   inner_num_ = bottom[0]->count(softmax_axis_ + 1);
   vector<int> scale_dims = bottom[0]->shape();
@@ -33,33 +31,41 @@ void SoftmaxLayer::Forward_cpu(const vector<Blob*>& bottom,
   real_t* scale_data = scale_.mutable_cpu_data();
   int channels = bottom[0]->shape(softmax_axis_);
   int dim = bottom[0]->count() / outer_num_;
-  caffe_copy(bottom[0]->count(), bottom_data, top_data);
   // We need to subtract the max to avoid numerical issues, compute the exp,
-  // and then normalize.
-  for (int i = 0; i < outer_num_; ++i) {
-    // initialize scale_data to the first plane
-    caffe_copy(inner_num_, bottom_data + i * dim, scale_data);
-    for (int j = 0; j < channels; j++) {
-      for (int k = 0; k < inner_num_; k++) {
-        scale_data[k] = std::max(scale_data[k],
-            bottom_data[i * dim + j * inner_num_ + k]);
+  // and then normalize. Every outer index has a plane of scale_ of its own.
+  parallel_for(0, outer_num_, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      const real_t* bottom_i = bottom_data + i * dim;
+      real_t* top_i = top_data + i * dim;
+      real_t* scale_i = scale_data + i * inner_num_;
+      // initialize scale_data to the first plane
+      std::copy(bottom_i, bottom_i + inner_num_, scale_i);
+      for (int j = 0; j < channels; j++) {
+        for (int k = 0; k < inner_num_; k++) {
+          scale_i[k] = std::max(scale_i[k], bottom_i[j * inner_num_ + k]);
+        }
+      }
+      // subtraction and exponentiation
+      for (int j = 0; j < channels; j++) {
+        for (int k = 0; k < inner_num_; k++) {
+          top_i[j * inner_num_ + k] =
+              std::exp(bottom_i[j * inner_num_ + k] - scale_i[k]);
+        }
+      }
+      // sum after exp
+      caffe_set(inner_num_, static_cast<real_t>(0), scale_i);
+      for (int j = 0; j < channels; j++) {
+        for (int k = 0; k < inner_num_; k++) {
+          scale_i[k] += top_i[j * inner_num_ + k];
+        }
+      }
+      // division
+      for (int j = 0; j < channels; j++) {
+        caffe_div(inner_num_, top_i + j * inner_num_, scale_i,
+                  top_i + j * inner_num_);
       }
     }
-    // subtraction
-    caffe_cpu_gemm(CblasNoTrans, CblasNoTrans, channels, inner_num_,
-      1, static_cast<real_t>(-1), sum_multiplier_.cpu_data(), scale_data,
-      static_cast<real_t>(1), top_data);
-    // exponentiation
-    caffe_exp(dim, top_data, top_data);
-    // sum after exp
-    caffe_cpu_gemv(CblasTrans, channels, inner_num_, static_cast<real_t>(1),
-      top_data, sum_multiplier_.cpu_data(), static_cast<real_t>(0), scale_data);
-    // division
-    for (int j = 0; j < channels; j++) {
-      caffe_div(inner_num_, top_data, scale_data, top_data);
-      top_data += inner_num_;
-    }
-  }
+  }, parallel_grain(dim));
 }
 
 #ifndef USE_CUDA
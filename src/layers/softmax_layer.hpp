@@ -32,8 +32,6 @@ class SoftmaxLayer : public Layer {
   int outer_num_;
   int inner_num_;
   int softmax_axis_;
-  /// sum_multiplier is used to carry out sum using BLAS
-  Blob sum_multiplier_;
   /// scale is an intermediate Blob to hold temporary results.
   Blob scale_;
 };
@@ -9,11 +9,9 @@ void SplitLayer::Reshape(const vector<Blob*>& bottom,
                          const vector<Blob*>& top) {
   count_ = bottom[0]->count();
   for (int i = 0; i < top.size(); ++i) {
-    // Do not allow in-place computation in the SplitLayer.  Instead, share data
-    // by reference in the forward pass, and keep separate diff allocations in
-    // the backward pass.  (Technically, it should be possible to share the diff
-    // blob of the first split output with the input, but this seems to cause
-    // some strange effects in practice...)
+    // Do not allow in-place computation in the SplitLayer.  Instead, Net shares
+    // data by reference for every top that no consumer writes in place (see
+    // Net::ShareSplitBlobs), the remaining tops are copied in the forward pass.
     CHECK_NE(top[i], bottom[0]) << this->type() << " Layer does not "
         "allow in-place computation.";
     top[i]->ReshapeLike(*bottom[0]);
@@ -23,15 +21,21 @@ void SplitLayer::Reshape(const vector<Blob*>& bottom,
 
 void SplitLayer::Forward_cpu(const vector<Blob*>& bottom,
                              const vector<Blob*>& top) {
+  if (count_ == 0) { return; }
   for (int i = 0; i < top.size(); ++i) {
-    caffe_copy(bottom[0]->count(), bottom[0]->cpu_data(), top[i]->mutable_cpu_data());
+    if (top[i]->data() != bottom[0]->data()) {
+      caffe_copy(count_, bottom[0]->cpu_data(), top[i]->mutable_cpu_data());
+    }
   }
 }
 
 void SplitLayer::Forward_gpu(const vector<Blob*>& bottom,
                              const vector<Blob*>& top) {
+  if (count_ == 0) { return; }
   for (int i = 0; i < top.size(); ++i) {
-    caffe_copy(bottom[0]->count(), bottom[0]->gpu_data(), top[i]->mutable_gpu_data());
+    if (top[i]->data() != bottom[0]->data()) {
+      caffe_copy(count_, bottom[0]->gpu_data(), top[i]->mutable_gpu_data());
+    }
   }
 }
 
@@ -11,7 +11,8 @@ namespace caffe {
  * @brief Creates a "split" path in the network by copying the bottom Blob
  *        into multiple top Blob%s to be used by multiple consuming layers.
  *
- * TODO(dox): thorough documentation for Forward, Backward, and proto params.
+ * Net lets the tops share data with the bottom whenever it is safe, the copy
+ * is only done for tops that don't.
  */
 class SplitLayer : public Layer {
  public:
@@ -23,6 +24,7 @@ class SplitLayer : public Layer {
   virtual const char* type() const { return "Split"; }
   virtual int ExactNumBottomBlobs() const { return 1; }
   virtual int MinTopBlobs() const { return 1; }
+  virtual bool IsLayoutAgnostic() const { return true; }
 
  protected:
   virtual void Forward_cpu(const vector<Blob*>& bottom,
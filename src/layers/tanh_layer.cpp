@@ -1,9 +1,11 @@
+#include <cmath>
 // TanH neuron activation function layer.
 // Adapted from ReLU layer code written by Yangqing Jia
 
 #include <vector>
 
 #include "./tanh_layer.hpp"
+#include "../util/thread_pool.hpp"
 
 #ifdef USE_CUDNN
 #include "./cudnn/cudnn_tanh_layer.hpp"
@@ -16,9 +18,21 @@ void TanHLayer::Forward_cpu(const vector<Blob*>& bottom,
   const real_t* bottom_data = bottom[0]->cpu_data();
   real_t* top_data = top[0]->mutable_cpu_data();
   const int count = bottom[0]->count();
-  for (int i = 0; i < count; ++i) {
-    top_data[i] = tanh(bottom_data[i]);
-  }
+  parallel_for(0, count, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      top_data[i] = tanh(bottom_data[i]);
+    }
+  }, parallel_grain(1));
+}
+
+void TanHLayer::ForwardEpilogue_cpu(real_t* data, int channels,
+                                    int inner_dim, int channel_offset) {
+  const int count = channels * inner_dim;
+  parallel_for(0, count, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      data[i] = tanh(data[i]);
+    }
+  }, parallel_grain(1));
 }
 
 #ifndef USE_CUDA
@@ -21,6 +21,9 @@ class TanHLayer : public NeuronLayer {
       : NeuronLayer(param) {}
 
   virtual const char* type() const { return "TanH"; }
+  virtual bool CanRunAsEpilogue() const { return true; }
+  virtual void ForwardEpilogue_cpu(real_t* data, int channels, int inner_dim,
+                                   int channel_offset);
 
  protected:
   /**
@@ -0,0 +1,328 @@
+#include <algorithm>
+#include <vector>
+
+#include "./winograd_conv_layer.hpp"
+#include "../syncedmem.hpp"
+#include "../util/thread_pool.hpp"
+
+namespace caffe {
+
+/*!
+ * \brief the matrices of F(M x M, 3x3), Y = AT [(G g GT) * (BT d B)] A for
+ *  an (M + 2) x (M + 2) tile d of the input and a 3x3 kernel g, from Lavin
+ *  and Gray, Fast Algorithms for Convolutional Neural Networks
+ */
+template <int M>
+struct WinogradMatrices {
+  static const int kAlpha = M + 2;
+  static const real_t BT[kAlpha][kAlpha];
+  static const real_t G[kAlpha][3];
+  static const real_t AT[M][kAlpha];
+};
+
+template <> const real_t WinogradMatrices<2>::BT[4][4] = {
+  { 1,  0, -1,  0 },
+  { 0,  1,  1,  0 },
+  { 0, -1,  1,  0 },
+  { 0,  1,  0, -1 },
+};
+template <> const real_t WinogradMatrices<2>::G[4][3] = {
+  { 1.f,    0,    0 },
+  { .5f,  .5f,  .5f },
+  { .5f, -.5f,  .5f },
+  {   0,    0,  1.f },
+};
+template <> const real_t WinogradMatrices<2>::AT[2][4] = {
+  { 1,  1,  1,  0 },
+  { 0,  1, -1, -1 },
+};
+
+template <> const real_t WinogradMatrices<4>::BT[6][6] = {
+  { 4,  0, -5,  0,  1,  0 },
+  { 0, -4, -4,  1,  1,  0 },
+  { 0,  4, -4, -1,  1,  0 },
+  { 0, -2, -1,  2,  1,  0 },
+  { 0,  2, -1, -2,  1,  0 },
+  { 0,  4,  0, -5,  0,  1 },
+};
+template <> const real_t WinogradMatrices<4>::G[6][3] = {
+  {  1.f / 4,        0,        0 },
+  { -1.f / 6, -1.f / 6, -1.f / 6 },
+  { -1.f / 6,  1.f / 6, -1.f / 6 },
+  { 1.f / 24, 1.f / 12,  1.f / 6 },
+  { 1.f / 24, -1.f / 12, 1.f / 6 },
+  {        0,        0,      1.f },
+};
+template <> const real_t WinogradMatrices<4>::AT[4][6] = {
+  { 1,  1,  1,  1,  1,  0 },
+  { 0,  1, -1,  2, -2,  0 },
+  { 0,  1,  1,  4,  4,  0 },
+  { 0,  1, -1,  8, -8,  1 },
+};
+
+// U = G g GT of every kernel, element i of a tile in the matrix weights[i]
+template <int M>
+static void WinogradTransformWeights(const real_t* kernels, int num_output,
+                                     int channels,
+                                     vector<PackedMatrix>* weights) {
+  typedef WinogradMatrices<M> F;
+  const int A = F::kAlpha;
+  const size_t plane = static_cast<size_t>(num_output) * channels;
+  vector<real_t> transformed(A * A * plane);
+  for (size_t k = 0; k < plane; ++k) {
+    const real_t* g = kernels + k * 9;
+    real_t t[A][3];
+    for (int i = 0; i < A; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        t[i][j] = F::G[i][0] * g[j] + F::G[i][1] * g[3 + j] +
+                  F::G[i][2] * g[6 + j];
+      }
+    }
+    for (int i = 0; i < A; ++i) {
+      for (int j = 0; j < A; ++j) {
+        transformed[(i * A + j) * plane + k] =
+            t[i][0] * F::G[j][0] + t[i][1] * F::G[j][1] + t[i][2] * F::G[j][2];
+      }
+    }
+  }
+  weights->resize(A * A);
+  for (int i = 0; i < A * A; ++i) {
+    (*weights)[i].Pack(false, num_output, channels, &transformed[i * plane]);
+  }
+}
+
+// V = BT d B of every tile of every channel, element i of a tile in the
+// matrix at i * channels * tiles
+template <int M>
+static void WinogradTransformInput(const real_t* input, int channels,
+                                   int height, int width, int pad_h,
+                                   int pad_w, int tiles_h, int tiles_w,
+                                   real_t* tiles) {
+  typedef WinogradMatrices<M> F;
+  const int A = F::kAlpha;
+  const int num_tiles = tiles_h * tiles_w;
+  const size_t plane = static_cast<size_t>(channels) * num_tiles;
+  parallel_for(0, channels, [&](int begin, int end) {
+    real_t d[A][A], t[A][A];
+    for (int c = begin; c < end; ++c) {
+      const real_t* in = input + static_cast<size_t>(c) * height * width;
+      real_t* out = tiles + static_cast<size_t>(c) * num_tiles;
+      for (int th = 0; th < tiles_h; ++th) {
+        for (int tw = 0; tw < tiles_w; ++tw) {
+          const int y0 = th * M - pad_h, x0 = tw * M - pad_w;
+          if (y0 >= 0 && x0 >= 0 && y0 + A <= height && x0 + A <= width) {
+            for (int i = 0; i < A; ++i) {
+              for (int j = 0; j < A; ++j) {
+                d[i][j] = in[(y0 + i) * width + x0 + j];
+              }
+            }
+          } else {
+            // the border, padded with zeros
+            for (int i = 0; i < A; ++i) {
+              for (int j = 0; j < A; ++j) {
+                const int y = y0 + i, x = x0 + j;
+                d[i][j] = y >= 0 && y < height && x >= 0 && x < width
+                    ? in[y * width + x] : 0;
+              }
+            }
+          }
+          for (int i = 0; i < A; ++i) {
+            for (int j = 0; j < A; ++j) {
+              real_t sum = 0;
+              for (int k = 0; k < A; ++k) {
+                sum += F::BT[i][k] * d[k][j];
+              }
+              t[i][j] = sum;
+            }
+          }
+          for (int i = 0; i < A; ++i) {
+            for (int j = 0; j < A; ++j) {
+              real_t sum = 0;
+              for (int k = 0; k < A; ++k) {
+                sum += t[i][k] * F::BT[j][k];
+              }
+              out[(i * A + j) * plane] = sum;
+            }
+          }
+          ++out;
+        }
+      }
+    }
+  }, parallel_grain(static_cast<int64_t>(num_tiles) * A * A));
+}
+
+// Y = AT m A of every tile of every output channel, plus the bias, added to
+// output if accumulate
+template <int M>
+static void WinogradTransformOutput(const real_t* tiles, const real_t* bias,
+                                    int num_output, int height, int width,
+                                    int tiles_h, int tiles_w, bool accumulate,
+                                    real_t* output) {
+  typedef WinogradMatrices<M> F;
+  const int A = F::kAlpha;
+  const int num_tiles = tiles_h * tiles_w;
+  const size_t plane = static_cast<size_t>(num_output) * num_tiles;
+  parallel_for(0, num_output, [&](int begin, int end) {
+    real_t m[A][A], t[M][A];
+    for (int k = begin; k < end; ++k) {
+      const real_t b = bias ? bias[k] : 0;
+      const real_t* in = tiles + static_cast<size_t>(k) * num_tiles;
+      real_t* out = output + static_cast<size_t>(k) * height * width;
+      for (int th = 0; th < tiles_h; ++th) {
+        for (int tw = 0; tw < tiles_w; ++tw) {
+          for (int i = 0; i < A; ++i) {
+            for (int j = 0; j < A; ++j) {
+              m[i][j] = in[(i * A + j) * plane];
+            }
+          }
+          ++in;
+          for (int i = 0; i < M; ++i) {
+            for (int j = 0; j < A; ++j) {
+              real_t sum = 0;
+              for (int l = 0; l < A; ++l) {
+                sum += F::AT[i][l] * m[l][j];
+              }
+              t[i][j] = sum;
+            }
+          }
+          const int y0 = th * M, x0 = tw * M;
+          const int rows = std::min(M, height - y0);
+          const int cols = std::min(M, width - x0);
+          for (int i = 0; i < rows; ++i) {
+            real_t* row = out + (y0 + i) * width + x0;
+            for (int j = 0; j < cols; ++j) {
+              real_t sum = b;
+              for (int l = 0; l < A; ++l) {
+                sum += t[i][l] * F::AT[j][l];
+              }
+              row[j] = accumulate ? row[j] + sum : sum;
+            }
+          }
+        }
+      }
+    }
+  }, parallel_grain(static_cast<int64_t>(num_tiles) * A * A));
+}
+
+void WinogradConvolutionLayer::Reshape(const vector<Blob*>& bottom,
+                                       const vector<Blob*>& top) {
+  ConvolutionLayer::Reshape(bottom, top);
+  const ConvolutionParameter& param = this->layer_param_.convolution_param();
+  const int* kernel = this->kernel_shape_.cpu_data();
+  const int* stride = this->stride_.cpu_data();
+  const int* dilation = this->dilation_.cpu_data();
+  const bool supported = this->num_spatial_axes_ == 2 &&
+      this->channel_axis_ == 1 && this->group_ == 1 &&
+      kernel[0] == 3 && kernel[1] == 3 && stride[0] == 1 && stride[1] == 1 &&
+      dilation[0] == 1 && dilation[1] == 1;
+  tile_ = 0;
+  if (IsQuantized(this->layer_param_)) {
+    // int8 runs the gemm of ConvolutionLayer, even if forced
+    return;
+  }
+  const bool forced = param.engine() == ConvolutionParameter_Engine_WINOGRAD;
+  if (forced) {
+    CHECK(supported) << "Winograd convolution takes 3x3 kernels of stride 1 "
+                     << "and dilation 1 without groups";
+  } else if (!supported || !GetGemmKernel() || this->channel_block_ ||
+             this->channels_ < 16 || this->num_output_ < 16) {
+    // few channels leave little to the gemm, transforming costs more, and
+    // the tiles are transformed from NCHW
+    return;
+  }
+  const int height = this->output_shape_[0], width = this->output_shape_[1];
+  // every transformed weight is read once per tile, so it takes enough tiles
+  // for the gemms not to wait on memory
+  const int kMinTiles = 24;
+  if (param.winograd_tile() != 0) {
+    CHECK(param.winograd_tile() == 2 || param.winograd_tile() == 4)
+        << "winograd_tile must be 2 or 4";
+    tile_ = param.winograd_tile();
+  } else if (((height + 3) / 4) * ((width + 3) / 4) >= kMinTiles) {
+    tile_ = 4;
+  } else if (forced || ((height + 1) / 2) * ((width + 1) / 2) >= kMinTiles) {
+    tile_ = 2;
+  } else {
+    return;
+  }
+  tiles_h_ = (height + tile_ - 1) / tile_;
+  tiles_w_ = (width + tile_ - 1) / tile_;
+  const int alpha = tile_ + 2;
+  vector<int> shape(3);
+  shape[0] = alpha * alpha;
+  shape[1] = this->channels_;
+  shape[2] = tiles_h_ * tiles_w_;
+  input_tiles_.Reshape(shape);
+  shape[1] = this->num_output_;
+  output_tiles_.Reshape(shape);
+}
+
+const vector<PackedMatrix>& WinogradConvolutionLayer::TransformWeights() {
+  // three ints, no layout of PackedWeights, which packs the same type
+  const int layout[] = {tile_, this->num_output_, this->channels_};
+  return weights_.Get(*this->blobs_[0], vector<int>(layout, layout + 3),
+      [this](const Blob& weights, vector<PackedMatrix>* transformed) {
+        if (tile_ == 2) {
+          WinogradTransformWeights<2>(weights.cpu_data(), this->num_output_,
+                                      this->channels_, transformed);
+        } else {
+          WinogradTransformWeights<4>(weights.cpu_data(), this->num_output_,
+                                      this->channels_, transformed);
+        }
+      });
+}
+
+void WinogradConvolutionLayer::Forward_cpu(const vector<Blob*>& bottom,
+                                           const vector<Blob*>& top) {
+  if (tile_ == 0) {
+    ConvolutionLayer::Forward_cpu(bottom, top);
+    return;
+  }
+  const vector<PackedMatrix>& weights = TransformWeights();
+  const int height = this->input_shape(1), width = this->input_shape(2);
+  const int out_height = this->output_shape_[0];
+  const int out_width = this->output_shape_[1];
+  const int* pad = this->pad_.cpu_data();
+  const int num_tiles = tiles_h_ * tiles_w_;
+  const int area = (tile_ + 2) * (tile_ + 2);
+  const real_t* bias = this->bias_term_ ? this->blobs_[1]->cpu_data() : NULL;
+  real_t* input_tiles = input_tiles_.mutable_cpu_data();
+  real_t* output_tiles = output_tiles_.mutable_cpu_data();
+  for (int i = 0; i < bottom.size(); ++i) {
+    const real_t* bottom_data = bottom[i]->cpu_data();
+    real_t* top_data = top[i]->mutable_cpu_data();
+    for (int n = 0; n < this->num_; ++n) {
+      const real_t* input = bottom_data + n * this->bottom_dim_;
+      real_t* output = top_data + n * this->top_dim_;
+      if (tile_ == 2) {
+        WinogradTransformInput<2>(input, this->channels_, height, width,
+            pad[0], pad[1], tiles_h_, tiles_w_, input_tiles);
+      } else {
+        WinogradTransformInput<4>(input, this->channels_, height, width,
+            pad[0], pad[1], tiles_h_, tiles_w_, input_tiles);
+      }
+      // the gemms of the elements of a tile are independent, one per chunk
+      parallel_for(0, area, [&](int begin, int end) {
+        for (int e = begin; e < end; ++e) {
+          caffe_cpu_gemm_packed(weights[e], CblasNoTrans, num_tiles,
+              input_tiles + static_cast<size_t>(e) * this->channels_ * num_tiles,
+              static_cast<real_t>(0),
+              output_tiles + static_cast<size_t>(e) * this->num_output_ * num_tiles);
+        }
+      });
+      if (tile_ == 2) {
+        WinogradTransformOutput<2>(output_tiles, bias, this->num_output_,
+            out_height, out_width, tiles_h_, tiles_w_, this->accumulate_top_,
+            output);
+      } else {
+        WinogradTransformOutput<4>(output_tiles, bias, this->num_output_,
+            out_height, out_width, tiles_h_, tiles_w_, this->accumulate_top_,
+            output);
+      }
+      this->ForwardEpilogues_cpu(output, this->num_output_,
+          this->out_spatial_dim_);
+    }
+  }
+}
+
+}  // namespace caffe
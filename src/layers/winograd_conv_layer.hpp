@@ -0,0 +1,68 @@
+#ifndef CAFFE_WINOGRAD_CONV_LAYER_HPP_
+#define CAFFE_WINOGRAD_CONV_LAYER_HPP_
+
+#include <vector>
+
+#include "./conv_layer.hpp"
+#include "../util/gemm.hpp"
+
+namespace caffe {
+
+/**
+ * @brief Convolves 3x3 kernels of stride 1 by Winograd minimal filtering,
+ *        F(2x2,3x3) or F(4x4,3x3), on CPU.
+ *
+ *   Tiles of the input and the kernels are transformed to (m + 2) x (m + 2)
+ *   matrices, whose element wise products sum over the input channels in one
+ *   gemm per element. The product is transformed back to m x m outputs. That
+ *   takes 16 / 4 or 36 / 16 multiplications per output instead of 9, and the
+ *   transformed tiles are 4 / 1 or 9 / 4 times the input instead of the 9
+ *   times of the col buffer.
+ *
+ *   Other convolutions, those with few channels, those in int8, and those
+ *   blocked in channels unless engine is WINOGRAD, fall back to
+ *   ConvolutionLayer.
+ */
+class WinogradConvolutionLayer : public ConvolutionLayer {
+ public:
+  explicit WinogradConvolutionLayer(const LayerParameter& param)
+      : ConvolutionLayer(param), tile_(0) {}
+  virtual void Reshape(const vector<Blob*>& bottom,
+                       const vector<Blob*>& top);
+  /// @brief blocked in channels it runs ConvolutionLayer, unless forced
+  virtual bool AcceptsChannelBlock(int block) const {
+    return this->layer_param_.convolution_param().engine() !=
+               ConvolutionParameter_Engine_WINOGRAD &&
+           ConvolutionLayer::AcceptsChannelBlock(block);
+  }
+  virtual vector<Blob*> GetTempBlobs() {
+    if (tile_ == 0) return ConvolutionLayer::GetTempBlobs();
+    return {&input_tiles_, &output_tiles_};
+  }
+
+ protected:
+  virtual void Forward_cpu(const vector<Blob*>& bottom,
+                           const vector<Blob*>& top);
+
+ private:
+  /**
+   * @brief the weights transformed and packed, one num_output x channels
+   *   matrix per element of a tile
+   */
+  const vector<PackedMatrix>& TransformWeights();
+
+  /// @brief output tile m of F(m x m, 3x3), 0 to run ConvolutionLayer
+  int tile_;
+  int tiles_h_;
+  int tiles_w_;
+  /// @brief the transformed weights, shared with layers sharing blobs_[0]
+  WeightsCache<vector<PackedMatrix> > weights_;
+  /// @brief transformed tiles of an image, (m + 2)^2 x channels x tiles
+  Blob input_tiles_;
+  /// @brief their products, (m + 2)^2 x num_output x tiles
+  Blob output_tiles_;
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_WINOGRAD_CONV_LAYER_HPP_
@@ -1,6 +1,10 @@
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <mutex>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -11,13 +15,37 @@
 #include "caffe/net.hpp"
 #include "caffe/profiler.hpp"
 #include "./layer.hpp"
+#include "./syncedmem.hpp"
 #include "./util/math_functions.hpp"
 #include "./util/upgrade_proto.hpp"
 #include "./proto/caffe.pb.h"
 #include "./util/insert_splits.hpp"
+#include "./util/channel_layout.hpp"
+#include "./util/fuse_layers.hpp"
+#include "./util/io.hpp"
+#include "./util/flat_weights.hpp"
+#include "./util/quantize.hpp"
+#include "./util/thread_pool.hpp"
 using namespace std;
 namespace caffe {
 
+	// Profiler scope of a phase of loading a net, closed when the phase fails.
+	class LoadScope {
+	public:
+		explicit LoadScope(const char* name)
+			: started_(Profiler::Get()->IsRunning()) {
+			Profiler::Get()->ScopeStart(name);
+		}
+		~LoadScope() {
+			if (started_) {
+				Profiler::Get()->ScopeEnd();
+			}
+		}
+
+	private:
+		bool started_;
+	};
+
 	static bool StateMeetsRule(const NetState& state,
 		const NetStateRule& rule, const std::string& layer_name) {
 		// Check whether the rule is broken due to phase.
@@ -121,12 +149,16 @@ namespace caffe {
 	Net::Net(const string& param_file)
 	{
 		NetParameter param;
-		ReadNetParamsFromTextFileOrDie(param_file, &param);
+		{
+			LoadScope scope("Read net");
+			ReadNetParamsFromTextFileOrDie(param_file, &param);
+		}
 		Init(param);
 	}
 
 	 
 	void Net::Init(const NetParameter& in_param) {
+		LoadScope scope("Init net");
 		// Filter layers based on their include/exclude rules and
 		// the current NetState.
 		NetParameter filtered_param;
@@ -146,15 +178,44 @@ namespace caffe {
 		param_id_vecs_.resize(param.layer_size());
 		top_id_vecs_.resize(param.layer_size());
 		bottom_need_backward_.resize(param.layer_size());
+		// Blob layouts blocked in channels are planned as the layers come.
+		shared_ptr<ChannelLayout> channel_layout;
+		if (param.channel_block() > 0 && Caffe::mode() == Caffe::CPU) {
+			channel_layout.reset(new ChannelLayout(param, param.channel_block()));
+		}
 		for (int layer_id = 0; layer_id < param.layer_size(); ++layer_id) {
 			// Setup layer.
+			shared_ptr<Layer> layer = LayerRegistry::CreateLayer(param.layer(layer_id));
+			if (channel_layout) {
+				ChannelLayout::BlobLookup blob = [&](const string& name) -> const Blob* {
+					map<string, int>::const_iterator it = blob_name_to_idx.find(name);
+					return it == blob_name_to_idx.end() ? NULL : blobs_[it->second].get();
+				};
+				// The layer comes again after the Reorder layers put in front of it.
+				if (channel_layout->Plan(&param, layer_id, *layer, blob) > 0) {
+					layer = LayerRegistry::CreateLayer(param.layer(layer_id));
+				}
+				layer->SetChannelBlock(channel_layout->block(layer_id),
+					channel_layout->plain_bottoms(layer_id));
+				bottom_vecs_.resize(param.layer_size());
+				top_vecs_.resize(param.layer_size());
+				bottom_id_vecs_.resize(param.layer_size());
+				param_id_vecs_.resize(param.layer_size());
+				top_id_vecs_.resize(param.layer_size());
+				bottom_need_backward_.resize(param.layer_size());
+			}
 			const LayerParameter& layer_param = param.layer(layer_id);
-			layers_.push_back(LayerRegistry::CreateLayer(layer_param));
+			layers_.push_back(layer);
 			layer_names_.push_back(layer_param.name());
 			LOG(INFO) << "Creating Layer " << layer_param.name();
 			bool need_backward = false;
 
 			// Figure out this layer's input and output
+			if (channel_layout && layer_param.top_size() == 1 &&
+				channel_layout->copies().count(layer_param.top(0))) {
+				// the NCHW copy reads again a blob that layers read blocked
+				available_blobs.insert(layer_param.bottom(0));
+			}
 			for (int bottom_id = 0; bottom_id < layer_param.bottom_size();
 				++bottom_id) {
 				const int blob_id = AppendBottom(param, layer_id, bottom_id,
@@ -189,6 +250,12 @@ namespace caffe {
 		}
 		
 		// In the end, all remaining blobs are considered output blobs.
+		if (channel_layout) {
+			for (set<string>::const_iterator it = channel_layout->copies().begin();
+				it != channel_layout->copies().end(); ++it) {
+				available_blobs.erase(*it);
+			}
+		}
 		for (set<string>::iterator it = available_blobs.begin();
 			it != available_blobs.end(); ++it) {
 			LOG(INFO) << "This network produces output " << *it;
@@ -198,8 +265,40 @@ namespace caffe {
 		for (size_t blob_id = 0; blob_id < blob_names_.size(); ++blob_id) {
 			blob_names_index_[blob_names_[blob_id]] = blob_id;
 		}
+		if (channel_layout) {
+			// the names of the net description find the NCHW blob they end in
+			const map<string, string> channel_blob_names = channel_layout->BlobNames();
+			for (map<string, string>::const_iterator it = channel_blob_names.begin();
+				it != channel_blob_names.end(); ++it) {
+				blob_names_index_[it->first] = blob_names_index_[it->second];
+			}
+		}
+		layer_scope_names_.resize(layer_names_.size());
 		for (size_t layer_id = 0; layer_id < layer_names_.size(); ++layer_id) {
-			layer_names_index_[layer_names_[layer_id]] = layer_id;
+			// the first of layers with the same name gets the trained weights
+			layer_names_index_.insert(std::make_pair(layer_names_[layer_id],
+				static_cast<int>(layer_id)));
+			layer_scope_names_[layer_id] =
+				layer_names_[layer_id] + " (" + layers_[layer_id]->type() + ")";
+		}
+		FindConcatViews();
+		ShareConcatBlobs();
+		ShareSplitBlobs();
+		layer_fused_into_.assign(layers_.size(), -1);
+		if (param.fuse_layers()) {
+			FuseEpilogues();
+		}
+		ShareResidualBlobs();
+		parallel_branches_ = param.parallel_branches();
+		ShareTempBlobs();
+		optimize_memory_ = param.optimize_memory();
+		if (optimize_memory_) {
+			AnalyzeMemory();
+			PlanMemory();
+		}
+		warmed_up_ = false;
+		if (parallel_branches_) {
+			BuildLayerGraph();
 		}
 		LOG(INFO) << "Network initialization done.";
 	}
@@ -373,15 +472,233 @@ namespace caffe {
 		CHECK_GE(start, 0);
 		CHECK_LT(end, layers_.size());
 		real_t loss = 0;
+		ThreadPool* pool = NULL;
+		// the first pass allocates the memory of the net on this thread
+		if (parallel_branches_ && warmed_up_ && Caffe::mode() == Caffe::CPU) {
+			pool = Caffe::thread_pool();
+		}
+		// A fused residual adds onto its shortcut in place, so a range may
+		// start between the shortcut and the Convolution only while the sum is
+		// not done, and between the Convolution and the Eltwise once it is.
+		for (int r = 0; r < residual_views_.size(); ++r) {
+			const int eltwise_id = residual_views_[r].first;
+			const int conv_id = layer_fused_into_[eltwise_id];
+			if (start > residual_producers_[r] && start <= conv_id) {
+				CHECK(!residual_summed_[r]) << "Cannot forward from "
+					<< layer_names_[start] << ", " << layer_names_[conv_id]
+					<< " already added its output onto the shortcut of "
+					<< layer_names_[eltwise_id] << ", forward from "
+					<< layer_names_[residual_producers_[r]] << " or before";
+			} else if (start > conv_id && start <= eltwise_id) {
+				CHECK(residual_summed_[r]) << "Cannot forward from "
+					<< layer_names_[start] << ", " << layer_names_[eltwise_id]
+					<< " is fused into " << layer_names_[conv_id]
+					<< ", forward from there or before";
+			}
+			if (start <= conv_id && conv_id <= end) {
+				residual_summed_[r] = true;
+			} else if (start <= residual_producers_[r] &&
+				residual_producers_[r] <= end) {
+				residual_summed_[r] = false;
+			}
+		}
+		for (int i = start; i <= end && pool != NULL; ++i) {
+			// the graph doesn't know the epilogues run on their own
+			if (layer_fused(i) && layer_fused_into_[i] < start &&
+				layers_[i]->CanRunAsEpilogue()) {
+				pool = NULL;
+			}
+		}
+		if (pool != NULL) {
+			ForwardBranches(start, end, pool);
+			return loss;
+		}
 		for (int i = start; i <= end; ++i) {
 			// LOG(ERROR) << "Forwarding " << layer_names_[i];
 			real_t layer_loss = 0;
-			layers_[i]->Forward(bottom_vecs_[i], top_vecs_[i]);
+			// already run by the layer it is fused into, a residual Eltwise
+			// also before the range, see above
+			if (layer_fused(i) && (layer_fused_into_[i] >= start ||
+				!layers_[i]->CanRunAsEpilogue())) {
+				continue;
+			}
+			ForwardLayer(i);
 			loss += layer_loss;
 		}
+		if (start == 0 && end == layers_.size() - 1) {
+			warmed_up_ = true;
+		}
 		return loss;
 	}
 
+	void Net::ForwardLayer(int i) {
+		Profiler* profiler = Profiler::Get();
+		const bool profiling = profiler->IsRunning();
+		if (profiling) {
+			const LayerCost cost = layer_cost(i);
+			std::ostringstream args;
+			args << "{\"macs\": " << cost.macs
+				<< ", \"bytes_read\": " << cost.bytes_read
+				<< ", \"bytes_written\": " << cost.bytes_written
+				<< ", \"macs_per_byte\": " << static_cast<double>(cost.macs) /
+				std::max<int64_t>(cost.bytes_read + cost.bytes_written, 1) << "}";
+			profiler->ScopeStart(layer_scope_names_[i].c_str(), args.str().c_str());
+		}
+		layers_[i]->Forward(bottom_vecs_[i], top_vecs_[i]);
+		if (profiling) {
+#ifdef USE_CUDA
+			// kernels run asynchronously, wait for them to time the layer
+			if (Caffe::mode() == Caffe::GPU) {
+				CUDA_CHECK(cudaDeviceSynchronize());
+			}
+#endif  // USE_CUDA
+			profiler->ScopeEnd();
+		}
+	}
+
+	void Net::ForwardBranches(int start, int end, ThreadPool* pool) {
+		// predecessors of every layer in [start, end] not run yet
+		vector<int> num_waiting(layers_.size(), 0);
+		int remaining = 0;
+		for (int i = start; i <= end; ++i) {
+			if (layer_fused(i)) continue;
+			++remaining;
+			for (int next : layer_successors_[i]) {
+				if (next <= end) {
+					++num_waiting[next];
+				}
+			}
+		}
+		std::deque<int> ready;
+		for (int i = start; i <= end; ++i) {
+			if (!layer_fused(i) && num_waiting[i] == 0) {
+				ready.push_back(i);
+			}
+		}
+		auto finish = [&](int i) {
+			--remaining;
+			for (int next : layer_successors_[i]) {
+				if (next <= end && --num_waiting[next] == 0) {
+					ready.push_back(next);
+				}
+			}
+		};
+		std::mutex mutex;
+		std::condition_variable cv;
+		int running = 0;
+		bool failed = false;
+		// Every thread of the pool takes ready layers until the net narrows
+		// down to a single branch again, which then runs here and may spread
+		// its layers over the pool itself.
+		auto run_branches = [&](int, int) {
+			std::unique_lock<std::mutex> lock(mutex);
+			while (!failed && remaining > 0 && (running > 0 || ready.size() > 1)) {
+				if (ready.empty()) {
+					cv.wait(lock);
+					continue;
+				}
+				const int i = ready.front();
+				ready.pop_front();
+				++running;
+				lock.unlock();
+				try {
+					ForwardLayer(i);
+				}
+				catch (...) {
+					lock.lock();
+					failed = true;
+					--running;
+					cv.notify_all();
+					throw;
+				}
+				lock.lock();
+				--running;
+				finish(i);
+				cv.notify_all();
+			}
+		};
+		while (remaining > 0) {
+			if (ready.size() == 1) {
+				const int i = ready.front();
+				ready.pop_front();
+				ForwardLayer(i);
+				finish(i);
+			}
+			else {
+				pool->Run(0, pool->num_threads(), 1, run_branches);
+			}
+		}
+	}
+
+	void Net::BuildLayerGraph() {
+		// Layers depend on each other through the memory they touch rather than
+		// through blob names, so blobs sharing memory by PlanMemory, Concat
+		// views or residual sums keep the order in which they are used. A layer
+		// reads its bottoms and writes its tops and temporary blobs.
+		struct Access {
+			int layer_id;
+			int begin, end;
+			bool write;
+		};
+		std::map<const SyncedMemory*, vector<Access> > accesses;
+		layer_successors_.assign(layers_.size(), vector<int>());
+		for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+			// epilogues run inside the layer they are fused into
+			if (layer_fused_into_[layer_id] >= 0) continue;
+			vector<std::pair<Blob*, bool> > blobs;
+			for (Blob* blob : bottom_vecs_[layer_id]) {
+				blobs.push_back(std::make_pair(blob, false));
+			}
+			for (Blob* blob : top_vecs_[layer_id]) {
+				blobs.push_back(std::make_pair(blob, true));
+			}
+			for (Blob* blob : layers_[layer_id]->GetTempBlobs()) {
+				blobs.push_back(std::make_pair(blob, true));
+			}
+			set<int> predecessors;
+			for (const auto& blob : blobs) {
+				if (blob.first->count() == 0) continue;
+				Access access = { layer_id, blob.first->data_offset(),
+					blob.first->data_offset() + blob.first->count(), blob.second };
+				vector<Access>& memory = accesses[blob.first->data().get()];
+				// the latest access first, a write covering the whole range
+				// already comes after all earlier ones
+				for (int k = static_cast<int>(memory.size()) - 1; k >= 0; --k) {
+					const Access& other = memory[k];
+					if (other.layer_id == layer_id || other.end <= access.begin ||
+						access.end <= other.begin || !(other.write || access.write)) {
+						continue;
+					}
+					predecessors.insert(other.layer_id);
+					if (other.write && other.begin <= access.begin &&
+						access.end <= other.end) {
+						break;
+					}
+				}
+				memory.push_back(access);
+			}
+			for (int predecessor : predecessors) {
+				layer_successors_[predecessor].push_back(layer_id);
+			}
+		}
+	}
+
+	bool Net::layer_fused(int i) const {
+		// activations are only run as epilogues in CPU mode
+		return layer_fused_into_[i] >= 0 && (Caffe::mode() == Caffe::CPU ||
+			!layers_[i]->CanRunAsEpilogue());
+	}
+
+	LayerCost Net::layer_cost(int i) const {
+		CHECK_GE(i, 0) << "Invalid layer id";
+		CHECK_LT(i, layers_.size()) << "Invalid layer id";
+		if (layer_fused(i)) {
+			LayerCost cost = { 0, 0, 0 };
+			return cost;
+		}
+		return layers_[i]->GetCost(bottom_vecs_[i], top_vecs_[i]);
+	}
+
 	const vector<Blob*>& Net::Forward(real_t* loss) {
 		if (loss != NULL) {
 			*loss = ForwardFromTo(0, layers_.size() - 1);
@@ -397,22 +714,508 @@ namespace caffe {
 		for (int i = 0; i < layers_.size(); ++i) {
 			layers_[i]->Reshape(bottom_vecs_[i], top_vecs_[i]);
 		}
+		ShareConcatBlobs();
+		ShareSplitBlobs();
+		ShareResidualBlobs();
+		ShareTempBlobs();
+		if (optimize_memory_) {
+			PlanMemory();
+		}
+		warmed_up_ = false;
+		if (parallel_branches_) {
+			BuildLayerGraph();
+		}
+	}
+
+	void Net::AnalyzeMemory() {
+		// Layers like Reshape or single-input Concat share the data of their
+		// bottom right after SetUp, so the blobs holding the same SyncedMemory
+		// form one group and live as long as the longest living of them.
+		map<SyncedMemory*, int> memory_to_id;
+		blob_memory_ids_.assign(blobs_.size(), -1);
+		for (int blob_id = 0; blob_id < blobs_.size(); ++blob_id) {
+			if (blobs_[blob_id]->count() == 0) {
+				continue;
+			}
+			SyncedMemory* memory = blobs_[blob_id]->data().get();
+			if (memory_to_id.find(memory) == memory_to_id.end()) {
+				const int memory_id = memory_to_id.size();
+				memory_to_id[memory] = memory_id;
+			}
+			blob_memory_ids_[blob_id] = memory_to_id[memory];
+		}
+		// Net inputs are filled before Forward and outputs are read after it,
+		// memory shared with parameters holds the weights, so all of them
+		// must keep their own memory.
+		set<int> pinned;
+		for (int i = 0; i < net_input_blob_indices_.size(); ++i) {
+			pinned.insert(blob_memory_ids_[net_input_blob_indices_[i]]);
+		}
+		for (int i = 0; i < net_output_blob_indices_.size(); ++i) {
+			pinned.insert(blob_memory_ids_[net_output_blob_indices_[i]]);
+		}
+		for (int i = 0; i < params_.size(); ++i) {
+			if (params_[i]->count() == 0) {
+				continue;
+			}
+			map<SyncedMemory*, int>::iterator it =
+				memory_to_id.find(params_[i]->data().get());
+			if (it != memory_to_id.end()) {
+				pinned.insert(it->second);
+			}
+		}
+		for (int blob_id = 0; blob_id < blobs_.size(); ++blob_id) {
+			if (pinned.count(blob_memory_ids_[blob_id])) {
+				blob_memory_ids_[blob_id] = -1;
+			}
+		}
+	}
+
+	void Net::PlanMemory() {
+		int num_groups = 0;
+		for (int blob_id = 0; blob_id < blobs_.size(); ++blob_id) {
+			num_groups = max(num_groups, blob_memory_ids_[blob_id] + 1);
+		}
+		// Concat inputs that can't stay in the Concat output after a Reshape
+		// got their own memory and form a group of their own.
+		vector<int> memory_ids(blob_memory_ids_);
+		for (int i = 0; i < concat_views_.size(); ++i) {
+			const int layer_id = concat_views_[i].first;
+			const int top_id = top_id_vecs_[layer_id][0];
+			const int blob_id = bottom_id_vecs_[layer_id][concat_views_[i].second];
+			if (blobs_[blob_id]->count() == 0) {
+				continue;
+			}
+			if (blobs_[blob_id]->data() == blobs_[top_id]->data()) {
+				memory_ids[blob_id] = memory_ids[top_id];
+			}
+			else {
+				memory_ids[blob_id] = num_groups++;
+			}
+		}
+		vector<size_t> group_size(num_groups, 0);
+		for (int blob_id = 0; blob_id < blobs_.size(); ++blob_id) {
+			const int group = memory_ids[blob_id];
+			if (group >= 0) {
+				const Blob* blob = blobs_[blob_id].get();
+				group_size[group] = max(group_size[group],
+					(blob->data_offset() + blob->count()) * sizeof(real_t));
+			}
+		}
+		// The last layer touching each group, after which its memory is free.
+		vector<int> last_use(num_groups, -1);
+		for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+			for (int i = 0; i < bottom_id_vecs_[layer_id].size(); ++i) {
+				const int group = memory_ids[bottom_id_vecs_[layer_id][i]];
+				if (group >= 0) last_use[group] = layer_id;
+			}
+			for (int i = 0; i < top_id_vecs_[layer_id].size(); ++i) {
+				const int group = memory_ids[top_id_vecs_[layer_id][i]];
+				if (group >= 0) last_use[group] = layer_id;
+			}
+		}
+		// Walk the layers in execution order, every group takes the smallest
+		// free region that fits when it is first written (or grows the largest
+		// one), and gives the region back after its last use.
+		vector<size_t> region_size;
+		multimap<size_t, int> free_regions;
+		vector<int> group_region(num_groups, -1);
+		vector<bool> released(num_groups, false);
+		for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+			for (int i = 0; i < top_id_vecs_[layer_id].size(); ++i) {
+				const int group = memory_ids[top_id_vecs_[layer_id][i]];
+				if (group < 0 || group_region[group] >= 0) {
+					continue;
+				}
+				const size_t size = group_size[group];
+				multimap<size_t, int>::iterator it = free_regions.lower_bound(size);
+				if (it == free_regions.end() && !free_regions.empty()) {
+					--it;
+				}
+				if (it != free_regions.end()) {
+					group_region[group] = it->second;
+					region_size[it->second] = max(region_size[it->second], size);
+					free_regions.erase(it);
+				}
+				else {
+					group_region[group] = region_size.size();
+					region_size.push_back(size);
+				}
+			}
+			vector<int> used_ids(bottom_id_vecs_[layer_id]);
+			used_ids.insert(used_ids.end(), top_id_vecs_[layer_id].begin(),
+				top_id_vecs_[layer_id].end());
+			for (int i = 0; i < used_ids.size(); ++i) {
+				const int group = memory_ids[used_ids[i]];
+				if (group < 0 || last_use[group] != layer_id ||
+					group_region[group] < 0 || released[group]) {
+					continue;
+				}
+				const int region = group_region[group];
+				free_regions.insert(make_pair(region_size[region], region));
+				released[group] = true;
+			}
+		}
+		vector<shared_ptr<SyncedMemory> > regions(region_size.size());
+		size_t memory_planned = 0;
+		for (int region = 0; region < region_size.size(); ++region) {
+			regions[region].reset(new SyncedMemory(region_size[region]));
+			memory_planned += region_size[region];
+		}
+		size_t memory_total = 0;
+		for (int group = 0; group < num_groups; ++group) {
+			memory_total += group_size[group];
+		}
+		for (int blob_id = 0; blob_id < blobs_.size(); ++blob_id) {
+			const int group = memory_ids[blob_id];
+			if (group >= 0 && group_region[group] >= 0) {
+				blobs_[blob_id]->ShareData(regions[group_region[group]],
+					blobs_[blob_id]->data_offset());
+			}
+		}
+		LOG(INFO) << "Memory required for intermediate data: " << memory_total
+			<< ", reduced to " << memory_planned << " by sharing";
+	}
+
+	void Net::ShareSplitBlobs() {
+		// A top written in place by a later layer must keep its own copy,
+		// otherwise every other branch would see the change.
+		set<int> in_place_blobs;
+		for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+			const vector<int>& bottom_ids = bottom_id_vecs_[layer_id];
+			for (int i = 0; i < top_id_vecs_[layer_id].size(); ++i) {
+				const int blob_id = top_id_vecs_[layer_id][i];
+				if (find(bottom_ids.begin(), bottom_ids.end(), blob_id) !=
+					bottom_ids.end()) {
+					in_place_blobs.insert(blob_id);
+				}
+			}
+		}
+		for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+			if (layers_[layer_id]->layer_param().type() != "Split" ||
+				bottom_vecs_[layer_id][0]->count() == 0) {
+				continue;
+			}
+			for (int i = 0; i < top_vecs_[layer_id].size(); ++i) {
+				if (!in_place_blobs.count(top_id_vecs_[layer_id][i])) {
+					top_vecs_[layer_id][i]->ShareData(*bottom_vecs_[layer_id][0]);
+				}
+			}
+		}
+	}
+
+	void Net::FuseEpilogues() {
+		// Only in-place activations are fused: they are the sole reader of the
+		// blob version their producer writes (InsertSplits sees to that), so the
+		// producer may apply them to its output while it is still in cache.
+		layer_fused_into_.assign(layers_.size(), -1);
+		residual_views_.clear();
+		residual_blob_ids_.clear();
+		residual_producers_.clear();
+		residual_summed_.clear();
+		// the last layer writing each blob that is not fused itself
+		vector<int> producer(blobs_.size(), -1);
+		for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+			const vector<int>& bottom_ids = bottom_id_vecs_[layer_id];
+			const vector<int>& top_ids = top_id_vecs_[layer_id];
+			Layer* layer = layers_[layer_id].get();
+			if (layer->layer_param().type() == "Eltwise" &&
+				FuseResidual(layer_id, producer)) {
+				// a ReLU on the sum may follow as epilogue of the Convolution
+				producer[top_ids[0]] = layer_fused_into_[layer_id];
+				continue;
+			}
+			if (layer->CanRunAsEpilogue() && bottom_ids.size() == 1 &&
+				top_ids.size() == 1 && bottom_ids[0] == top_ids[0] &&
+				producer[bottom_ids[0]] >= 0) {
+				const int producer_id = producer[bottom_ids[0]];
+				Layer* producer_layer = layers_[producer_id].get();
+				if (producer_layer->AcceptsEpilogue() &&
+					top_id_vecs_[producer_id].size() == 1) {
+					LOG(INFO) << "Fusing " << layer_names_[layer_id] << " into "
+						<< layer_names_[producer_id];
+					producer_layer->AddEpilogue(layer);
+					layer_fused_into_[layer_id] = producer_id;
+					continue;
+				}
+			}
+			for (int i = 0; i < top_ids.size(); ++i) {
+				producer[top_ids[i]] = layer_id;
+			}
+		}
+	}
+
+	bool Net::FuseResidual(int layer_id, const vector<int>& producer) {
+		const EltwiseParameter& eltwise_param =
+			layers_[layer_id]->layer_param().eltwise_param();
+		const vector<int>& bottom_ids = bottom_id_vecs_[layer_id];
+		const int top_id = top_id_vecs_[layer_id][0];
+		if (eltwise_param.operation() != EltwiseParameter_EltwiseOp_SUM ||
+			bottom_ids.size() != 2 || bottom_ids[0] == bottom_ids[1] ||
+			find(bottom_ids.begin(), bottom_ids.end(), top_id) != bottom_ids.end()) {
+			return false;
+		}
+		for (int i = 0; i < eltwise_param.coeff_size(); ++i) {
+			if (eltwise_param.coeff(i) != 1) {
+				return false;
+			}
+		}
+		// The input written last is fused, the shortcut is ready by then.
+		const int input = producer[bottom_ids[1]] > producer[bottom_ids[0]] ? 1 : 0;
+		const int conv_id = producer[bottom_ids[input]];
+		const int conv_top_id = bottom_ids[input];
+		const int shortcut_id = bottom_ids[1 - input];
+		if (conv_id < 0 || !layers_[conv_id]->AcceptsResidual() ||
+			layers_[conv_id]->has_epilogues() || top_id_vecs_[conv_id].size() != 1 ||
+			blobs_[shortcut_id]->count() == 0 || blobs_[top_id]->count() == 0) {
+			return false;
+		}
+		// Concat views keep their place in the Concat output.
+		for (int i = 0; i < concat_views_.size(); ++i) {
+			const int blob_id =
+				bottom_id_vecs_[concat_views_[i].first][concat_views_[i].second];
+			if (blob_id == shortcut_id || blob_id == top_id) {
+				return false;
+			}
+		}
+		// The Convolution output must have memory of its own. Nothing but the
+		// Eltwise may touch the shortcut memory from the Convolution on, and
+		// nothing may touch the Eltwise output memory before the Eltwise, it
+		// moves onto the shortcut memory together with the output.
+		const SyncedMemory* conv_memory = blobs_[conv_top_id]->data().get();
+		const SyncedMemory* shortcut_memory = blobs_[shortcut_id]->data().get();
+		const SyncedMemory* top_memory = blobs_[top_id]->data().get();
+		vector<bool> in_shortcut(blobs_.size(), false);
+		vector<int> blob_ids(1, conv_top_id);
+		for (int blob_id = 0; blob_id < blobs_.size(); ++blob_id) {
+			if (blobs_[blob_id]->count() == 0) {
+				continue;
+			}
+			const SyncedMemory* memory = blobs_[blob_id]->data().get();
+			if (memory == conv_memory && blob_id != conv_top_id) {
+				return false;
+			}
+			in_shortcut[blob_id] = memory == shortcut_memory;
+			if (memory == top_memory) {
+				blob_ids.push_back(blob_id);
+			}
+		}
+		for (int i = 0; i < net_input_blob_indices_.size(); ++i) {
+			if (in_shortcut[net_input_blob_indices_[i]]) {
+				return false;
+			}
+		}
+		// the first layer writing the shortcut memory, or the one it is fused into
+		int shortcut_producer = -1;
+		for (int j = 0; j < layers_.size(); ++j) {
+			if (j == layer_id) {
+				continue;
+			}
+			vector<int> blob_ids_j(bottom_id_vecs_[j]);
+			blob_ids_j.insert(blob_ids_j.end(), top_id_vecs_[j].begin(),
+				top_id_vecs_[j].end());
+			for (int i = 0; i < blob_ids_j.size(); ++i) {
+				const int blob_id = blob_ids_j[i];
+				if ((in_shortcut[blob_id] && j >= conv_id) || (j < layer_id &&
+					find(blob_ids.begin() + 1, blob_ids.end(), blob_id) != blob_ids.end())) {
+					return false;
+				}
+				if (shortcut_producer < 0 && in_shortcut[blob_id] &&
+					i >= bottom_id_vecs_[j].size()) {
+					shortcut_producer = layer_fused_into_[j] >= 0 ? layer_fused_into_[j] : j;
+				}
+			}
+		}
+		if (shortcut_producer < 0) {
+			return false;
+		}
+		LOG(INFO) << "Fusing " << layer_names_[layer_id] << " into "
+			<< layer_names_[conv_id];
+		layers_[conv_id]->AccumulateTop();
+		layer_fused_into_[layer_id] = conv_id;
+		residual_views_.push_back(make_pair(layer_id, 1 - input));
+		residual_blob_ids_.push_back(blob_ids);
+		residual_producers_.push_back(shortcut_producer);
+		residual_summed_.push_back(false);
+		return true;
+	}
+
+	void Net::ShareResidualBlobs() {
+		// In order, so a shortcut moved by an earlier residual is in place.
+		for (int i = 0; i < residual_views_.size(); ++i) {
+			const Blob* shortcut =
+				bottom_vecs_[residual_views_[i].first][residual_views_[i].second];
+			if (shortcut->count() == 0) {
+				continue;
+			}
+			for (int j = 0; j < residual_blob_ids_[i].size(); ++j) {
+				blobs_[residual_blob_ids_[i][j]]->ShareData(*shortcut);
+			}
+		}
+	}
+
+	void Net::FindConcatViews() {
+		// Only a blob with memory of its own, written by earlier layers (the
+		// first of which is no Split, see ShareSplitBlobs) and read by nothing
+		// but the Concat and in-place layers may live in the Concat output.
+		map<SyncedMemory*, int> memory_users;
+		for (int blob_id = 0; blob_id < blobs_.size(); ++blob_id) {
+			if (blobs_[blob_id]->count() > 0) {
+				++memory_users[blobs_[blob_id]->data().get()];
+			}
+		}
+		for (int i = 0; i < params_.size(); ++i) {
+			if (params_[i]->count() > 0) {
+				++memory_users[params_[i]->data().get()];
+			}
+		}
+		set<int> net_inputs(net_input_blob_indices_.begin(),
+			net_input_blob_indices_.end());
+		concat_views_.clear();
+		// Outer Concats first, so nested Concats end up in the outermost output.
+		for (int layer_id = layers_.size() - 1; layer_id >= 0; --layer_id) {
+			if (layers_[layer_id]->layer_param().type() != "Concat" ||
+				bottom_vecs_[layer_id].size() == 1) {
+				continue;
+			}
+			for (int i = 0; i < bottom_id_vecs_[layer_id].size(); ++i) {
+				const int blob_id = bottom_id_vecs_[layer_id][i];
+				const Blob* blob = blobs_[blob_id].get();
+				if (blob->count() == 0 || net_inputs.count(blob_id) ||
+					memory_users[blob->data().get()] != 1) {
+					continue;
+				}
+				int producer = -1;
+				bool viewable = true;
+				for (int j = 0; j < layers_.size() && viewable; ++j) {
+					const vector<int>& bottom_ids = bottom_id_vecs_[j];
+					const vector<int>& top_ids = top_id_vecs_[j];
+					const int reads = count(bottom_ids.begin(), bottom_ids.end(), blob_id);
+					const bool writes =
+						find(top_ids.begin(), top_ids.end(), blob_id) != top_ids.end();
+					if (j == layer_id) {
+						viewable = reads == 1 && !writes;
+					}
+					else if (reads > 0 || writes) {
+						viewable = writes && j < layer_id;
+					}
+					if (writes && producer < 0) {
+						producer = j;
+					}
+				}
+				if (viewable && producer >= 0 &&
+					layers_[producer]->layer_param().type() != "Split") {
+					concat_views_.push_back(make_pair(layer_id, i));
+				}
+			}
+		}
+	}
+
+	void Net::ShareConcatBlobs() {
+		// When the Concat axis is the outermost non-trivial one, every input
+		// is a contiguous part of the output and its producer can write there
+		// directly. ConcatLayer skips the copy of such inputs.
+		for (int i = 0; i < concat_views_.size(); ++i) {
+			const int layer_id = concat_views_[i].first;
+			const int index = concat_views_[i].second;
+			const vector<Blob*>& bottom = bottom_vecs_[layer_id];
+			Blob* top = top_vecs_[layer_id][0];
+			Blob* blob = bottom[index];
+			if (blob->count() == 0) {
+				continue;
+			}
+			const ConcatParameter& concat_param =
+				layers_[layer_id]->layer_param().concat_param();
+			const int axis = concat_param.has_concat_dim() ?
+				static_cast<int>(concat_param.concat_dim()) :
+				top->CanonicalAxisIndex(concat_param.axis());
+			if (top->count(0, axis) == 1) {
+				int offset = 0;
+				for (int j = 0; j < index; ++j) {
+					offset += bottom[j]->count();
+				}
+				blob->ShareData(*top, offset);
+			}
+			else if (blob->data() == top->data()) {
+				blob->ShareData(shared_ptr<SyncedMemory>(
+					new SyncedMemory(blob->count() * sizeof(real_t))));
+			}
+		}
+	}
+
+	void Net::ShareTempBlobs() {
+		if (parallel_branches_) {
+			// layers of different branches may run at the same time
+			size_t memory_total = 0;
+			for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+				for (Blob* blob : layers_[layer_id]->GetTempBlobs()) {
+					if (blob->count() > 0) {
+						blob->ShareData(shared_ptr<SyncedMemory>(
+							new SyncedMemory(blob->count() * sizeof(real_t))));
+						memory_total += blob->count() * sizeof(real_t);
+					}
+				}
+			}
+			if (memory_total > 0) {
+				LOG(INFO) << "Memory required for temporary data: " << memory_total;
+			}
+			return;
+		}
+		// Layers run one after another, so the k-th largest temporary blob of
+		// every layer can live in the same workspace, sized for the largest
+		// of them. Blobs of a single layer never overlap.
+		vector<vector<Blob*> > temp_blobs(layers_.size());
+		vector<size_t> workspace_size;
+		size_t memory_total = 0;
+		for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+			vector<Blob*>& blobs = temp_blobs[layer_id];
+			blobs = layers_[layer_id]->GetTempBlobs();
+			sort(blobs.begin(), blobs.end(), [](const Blob* a, const Blob* b) {
+				return a->count() > b->count();
+			});
+			for (int k = 0; k < blobs.size(); ++k) {
+				const size_t size = blobs[k]->count() * sizeof(real_t);
+				if (k == workspace_size.size()) {
+					workspace_size.push_back(0);
+				}
+				workspace_size[k] = max(workspace_size[k], size);
+				memory_total += size;
+			}
+		}
+		vector<shared_ptr<SyncedMemory> > workspaces(workspace_size.size());
+		size_t memory_shared = 0;
+		for (int k = 0; k < workspace_size.size(); ++k) {
+			workspaces[k].reset(new SyncedMemory(workspace_size[k]));
+			memory_shared += workspace_size[k];
+		}
+		for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+			const vector<Blob*>& blobs = temp_blobs[layer_id];
+			for (int k = 0; k < blobs.size(); ++k) {
+				if (blobs[k]->count() > 0) {
+					blobs[k]->ShareData(workspaces[k]);
+				}
+			}
+		}
+		if (memory_total > 0) {
+			LOG(INFO) << "Memory required for temporary data: " << memory_total
+				<< ", reduced to " << memory_shared << " by sharing";
+		}
 	}
 
 	void Net::CopyTrainedLayersFrom(const NetParameter& param) {
+		LoadScope scope("Copy weights");
 		int num_source_layers = param.layer_size();
+		vector<std::pair<Blob*, const BlobProto*> > copies;
 		for (int i = 0; i < num_source_layers; ++i) {
 			const LayerParameter& source_layer = param.layer(i);
 			const string& source_layer_name = source_layer.name();
-			int target_layer_id = 0;
-			while (target_layer_id != layer_names_.size() &&
-				layer_names_[target_layer_id] != source_layer_name) {
-				++target_layer_id;
-			}
-			if (target_layer_id == layer_names_.size()) {
+			map<string, int>::const_iterator target =
+				layer_names_index_.find(source_layer_name);
+			if (target == layer_names_index_.end()) {
 				LOG(INFO) << "Ignoring source layer " << source_layer_name;
 				continue;
 			}
+			const int target_layer_id = target->second;
 			DLOG(INFO) << "Copying source layer " << source_layer_name;
 			vector<shared_ptr<Blob > >& target_blobs =
 				layers_[target_layer_id]->blobs();
@@ -430,21 +1233,129 @@ namespace caffe {
 						<< "To learn this layer's parameters from scratch rather than "
 						<< "copying from a saved net, rename the layer.";
 				}
-				const bool kReshape = false;
-				target_blobs[j]->FromProto(source_layer.blobs(j), kReshape);
+				// allocate here, copies may run on other threads
+				const BlobProto& source_blob = source_layer.blobs(j);
+				if (source_blob.has_int8_data()) {
+					// int8 replaces the memory of the blob with a smaller one
+					target_blobs[j]->FromProto(source_blob, false);
+					continue;
+				}
+				if (target_blobs[j]->is_int8()) {
+					target_blobs[j]->ReshapeLike(*target_blobs[j]);
+				}
+				target_blobs[j]->mutable_cpu_data();
+				if (source_blob.diff_size() > 0 || source_blob.double_diff_size() > 0) {
+					target_blobs[j]->mutable_cpu_diff();
+				}
+				copies.push_back(std::make_pair(target_blobs[j].get(), &source_blob));
+			}
+		}
+		parallel_for(0, copies.size(), [&](int begin, int end) {
+			const bool kReshape = false;
+			for (int k = begin; k < end; ++k) {
+				copies[k].first->FromProto(*copies[k].second, kReshape);
+			}
+		});
+	}
+
+	void Net::ShareTrainedLayersWith(const Net* other) {
+		LoadScope scope("Share weights");
+		for (int i = 0; i < other->layers().size(); ++i) {
+			Layer* source_layer = other->layers()[i].get();
+			const string& source_layer_name = other->layer_names()[i];
+			map<string, int>::const_iterator target =
+				layer_names_index_.find(source_layer_name);
+			if (target == layer_names_index_.end()) {
+				LOG(INFO) << "Ignoring source layer " << source_layer_name;
+				continue;
+			}
+			const int target_layer_id = target->second;
+			DLOG(INFO) << "Sharing source layer " << source_layer_name;
+			vector<shared_ptr<Blob > >& target_blobs =
+				layers_[target_layer_id]->blobs();
+			CHECK_EQ(target_blobs.size(), source_layer->blobs().size())
+				<< "Incompatible number of blobs for layer " << source_layer_name;
+			for (int j = 0; j < target_blobs.size(); ++j) {
+				const Blob* source_blob = source_layer->blobs()[j].get();
+				CHECK(target_blobs[j]->shape() == source_blob->shape())
+					<< "Cannot share param " << j << " weights from layer '"
+					<< source_layer_name << "'; shape mismatch.  Source param shape is "
+					<< source_blob->shape_string() << "; target param shape is "
+					<< target_blobs[j]->shape_string();
+#ifdef USE_CUDA
+				// copy to the device now, not by the first nets running at once
+				if (Caffe::mode() == Caffe::GPU) {
+					source_blob->gpu_data();
+				}
+#endif  // USE_CUDA
+				target_blobs[j]->ShareData(*source_blob);
 			}
 		}
 	}
 
 	void Net::CopyTrainedLayersFrom(const string trained_filename) {
-		CopyTrainedLayersFromBinaryProto(trained_filename);
+		if (IsFlatWeightsFile(trained_filename)) {
+			CopyTrainedLayersFromFlat(trained_filename);
+		}
+		else {
+			CopyTrainedLayersFromBinaryProto(trained_filename);
+		}
+	}
+
+	// Flat weights keep the 4-D shape legacy BlobProto dimensions were read
+	// as, which matches like in Blob::ShapeEquals: (1 x 1 x M x N) for M x N.
+	static bool FlatShapeEquals(const Blob& target, const Blob& source) {
+		if (target.shape() == source.shape()) {
+			return true;
+		}
+		return source.num_axes() == 4 && target.num_axes() <= 4 &&
+			target.LegacyShape(-4) == source.shape(0) &&
+			target.LegacyShape(-3) == source.shape(1) &&
+			target.LegacyShape(-2) == source.shape(2) &&
+			target.LegacyShape(-1) == source.shape(3);
+	}
+
+	void Net::CopyTrainedLayersFromFlat(const string trained_filename) {
+		LoadScope scope("Map weights");
+		vector<FlatLayer> source_layers = ReadFlatWeights(trained_filename);
+		for (int i = 0; i < source_layers.size(); ++i) {
+			const FlatLayer& source_layer = source_layers[i];
+			const string& source_layer_name = source_layer.name;
+			map<string, int>::const_iterator target =
+				layer_names_index_.find(source_layer_name);
+			if (target == layer_names_index_.end()) {
+				LOG(INFO) << "Ignoring source layer " << source_layer_name;
+				continue;
+			}
+			const int target_layer_id = target->second;
+			DLOG(INFO) << "Mapping source layer " << source_layer_name;
+			vector<shared_ptr<Blob > >& target_blobs =
+				layers_[target_layer_id]->blobs();
+			CHECK_EQ(target_blobs.size(), source_layer.blobs.size())
+				<< "Incompatible number of blobs for layer " << source_layer_name;
+			for (int j = 0; j < target_blobs.size(); ++j) {
+				const Blob* source_blob = source_layer.blobs[j].get();
+				CHECK(FlatShapeEquals(*target_blobs[j], *source_blob))
+					<< "Cannot copy param " << j << " weights from layer '"
+					<< source_layer_name << "'; shape mismatch.  Source param shape is "
+					<< source_blob->shape_string() << "; target param shape is "
+					<< target_blobs[j]->shape_string();
+				// the target keeps its shape over the mapped data
+				if (source_blob->count() > 0) {
+					target_blobs[j]->ShareData(*source_blob);
+				}
+			}
+		}
 	}
 
 	 
 	void Net::CopyTrainedLayersFromBinaryProto(
 		const string trained_filename) {
 		NetParameter param;
-		ReadNetParamsFromBinaryFileOrDie(trained_filename, &param);
+		{
+			LoadScope scope("Read weights");
+			ReadNetParamsFromBinaryFileOrDie(trained_filename, &param);
+		}
 		CopyTrainedLayersFrom(param);
 	}
 
@@ -486,5 +1397,130 @@ namespace caffe {
 
 //////////////////////
 
+	int FoldBatchNorm(const string& param_file, const string& trained_file,
+		const string& out_param_file, const string& out_trained_file) {
+		NetParameter param, trained_param;
+		ReadNetParamsFromTextFileOrDie(param_file, &param);
+		ReadNetParamsFromBinaryFileOrDie(trained_file, &trained_param);
+		// Attach the trained blobs to the layers, the folding works on both.
+		map<string, const LayerParameter*> trained_layers;
+		for (int i = 0; i < trained_param.layer_size(); ++i) {
+			trained_layers[trained_param.layer(i).name()] = &trained_param.layer(i);
+		}
+		for (int i = 0; i < param.layer_size(); ++i) {
+			LayerParameter* layer_param = param.mutable_layer(i);
+			map<string, const LayerParameter*>::iterator it =
+				trained_layers.find(layer_param->name());
+			if (it != trained_layers.end()) {
+				layer_param->mutable_blobs()->CopyFrom(it->second->blobs());
+			}
+		}
+		NetParameter folded_param;
+		const int num_folded = FoldBatchNorm(param, &folded_param);
+		WriteProtoToBinaryFile(folded_param, out_trained_file);
+		for (int i = 0; i < folded_param.layer_size(); ++i) {
+			folded_param.mutable_layer(i)->clear_blobs();
+		}
+		WriteProtoToTextFile(folded_param, out_param_file);
+		LOG(INFO) << "Folded " << num_folded << " layers";
+		return num_folded;
+	}
+
+	void ConvertToFlatWeights(const string& trained_file,
+		const string& out_trained_file) {
+		NetParameter trained_param;
+		ReadNetParamsFromBinaryFileOrDie(trained_file, &trained_param);
+		WriteFlatWeights(trained_param, out_trained_file);
+	}
+
+	int CalibrateInt8(const string& param_file, const string& trained_file,
+		const vector<string>& input_files, const string& out_param_file,
+		const string& out_trained_file) {
+		NetParameter param;
+		ReadNetParamsFromTextFileOrDie(param_file, &param);
+		for (int i = 0; i < param.layer_size(); ++i) {
+			param.mutable_layer(i)->clear_quantization_param();
+		}
+		Net net(param);
+		net.CopyTrainedLayersFrom(trained_file);
+		CHECK_EQ(net.num_inputs(), 1) << "CalibrateInt8 takes samples of a single "
+			<< "input, " << param_file << " has " << net.num_inputs();
+		// range of the input of each layer to quantize, over all of the inputs
+		map<string, pair<real_t, real_t> > ranges;
+		for (size_t k = 0; k < input_files.size(); ++k) {
+			BlobProto input;
+			ReadProtoFromBinaryFileOrDie(input_files[k], &input);
+			net.input_blobs()[0]->FromProto(input);
+			net.Reshape();
+			// a layer at a time to see the inputs before they are overwritten
+			for (int i = 0; i < net.layers().size(); ++i) {
+				if (net.layer_fused(i)) continue;
+				const string type = net.layers()[i]->type();
+				if (type == "Convolution" || type == "ConvolutionDepthwise" ||
+					type == "InnerProduct") {
+					const Blob* bottom = net.bottom_vecs()[i][0];
+					const real_t* data = bottom->cpu_data();
+					pair<real_t, real_t> range(data[0], data[0]);
+					for (int j = 1; j < bottom->count(); ++j) {
+						range.first = std::min(range.first, data[j]);
+						range.second = std::max(range.second, data[j]);
+					}
+					const string& name = net.layer_names()[i];
+					if (k > 0) {
+						range.first = std::min(range.first, ranges[name].first);
+						range.second = std::max(range.second, ranges[name].second);
+					}
+					ranges[name] = range;
+				}
+				net.ForwardFromTo(i, i);
+			}
+		}
+		int num_quantized = 0;
+		set<string> quantized;
+		for (int i = 0; i < param.layer_size(); ++i) {
+			LayerParameter* layer_param = param.mutable_layer(i);
+			map<string, pair<real_t, real_t> >::iterator it =
+				ranges.find(layer_param->name());
+			if (it == ranges.end()) continue;
+			// uint8 from 0 for inputs that are never negative, as after a ReLU
+			const real_t low = it->second.first, high = it->second.second;
+			const int zero_point = low >= 0 ? 0 : 128;
+			const real_t scale = zero_point == 0 ? high / 255 :
+				std::max(-low, high) / 127;
+			if (scale > 0) {
+				QuantizationParameter* quantization =
+					layer_param->mutable_quantization_param();
+				quantization->set_bottom_scale(scale);
+				quantization->set_bottom_zero_point(zero_point);
+				++num_quantized;
+				// the weights of a transposed gemm are quantized when first used
+				if (layer_param->type() != "InnerProduct" ||
+					!layer_param->inner_product_param().transpose()) {
+					quantized.insert(layer_param->name());
+				}
+			}
+		}
+		WriteProtoToTextFile(param, out_param_file);
+		// the weights as loaded, in int8 for the quantized layers
+		NetParameter trained_param;
+		for (int i = 0; i < net.layers().size(); ++i) {
+			const vector<shared_ptr<Blob> >& blobs = net.layers()[i]->blobs();
+			if (blobs.empty()) continue;
+			LayerParameter* layer_param = trained_param.add_layer();
+			layer_param->set_name(net.layer_names()[i]);
+			layer_param->set_type(net.layers()[i]->type());
+			for (int j = 0; j < blobs.size(); ++j) {
+				if (j == 0 && quantized.count(layer_param->name())) {
+					QuantizeWeights(*blobs[j], layer_param->add_blobs());
+				}
+				else {
+					blobs[j]->ToProto(layer_param->add_blobs());
+				}
+			}
+		}
+		WriteProtoToBinaryFile(trained_param, out_trained_file);
+		LOG(INFO) << "Quantized " << num_quantized << " layers";
+		return num_quantized;
+	}
 
 }  // namespace caffe
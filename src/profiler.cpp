@@ -8,12 +8,30 @@
 
 #include <fstream>
 
+#include "./thread_local.hpp"
+
 namespace caffe {
 
+struct Profiler::ThreadProfile {
+  /*! \brief tid in the dump */
+  int tid;
+  /*! \brief scope stack for nested scope */
+  std::vector<Scope> scope_stack;
+  /*! \brief all scopes used in profile, not including scopes in stack */
+  std::vector<Scope> scopes;
+
+  ThreadProfile() {
+    scope_stack.reserve(10);
+    scopes.reserve(1024);
+    Profiler *profiler = Profiler::Get();
+    std::lock_guard<std::mutex> lock(profiler->mutex_);
+    tid = static_cast<int>(profiler->threads_.size());
+    profiler->threads_.push_back(this);
+  }
+};
+
 Profiler::Profiler()
     : init_(Now()), state_(kNotRunning) {
-  scope_stack_.reserve(10);
-  scopes_.reserve(1024);
 }
 
 Profiler *Profiler::Get() {
@@ -21,27 +39,54 @@ Profiler *Profiler::Get() {
   return &inst;
 }
 
-void Profiler::ScopeStart(const char *name) {
+Profiler::ThreadProfile *Profiler::GetThreadProfile() {
+  return ThreadLocalStore<ThreadProfile>::Get();
+}
+
+void Profiler::TurnON() {
+  State expected = kNotRunning;
+  CHECK(state_.compare_exchange_strong(expected, kRunning))
+      << "Profile is already running.";
+}
+
+void Profiler::TurnOFF() {
+  const ThreadProfile *thread = GetThreadProfile();
+  CHECK(thread->scope_stack.empty())
+      << "Profile scope stack is not empty, with size = "
+      << thread->scope_stack.size();
+  State expected = kRunning;
+  CHECK(state_.compare_exchange_strong(expected, kNotRunning))
+      << "Profile is not running.";
+}
+
+void Profiler::ScopeStart(const char *name, const char *args) {
   if (state_ == kNotRunning) return;
-  ScopePtr scope(new Scope);
-  if (!scope_stack_.empty()) {
-    scope->name = scope_stack_.back()->name + ":" + name;
+  ThreadProfile *thread = GetThreadProfile();
+  Scope scope;
+  if (!thread->scope_stack.empty()) {
+    scope.name = thread->scope_stack.back().name + ":" + name;
   }
   else{
-    scope->name = name;
+    scope.name = name;
+  }
+  if (args != NULL) {
+    scope.args = args;
   }
-  scope->start_microsec = Now() - init_;
-  scope_stack_.push_back(scope);
+  scope.start_microsec = Now() - init_;
+  thread->scope_stack.push_back(scope);
 }
 
 void Profiler::ScopeEnd() {
-  if (state_ == kNotRunning) return;
-  CHECK(!scope_stack_.empty());
-  ScopePtr current_scope = scope_stack_.back();
-  current_scope->end_microsec = Now() - init_;
-  scopes_.push_back(current_scope);
+  ThreadProfile *thread = GetThreadProfile();
+  if (thread->scope_stack.empty()) {
+    CHECK_EQ(state_.load(), kNotRunning);
+    return;
+  }
+  Scope &current_scope = thread->scope_stack.back();
+  current_scope.end_microsec = Now() - init_;
+  thread->scopes.push_back(current_scope);
   // pop stack
-  scope_stack_.pop_back();
+  thread->scope_stack.pop_back();
 }
 
 uint64_t Profiler::Now() const {
@@ -59,20 +104,31 @@ uint64_t Profiler::Now() const {
 static void ProfilerWriteEvent(std::ofstream &file,
                               const char *name,
                               const char *ph,
-                              uint64_t ts) {
+                              uint64_t ts,
+                              int tid,
+                              const std::string &args = "") {
   file << "    {" << std::endl;
   file << "      \"name\": \"" << name << "\"," << std::endl;
   file << "      \"cat\": \"category\"," << std::endl;
   file << "      \"ph\": \"" << ph << "\"," << std::endl;
   file << "      \"ts\": " << ts << "," << std::endl;
   file << "      \"pid\": 0," << std::endl;
-  file << "      \"tid\": 0" << std::endl;
+  file << "      \"tid\": " << tid;
+  if (!args.empty()) {
+    file << "," << std::endl;
+    file << "      \"args\": " << args;
+  }
+  file << std::endl;
   file << "    }";
 }
 
 void Profiler::DumpProfile(const char *fn) const {
-  CHECK(scope_stack_.empty());
-  CHECK_EQ(state_, kNotRunning);
+  CHECK_EQ(state_.load(), kNotRunning);
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto thread : threads_) {
+    CHECK(thread->scope_stack.empty())
+        << "Profile scope stack of thread " << thread->tid << " is not empty";
+  }
 
   std::ofstream file;
   file.open(fn);
@@ -80,17 +136,21 @@ void Profiler::DumpProfile(const char *fn) const {
   file << "  \"traceEvents\": [";
 
   bool is_first = true;
-  for (auto scope : scopes_) {
-    if (is_first) {
-      file << std::endl;
-      is_first = false;
-    }
-    else {
+  for (auto thread : threads_) {
+    for (const Scope &scope : thread->scopes) {
+      if (is_first) {
+        file << std::endl;
+        is_first = false;
+      }
+      else {
+        file << "," << std::endl;
+      }
+      ProfilerWriteEvent(file, scope.name.c_str(), "B", scope.start_microsec,
+                         thread->tid, scope.args);
       file << "," << std::endl;
+      ProfilerWriteEvent(file, scope.name.c_str(), "E", scope.end_microsec,
+                         thread->tid);
     }
-    ProfilerWriteEvent(file, scope->name.c_str(), "B", scope->start_microsec);
-    file << "," << std::endl;
-    ProfilerWriteEvent(file, scope->name.c_str(), "E", scope->end_microsec);
   }
 
   file << "  ]," << std::endl;
@@ -0,0 +1,24401 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: caffe.proto
+
+#include "caffe.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace caffe {
+PROTOBUF_CONSTEXPR BlobShape::BlobShape(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dim_)*/{}
+  , /*decltype(_impl_._dim_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlobShapeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlobShapeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlobShapeDefaultTypeInternal() {}
+  union {
+    BlobShape _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlobShapeDefaultTypeInternal _BlobShape_default_instance_;
+PROTOBUF_CONSTEXPR BlobProto::BlobProto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{}
+  , /*decltype(_impl_.diff_)*/{}
+  , /*decltype(_impl_.double_data_)*/{}
+  , /*decltype(_impl_.double_diff_)*/{}
+  , /*decltype(_impl_.int8_scale_)*/{}
+  , /*decltype(_impl_.int8_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shape_)*/nullptr
+  , /*decltype(_impl_.num_)*/0
+  , /*decltype(_impl_.channels_)*/0
+  , /*decltype(_impl_.height_)*/0
+  , /*decltype(_impl_.width_)*/0} {}
+struct BlobProtoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlobProtoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlobProtoDefaultTypeInternal() {}
+  union {
+    BlobProto _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlobProtoDefaultTypeInternal _BlobProto_default_instance_;
+PROTOBUF_CONSTEXPR BlobProtoVector::BlobProtoVector(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.blobs_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlobProtoVectorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlobProtoVectorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlobProtoVectorDefaultTypeInternal() {}
+  union {
+    BlobProtoVector _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlobProtoVectorDefaultTypeInternal _BlobProtoVector_default_instance_;
+PROTOBUF_CONSTEXPR NormalizedBBox::NormalizedBBox(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.xmin_)*/0
+  , /*decltype(_impl_.ymin_)*/0
+  , /*decltype(_impl_.xmax_)*/0
+  , /*decltype(_impl_.ymax_)*/0
+  , /*decltype(_impl_.label_)*/0
+  , /*decltype(_impl_.difficult_)*/false
+  , /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_.size_)*/0} {}
+struct NormalizedBBoxDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NormalizedBBoxDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NormalizedBBoxDefaultTypeInternal() {}
+  union {
+    NormalizedBBox _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NormalizedBBoxDefaultTypeInternal _NormalizedBBox_default_instance_;
+PROTOBUF_CONSTEXPR FillerParameter::FillerParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.type_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_.min_)*/0
+  , /*decltype(_impl_.mean_)*/0
+  , /*decltype(_impl_.variance_norm_)*/0
+  , /*decltype(_impl_.sparse_)*/-1
+  , /*decltype(_impl_.max_)*/1
+  , /*decltype(_impl_.std_)*/1} {}
+struct FillerParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FillerParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FillerParameterDefaultTypeInternal() {}
+  union {
+    FillerParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FillerParameterDefaultTypeInternal _FillerParameter_default_instance_;
+PROTOBUF_CONSTEXPR NetParameter::NetParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.layers_)*/{}
+  , /*decltype(_impl_.input_)*/{}
+  , /*decltype(_impl_.input_dim_)*/{}
+  , /*decltype(_impl_.input_shape_)*/{}
+  , /*decltype(_impl_.layer_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.state_)*/nullptr
+  , /*decltype(_impl_.force_backward_)*/false
+  , /*decltype(_impl_.debug_info_)*/false
+  , /*decltype(_impl_.optimize_memory_)*/false
+  , /*decltype(_impl_.parallel_branches_)*/false
+  , /*decltype(_impl_.channel_block_)*/0u
+  , /*decltype(_impl_.fuse_layers_)*/false} {}
+struct NetParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetParameterDefaultTypeInternal() {}
+  union {
+    NetParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetParameterDefaultTypeInternal _NetParameter_default_instance_;
+PROTOBUF_CONSTEXPR NetState::NetState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.stage_)*/{}
+  , /*decltype(_impl_.level_)*/0
+  , /*decltype(_impl_.phase_)*/1} {}
+struct NetStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetStateDefaultTypeInternal() {}
+  union {
+    NetState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetStateDefaultTypeInternal _NetState_default_instance_;
+PROTOBUF_CONSTEXPR NetStateRule::NetStateRule(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.stage_)*/{}
+  , /*decltype(_impl_.not_stage_)*/{}
+  , /*decltype(_impl_.phase_)*/0
+  , /*decltype(_impl_.min_level_)*/0
+  , /*decltype(_impl_.max_level_)*/0} {}
+struct NetStateRuleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetStateRuleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetStateRuleDefaultTypeInternal() {}
+  union {
+    NetStateRule _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetStateRuleDefaultTypeInternal _NetStateRule_default_instance_;
+PROTOBUF_CONSTEXPR ParamSpec::ParamSpec(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.share_mode_)*/0
+  , /*decltype(_impl_.lr_mult_)*/1
+  , /*decltype(_impl_.decay_mult_)*/1} {}
+struct ParamSpecDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ParamSpecDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ParamSpecDefaultTypeInternal() {}
+  union {
+    ParamSpec _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ParamSpecDefaultTypeInternal _ParamSpec_default_instance_;
+PROTOBUF_CONSTEXPR LayerParameter::LayerParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.bottom_)*/{}
+  , /*decltype(_impl_.top_)*/{}
+  , /*decltype(_impl_.loss_weight_)*/{}
+  , /*decltype(_impl_.param_)*/{}
+  , /*decltype(_impl_.blobs_)*/{}
+  , /*decltype(_impl_.include_)*/{}
+  , /*decltype(_impl_.exclude_)*/{}
+  , /*decltype(_impl_.propagate_down_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.loss_param_)*/nullptr
+  , /*decltype(_impl_.argmax_param_)*/nullptr
+  , /*decltype(_impl_.batch_norm_param_)*/nullptr
+  , /*decltype(_impl_.bias_param_)*/nullptr
+  , /*decltype(_impl_.bn_param_)*/nullptr
+  , /*decltype(_impl_.concat_param_)*/nullptr
+  , /*decltype(_impl_.convolution_param_)*/nullptr
+  , /*decltype(_impl_.crop_param_)*/nullptr
+  , /*decltype(_impl_.dropout_param_)*/nullptr
+  , /*decltype(_impl_.eltwise_param_)*/nullptr
+  , /*decltype(_impl_.elu_param_)*/nullptr
+  , /*decltype(_impl_.embed_param_)*/nullptr
+  , /*decltype(_impl_.exp_param_)*/nullptr
+  , /*decltype(_impl_.flatten_param_)*/nullptr
+  , /*decltype(_impl_.inner_product_param_)*/nullptr
+  , /*decltype(_impl_.input_param_)*/nullptr
+  , /*decltype(_impl_.log_param_)*/nullptr
+  , /*decltype(_impl_.lrn_param_)*/nullptr
+  , /*decltype(_impl_.mvn_param_)*/nullptr
+  , /*decltype(_impl_.parameter_param_)*/nullptr
+  , /*decltype(_impl_.pooling_param_)*/nullptr
+  , /*decltype(_impl_.power_param_)*/nullptr
+  , /*decltype(_impl_.prelu_param_)*/nullptr
+  , /*decltype(_impl_.proposal_param_)*/nullptr
+  , /*decltype(_impl_.psroi_pooling_param_)*/nullptr
+  , /*decltype(_impl_.reduction_param_)*/nullptr
+  , /*decltype(_impl_.relu_param_)*/nullptr
+  , /*decltype(_impl_.reshape_param_)*/nullptr
+  , /*decltype(_impl_.roi_pooling_param_)*/nullptr
+  , /*decltype(_impl_.scale_param_)*/nullptr
+  , /*decltype(_impl_.sigmoid_param_)*/nullptr
+  , /*decltype(_impl_.softmax_param_)*/nullptr
+  , /*decltype(_impl_.spp_param_)*/nullptr
+  , /*decltype(_impl_.slice_param_)*/nullptr
+  , /*decltype(_impl_.tanh_param_)*/nullptr
+  , /*decltype(_impl_.threshold_param_)*/nullptr
+  , /*decltype(_impl_.tile_param_)*/nullptr
+  , /*decltype(_impl_.detection_output_param_)*/nullptr
+  , /*decltype(_impl_.permute_param_)*/nullptr
+  , /*decltype(_impl_.prior_box_param_)*/nullptr
+  , /*decltype(_impl_.shuffle_channel_param_)*/nullptr
+  , /*decltype(_impl_.norm_param_)*/nullptr
+  , /*decltype(_impl_.reorder_param_)*/nullptr
+  , /*decltype(_impl_.quantization_param_)*/nullptr
+  , /*decltype(_impl_.phase_)*/0} {}
+struct LayerParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LayerParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LayerParameterDefaultTypeInternal() {}
+  union {
+    LayerParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LayerParameterDefaultTypeInternal _LayerParameter_default_instance_;
+PROTOBUF_CONSTEXPR LossParameter::LossParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ignore_label_)*/0
+  , /*decltype(_impl_.normalize_)*/false
+  , /*decltype(_impl_.normalization_)*/1} {}
+struct LossParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LossParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LossParameterDefaultTypeInternal() {}
+  union {
+    LossParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LossParameterDefaultTypeInternal _LossParameter_default_instance_;
+PROTOBUF_CONSTEXPR ArgMaxParameter::ArgMaxParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.out_max_val_)*/false
+  , /*decltype(_impl_.axis_)*/0
+  , /*decltype(_impl_.top_k_)*/1u} {}
+struct ArgMaxParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ArgMaxParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ArgMaxParameterDefaultTypeInternal() {}
+  union {
+    ArgMaxParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ArgMaxParameterDefaultTypeInternal _ArgMaxParameter_default_instance_;
+PROTOBUF_CONSTEXPR ConcatParameter::ConcatParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.concat_dim_)*/1u
+  , /*decltype(_impl_.axis_)*/1} {}
+struct ConcatParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConcatParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConcatParameterDefaultTypeInternal() {}
+  union {
+    ConcatParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConcatParameterDefaultTypeInternal _ConcatParameter_default_instance_;
+PROTOBUF_CONSTEXPR BatchNormParameter::BatchNormParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.use_global_stats_)*/false
+  , /*decltype(_impl_.moving_average_fraction_)*/0.999f
+  , /*decltype(_impl_.eps_)*/1e-05f} {}
+struct BatchNormParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchNormParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchNormParameterDefaultTypeInternal() {}
+  union {
+    BatchNormParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchNormParameterDefaultTypeInternal _BatchNormParameter_default_instance_;
+PROTOBUF_CONSTEXPR BiasParameter::BiasParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.filler_)*/nullptr
+  , /*decltype(_impl_.axis_)*/1
+  , /*decltype(_impl_.num_axes_)*/1} {}
+struct BiasParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BiasParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BiasParameterDefaultTypeInternal() {}
+  union {
+    BiasParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BiasParameterDefaultTypeInternal _BiasParameter_default_instance_;
+PROTOBUF_CONSTEXPR BNParameter::BNParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.slope_filler_)*/nullptr
+  , /*decltype(_impl_.bias_filler_)*/nullptr
+  , /*decltype(_impl_.frozen_)*/false
+  , /*decltype(_impl_.engine_)*/0
+  , /*decltype(_impl_.momentum_)*/0.9f
+  , /*decltype(_impl_.eps_)*/1e-05f} {}
+struct BNParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BNParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BNParameterDefaultTypeInternal() {}
+  union {
+    BNParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BNParameterDefaultTypeInternal _BNParameter_default_instance_;
+PROTOBUF_CONSTEXPR ConvolutionParameter::ConvolutionParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.pad_)*/{}
+  , /*decltype(_impl_.kernel_size_)*/{}
+  , /*decltype(_impl_.stride_)*/{}
+  , /*decltype(_impl_.dilation_)*/{}
+  , /*decltype(_impl_.weight_filler_)*/nullptr
+  , /*decltype(_impl_.bias_filler_)*/nullptr
+  , /*decltype(_impl_.num_output_)*/0u
+  , /*decltype(_impl_.pad_h_)*/0u
+  , /*decltype(_impl_.pad_w_)*/0u
+  , /*decltype(_impl_.kernel_h_)*/0u
+  , /*decltype(_impl_.kernel_w_)*/0u
+  , /*decltype(_impl_.stride_h_)*/0u
+  , /*decltype(_impl_.stride_w_)*/0u
+  , /*decltype(_impl_.engine_)*/0
+  , /*decltype(_impl_.force_nd_im2col_)*/false
+  , /*decltype(_impl_.winograd_tile_)*/0u
+  , /*decltype(_impl_.axis_)*/1
+  , /*decltype(_impl_.bias_term_)*/true
+  , /*decltype(_impl_.group_)*/1u} {}
+struct ConvolutionParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConvolutionParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConvolutionParameterDefaultTypeInternal() {}
+  union {
+    ConvolutionParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConvolutionParameterDefaultTypeInternal _ConvolutionParameter_default_instance_;
+PROTOBUF_CONSTEXPR CropParameter::CropParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.offset_)*/{}
+  , /*decltype(_impl_.axis_)*/2} {}
+struct CropParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CropParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CropParameterDefaultTypeInternal() {}
+  union {
+    CropParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CropParameterDefaultTypeInternal _CropParameter_default_instance_;
+PROTOBUF_CONSTEXPR DropoutParameter::DropoutParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.dropout_ratio_)*/0.5f} {}
+struct DropoutParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DropoutParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DropoutParameterDefaultTypeInternal() {}
+  union {
+    DropoutParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DropoutParameterDefaultTypeInternal _DropoutParameter_default_instance_;
+PROTOBUF_CONSTEXPR EltwiseParameter::EltwiseParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.coeff_)*/{}
+  , /*decltype(_impl_.operation_)*/1
+  , /*decltype(_impl_.stable_prod_grad_)*/true} {}
+struct EltwiseParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EltwiseParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EltwiseParameterDefaultTypeInternal() {}
+  union {
+    EltwiseParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EltwiseParameterDefaultTypeInternal _EltwiseParameter_default_instance_;
+PROTOBUF_CONSTEXPR ELUParameter::ELUParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.alpha_)*/1} {}
+struct ELUParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ELUParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ELUParameterDefaultTypeInternal() {}
+  union {
+    ELUParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ELUParameterDefaultTypeInternal _ELUParameter_default_instance_;
+PROTOBUF_CONSTEXPR EmbedParameter::EmbedParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.weight_filler_)*/nullptr
+  , /*decltype(_impl_.bias_filler_)*/nullptr
+  , /*decltype(_impl_.num_output_)*/0u
+  , /*decltype(_impl_.input_dim_)*/0u
+  , /*decltype(_impl_.bias_term_)*/true} {}
+struct EmbedParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EmbedParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EmbedParameterDefaultTypeInternal() {}
+  union {
+    EmbedParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EmbedParameterDefaultTypeInternal _EmbedParameter_default_instance_;
+PROTOBUF_CONSTEXPR ExpParameter::ExpParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.shift_)*/0
+  , /*decltype(_impl_.base_)*/-1
+  , /*decltype(_impl_.scale_)*/1} {}
+struct ExpParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExpParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExpParameterDefaultTypeInternal() {}
+  union {
+    ExpParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExpParameterDefaultTypeInternal _ExpParameter_default_instance_;
+PROTOBUF_CONSTEXPR FlattenParameter::FlattenParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.axis_)*/1
+  , /*decltype(_impl_.end_axis_)*/-1} {}
+struct FlattenParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FlattenParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FlattenParameterDefaultTypeInternal() {}
+  union {
+    FlattenParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FlattenParameterDefaultTypeInternal _FlattenParameter_default_instance_;
+PROTOBUF_CONSTEXPR InnerProductParameter::InnerProductParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.weight_filler_)*/nullptr
+  , /*decltype(_impl_.bias_filler_)*/nullptr
+  , /*decltype(_impl_.num_output_)*/0u
+  , /*decltype(_impl_.transpose_)*/false
+  , /*decltype(_impl_.bias_term_)*/true
+  , /*decltype(_impl_.axis_)*/1} {}
+struct InnerProductParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InnerProductParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InnerProductParameterDefaultTypeInternal() {}
+  union {
+    InnerProductParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InnerProductParameterDefaultTypeInternal _InnerProductParameter_default_instance_;
+PROTOBUF_CONSTEXPR InputParameter::InputParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.shape_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InputParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InputParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InputParameterDefaultTypeInternal() {}
+  union {
+    InputParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InputParameterDefaultTypeInternal _InputParameter_default_instance_;
+PROTOBUF_CONSTEXPR LogParameter::LogParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.shift_)*/0
+  , /*decltype(_impl_.base_)*/-1
+  , /*decltype(_impl_.scale_)*/1} {}
+struct LogParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogParameterDefaultTypeInternal() {}
+  union {
+    LogParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogParameterDefaultTypeInternal _LogParameter_default_instance_;
+PROTOBUF_CONSTEXPR LRNParameter::LRNParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.norm_region_)*/0
+  , /*decltype(_impl_.engine_)*/0
+  , /*decltype(_impl_.local_size_)*/5u
+  , /*decltype(_impl_.alpha_)*/1
+  , /*decltype(_impl_.beta_)*/0.75f
+  , /*decltype(_impl_.k_)*/1} {}
+struct LRNParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LRNParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LRNParameterDefaultTypeInternal() {}
+  union {
+    LRNParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LRNParameterDefaultTypeInternal _LRNParameter_default_instance_;
+PROTOBUF_CONSTEXPR MVNParameter::MVNParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.across_channels_)*/false
+  , /*decltype(_impl_.normalize_variance_)*/true
+  , /*decltype(_impl_.eps_)*/1e-09f} {}
+struct MVNParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MVNParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MVNParameterDefaultTypeInternal() {}
+  union {
+    MVNParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MVNParameterDefaultTypeInternal _MVNParameter_default_instance_;
+PROTOBUF_CONSTEXPR ParameterParameter::ParameterParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.shape_)*/nullptr} {}
+struct ParameterParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ParameterParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ParameterParameterDefaultTypeInternal() {}
+  union {
+    ParameterParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ParameterParameterDefaultTypeInternal _ParameterParameter_default_instance_;
+PROTOBUF_CONSTEXPR PoolingParameter::PoolingParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.pool_)*/0
+  , /*decltype(_impl_.kernel_size_)*/0u
+  , /*decltype(_impl_.pad_)*/0u
+  , /*decltype(_impl_.kernel_h_)*/0u
+  , /*decltype(_impl_.kernel_w_)*/0u
+  , /*decltype(_impl_.stride_h_)*/0u
+  , /*decltype(_impl_.stride_w_)*/0u
+  , /*decltype(_impl_.pad_h_)*/0u
+  , /*decltype(_impl_.pad_w_)*/0u
+  , /*decltype(_impl_.engine_)*/0
+  , /*decltype(_impl_.global_pooling_)*/false
+  , /*decltype(_impl_.stride_)*/1u} {}
+struct PoolingParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PoolingParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PoolingParameterDefaultTypeInternal() {}
+  union {
+    PoolingParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PoolingParameterDefaultTypeInternal _PoolingParameter_default_instance_;
+PROTOBUF_CONSTEXPR PowerParameter::PowerParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.shift_)*/0
+  , /*decltype(_impl_.power_)*/1
+  , /*decltype(_impl_.scale_)*/1} {}
+struct PowerParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PowerParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PowerParameterDefaultTypeInternal() {}
+  union {
+    PowerParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PowerParameterDefaultTypeInternal _PowerParameter_default_instance_;
+PROTOBUF_CONSTEXPR PReLUParameter::PReLUParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.filler_)*/nullptr
+  , /*decltype(_impl_.channel_shared_)*/false} {}
+struct PReLUParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PReLUParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PReLUParameterDefaultTypeInternal() {}
+  union {
+    PReLUParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PReLUParameterDefaultTypeInternal _PReLUParameter_default_instance_;
+PROTOBUF_CONSTEXPR ProposalParameter::ProposalParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ratio_)*/{}
+  , /*decltype(_impl_.scale_)*/{}
+  , /*decltype(_impl_.feat_stride_)*/16u
+  , /*decltype(_impl_.base_size_)*/16u
+  , /*decltype(_impl_.min_size_)*/16u
+  , /*decltype(_impl_.pre_nms_topn_)*/6000u
+  , /*decltype(_impl_.post_nms_topn_)*/300u
+  , /*decltype(_impl_.nms_thresh_)*/0.7f} {}
+struct ProposalParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProposalParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProposalParameterDefaultTypeInternal() {}
+  union {
+    ProposalParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProposalParameterDefaultTypeInternal _ProposalParameter_default_instance_;
+PROTOBUF_CONSTEXPR PSROIPoolingParameter::PSROIPoolingParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.spatial_scale_)*/0
+  , /*decltype(_impl_.output_dim_)*/0
+  , /*decltype(_impl_.group_size_)*/0} {}
+struct PSROIPoolingParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PSROIPoolingParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PSROIPoolingParameterDefaultTypeInternal() {}
+  union {
+    PSROIPoolingParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PSROIPoolingParameterDefaultTypeInternal _PSROIPoolingParameter_default_instance_;
+PROTOBUF_CONSTEXPR QuantizationParameter::QuantizationParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.bottom_scale_)*/0
+  , /*decltype(_impl_.bottom_zero_point_)*/128u} {}
+struct QuantizationParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QuantizationParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QuantizationParameterDefaultTypeInternal() {}
+  union {
+    QuantizationParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QuantizationParameterDefaultTypeInternal _QuantizationParameter_default_instance_;
+PROTOBUF_CONSTEXPR ReductionParameter::ReductionParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.axis_)*/0
+  , /*decltype(_impl_.operation_)*/1
+  , /*decltype(_impl_.coeff_)*/1} {}
+struct ReductionParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReductionParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReductionParameterDefaultTypeInternal() {}
+  union {
+    ReductionParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReductionParameterDefaultTypeInternal _ReductionParameter_default_instance_;
+PROTOBUF_CONSTEXPR ReLUParameter::ReLUParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.negative_slope_)*/0
+  , /*decltype(_impl_.engine_)*/0} {}
+struct ReLUParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReLUParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReLUParameterDefaultTypeInternal() {}
+  union {
+    ReLUParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReLUParameterDefaultTypeInternal _ReLUParameter_default_instance_;
+PROTOBUF_CONSTEXPR ReorderParameter::ReorderParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.bottom_channel_block_)*/0u
+  , /*decltype(_impl_.top_channel_block_)*/0u} {}
+struct ReorderParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReorderParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReorderParameterDefaultTypeInternal() {}
+  union {
+    ReorderParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReorderParameterDefaultTypeInternal _ReorderParameter_default_instance_;
+PROTOBUF_CONSTEXPR ReshapeParameter::ReshapeParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.shape_)*/nullptr
+  , /*decltype(_impl_.axis_)*/0
+  , /*decltype(_impl_.num_axes_)*/-1} {}
+struct ReshapeParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReshapeParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReshapeParameterDefaultTypeInternal() {}
+  union {
+    ReshapeParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReshapeParameterDefaultTypeInternal _ReshapeParameter_default_instance_;
+PROTOBUF_CONSTEXPR ROIPoolingParameter::ROIPoolingParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.pooled_h_)*/0u
+  , /*decltype(_impl_.pooled_w_)*/0u
+  , /*decltype(_impl_.spatial_scale_)*/1} {}
+struct ROIPoolingParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ROIPoolingParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ROIPoolingParameterDefaultTypeInternal() {}
+  union {
+    ROIPoolingParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ROIPoolingParameterDefaultTypeInternal _ROIPoolingParameter_default_instance_;
+PROTOBUF_CONSTEXPR ScaleParameter::ScaleParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.filler_)*/nullptr
+  , /*decltype(_impl_.bias_filler_)*/nullptr
+  , /*decltype(_impl_.bias_term_)*/false
+  , /*decltype(_impl_.axis_)*/1
+  , /*decltype(_impl_.num_axes_)*/1} {}
+struct ScaleParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScaleParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScaleParameterDefaultTypeInternal() {}
+  union {
+    ScaleParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScaleParameterDefaultTypeInternal _ScaleParameter_default_instance_;
+PROTOBUF_CONSTEXPR SigmoidParameter::SigmoidParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.engine_)*/0} {}
+struct SigmoidParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SigmoidParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SigmoidParameterDefaultTypeInternal() {}
+  union {
+    SigmoidParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SigmoidParameterDefaultTypeInternal _SigmoidParameter_default_instance_;
+PROTOBUF_CONSTEXPR SliceParameter::SliceParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.slice_point_)*/{}
+  , /*decltype(_impl_.slice_dim_)*/1u
+  , /*decltype(_impl_.axis_)*/1} {}
+struct SliceParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SliceParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SliceParameterDefaultTypeInternal() {}
+  union {
+    SliceParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SliceParameterDefaultTypeInternal _SliceParameter_default_instance_;
+PROTOBUF_CONSTEXPR SoftmaxParameter::SoftmaxParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.engine_)*/0
+  , /*decltype(_impl_.axis_)*/1} {}
+struct SoftmaxParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SoftmaxParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SoftmaxParameterDefaultTypeInternal() {}
+  union {
+    SoftmaxParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SoftmaxParameterDefaultTypeInternal _SoftmaxParameter_default_instance_;
+PROTOBUF_CONSTEXPR TanHParameter::TanHParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.engine_)*/0} {}
+struct TanHParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TanHParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TanHParameterDefaultTypeInternal() {}
+  union {
+    TanHParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TanHParameterDefaultTypeInternal _TanHParameter_default_instance_;
+PROTOBUF_CONSTEXPR TileParameter::TileParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tiles_)*/0
+  , /*decltype(_impl_.axis_)*/1} {}
+struct TileParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TileParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TileParameterDefaultTypeInternal() {}
+  union {
+    TileParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TileParameterDefaultTypeInternal _TileParameter_default_instance_;
+PROTOBUF_CONSTEXPR ThresholdParameter::ThresholdParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.threshold_)*/0} {}
+struct ThresholdParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ThresholdParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ThresholdParameterDefaultTypeInternal() {}
+  union {
+    ThresholdParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ThresholdParameterDefaultTypeInternal _ThresholdParameter_default_instance_;
+PROTOBUF_CONSTEXPR SPPParameter::SPPParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.pyramid_height_)*/0u
+  , /*decltype(_impl_.pool_)*/0
+  , /*decltype(_impl_.engine_)*/0} {}
+struct SPPParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SPPParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SPPParameterDefaultTypeInternal() {}
+  union {
+    SPPParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SPPParameterDefaultTypeInternal _SPPParameter_default_instance_;
+PROTOBUF_CONSTEXPR NonMaximumSuppressionParameter::NonMaximumSuppressionParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.top_k_)*/0
+  , /*decltype(_impl_.nms_threshold_)*/0.3f
+  , /*decltype(_impl_.eta_)*/1} {}
+struct NonMaximumSuppressionParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NonMaximumSuppressionParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NonMaximumSuppressionParameterDefaultTypeInternal() {}
+  union {
+    NonMaximumSuppressionParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NonMaximumSuppressionParameterDefaultTypeInternal _NonMaximumSuppressionParameter_default_instance_;
+PROTOBUF_CONSTEXPR SaveOutputParameter::SaveOutputParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.output_directory_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.output_name_prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.output_format_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.label_map_file_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_size_file_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.num_test_image_)*/0u} {}
+struct SaveOutputParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SaveOutputParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SaveOutputParameterDefaultTypeInternal() {}
+  union {
+    SaveOutputParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SaveOutputParameterDefaultTypeInternal _SaveOutputParameter_default_instance_;
+PROTOBUF_CONSTEXPR DetectionOutputParameter::DetectionOutputParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.save_file_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nms_param_)*/nullptr
+  , /*decltype(_impl_.save_output_param_)*/nullptr
+  , /*decltype(_impl_.num_classes_)*/0u
+  , /*decltype(_impl_.background_label_id_)*/0
+  , /*decltype(_impl_.confidence_threshold_)*/0
+  , /*decltype(_impl_.variance_encoded_in_target_)*/false
+  , /*decltype(_impl_.visualize_)*/false
+  , /*decltype(_impl_.visualize_threshold_)*/0
+  , /*decltype(_impl_.keep_top_k_)*/-1
+  , /*decltype(_impl_.share_location_)*/true
+  , /*decltype(_impl_.code_type_)*/1} {}
+struct DetectionOutputParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DetectionOutputParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DetectionOutputParameterDefaultTypeInternal() {}
+  union {
+    DetectionOutputParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DetectionOutputParameterDefaultTypeInternal _DetectionOutputParameter_default_instance_;
+PROTOBUF_CONSTEXPR PermuteParameter::PermuteParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.order_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PermuteParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PermuteParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PermuteParameterDefaultTypeInternal() {}
+  union {
+    PermuteParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PermuteParameterDefaultTypeInternal _PermuteParameter_default_instance_;
+PROTOBUF_CONSTEXPR PriorBoxParameter::PriorBoxParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.min_size_)*/{}
+  , /*decltype(_impl_.max_size_)*/{}
+  , /*decltype(_impl_.aspect_ratio_)*/{}
+  , /*decltype(_impl_.variance_)*/{}
+  , /*decltype(_impl_.clip_)*/false
+  , /*decltype(_impl_.img_size_)*/0u
+  , /*decltype(_impl_.img_h_)*/0u
+  , /*decltype(_impl_.img_w_)*/0u
+  , /*decltype(_impl_.step_)*/0
+  , /*decltype(_impl_.step_h_)*/0
+  , /*decltype(_impl_.step_w_)*/0
+  , /*decltype(_impl_.flip_)*/true
+  , /*decltype(_impl_.offset_)*/0.5f} {}
+struct PriorBoxParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PriorBoxParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PriorBoxParameterDefaultTypeInternal() {}
+  union {
+    PriorBoxParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PriorBoxParameterDefaultTypeInternal _PriorBoxParameter_default_instance_;
+PROTOBUF_CONSTEXPR ShuffleChannelParameter::ShuffleChannelParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.group_)*/1u} {}
+struct ShuffleChannelParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ShuffleChannelParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ShuffleChannelParameterDefaultTypeInternal() {}
+  union {
+    ShuffleChannelParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShuffleChannelParameterDefaultTypeInternal _ShuffleChannelParameter_default_instance_;
+PROTOBUF_CONSTEXPR NormalizeParameter::NormalizeParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.scale_filler_)*/nullptr
+  , /*decltype(_impl_.across_spatial_)*/true
+  , /*decltype(_impl_.channel_shared_)*/true
+  , /*decltype(_impl_.eps_)*/1e-10f} {}
+struct NormalizeParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NormalizeParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NormalizeParameterDefaultTypeInternal() {}
+  union {
+    NormalizeParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NormalizeParameterDefaultTypeInternal _NormalizeParameter_default_instance_;
+PROTOBUF_CONSTEXPR V1LayerParameter::V1LayerParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.bottom_)*/{}
+  , /*decltype(_impl_.top_)*/{}
+  , /*decltype(_impl_.blobs_)*/{}
+  , /*decltype(_impl_.blobs_lr_)*/{}
+  , /*decltype(_impl_.weight_decay_)*/{}
+  , /*decltype(_impl_.include_)*/{}
+  , /*decltype(_impl_.exclude_)*/{}
+  , /*decltype(_impl_.loss_weight_)*/{}
+  , /*decltype(_impl_.param_)*/{}
+  , /*decltype(_impl_.blob_share_mode_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.concat_param_)*/nullptr
+  , /*decltype(_impl_.convolution_param_)*/nullptr
+  , /*decltype(_impl_.dropout_param_)*/nullptr
+  , /*decltype(_impl_.inner_product_param_)*/nullptr
+  , /*decltype(_impl_.lrn_param_)*/nullptr
+  , /*decltype(_impl_.pooling_param_)*/nullptr
+  , /*decltype(_impl_.power_param_)*/nullptr
+  , /*decltype(_impl_.eltwise_param_)*/nullptr
+  , /*decltype(_impl_.threshold_param_)*/nullptr
+  , /*decltype(_impl_.relu_param_)*/nullptr
+  , /*decltype(_impl_.slice_param_)*/nullptr
+  , /*decltype(_impl_.mvn_param_)*/nullptr
+  , /*decltype(_impl_.tanh_param_)*/nullptr
+  , /*decltype(_impl_.sigmoid_param_)*/nullptr
+  , /*decltype(_impl_.softmax_param_)*/nullptr
+  , /*decltype(_impl_.exp_param_)*/nullptr
+  , /*decltype(_impl_.loss_param_)*/nullptr
+  , /*decltype(_impl_.type_)*/0} {}
+struct V1LayerParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR V1LayerParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~V1LayerParameterDefaultTypeInternal() {}
+  union {
+    V1LayerParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 V1LayerParameterDefaultTypeInternal _V1LayerParameter_default_instance_;
+}  // namespace caffe
+static ::_pb::Metadata file_level_metadata_caffe_2eproto[57];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_caffe_2eproto[21];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_caffe_2eproto = nullptr;
+
+const uint32_t TableStruct_caffe_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobShape, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobShape, _impl_.dim_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.shape_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.diff_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.double_data_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.double_diff_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.int8_data_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.int8_scale_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.num_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.channels_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProto, _impl_.width_),
+  1,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,
+  2,
+  3,
+  4,
+  5,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProtoVector, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::BlobProtoVector, _impl_.blobs_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _impl_.xmin_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _impl_.ymin_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _impl_.xmax_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _impl_.ymax_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _impl_.label_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _impl_.difficult_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _impl_.score_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizedBBox, _impl_.size_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _impl_.mean_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _impl_.std_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _impl_.sparse_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FillerParameter, _impl_.variance_norm_),
+  0,
+  1,
+  2,
+  6,
+  3,
+  7,
+  5,
+  4,
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.input_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.input_shape_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.input_dim_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.force_backward_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.debug_info_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.optimize_memory_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.parallel_branches_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.channel_block_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.fuse_layers_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.layer_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetParameter, _impl_.layers_),
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  2,
+  1,
+  3,
+  4,
+  5,
+  6,
+  7,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::caffe::NetState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::NetState, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetState, _impl_.level_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetState, _impl_.stage_),
+  1,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::caffe::NetStateRule, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetStateRule, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::NetStateRule, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetStateRule, _impl_.min_level_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetStateRule, _impl_.max_level_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetStateRule, _impl_.stage_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NetStateRule, _impl_.not_stage_),
+  0,
+  1,
+  2,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::caffe::ParamSpec, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ParamSpec, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ParamSpec, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ParamSpec, _impl_.share_mode_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ParamSpec, _impl_.lr_mult_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ParamSpec, _impl_.decay_mult_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.bottom_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.top_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.loss_weight_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.blobs_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.propagate_down_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.include_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.exclude_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.loss_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.argmax_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.batch_norm_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.bias_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.bn_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.concat_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.convolution_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.crop_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.dropout_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.eltwise_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.elu_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.embed_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.exp_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.flatten_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.inner_product_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.input_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.log_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.lrn_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.mvn_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.parameter_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.pooling_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.power_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.prelu_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.proposal_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.psroi_pooling_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.reduction_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.relu_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.reshape_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.roi_pooling_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.scale_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.sigmoid_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.softmax_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.spp_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.slice_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.tanh_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.threshold_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.tile_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.detection_output_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.permute_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.prior_box_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.shuffle_channel_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.norm_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.reorder_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LayerParameter, _impl_.quantization_param_),
+  0,
+  1,
+  ~0u,
+  ~0u,
+  46,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  17,
+  18,
+  19,
+  20,
+  21,
+  22,
+  23,
+  24,
+  25,
+  26,
+  27,
+  28,
+  29,
+  30,
+  31,
+  32,
+  33,
+  34,
+  35,
+  36,
+  37,
+  38,
+  39,
+  40,
+  41,
+  42,
+  43,
+  44,
+  45,
+  PROTOBUF_FIELD_OFFSET(::caffe::LossParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LossParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::LossParameter, _impl_.ignore_label_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LossParameter, _impl_.normalization_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LossParameter, _impl_.normalize_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::ArgMaxParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ArgMaxParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ArgMaxParameter, _impl_.out_max_val_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ArgMaxParameter, _impl_.top_k_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ArgMaxParameter, _impl_.axis_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::ConcatParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConcatParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ConcatParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConcatParameter, _impl_.concat_dim_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::BatchNormParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BatchNormParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::BatchNormParameter, _impl_.use_global_stats_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BatchNormParameter, _impl_.moving_average_fraction_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BatchNormParameter, _impl_.eps_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::caffe::BiasParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BiasParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::BiasParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BiasParameter, _impl_.num_axes_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BiasParameter, _impl_.filler_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::BNParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BNParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::BNParameter, _impl_.slope_filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BNParameter, _impl_.bias_filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BNParameter, _impl_.momentum_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BNParameter, _impl_.eps_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BNParameter, _impl_.frozen_),
+  PROTOBUF_FIELD_OFFSET(::caffe::BNParameter, _impl_.engine_),
+  0,
+  1,
+  4,
+  5,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.num_output_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.bias_term_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.pad_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.kernel_size_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.stride_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.dilation_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.pad_h_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.pad_w_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.kernel_h_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.kernel_w_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.stride_h_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.stride_w_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.group_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.weight_filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.bias_filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.engine_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.winograd_tile_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ConvolutionParameter, _impl_.force_nd_im2col_),
+  2,
+  13,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  14,
+  0,
+  1,
+  9,
+  11,
+  12,
+  10,
+  PROTOBUF_FIELD_OFFSET(::caffe::CropParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::CropParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::CropParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::CropParameter, _impl_.offset_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::caffe::DropoutParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DropoutParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::DropoutParameter, _impl_.dropout_ratio_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::EltwiseParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::EltwiseParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::EltwiseParameter, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::caffe::EltwiseParameter, _impl_.coeff_),
+  PROTOBUF_FIELD_OFFSET(::caffe::EltwiseParameter, _impl_.stable_prod_grad_),
+  0,
+  ~0u,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::ELUParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ELUParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ELUParameter, _impl_.alpha_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::EmbedParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::EmbedParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::EmbedParameter, _impl_.num_output_),
+  PROTOBUF_FIELD_OFFSET(::caffe::EmbedParameter, _impl_.input_dim_),
+  PROTOBUF_FIELD_OFFSET(::caffe::EmbedParameter, _impl_.bias_term_),
+  PROTOBUF_FIELD_OFFSET(::caffe::EmbedParameter, _impl_.weight_filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::EmbedParameter, _impl_.bias_filler_),
+  2,
+  3,
+  4,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::ExpParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ExpParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ExpParameter, _impl_.base_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ExpParameter, _impl_.scale_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ExpParameter, _impl_.shift_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::FlattenParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FlattenParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::FlattenParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::FlattenParameter, _impl_.end_axis_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::InnerProductParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::InnerProductParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::InnerProductParameter, _impl_.num_output_),
+  PROTOBUF_FIELD_OFFSET(::caffe::InnerProductParameter, _impl_.bias_term_),
+  PROTOBUF_FIELD_OFFSET(::caffe::InnerProductParameter, _impl_.weight_filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::InnerProductParameter, _impl_.bias_filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::InnerProductParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::InnerProductParameter, _impl_.transpose_),
+  2,
+  4,
+  0,
+  1,
+  5,
+  3,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::caffe::InputParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::InputParameter, _impl_.shape_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LogParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LogParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::LogParameter, _impl_.base_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LogParameter, _impl_.scale_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LogParameter, _impl_.shift_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::LRNParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LRNParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::LRNParameter, _impl_.local_size_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LRNParameter, _impl_.alpha_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LRNParameter, _impl_.beta_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LRNParameter, _impl_.norm_region_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LRNParameter, _impl_.k_),
+  PROTOBUF_FIELD_OFFSET(::caffe::LRNParameter, _impl_.engine_),
+  2,
+  3,
+  4,
+  0,
+  5,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::MVNParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::MVNParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::MVNParameter, _impl_.normalize_variance_),
+  PROTOBUF_FIELD_OFFSET(::caffe::MVNParameter, _impl_.across_channels_),
+  PROTOBUF_FIELD_OFFSET(::caffe::MVNParameter, _impl_.eps_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::caffe::ParameterParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ParameterParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ParameterParameter, _impl_.shape_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.pool_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.pad_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.pad_h_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.pad_w_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.kernel_size_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.kernel_h_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.kernel_w_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.stride_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.stride_h_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.stride_w_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.engine_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PoolingParameter, _impl_.global_pooling_),
+  0,
+  2,
+  7,
+  8,
+  1,
+  3,
+  4,
+  11,
+  5,
+  6,
+  9,
+  10,
+  PROTOBUF_FIELD_OFFSET(::caffe::PowerParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PowerParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::PowerParameter, _impl_.power_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PowerParameter, _impl_.scale_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PowerParameter, _impl_.shift_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::PReLUParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PReLUParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::PReLUParameter, _impl_.filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PReLUParameter, _impl_.channel_shared_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _impl_.feat_stride_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _impl_.base_size_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _impl_.min_size_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _impl_.ratio_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _impl_.scale_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _impl_.pre_nms_topn_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _impl_.post_nms_topn_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ProposalParameter, _impl_.nms_thresh_),
+  0,
+  1,
+  2,
+  ~0u,
+  ~0u,
+  3,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::caffe::PSROIPoolingParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PSROIPoolingParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::PSROIPoolingParameter, _impl_.spatial_scale_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PSROIPoolingParameter, _impl_.output_dim_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PSROIPoolingParameter, _impl_.group_size_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::caffe::QuantizationParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::QuantizationParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::QuantizationParameter, _impl_.bottom_scale_),
+  PROTOBUF_FIELD_OFFSET(::caffe::QuantizationParameter, _impl_.bottom_zero_point_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::ReductionParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReductionParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ReductionParameter, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReductionParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReductionParameter, _impl_.coeff_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::caffe::ReLUParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReLUParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ReLUParameter, _impl_.negative_slope_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReLUParameter, _impl_.engine_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::ReorderParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReorderParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ReorderParameter, _impl_.bottom_channel_block_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReorderParameter, _impl_.top_channel_block_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::ReshapeParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReshapeParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ReshapeParameter, _impl_.shape_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReshapeParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ReshapeParameter, _impl_.num_axes_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::caffe::ROIPoolingParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ROIPoolingParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ROIPoolingParameter, _impl_.pooled_h_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ROIPoolingParameter, _impl_.pooled_w_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ROIPoolingParameter, _impl_.spatial_scale_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::caffe::ScaleParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ScaleParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ScaleParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ScaleParameter, _impl_.num_axes_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ScaleParameter, _impl_.filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ScaleParameter, _impl_.bias_term_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ScaleParameter, _impl_.bias_filler_),
+  3,
+  4,
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::SigmoidParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SigmoidParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::SigmoidParameter, _impl_.engine_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::SliceParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SliceParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::SliceParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SliceParameter, _impl_.slice_point_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SliceParameter, _impl_.slice_dim_),
+  1,
+  ~0u,
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::SoftmaxParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SoftmaxParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::SoftmaxParameter, _impl_.engine_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SoftmaxParameter, _impl_.axis_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::caffe::TanHParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::TanHParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::TanHParameter, _impl_.engine_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::TileParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::TileParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::TileParameter, _impl_.axis_),
+  PROTOBUF_FIELD_OFFSET(::caffe::TileParameter, _impl_.tiles_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::ThresholdParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ThresholdParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ThresholdParameter, _impl_.threshold_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::SPPParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SPPParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::SPPParameter, _impl_.pyramid_height_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SPPParameter, _impl_.pool_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SPPParameter, _impl_.engine_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::caffe::NonMaximumSuppressionParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NonMaximumSuppressionParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::NonMaximumSuppressionParameter, _impl_.nms_threshold_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NonMaximumSuppressionParameter, _impl_.top_k_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NonMaximumSuppressionParameter, _impl_.eta_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::caffe::SaveOutputParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SaveOutputParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::SaveOutputParameter, _impl_.output_directory_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SaveOutputParameter, _impl_.output_name_prefix_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SaveOutputParameter, _impl_.output_format_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SaveOutputParameter, _impl_.label_map_file_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SaveOutputParameter, _impl_.name_size_file_),
+  PROTOBUF_FIELD_OFFSET(::caffe::SaveOutputParameter, _impl_.num_test_image_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.num_classes_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.share_location_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.background_label_id_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.nms_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.save_output_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.code_type_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.variance_encoded_in_target_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.keep_top_k_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.confidence_threshold_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.visualize_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.visualize_threshold_),
+  PROTOBUF_FIELD_OFFSET(::caffe::DetectionOutputParameter, _impl_.save_file_),
+  3,
+  10,
+  4,
+  1,
+  2,
+  11,
+  6,
+  9,
+  5,
+  7,
+  8,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::caffe::PermuteParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::PermuteParameter, _impl_.order_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.min_size_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.max_size_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.aspect_ratio_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.flip_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.clip_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.variance_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.img_size_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.img_h_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.img_w_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.step_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.step_h_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.step_w_),
+  PROTOBUF_FIELD_OFFSET(::caffe::PriorBoxParameter, _impl_.offset_),
+  ~0u,
+  ~0u,
+  ~0u,
+  7,
+  0,
+  ~0u,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  8,
+  PROTOBUF_FIELD_OFFSET(::caffe::ShuffleChannelParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::ShuffleChannelParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::ShuffleChannelParameter, _impl_.group_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizeParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizeParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizeParameter, _impl_.across_spatial_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizeParameter, _impl_.scale_filler_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizeParameter, _impl_.channel_shared_),
+  PROTOBUF_FIELD_OFFSET(::caffe::NormalizeParameter, _impl_.eps_),
+  1,
+  0,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.bottom_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.top_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.include_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.exclude_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.blobs_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.blob_share_mode_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.blobs_lr_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.weight_decay_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.loss_weight_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.concat_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.convolution_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.dropout_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.eltwise_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.exp_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.inner_product_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.lrn_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.mvn_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.pooling_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.power_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.relu_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.sigmoid_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.softmax_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.slice_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.tanh_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.threshold_param_),
+  PROTOBUF_FIELD_OFFSET(::caffe::V1LayerParameter, _impl_.loss_param_),
+  ~0u,
+  ~0u,
+  0,
+  ~0u,
+  ~0u,
+  18,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  1,
+  2,
+  3,
+  8,
+  16,
+  4,
+  5,
+  12,
+  6,
+  7,
+  10,
+  14,
+  15,
+  11,
+  13,
+  9,
+  17,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::caffe::BlobShape)},
+  { 7, 24, -1, sizeof(::caffe::BlobProto)},
+  { 35, -1, -1, sizeof(::caffe::BlobProtoVector)},
+  { 42, 56, -1, sizeof(::caffe::NormalizedBBox)},
+  { 64, 78, -1, sizeof(::caffe::FillerParameter)},
+  { 86, 105, -1, sizeof(::caffe::NetParameter)},
+  { 118, 127, -1, sizeof(::caffe::NetState)},
+  { 130, 141, -1, sizeof(::caffe::NetStateRule)},
+  { 146, 156, -1, sizeof(::caffe::ParamSpec)},
+  { 160, 221, -1, sizeof(::caffe::LayerParameter)},
+  { 276, 285, -1, sizeof(::caffe::LossParameter)},
+  { 288, 297, -1, sizeof(::caffe::ArgMaxParameter)},
+  { 300, 308, -1, sizeof(::caffe::ConcatParameter)},
+  { 310, 319, -1, sizeof(::caffe::BatchNormParameter)},
+  { 322, 331, -1, sizeof(::caffe::BiasParameter)},
+  { 334, 346, -1, sizeof(::caffe::BNParameter)},
+  { 352, 377, -1, sizeof(::caffe::ConvolutionParameter)},
+  { 396, 404, -1, sizeof(::caffe::CropParameter)},
+  { 406, 413, -1, sizeof(::caffe::DropoutParameter)},
+  { 414, 423, -1, sizeof(::caffe::EltwiseParameter)},
+  { 426, 433, -1, sizeof(::caffe::ELUParameter)},
+  { 434, 445, -1, sizeof(::caffe::EmbedParameter)},
+  { 450, 459, -1, sizeof(::caffe::ExpParameter)},
+  { 462, 470, -1, sizeof(::caffe::FlattenParameter)},
+  { 472, 484, -1, sizeof(::caffe::InnerProductParameter)},
+  { 490, -1, -1, sizeof(::caffe::InputParameter)},
+  { 497, 506, -1, sizeof(::caffe::LogParameter)},
+  { 509, 521, -1, sizeof(::caffe::LRNParameter)},
+  { 527, 536, -1, sizeof(::caffe::MVNParameter)},
+  { 539, 546, -1, sizeof(::caffe::ParameterParameter)},
+  { 547, 565, -1, sizeof(::caffe::PoolingParameter)},
+  { 577, 586, -1, sizeof(::caffe::PowerParameter)},
+  { 589, 597, -1, sizeof(::caffe::PReLUParameter)},
+  { 599, 613, -1, sizeof(::caffe::ProposalParameter)},
+  { 621, 630, -1, sizeof(::caffe::PSROIPoolingParameter)},
+  { 633, 641, -1, sizeof(::caffe::QuantizationParameter)},
+  { 643, 652, -1, sizeof(::caffe::ReductionParameter)},
+  { 655, 663, -1, sizeof(::caffe::ReLUParameter)},
+  { 665, 673, -1, sizeof(::caffe::ReorderParameter)},
+  { 675, 684, -1, sizeof(::caffe::ReshapeParameter)},
+  { 687, 696, -1, sizeof(::caffe::ROIPoolingParameter)},
+  { 699, 710, -1, sizeof(::caffe::ScaleParameter)},
+  { 715, 722, -1, sizeof(::caffe::SigmoidParameter)},
+  { 723, 732, -1, sizeof(::caffe::SliceParameter)},
+  { 735, 743, -1, sizeof(::caffe::SoftmaxParameter)},
+  { 745, 752, -1, sizeof(::caffe::TanHParameter)},
+  { 753, 761, -1, sizeof(::caffe::TileParameter)},
+  { 763, 770, -1, sizeof(::caffe::ThresholdParameter)},
+  { 771, 780, -1, sizeof(::caffe::SPPParameter)},
+  { 783, 792, -1, sizeof(::caffe::NonMaximumSuppressionParameter)},
+  { 795, 807, -1, sizeof(::caffe::SaveOutputParameter)},
+  { 813, 831, -1, sizeof(::caffe::DetectionOutputParameter)},
+  { 843, -1, -1, sizeof(::caffe::PermuteParameter)},
+  { 850, 869, -1, sizeof(::caffe::PriorBoxParameter)},
+  { 882, 889, -1, sizeof(::caffe::ShuffleChannelParameter)},
+  { 890, 900, -1, sizeof(::caffe::NormalizeParameter)},
+  { 904, 939, -1, sizeof(::caffe::V1LayerParameter)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::caffe::_BlobShape_default_instance_._instance,
+  &::caffe::_BlobProto_default_instance_._instance,
+  &::caffe::_BlobProtoVector_default_instance_._instance,
+  &::caffe::_NormalizedBBox_default_instance_._instance,
+  &::caffe::_FillerParameter_default_instance_._instance,
+  &::caffe::_NetParameter_default_instance_._instance,
+  &::caffe::_NetState_default_instance_._instance,
+  &::caffe::_NetStateRule_default_instance_._instance,
+  &::caffe::_ParamSpec_default_instance_._instance,
+  &::caffe::_LayerParameter_default_instance_._instance,
+  &::caffe::_LossParameter_default_instance_._instance,
+  &::caffe::_ArgMaxParameter_default_instance_._instance,
+  &::caffe::_ConcatParameter_default_instance_._instance,
+  &::caffe::_BatchNormParameter_default_instance_._instance,
+  &::caffe::_BiasParameter_default_instance_._instance,
+  &::caffe::_BNParameter_default_instance_._instance,
+  &::caffe::_ConvolutionParameter_default_instance_._instance,
+  &::caffe::_CropParameter_default_instance_._instance,
+  &::caffe::_DropoutParameter_default_instance_._instance,
+  &::caffe::_EltwiseParameter_default_instance_._instance,
+  &::caffe::_ELUParameter_default_instance_._instance,
+  &::caffe::_EmbedParameter_default_instance_._instance,
+  &::caffe::_ExpParameter_default_instance_._instance,
+  &::caffe::_FlattenParameter_default_instance_._instance,
+  &::caffe::_InnerProductParameter_default_instance_._instance,
+  &::caffe::_InputParameter_default_instance_._instance,
+  &::caffe::_LogParameter_default_instance_._instance,
+  &::caffe::_LRNParameter_default_instance_._instance,
+  &::caffe::_MVNParameter_default_instance_._instance,
+  &::caffe::_ParameterParameter_default_instance_._instance,
+  &::caffe::_PoolingParameter_default_instance_._instance,
+  &::caffe::_PowerParameter_default_instance_._instance,
+  &::caffe::_PReLUParameter_default_instance_._instance,
+  &::caffe::_ProposalParameter_default_instance_._instance,
+  &::caffe::_PSROIPoolingParameter_default_instance_._instance,
+  &::caffe::_QuantizationParameter_default_instance_._instance,
+  &::caffe::_ReductionParameter_default_instance_._instance,
+  &::caffe::_ReLUParameter_default_instance_._instance,
+  &::caffe::_ReorderParameter_default_instance_._instance,
+  &::caffe::_ReshapeParameter_default_instance_._instance,
+  &::caffe::_ROIPoolingParameter_default_instance_._instance,
+  &::caffe::_ScaleParameter_default_instance_._instance,
+  &::caffe::_SigmoidParameter_default_instance_._instance,
+  &::caffe::_SliceParameter_default_instance_._instance,
+  &::caffe::_SoftmaxParameter_default_instance_._instance,
+  &::caffe::_TanHParameter_default_instance_._instance,
+  &::caffe::_TileParameter_default_instance_._instance,
+  &::caffe::_ThresholdParameter_default_instance_._instance,
+  &::caffe::_SPPParameter_default_instance_._instance,
+  &::caffe::_NonMaximumSuppressionParameter_default_instance_._instance,
+  &::caffe::_SaveOutputParameter_default_instance_._instance,
+  &::caffe::_DetectionOutputParameter_default_instance_._instance,
+  &::caffe::_PermuteParameter_default_instance_._instance,
+  &::caffe::_PriorBoxParameter_default_instance_._instance,
+  &::caffe::_ShuffleChannelParameter_default_instance_._instance,
+  &::caffe::_NormalizeParameter_default_instance_._instance,
+  &::caffe::_V1LayerParameter_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_caffe_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013caffe.proto\022\005caffe\"\034\n\tBlobShape\022\017\n\003dim"
+  "\030\001 \003(\003B\002\020\001\"\367\001\n\tBlobProto\022\037\n\005shape\030\007 \001(\0132"
+  "\020.caffe.BlobShape\022\020\n\004data\030\005 \003(\002B\002\020\001\022\020\n\004d"
+  "iff\030\006 \003(\002B\002\020\001\022\027\n\013double_data\030\010 \003(\001B\002\020\001\022\027"
+  "\n\013double_diff\030\t \003(\001B\002\020\001\022\021\n\tint8_data\030\n \001"
+  "(\014\022\026\n\nint8_scale\030\013 \003(\002B\002\020\001\022\016\n\003num\030\001 \001(\005:"
+  "\0010\022\023\n\010channels\030\002 \001(\005:\0010\022\021\n\006height\030\003 \001(\005:"
+  "\0010\022\020\n\005width\030\004 \001(\005:\0010\"2\n\017BlobProtoVector\022"
+  "\037\n\005blobs\030\001 \003(\0132\020.caffe.BlobProto\"\207\001\n\016Nor"
+  "malizedBBox\022\014\n\004xmin\030\001 \001(\002\022\014\n\004ymin\030\002 \001(\002\022"
+  "\014\n\004xmax\030\003 \001(\002\022\014\n\004ymax\030\004 \001(\002\022\r\n\005label\030\005 \001"
+  "(\005\022\021\n\tdifficult\030\006 \001(\010\022\r\n\005score\030\007 \001(\002\022\014\n\004"
+  "size\030\010 \001(\002\"\212\002\n\017FillerParameter\022\026\n\004type\030\001"
+  " \001(\t:\010constant\022\020\n\005value\030\002 \001(\002:\0010\022\016\n\003min\030"
+  "\003 \001(\002:\0010\022\016\n\003max\030\004 \001(\002:\0011\022\017\n\004mean\030\005 \001(\002:\001"
+  "0\022\016\n\003std\030\006 \001(\002:\0011\022\022\n\006sparse\030\007 \001(\005:\002-1\022B\n"
+  "\rvariance_norm\030\010 \001(\0162#.caffe.FillerParam"
+  "eter.VarianceNorm:\006FAN_IN\"4\n\014VarianceNor"
+  "m\022\n\n\006FAN_IN\020\000\022\013\n\007FAN_OUT\020\001\022\013\n\007AVERAGE\020\002\""
+  "\206\003\n\014NetParameter\022\014\n\004name\030\001 \001(\t\022\r\n\005input\030"
+  "\003 \003(\t\022%\n\013input_shape\030\010 \003(\0132\020.caffe.BlobS"
+  "hape\022\021\n\tinput_dim\030\004 \003(\005\022\035\n\016force_backwar"
+  "d\030\005 \001(\010:\005false\022\036\n\005state\030\006 \001(\0132\017.caffe.Ne"
+  "tState\022\031\n\ndebug_info\030\007 \001(\010:\005false\022\036\n\017opt"
+  "imize_memory\030\t \001(\010:\005false\022 \n\021parallel_br"
+  "anches\030\n \001(\010:\005false\022\030\n\rchannel_block\030\013 \001"
+  "(\r:\0010\022\032\n\013fuse_layers\030\014 \001(\010:\005false\022$\n\005lay"
+  "er\030d \003(\0132\025.caffe.LayerParameter\022\'\n\006layer"
+  "s\030\002 \003(\0132\027.caffe.V1LayerParameter\"N\n\010NetS"
+  "tate\022!\n\005phase\030\001 \001(\0162\014.caffe.Phase:\004TEST\022"
+  "\020\n\005level\030\002 \001(\005:\0010\022\r\n\005stage\030\003 \003(\t\"s\n\014NetS"
+  "tateRule\022\033\n\005phase\030\001 \001(\0162\014.caffe.Phase\022\021\n"
+  "\tmin_level\030\002 \001(\005\022\021\n\tmax_level\030\003 \001(\005\022\r\n\005s"
+  "tage\030\004 \003(\t\022\021\n\tnot_stage\030\005 \003(\t\"\243\001\n\tParamS"
+  "pec\022\014\n\004name\030\001 \001(\t\0221\n\nshare_mode\030\002 \001(\0162\035."
+  "caffe.ParamSpec.DimCheckMode\022\022\n\007lr_mult\030"
+  "\003 \001(\002:\0011\022\025\n\ndecay_mult\030\004 \001(\002:\0011\"*\n\014DimCh"
+  "eckMode\022\n\n\006STRICT\020\000\022\016\n\nPERMISSIVE\020\001\"\367\022\n\016"
+  "LayerParameter\022\014\n\004name\030\001 \001(\t\022\014\n\004type\030\002 \001"
+  "(\t\022\016\n\006bottom\030\003 \003(\t\022\013\n\003top\030\004 \003(\t\022\033\n\005phase"
+  "\030\n \001(\0162\014.caffe.Phase\022\023\n\013loss_weight\030\005 \003("
+  "\002\022\037\n\005param\030\006 \003(\0132\020.caffe.ParamSpec\022\037\n\005bl"
+  "obs\030\007 \003(\0132\020.caffe.BlobProto\022\026\n\016propagate"
+  "_down\030\013 \003(\010\022$\n\007include\030\010 \003(\0132\023.caffe.Net"
+  "StateRule\022$\n\007exclude\030\t \003(\0132\023.caffe.NetSt"
+  "ateRule\022)\n\nloss_param\030\310\001 \001(\0132\024.caffe.Los"
+  "sParameter\022-\n\014argmax_param\030\311\001 \001(\0132\026.caff"
+  "e.ArgMaxParameter\0224\n\020batch_norm_param\030\312\001"
+  " \001(\0132\031.caffe.BatchNormParameter\022)\n\nbias_"
+  "param\030\313\001 \001(\0132\024.caffe.BiasParameter\022%\n\010bn"
+  "_param\030\314\001 \001(\0132\022.caffe.BNParameter\022-\n\014con"
+  "cat_param\030\315\001 \001(\0132\026.caffe.ConcatParameter"
+  "\0227\n\021convolution_param\030\316\001 \001(\0132\033.caffe.Con"
+  "volutionParameter\022)\n\ncrop_param\030\317\001 \001(\0132\024"
+  ".caffe.CropParameter\022/\n\rdropout_param\030\320\001"
+  " \001(\0132\027.caffe.DropoutParameter\022/\n\reltwise"
+  "_param\030\321\001 \001(\0132\027.caffe.EltwiseParameter\022\'"
+  "\n\telu_param\030\322\001 \001(\0132\023.caffe.ELUParameter\022"
+  "+\n\013embed_param\030\323\001 \001(\0132\025.caffe.EmbedParam"
+  "eter\022\'\n\texp_param\030\324\001 \001(\0132\023.caffe.ExpPara"
+  "meter\022/\n\rflatten_param\030\325\001 \001(\0132\027.caffe.Fl"
+  "attenParameter\022:\n\023inner_product_param\030\326\001"
+  " \001(\0132\034.caffe.InnerProductParameter\022+\n\013in"
+  "put_param\030\327\001 \001(\0132\025.caffe.InputParameter\022"
+  "\'\n\tlog_param\030\330\001 \001(\0132\023.caffe.LogParameter"
+  "\022\'\n\tlrn_param\030\331\001 \001(\0132\023.caffe.LRNParamete"
+  "r\022\'\n\tmvn_param\030\332\001 \001(\0132\023.caffe.MVNParamet"
+  "er\0223\n\017parameter_param\030\333\001 \001(\0132\031.caffe.Par"
+  "ameterParameter\022/\n\rpooling_param\030\334\001 \001(\0132"
+  "\027.caffe.PoolingParameter\022+\n\013power_param\030"
+  "\336\001 \001(\0132\025.caffe.PowerParameter\022+\n\013prelu_p"
+  "aram\030\337\001 \001(\0132\025.caffe.PReLUParameter\0221\n\016pr"
+  "oposal_param\030\340\001 \001(\0132\030.caffe.ProposalPara"
+  "meter\022:\n\023psroi_pooling_param\030\341\001 \001(\0132\034.ca"
+  "ffe.PSROIPoolingParameter\0223\n\017reduction_p"
+  "aram\030\342\001 \001(\0132\031.caffe.ReductionParameter\022)"
+  "\n\nrelu_param\030\343\001 \001(\0132\024.caffe.ReLUParamete"
+  "r\022/\n\rreshape_param\030\344\001 \001(\0132\027.caffe.Reshap"
+  "eParameter\0226\n\021roi_pooling_param\030\345\001 \001(\0132\032"
+  ".caffe.ROIPoolingParameter\022+\n\013scale_para"
+  "m\030\346\001 \001(\0132\025.caffe.ScaleParameter\022/\n\rsigmo"
+  "id_param\030\347\001 \001(\0132\027.caffe.SigmoidParameter"
+  "\022/\n\rsoftmax_param\030\350\001 \001(\0132\027.caffe.Softmax"
+  "Parameter\022\'\n\tspp_param\030\351\001 \001(\0132\023.caffe.SP"
+  "PParameter\022+\n\013slice_param\030\352\001 \001(\0132\025.caffe"
+  ".SliceParameter\022)\n\ntanh_param\030\353\001 \001(\0132\024.c"
+  "affe.TanHParameter\0223\n\017threshold_param\030\354\001"
+  " \001(\0132\031.caffe.ThresholdParameter\022)\n\ntile_"
+  "param\030\355\001 \001(\0132\024.caffe.TileParameter\022@\n\026de"
+  "tection_output_param\030\356\001 \001(\0132\037.caffe.Dete"
+  "ctionOutputParameter\022/\n\rpermute_param\030\357\001"
+  " \001(\0132\027.caffe.PermuteParameter\0222\n\017prior_b"
+  "ox_param\030\360\001 \001(\0132\030.caffe.PriorBoxParamete"
+  "r\022>\n\025shuffle_channel_param\030\361\001 \001(\0132\036.caff"
+  "e.ShuffleChannelParameter\022.\n\nnorm_param\030"
+  "\362\001 \001(\0132\031.caffe.NormalizeParameter\022/\n\rreo"
+  "rder_param\030\363\001 \001(\0132\027.caffe.ReorderParamet"
+  "er\0229\n\022quantization_param\030\364\001 \001(\0132\034.caffe."
+  "QuantizationParameter\"\302\001\n\rLossParameter\022"
+  "\024\n\014ignore_label\030\001 \001(\005\022D\n\rnormalization\030\003"
+  " \001(\0162&.caffe.LossParameter.Normalization"
+  "Mode:\005VALID\022\021\n\tnormalize\030\002 \001(\010\"B\n\021Normal"
+  "izationMode\022\010\n\004FULL\020\000\022\t\n\005VALID\020\001\022\016\n\nBATC"
+  "H_SIZE\020\002\022\010\n\004NONE\020\003\"M\n\017ArgMaxParameter\022\032\n"
+  "\013out_max_val\030\001 \001(\010:\005false\022\020\n\005top_k\030\002 \001(\r"
+  ":\0011\022\014\n\004axis\030\003 \001(\005\"9\n\017ConcatParameter\022\017\n\004"
+  "axis\030\002 \001(\005:\0011\022\025\n\nconcat_dim\030\001 \001(\r:\0011\"j\n\022"
+  "BatchNormParameter\022\030\n\020use_global_stats\030\001"
+  " \001(\010\022&\n\027moving_average_fraction\030\002 \001(\002:\0050"
+  ".999\022\022\n\003eps\030\003 \001(\002:\0051e-05\"]\n\rBiasParamete"
+  "r\022\017\n\004axis\030\001 \001(\005:\0011\022\023\n\010num_axes\030\002 \001(\005:\0011\022"
+  "&\n\006filler\030\003 \001(\0132\026.caffe.FillerParameter\""
+  "\213\002\n\013BNParameter\022,\n\014slope_filler\030\001 \001(\0132\026."
+  "caffe.FillerParameter\022+\n\013bias_filler\030\002 \001"
+  "(\0132\026.caffe.FillerParameter\022\025\n\010momentum\030\003"
+  " \001(\002:\0030.9\022\022\n\003eps\030\004 \001(\002:\0051e-05\022\025\n\006frozen\030"
+  "\005 \001(\010:\005false\0222\n\006engine\030\006 \001(\0162\031.caffe.BNP"
+  "arameter.Engine:\007DEFAULT\"+\n\006Engine\022\013\n\007DE"
+  "FAULT\020\000\022\t\n\005CAFFE\020\001\022\t\n\005CUDNN\020\002\"\244\004\n\024Convol"
+  "utionParameter\022\022\n\nnum_output\030\001 \001(\r\022\027\n\tbi"
+  "as_term\030\002 \001(\010:\004true\022\013\n\003pad\030\003 \003(\r\022\023\n\013kern"
+  "el_size\030\004 \003(\r\022\016\n\006stride\030\006 \003(\r\022\020\n\010dilatio"
+  "n\030\022 \003(\r\022\020\n\005pad_h\030\t \001(\r:\0010\022\020\n\005pad_w\030\n \001(\r"
+  ":\0010\022\020\n\010kernel_h\030\013 \001(\r\022\020\n\010kernel_w\030\014 \001(\r\022"
+  "\020\n\010stride_h\030\r \001(\r\022\020\n\010stride_w\030\016 \001(\r\022\020\n\005g"
+  "roup\030\005 \001(\r:\0011\022-\n\rweight_filler\030\007 \001(\0132\026.c"
+  "affe.FillerParameter\022+\n\013bias_filler\030\010 \001("
+  "\0132\026.caffe.FillerParameter\022;\n\006engine\030\017 \001("
+  "\0162\".caffe.ConvolutionParameter.Engine:\007D"
+  "EFAULT\022\030\n\rwinograd_tile\030\023 \001(\r:\0010\022\017\n\004axis"
+  "\030\020 \001(\005:\0011\022\036\n\017force_nd_im2col\030\021 \001(\010:\005fals"
+  "e\"9\n\006Engine\022\013\n\007DEFAULT\020\000\022\t\n\005CAFFE\020\001\022\t\n\005C"
+  "UDNN\020\002\022\014\n\010WINOGRAD\020\003\"0\n\rCropParameter\022\017\n"
+  "\004axis\030\001 \001(\005:\0012\022\016\n\006offset\030\002 \003(\r\".\n\020Dropou"
+  "tParameter\022\032\n\rdropout_ratio\030\001 \001(\002:\0030.5\"\245"
+  "\001\n\020EltwiseParameter\0229\n\toperation\030\001 \001(\0162!"
+  ".caffe.EltwiseParameter.EltwiseOp:\003SUM\022\r"
+  "\n\005coeff\030\002 \003(\002\022\036\n\020stable_prod_grad\030\003 \001(\010:"
+  "\004true\"\'\n\tEltwiseOp\022\010\n\004PROD\020\000\022\007\n\003SUM\020\001\022\007\n"
+  "\003MAX\020\002\" \n\014ELUParameter\022\020\n\005alpha\030\001 \001(\002:\0011"
+  "\"\254\001\n\016EmbedParameter\022\022\n\nnum_output\030\001 \001(\r\022"
+  "\021\n\tinput_dim\030\002 \001(\r\022\027\n\tbias_term\030\003 \001(\010:\004t"
+  "rue\022-\n\rweight_filler\030\004 \001(\0132\026.caffe.Fille"
+  "rParameter\022+\n\013bias_filler\030\005 \001(\0132\026.caffe."
+  "FillerParameter\"D\n\014ExpParameter\022\020\n\004base\030"
+  "\001 \001(\002:\002-1\022\020\n\005scale\030\002 \001(\002:\0011\022\020\n\005shift\030\003 \001"
+  "(\002:\0010\"9\n\020FlattenParameter\022\017\n\004axis\030\001 \001(\005:"
+  "\0011\022\024\n\010end_axis\030\002 \001(\005:\002-1\"\313\001\n\025InnerProduc"
+  "tParameter\022\022\n\nnum_output\030\001 \001(\r\022\027\n\tbias_t"
+  "erm\030\002 \001(\010:\004true\022-\n\rweight_filler\030\003 \001(\0132\026"
+  ".caffe.FillerParameter\022+\n\013bias_filler\030\004 "
+  "\001(\0132\026.caffe.FillerParameter\022\017\n\004axis\030\005 \001("
+  "\005:\0011\022\030\n\ttranspose\030\006 \001(\010:\005false\"1\n\016InputP"
+  "arameter\022\037\n\005shape\030\001 \003(\0132\020.caffe.BlobShap"
+  "e\"D\n\014LogParameter\022\020\n\004base\030\001 \001(\002:\002-1\022\020\n\005s"
+  "cale\030\002 \001(\002:\0011\022\020\n\005shift\030\003 \001(\002:\0010\"\270\002\n\014LRNP"
+  "arameter\022\025\n\nlocal_size\030\001 \001(\r:\0015\022\020\n\005alpha"
+  "\030\002 \001(\002:\0011\022\022\n\004beta\030\003 \001(\002:\0040.75\022D\n\013norm_re"
+  "gion\030\004 \001(\0162\036.caffe.LRNParameter.NormRegi"
+  "on:\017ACROSS_CHANNELS\022\014\n\001k\030\005 \001(\002:\0011\0223\n\006eng"
+  "ine\030\006 \001(\0162\032.caffe.LRNParameter.Engine:\007D"
+  "EFAULT\"5\n\nNormRegion\022\023\n\017ACROSS_CHANNELS\020"
+  "\000\022\022\n\016WITHIN_CHANNEL\020\001\"+\n\006Engine\022\013\n\007DEFAU"
+  "LT\020\000\022\t\n\005CAFFE\020\001\022\t\n\005CUDNN\020\002\"d\n\014MVNParamet"
+  "er\022 \n\022normalize_variance\030\001 \001(\010:\004true\022\036\n\017"
+  "across_channels\030\002 \001(\010:\005false\022\022\n\003eps\030\003 \001("
+  "\002:\0051e-09\"5\n\022ParameterParameter\022\037\n\005shape\030"
+  "\001 \001(\0132\020.caffe.BlobShape\"\222\003\n\020PoolingParam"
+  "eter\0225\n\004pool\030\001 \001(\0162\".caffe.PoolingParame"
+  "ter.PoolMethod:\003MAX\022\016\n\003pad\030\004 \001(\r:\0010\022\020\n\005p"
+  "ad_h\030\t \001(\r:\0010\022\020\n\005pad_w\030\n \001(\r:\0010\022\023\n\013kerne"
+  "l_size\030\002 \001(\r\022\020\n\010kernel_h\030\005 \001(\r\022\020\n\010kernel"
+  "_w\030\006 \001(\r\022\021\n\006stride\030\003 \001(\r:\0011\022\020\n\010stride_h\030"
+  "\007 \001(\r\022\020\n\010stride_w\030\010 \001(\r\0227\n\006engine\030\013 \001(\0162"
+  "\036.caffe.PoolingParameter.Engine:\007DEFAULT"
+  "\022\035\n\016global_pooling\030\014 \001(\010:\005false\"\036\n\nPoolM"
+  "ethod\022\007\n\003MAX\020\000\022\007\n\003AVE\020\001\"+\n\006Engine\022\013\n\007DEF"
+  "AULT\020\000\022\t\n\005CAFFE\020\001\022\t\n\005CUDNN\020\002\"F\n\016PowerPar"
+  "ameter\022\020\n\005power\030\001 \001(\002:\0011\022\020\n\005scale\030\002 \001(\002:"
+  "\0011\022\020\n\005shift\030\003 \001(\002:\0010\"W\n\016PReLUParameter\022&"
+  "\n\006filler\030\001 \001(\0132\026.caffe.FillerParameter\022\035"
+  "\n\016channel_shared\030\002 \001(\010:\005false\"\310\001\n\021Propos"
+  "alParameter\022\027\n\013feat_stride\030\001 \001(\r:\00216\022\025\n\t"
+  "base_size\030\002 \001(\r:\00216\022\024\n\010min_size\030\003 \001(\r:\0021"
+  "6\022\r\n\005ratio\030\004 \003(\002\022\r\n\005scale\030\005 \003(\002\022\032\n\014pre_n"
+  "ms_topn\030\006 \001(\r:\0046000\022\032\n\rpost_nms_topn\030\007 \001"
+  "(\r:\003300\022\027\n\nnms_thresh\030\010 \001(\002:\0030.7\"V\n\025PSRO"
+  "IPoolingParameter\022\025\n\rspatial_scale\030\001 \002(\002"
+  "\022\022\n\noutput_dim\030\002 \002(\005\022\022\n\ngroup_size\030\003 \002(\005"
+  "\"P\n\025QuantizationParameter\022\027\n\014bottom_scal"
+  "e\030\001 \001(\002:\0010\022\036\n\021bottom_zero_point\030\002 \001(\r:\0031"
+  "28\"\255\001\n\022ReductionParameter\022=\n\toperation\030\001"
+  " \001(\0162%.caffe.ReductionParameter.Reductio"
+  "nOp:\003SUM\022\017\n\004axis\030\002 \001(\005:\0010\022\020\n\005coeff\030\003 \001(\002"
+  ":\0011\"5\n\013ReductionOp\022\007\n\003SUM\020\001\022\010\n\004ASUM\020\002\022\t\n"
+  "\005SUMSQ\020\003\022\010\n\004MEAN\020\004\"\215\001\n\rReLUParameter\022\031\n\016"
+  "negative_slope\030\001 \001(\002:\0010\0224\n\006engine\030\002 \001(\0162"
+  "\033.caffe.ReLUParameter.Engine:\007DEFAULT\"+\n"
+  "\006Engine\022\013\n\007DEFAULT\020\000\022\t\n\005CAFFE\020\001\022\t\n\005CUDNN"
+  "\020\002\"Q\n\020ReorderParameter\022\037\n\024bottom_channel"
+  "_block\030\001 \001(\r:\0010\022\034\n\021top_channel_block\030\002 \001"
+  "(\r:\0010\"Z\n\020ReshapeParameter\022\037\n\005shape\030\001 \001(\013"
+  "2\020.caffe.BlobShape\022\017\n\004axis\030\002 \001(\005:\0010\022\024\n\010n"
+  "um_axes\030\003 \001(\005:\002-1\"Y\n\023ROIPoolingParameter"
+  "\022\023\n\010pooled_h\030\001 \001(\r:\0010\022\023\n\010pooled_w\030\002 \001(\r:"
+  "\0010\022\030\n\rspatial_scale\030\003 \001(\002:\0011\"\245\001\n\016ScalePa"
+  "rameter\022\017\n\004axis\030\001 \001(\005:\0011\022\023\n\010num_axes\030\002 \001"
+  "(\005:\0011\022&\n\006filler\030\003 \001(\0132\026.caffe.FillerPara"
+  "meter\022\030\n\tbias_term\030\004 \001(\010:\005false\022+\n\013bias_"
+  "filler\030\005 \001(\0132\026.caffe.FillerParameter\"x\n\020"
+  "SigmoidParameter\0227\n\006engine\030\001 \001(\0162\036.caffe"
+  ".SigmoidParameter.Engine:\007DEFAULT\"+\n\006Eng"
+  "ine\022\013\n\007DEFAULT\020\000\022\t\n\005CAFFE\020\001\022\t\n\005CUDNN\020\002\"L"
+  "\n\016SliceParameter\022\017\n\004axis\030\003 \001(\005:\0011\022\023\n\013sli"
+  "ce_point\030\002 \003(\r\022\024\n\tslice_dim\030\001 \001(\r:\0011\"\211\001\n"
+  "\020SoftmaxParameter\0227\n\006engine\030\001 \001(\0162\036.caff"
+  "e.SoftmaxParameter.Engine:\007DEFAULT\022\017\n\004ax"
+  "is\030\002 \001(\005:\0011\"+\n\006Engine\022\013\n\007DEFAULT\020\000\022\t\n\005CA"
+  "FFE\020\001\022\t\n\005CUDNN\020\002\"r\n\rTanHParameter\0224\n\006eng"
+  "ine\030\001 \001(\0162\033.caffe.TanHParameter.Engine:\007"
+  "DEFAULT\"+\n\006Engine\022\013\n\007DEFAULT\020\000\022\t\n\005CAFFE\020"
+  "\001\022\t\n\005CUDNN\020\002\"/\n\rTileParameter\022\017\n\004axis\030\001 "
+  "\001(\005:\0011\022\r\n\005tiles\030\002 \001(\005\"*\n\022ThresholdParame"
+  "ter\022\024\n\tthreshold\030\001 \001(\002:\0010\"\333\001\n\014SPPParamet"
+  "er\022\026\n\016pyramid_height\030\001 \001(\r\0221\n\004pool\030\002 \001(\016"
+  "2\036.caffe.SPPParameter.PoolMethod:\003MAX\0223\n"
+  "\006engine\030\006 \001(\0162\032.caffe.SPPParameter.Engin"
+  "e:\007DEFAULT\"\036\n\nPoolMethod\022\007\n\003MAX\020\000\022\007\n\003AVE"
+  "\020\001\"+\n\006Engine\022\013\n\007DEFAULT\020\000\022\t\n\005CAFFE\020\001\022\t\n\005"
+  "CUDNN\020\002\"[\n\036NonMaximumSuppressionParamete"
+  "r\022\032\n\rnms_threshold\030\001 \001(\002:\0030.3\022\r\n\005top_k\030\002"
+  " \001(\005\022\016\n\003eta\030\003 \001(\002:\0011\"\252\001\n\023SaveOutputParam"
+  "eter\022\030\n\020output_directory\030\001 \001(\t\022\032\n\022output"
+  "_name_prefix\030\002 \001(\t\022\025\n\routput_format\030\003 \001("
+  "\t\022\026\n\016label_map_file\030\004 \001(\t\022\026\n\016name_size_f"
+  "ile\030\005 \001(\t\022\026\n\016num_test_image\030\006 \001(\r\"\307\003\n\030De"
+  "tectionOutputParameter\022\023\n\013num_classes\030\001 "
+  "\001(\r\022\034\n\016share_location\030\002 \001(\010:\004true\022\036\n\023bac"
+  "kground_label_id\030\003 \001(\005:\0010\0228\n\tnms_param\030\004"
+  " \001(\0132%.caffe.NonMaximumSuppressionParame"
+  "ter\0225\n\021save_output_param\030\005 \001(\0132\032.caffe.S"
+  "aveOutputParameter\022<\n\tcode_type\030\006 \001(\0162!."
+  "caffe.PriorBoxParameter.CodeType:\006CORNER"
+  "\022)\n\032variance_encoded_in_target\030\010 \001(\010:\005fa"
+  "lse\022\026\n\nkeep_top_k\030\007 \001(\005:\002-1\022\034\n\024confidenc"
+  "e_threshold\030\t \001(\002\022\030\n\tvisualize\030\n \001(\010:\005fa"
+  "lse\022\033\n\023visualize_threshold\030\013 \001(\002\022\021\n\tsave"
+  "_file\030\014 \001(\t\"!\n\020PermuteParameter\022\r\n\005order"
+  "\030\001 \003(\r\"\265\002\n\021PriorBoxParameter\022\020\n\010min_size"
+  "\030\001 \003(\002\022\020\n\010max_size\030\002 \003(\002\022\024\n\014aspect_ratio"
+  "\030\003 \003(\002\022\022\n\004flip\030\004 \001(\010:\004true\022\023\n\004clip\030\005 \001(\010"
+  ":\005false\022\020\n\010variance\030\006 \003(\002\022\020\n\010img_size\030\007 "
+  "\001(\r\022\r\n\005img_h\030\010 \001(\r\022\r\n\005img_w\030\t \001(\r\022\014\n\004ste"
+  "p\030\n \001(\002\022\016\n\006step_h\030\013 \001(\002\022\016\n\006step_w\030\014 \001(\002\022"
+  "\023\n\006offset\030\r \001(\002:\0030.5\"8\n\010CodeType\022\n\n\006CORN"
+  "ER\020\001\022\017\n\013CENTER_SIZE\020\002\022\017\n\013CORNER_SIZE\020\003\"+"
+  "\n\027ShuffleChannelParameter\022\020\n\005group\030\001 \001(\r"
+  ":\0011\"\222\001\n\022NormalizeParameter\022\034\n\016across_spa"
+  "tial\030\001 \001(\010:\004true\022,\n\014scale_filler\030\002 \001(\0132\026"
+  ".caffe.FillerParameter\022\034\n\016channel_shared"
+  "\030\003 \001(\010:\004true\022\022\n\003eps\030\004 \001(\002:\0051e-10\"\305\013\n\020V1L"
+  "ayerParameter\022\016\n\006bottom\030\002 \003(\t\022\013\n\003top\030\003 \003"
+  "(\t\022\014\n\004name\030\004 \001(\t\022$\n\007include\030  \003(\0132\023.caff"
+  "e.NetStateRule\022$\n\007exclude\030! \003(\0132\023.caffe."
+  "NetStateRule\022/\n\004type\030\005 \001(\0162!.caffe.V1Lay"
+  "erParameter.LayerType\022\037\n\005blobs\030\006 \003(\0132\020.c"
+  "affe.BlobProto\022\016\n\005param\030\351\007 \003(\t\022>\n\017blob_s"
+  "hare_mode\030\352\007 \003(\0162$.caffe.V1LayerParamete"
+  "r.DimCheckMode\022\020\n\010blobs_lr\030\007 \003(\002\022\024\n\014weig"
+  "ht_decay\030\010 \003(\002\022\023\n\013loss_weight\030# \003(\002\022,\n\014c"
+  "oncat_param\030\t \001(\0132\026.caffe.ConcatParamete"
+  "r\0226\n\021convolution_param\030\n \001(\0132\033.caffe.Con"
+  "volutionParameter\022.\n\rdropout_param\030\014 \001(\013"
+  "2\027.caffe.DropoutParameter\022.\n\reltwise_par"
+  "am\030\030 \001(\0132\027.caffe.EltwiseParameter\022&\n\texp"
+  "_param\030) \001(\0132\023.caffe.ExpParameter\0229\n\023inn"
+  "er_product_param\030\021 \001(\0132\034.caffe.InnerProd"
+  "uctParameter\022&\n\tlrn_param\030\022 \001(\0132\023.caffe."
+  "LRNParameter\022&\n\tmvn_param\030\" \001(\0132\023.caffe."
+  "MVNParameter\022.\n\rpooling_param\030\023 \001(\0132\027.ca"
+  "ffe.PoolingParameter\022*\n\013power_param\030\025 \001("
+  "\0132\025.caffe.PowerParameter\022(\n\nrelu_param\030\036"
+  " \001(\0132\024.caffe.ReLUParameter\022.\n\rsigmoid_pa"
+  "ram\030& \001(\0132\027.caffe.SigmoidParameter\022.\n\rso"
+  "ftmax_param\030\' \001(\0132\027.caffe.SoftmaxParamet"
+  "er\022*\n\013slice_param\030\037 \001(\0132\025.caffe.SlicePar"
+  "ameter\022(\n\ntanh_param\030% \001(\0132\024.caffe.TanHP"
+  "arameter\0222\n\017threshold_param\030\031 \001(\0132\031.caff"
+  "e.ThresholdParameter\022(\n\nloss_param\030* \001(\013"
+  "2\024.caffe.LossParameter\"\233\002\n\tLayerType\022\010\n\004"
+  "NONE\020\000\022\n\n\006ABSVAL\020#\022\010\n\004BNLL\020\002\022\n\n\006CONCAT\020\003"
+  "\022\017\n\013CONVOLUTION\020\004\022\021\n\rDECONVOLUTION\020\'\022\013\n\007"
+  "DROPOUT\020\006\022\013\n\007ELTWISE\020\031\022\007\n\003EXP\020&\022\013\n\007FLATT"
+  "EN\020\010\022\021\n\rINNER_PRODUCT\020\016\022\007\n\003LRN\020\017\022\007\n\003MVN\020"
+  "\"\022\013\n\007POOLING\020\021\022\t\n\005POWER\020\032\022\010\n\004RELU\020\022\022\013\n\007S"
+  "IGMOID\020\023\022\013\n\007SOFTMAX\020\024\022\t\n\005SPLIT\020\026\022\t\n\005SLIC"
+  "E\020!\022\010\n\004TANH\020\027\022\r\n\tTHRESHOLD\020\037\"*\n\014DimCheck"
+  "Mode\022\n\n\006STRICT\020\000\022\016\n\nPERMISSIVE\020\001*\034\n\005Phas"
+  "e\022\t\n\005TRAIN\020\000\022\010\n\004TEST\020\001"
+  ;
+static ::_pbi::once_flag descriptor_table_caffe_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_caffe_2eproto = {
+    false, false, 11942, descriptor_table_protodef_caffe_2eproto,
+    "caffe.proto",
+    &descriptor_table_caffe_2eproto_once, nullptr, 0, 57,
+    schemas, file_default_instances, TableStruct_caffe_2eproto::offsets,
+    file_level_metadata_caffe_2eproto, file_level_enum_descriptors_caffe_2eproto,
+    file_level_service_descriptors_caffe_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_caffe_2eproto_getter() {
+  return &descriptor_table_caffe_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_caffe_2eproto(&descriptor_table_caffe_2eproto);
+namespace caffe {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FillerParameter_VarianceNorm_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[0];
+}
+bool FillerParameter_VarianceNorm_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr FillerParameter_VarianceNorm FillerParameter::FAN_IN;
+constexpr FillerParameter_VarianceNorm FillerParameter::FAN_OUT;
+constexpr FillerParameter_VarianceNorm FillerParameter::AVERAGE;
+constexpr FillerParameter_VarianceNorm FillerParameter::VarianceNorm_MIN;
+constexpr FillerParameter_VarianceNorm FillerParameter::VarianceNorm_MAX;
+constexpr int FillerParameter::VarianceNorm_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ParamSpec_DimCheckMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[1];
+}
+bool ParamSpec_DimCheckMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ParamSpec_DimCheckMode ParamSpec::STRICT;
+constexpr ParamSpec_DimCheckMode ParamSpec::PERMISSIVE;
+constexpr ParamSpec_DimCheckMode ParamSpec::DimCheckMode_MIN;
+constexpr ParamSpec_DimCheckMode ParamSpec::DimCheckMode_MAX;
+constexpr int ParamSpec::DimCheckMode_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LossParameter_NormalizationMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[2];
+}
+bool LossParameter_NormalizationMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr LossParameter_NormalizationMode LossParameter::FULL;
+constexpr LossParameter_NormalizationMode LossParameter::VALID;
+constexpr LossParameter_NormalizationMode LossParameter::BATCH_SIZE;
+constexpr LossParameter_NormalizationMode LossParameter::NONE;
+constexpr LossParameter_NormalizationMode LossParameter::NormalizationMode_MIN;
+constexpr LossParameter_NormalizationMode LossParameter::NormalizationMode_MAX;
+constexpr int LossParameter::NormalizationMode_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* BNParameter_Engine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[3];
+}
+bool BNParameter_Engine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr BNParameter_Engine BNParameter::DEFAULT;
+constexpr BNParameter_Engine BNParameter::CAFFE;
+constexpr BNParameter_Engine BNParameter::CUDNN;
+constexpr BNParameter_Engine BNParameter::Engine_MIN;
+constexpr BNParameter_Engine BNParameter::Engine_MAX;
+constexpr int BNParameter::Engine_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ConvolutionParameter_Engine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[4];
+}
+bool ConvolutionParameter_Engine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ConvolutionParameter_Engine ConvolutionParameter::DEFAULT;
+constexpr ConvolutionParameter_Engine ConvolutionParameter::CAFFE;
+constexpr ConvolutionParameter_Engine ConvolutionParameter::CUDNN;
+constexpr ConvolutionParameter_Engine ConvolutionParameter::WINOGRAD;
+constexpr ConvolutionParameter_Engine ConvolutionParameter::Engine_MIN;
+constexpr ConvolutionParameter_Engine ConvolutionParameter::Engine_MAX;
+constexpr int ConvolutionParameter::Engine_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EltwiseParameter_EltwiseOp_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[5];
+}
+bool EltwiseParameter_EltwiseOp_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr EltwiseParameter_EltwiseOp EltwiseParameter::PROD;
+constexpr EltwiseParameter_EltwiseOp EltwiseParameter::SUM;
+constexpr EltwiseParameter_EltwiseOp EltwiseParameter::MAX;
+constexpr EltwiseParameter_EltwiseOp EltwiseParameter::EltwiseOp_MIN;
+constexpr EltwiseParameter_EltwiseOp EltwiseParameter::EltwiseOp_MAX;
+constexpr int EltwiseParameter::EltwiseOp_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LRNParameter_NormRegion_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[6];
+}
+bool LRNParameter_NormRegion_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr LRNParameter_NormRegion LRNParameter::ACROSS_CHANNELS;
+constexpr LRNParameter_NormRegion LRNParameter::WITHIN_CHANNEL;
+constexpr LRNParameter_NormRegion LRNParameter::NormRegion_MIN;
+constexpr LRNParameter_NormRegion LRNParameter::NormRegion_MAX;
+constexpr int LRNParameter::NormRegion_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LRNParameter_Engine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[7];
+}
+bool LRNParameter_Engine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr LRNParameter_Engine LRNParameter::DEFAULT;
+constexpr LRNParameter_Engine LRNParameter::CAFFE;
+constexpr LRNParameter_Engine LRNParameter::CUDNN;
+constexpr LRNParameter_Engine LRNParameter::Engine_MIN;
+constexpr LRNParameter_Engine LRNParameter::Engine_MAX;
+constexpr int LRNParameter::Engine_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PoolingParameter_PoolMethod_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[8];
+}
+bool PoolingParameter_PoolMethod_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PoolingParameter_PoolMethod PoolingParameter::MAX;
+constexpr PoolingParameter_PoolMethod PoolingParameter::AVE;
+constexpr PoolingParameter_PoolMethod PoolingParameter::PoolMethod_MIN;
+constexpr PoolingParameter_PoolMethod PoolingParameter::PoolMethod_MAX;
+constexpr int PoolingParameter::PoolMethod_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PoolingParameter_Engine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[9];
+}
+bool PoolingParameter_Engine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PoolingParameter_Engine PoolingParameter::DEFAULT;
+constexpr PoolingParameter_Engine PoolingParameter::CAFFE;
+constexpr PoolingParameter_Engine PoolingParameter::CUDNN;
+constexpr PoolingParameter_Engine PoolingParameter::Engine_MIN;
+constexpr PoolingParameter_Engine PoolingParameter::Engine_MAX;
+constexpr int PoolingParameter::Engine_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReductionParameter_ReductionOp_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[10];
+}
+bool ReductionParameter_ReductionOp_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReductionParameter_ReductionOp ReductionParameter::SUM;
+constexpr ReductionParameter_ReductionOp ReductionParameter::ASUM;
+constexpr ReductionParameter_ReductionOp ReductionParameter::SUMSQ;
+constexpr ReductionParameter_ReductionOp ReductionParameter::MEAN;
+constexpr ReductionParameter_ReductionOp ReductionParameter::ReductionOp_MIN;
+constexpr ReductionParameter_ReductionOp ReductionParameter::ReductionOp_MAX;
+constexpr int ReductionParameter::ReductionOp_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReLUParameter_Engine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[11];
+}
+bool ReLUParameter_Engine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReLUParameter_Engine ReLUParameter::DEFAULT;
+constexpr ReLUParameter_Engine ReLUParameter::CAFFE;
+constexpr ReLUParameter_Engine ReLUParameter::CUDNN;
+constexpr ReLUParameter_Engine ReLUParameter::Engine_MIN;
+constexpr ReLUParameter_Engine ReLUParameter::Engine_MAX;
+constexpr int ReLUParameter::Engine_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SigmoidParameter_Engine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[12];
+}
+bool SigmoidParameter_Engine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SigmoidParameter_Engine SigmoidParameter::DEFAULT;
+constexpr SigmoidParameter_Engine SigmoidParameter::CAFFE;
+constexpr SigmoidParameter_Engine SigmoidParameter::CUDNN;
+constexpr SigmoidParameter_Engine SigmoidParameter::Engine_MIN;
+constexpr SigmoidParameter_Engine SigmoidParameter::Engine_MAX;
+constexpr int SigmoidParameter::Engine_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SoftmaxParameter_Engine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[13];
+}
+bool SoftmaxParameter_Engine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SoftmaxParameter_Engine SoftmaxParameter::DEFAULT;
+constexpr SoftmaxParameter_Engine SoftmaxParameter::CAFFE;
+constexpr SoftmaxParameter_Engine SoftmaxParameter::CUDNN;
+constexpr SoftmaxParameter_Engine SoftmaxParameter::Engine_MIN;
+constexpr SoftmaxParameter_Engine SoftmaxParameter::Engine_MAX;
+constexpr int SoftmaxParameter::Engine_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TanHParameter_Engine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[14];
+}
+bool TanHParameter_Engine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TanHParameter_Engine TanHParameter::DEFAULT;
+constexpr TanHParameter_Engine TanHParameter::CAFFE;
+constexpr TanHParameter_Engine TanHParameter::CUDNN;
+constexpr TanHParameter_Engine TanHParameter::Engine_MIN;
+constexpr TanHParameter_Engine TanHParameter::Engine_MAX;
+constexpr int TanHParameter::Engine_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SPPParameter_PoolMethod_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[15];
+}
+bool SPPParameter_PoolMethod_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SPPParameter_PoolMethod SPPParameter::MAX;
+constexpr SPPParameter_PoolMethod SPPParameter::AVE;
+constexpr SPPParameter_PoolMethod SPPParameter::PoolMethod_MIN;
+constexpr SPPParameter_PoolMethod SPPParameter::PoolMethod_MAX;
+constexpr int SPPParameter::PoolMethod_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SPPParameter_Engine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[16];
+}
+bool SPPParameter_Engine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SPPParameter_Engine SPPParameter::DEFAULT;
+constexpr SPPParameter_Engine SPPParameter::CAFFE;
+constexpr SPPParameter_Engine SPPParameter::CUDNN;
+constexpr SPPParameter_Engine SPPParameter::Engine_MIN;
+constexpr SPPParameter_Engine SPPParameter::Engine_MAX;
+constexpr int SPPParameter::Engine_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PriorBoxParameter_CodeType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[17];
+}
+bool PriorBoxParameter_CodeType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PriorBoxParameter_CodeType PriorBoxParameter::CORNER;
+constexpr PriorBoxParameter_CodeType PriorBoxParameter::CENTER_SIZE;
+constexpr PriorBoxParameter_CodeType PriorBoxParameter::CORNER_SIZE;
+constexpr PriorBoxParameter_CodeType PriorBoxParameter::CodeType_MIN;
+constexpr PriorBoxParameter_CodeType PriorBoxParameter::CodeType_MAX;
+constexpr int PriorBoxParameter::CodeType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* V1LayerParameter_LayerType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[18];
+}
+bool V1LayerParameter_LayerType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 2:
+    case 3:
+    case 4:
+    case 6:
+    case 8:
+    case 14:
+    case 15:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 22:
+    case 23:
+    case 25:
+    case 26:
+    case 31:
+    case 33:
+    case 34:
+    case 35:
+    case 38:
+    case 39:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr V1LayerParameter_LayerType V1LayerParameter::NONE;
+constexpr V1LayerParameter_LayerType V1LayerParameter::ABSVAL;
+constexpr V1LayerParameter_LayerType V1LayerParameter::BNLL;
+constexpr V1LayerParameter_LayerType V1LayerParameter::CONCAT;
+constexpr V1LayerParameter_LayerType V1LayerParameter::CONVOLUTION;
+constexpr V1LayerParameter_LayerType V1LayerParameter::DECONVOLUTION;
+constexpr V1LayerParameter_LayerType V1LayerParameter::DROPOUT;
+constexpr V1LayerParameter_LayerType V1LayerParameter::ELTWISE;
+constexpr V1LayerParameter_LayerType V1LayerParameter::EXP;
+constexpr V1LayerParameter_LayerType V1LayerParameter::FLATTEN;
+constexpr V1LayerParameter_LayerType V1LayerParameter::INNER_PRODUCT;
+constexpr V1LayerParameter_LayerType V1LayerParameter::LRN;
+constexpr V1LayerParameter_LayerType V1LayerParameter::MVN;
+constexpr V1LayerParameter_LayerType V1LayerParameter::POOLING;
+constexpr V1LayerParameter_LayerType V1LayerParameter::POWER;
+constexpr V1LayerParameter_LayerType V1LayerParameter::RELU;
+constexpr V1LayerParameter_LayerType V1LayerParameter::SIGMOID;
+constexpr V1LayerParameter_LayerType V1LayerParameter::SOFTMAX;
+constexpr V1LayerParameter_LayerType V1LayerParameter::SPLIT;
+constexpr V1LayerParameter_LayerType V1LayerParameter::SLICE;
+constexpr V1LayerParameter_LayerType V1LayerParameter::TANH;
+constexpr V1LayerParameter_LayerType V1LayerParameter::THRESHOLD;
+constexpr V1LayerParameter_LayerType V1LayerParameter::LayerType_MIN;
+constexpr V1LayerParameter_LayerType V1LayerParameter::LayerType_MAX;
+constexpr int V1LayerParameter::LayerType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* V1LayerParameter_DimCheckMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[19];
+}
+bool V1LayerParameter_DimCheckMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr V1LayerParameter_DimCheckMode V1LayerParameter::STRICT;
+constexpr V1LayerParameter_DimCheckMode V1LayerParameter::PERMISSIVE;
+constexpr V1LayerParameter_DimCheckMode V1LayerParameter::DimCheckMode_MIN;
+constexpr V1LayerParameter_DimCheckMode V1LayerParameter::DimCheckMode_MAX;
+constexpr int V1LayerParameter::DimCheckMode_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Phase_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_caffe_2eproto);
+  return file_level_enum_descriptors_caffe_2eproto[20];
+}
+bool Phase_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class BlobShape::_Internal {
+ public:
+};
+
+BlobShape::BlobShape(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.BlobShape)
+}
+BlobShape::BlobShape(const BlobShape& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlobShape* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dim_){from._impl_.dim_}
+    , /*decltype(_impl_._dim_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:caffe.BlobShape)
+}
+
+inline void BlobShape::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dim_){arena}
+    , /*decltype(_impl_._dim_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BlobShape::~BlobShape() {
+  // @@protoc_insertion_point(destructor:caffe.BlobShape)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlobShape::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dim_.~RepeatedField();
+}
+
+void BlobShape::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlobShape::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.BlobShape)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dim_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlobShape::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int64 dim = 1 [packed = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_dim(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_dim(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlobShape::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.BlobShape)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int64 dim = 1 [packed = true];
+  {
+    int byte_size = _impl_._dim_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          1, _internal_dim(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.BlobShape)
+  return target;
+}
+
+size_t BlobShape::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.BlobShape)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int64 dim = 1 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.dim_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._dim_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlobShape::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlobShape::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlobShape::GetClassData() const { return &_class_data_; }
+
+
+void BlobShape::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlobShape*>(&to_msg);
+  auto& from = static_cast<const BlobShape&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.BlobShape)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.dim_.MergeFrom(from._impl_.dim_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlobShape::CopyFrom(const BlobShape& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.BlobShape)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlobShape::IsInitialized() const {
+  return true;
+}
+
+void BlobShape::InternalSwap(BlobShape* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.dim_.InternalSwap(&other->_impl_.dim_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlobShape::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[0]);
+}
+
+// ===================================================================
+
+class BlobProto::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BlobProto>()._impl_._has_bits_);
+  static const ::caffe::BlobShape& shape(const BlobProto* msg);
+  static void set_has_shape(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_int8_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_channels(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+const ::caffe::BlobShape&
+BlobProto::_Internal::shape(const BlobProto* msg) {
+  return *msg->_impl_.shape_;
+}
+BlobProto::BlobProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.BlobProto)
+}
+BlobProto::BlobProto(const BlobProto& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlobProto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){from._impl_.data_}
+    , decltype(_impl_.diff_){from._impl_.diff_}
+    , decltype(_impl_.double_data_){from._impl_.double_data_}
+    , decltype(_impl_.double_diff_){from._impl_.double_diff_}
+    , decltype(_impl_.int8_scale_){from._impl_.int8_scale_}
+    , decltype(_impl_.int8_data_){}
+    , decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.num_){}
+    , decltype(_impl_.channels_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.width_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.int8_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.int8_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_int8_data()) {
+    _this->_impl_.int8_data_.Set(from._internal_int8_data(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_shape()) {
+    _this->_impl_.shape_ = new ::caffe::BlobShape(*from._impl_.shape_);
+  }
+  ::memcpy(&_impl_.num_, &from._impl_.num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.width_) -
+    reinterpret_cast<char*>(&_impl_.num_)) + sizeof(_impl_.width_));
+  // @@protoc_insertion_point(copy_constructor:caffe.BlobProto)
+}
+
+inline void BlobProto::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){arena}
+    , decltype(_impl_.diff_){arena}
+    , decltype(_impl_.double_data_){arena}
+    , decltype(_impl_.double_diff_){arena}
+    , decltype(_impl_.int8_scale_){arena}
+    , decltype(_impl_.int8_data_){}
+    , decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.num_){0}
+    , decltype(_impl_.channels_){0}
+    , decltype(_impl_.height_){0}
+    , decltype(_impl_.width_){0}
+  };
+  _impl_.int8_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.int8_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BlobProto::~BlobProto() {
+  // @@protoc_insertion_point(destructor:caffe.BlobProto)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlobProto::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.~RepeatedField();
+  _impl_.diff_.~RepeatedField();
+  _impl_.double_data_.~RepeatedField();
+  _impl_.double_diff_.~RepeatedField();
+  _impl_.int8_scale_.~RepeatedField();
+  _impl_.int8_data_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.shape_;
+}
+
+void BlobProto::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlobProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.BlobProto)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.Clear();
+  _impl_.diff_.Clear();
+  _impl_.double_data_.Clear();
+  _impl_.double_diff_.Clear();
+  _impl_.int8_scale_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.int8_data_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.shape_ != nullptr);
+      _impl_.shape_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000003cu) {
+    ::memset(&_impl_.num_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.width_) -
+        reinterpret_cast<char*>(&_impl_.num_)) + sizeof(_impl_.width_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlobProto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 num = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num(&has_bits);
+          _impl_.num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 channels = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_channels(&has_bits);
+          _impl_.channels_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 height = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_height(&has_bits);
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 width = 4 [default = 0];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_width(&has_bits);
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float data = 5 [packed = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 45) {
+          _internal_add_data(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float diff = 6 [packed = true];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_diff(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 53) {
+          _internal_add_diff(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.BlobShape shape = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shape(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double double_data = 8 [packed = true];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_double_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 65) {
+          _internal_add_double_data(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double double_diff = 9 [packed = true];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_double_diff(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 73) {
+          _internal_add_double_diff(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes int8_data = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_int8_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float int8_scale = 11 [packed = true];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_int8_scale(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 93) {
+          _internal_add_int8_scale(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlobProto::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.BlobProto)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 num = 1 [default = 0];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_num(), target);
+  }
+
+  // optional int32 channels = 2 [default = 0];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_channels(), target);
+  }
+
+  // optional int32 height = 3 [default = 0];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_height(), target);
+  }
+
+  // optional int32 width = 4 [default = 0];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_width(), target);
+  }
+
+  // repeated float data = 5 [packed = true];
+  if (this->_internal_data_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_data(), target);
+  }
+
+  // repeated float diff = 6 [packed = true];
+  if (this->_internal_diff_size() > 0) {
+    target = stream->WriteFixedPacked(6, _internal_diff(), target);
+  }
+
+  // optional .caffe.BlobShape shape = 7;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::shape(this),
+        _Internal::shape(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated double double_data = 8 [packed = true];
+  if (this->_internal_double_data_size() > 0) {
+    target = stream->WriteFixedPacked(8, _internal_double_data(), target);
+  }
+
+  // repeated double double_diff = 9 [packed = true];
+  if (this->_internal_double_diff_size() > 0) {
+    target = stream->WriteFixedPacked(9, _internal_double_diff(), target);
+  }
+
+  // optional bytes int8_data = 10;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        10, this->_internal_int8_data(), target);
+  }
+
+  // repeated float int8_scale = 11 [packed = true];
+  if (this->_internal_int8_scale_size() > 0) {
+    target = stream->WriteFixedPacked(11, _internal_int8_scale(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.BlobProto)
+  return target;
+}
+
+size_t BlobProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.BlobProto)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float data = 5 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_data_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float diff = 6 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_diff_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated double double_data = 8 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_double_data_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated double double_diff = 9 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_double_diff_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float int8_scale = 11 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_int8_scale_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional bytes int8_data = 10;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_int8_data());
+    }
+
+    // optional .caffe.BlobShape shape = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.shape_);
+    }
+
+    // optional int32 num = 1 [default = 0];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num());
+    }
+
+    // optional int32 channels = 2 [default = 0];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_channels());
+    }
+
+    // optional int32 height = 3 [default = 0];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_height());
+    }
+
+    // optional int32 width = 4 [default = 0];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_width());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlobProto::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlobProto::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlobProto::GetClassData() const { return &_class_data_; }
+
+
+void BlobProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlobProto*>(&to_msg);
+  auto& from = static_cast<const BlobProto&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.BlobProto)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.data_.MergeFrom(from._impl_.data_);
+  _this->_impl_.diff_.MergeFrom(from._impl_.diff_);
+  _this->_impl_.double_data_.MergeFrom(from._impl_.double_data_);
+  _this->_impl_.double_diff_.MergeFrom(from._impl_.double_diff_);
+  _this->_impl_.int8_scale_.MergeFrom(from._impl_.int8_scale_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_int8_data(from._internal_int8_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_shape()->::caffe::BlobShape::MergeFrom(
+          from._internal_shape());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_ = from._impl_.num_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.channels_ = from._impl_.channels_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.height_ = from._impl_.height_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.width_ = from._impl_.width_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlobProto::CopyFrom(const BlobProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.BlobProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlobProto::IsInitialized() const {
+  return true;
+}
+
+void BlobProto::InternalSwap(BlobProto* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.data_.InternalSwap(&other->_impl_.data_);
+  _impl_.diff_.InternalSwap(&other->_impl_.diff_);
+  _impl_.double_data_.InternalSwap(&other->_impl_.double_data_);
+  _impl_.double_diff_.InternalSwap(&other->_impl_.double_diff_);
+  _impl_.int8_scale_.InternalSwap(&other->_impl_.int8_scale_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.int8_data_, lhs_arena,
+      &other->_impl_.int8_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BlobProto, _impl_.width_)
+      + sizeof(BlobProto::_impl_.width_)
+      - PROTOBUF_FIELD_OFFSET(BlobProto, _impl_.shape_)>(
+          reinterpret_cast<char*>(&_impl_.shape_),
+          reinterpret_cast<char*>(&other->_impl_.shape_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlobProto::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[1]);
+}
+
+// ===================================================================
+
+class BlobProtoVector::_Internal {
+ public:
+};
+
+BlobProtoVector::BlobProtoVector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.BlobProtoVector)
+}
+BlobProtoVector::BlobProtoVector(const BlobProtoVector& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlobProtoVector* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blobs_){from._impl_.blobs_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:caffe.BlobProtoVector)
+}
+
+inline void BlobProtoVector::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blobs_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BlobProtoVector::~BlobProtoVector() {
+  // @@protoc_insertion_point(destructor:caffe.BlobProtoVector)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlobProtoVector::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.blobs_.~RepeatedPtrField();
+}
+
+void BlobProtoVector::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlobProtoVector::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.BlobProtoVector)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.blobs_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlobProtoVector::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .caffe.BlobProto blobs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_blobs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlobProtoVector::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.BlobProtoVector)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .caffe.BlobProto blobs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blobs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blobs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.BlobProtoVector)
+  return target;
+}
+
+size_t BlobProtoVector::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.BlobProtoVector)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .caffe.BlobProto blobs = 1;
+  total_size += 1UL * this->_internal_blobs_size();
+  for (const auto& msg : this->_impl_.blobs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlobProtoVector::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlobProtoVector::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlobProtoVector::GetClassData() const { return &_class_data_; }
+
+
+void BlobProtoVector::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlobProtoVector*>(&to_msg);
+  auto& from = static_cast<const BlobProtoVector&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.BlobProtoVector)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.blobs_.MergeFrom(from._impl_.blobs_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlobProtoVector::CopyFrom(const BlobProtoVector& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.BlobProtoVector)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlobProtoVector::IsInitialized() const {
+  return true;
+}
+
+void BlobProtoVector::InternalSwap(BlobProtoVector* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.blobs_.InternalSwap(&other->_impl_.blobs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlobProtoVector::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[2]);
+}
+
+// ===================================================================
+
+class NormalizedBBox::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NormalizedBBox>()._impl_._has_bits_);
+  static void set_has_xmin(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_ymin(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_xmax(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ymax(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_label(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_difficult(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_score(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+};
+
+NormalizedBBox::NormalizedBBox(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.NormalizedBBox)
+}
+NormalizedBBox::NormalizedBBox(const NormalizedBBox& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NormalizedBBox* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.xmin_){}
+    , decltype(_impl_.ymin_){}
+    , decltype(_impl_.xmax_){}
+    , decltype(_impl_.ymax_){}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.difficult_){}
+    , decltype(_impl_.score_){}
+    , decltype(_impl_.size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.xmin_, &from._impl_.xmin_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.size_) -
+    reinterpret_cast<char*>(&_impl_.xmin_)) + sizeof(_impl_.size_));
+  // @@protoc_insertion_point(copy_constructor:caffe.NormalizedBBox)
+}
+
+inline void NormalizedBBox::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.xmin_){0}
+    , decltype(_impl_.ymin_){0}
+    , decltype(_impl_.xmax_){0}
+    , decltype(_impl_.ymax_){0}
+    , decltype(_impl_.label_){0}
+    , decltype(_impl_.difficult_){false}
+    , decltype(_impl_.score_){0}
+    , decltype(_impl_.size_){0}
+  };
+}
+
+NormalizedBBox::~NormalizedBBox() {
+  // @@protoc_insertion_point(destructor:caffe.NormalizedBBox)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NormalizedBBox::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void NormalizedBBox::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NormalizedBBox::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.NormalizedBBox)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.xmin_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.size_) -
+        reinterpret_cast<char*>(&_impl_.xmin_)) + sizeof(_impl_.size_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NormalizedBBox::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float xmin = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_xmin(&has_bits);
+          _impl_.xmin_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float ymin = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_ymin(&has_bits);
+          _impl_.ymin_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float xmax = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_xmax(&has_bits);
+          _impl_.xmax_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float ymax = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_ymax(&has_bits);
+          _impl_.ymax_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 label = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_label(&has_bits);
+          _impl_.label_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool difficult = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_difficult(&has_bits);
+          _impl_.difficult_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float score = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_score(&has_bits);
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NormalizedBBox::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.NormalizedBBox)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float xmin = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_xmin(), target);
+  }
+
+  // optional float ymin = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_ymin(), target);
+  }
+
+  // optional float xmax = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_xmax(), target);
+  }
+
+  // optional float ymax = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_ymax(), target);
+  }
+
+  // optional int32 label = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_label(), target);
+  }
+
+  // optional bool difficult = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_difficult(), target);
+  }
+
+  // optional float score = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_score(), target);
+  }
+
+  // optional float size = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.NormalizedBBox)
+  return target;
+}
+
+size_t NormalizedBBox::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.NormalizedBBox)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional float xmin = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float ymin = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float xmax = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float ymax = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 label = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_label());
+    }
+
+    // optional bool difficult = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional float score = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float size = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NormalizedBBox::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NormalizedBBox::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NormalizedBBox::GetClassData() const { return &_class_data_; }
+
+
+void NormalizedBBox::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NormalizedBBox*>(&to_msg);
+  auto& from = static_cast<const NormalizedBBox&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.NormalizedBBox)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.xmin_ = from._impl_.xmin_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.ymin_ = from._impl_.ymin_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.xmax_ = from._impl_.xmax_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.ymax_ = from._impl_.ymax_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.label_ = from._impl_.label_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.difficult_ = from._impl_.difficult_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.score_ = from._impl_.score_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.size_ = from._impl_.size_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NormalizedBBox::CopyFrom(const NormalizedBBox& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.NormalizedBBox)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NormalizedBBox::IsInitialized() const {
+  return true;
+}
+
+void NormalizedBBox::InternalSwap(NormalizedBBox* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NormalizedBBox, _impl_.size_)
+      + sizeof(NormalizedBBox::_impl_.size_)
+      - PROTOBUF_FIELD_OFFSET(NormalizedBBox, _impl_.xmin_)>(
+          reinterpret_cast<char*>(&_impl_.xmin_),
+          reinterpret_cast<char*>(&other->_impl_.xmin_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NormalizedBBox::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[3]);
+}
+
+// ===================================================================
+
+class FillerParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FillerParameter>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_min(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_max(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_mean(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_std(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_sparse(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_variance_norm(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString FillerParameter::Impl_::_i_give_permission_to_break_this_code_default_type_{{{"constant", 8}}, {nullptr}};
+FillerParameter::FillerParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.FillerParameter)
+}
+FillerParameter::FillerParameter(const FillerParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FillerParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.min_){}
+    , decltype(_impl_.mean_){}
+    , decltype(_impl_.variance_norm_){}
+    , decltype(_impl_.sparse_){}
+    , decltype(_impl_.max_){}
+    , decltype(_impl_.std_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.type_.InitDefault();
+  if (from._internal_has_type()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.value_, &from._impl_.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.std_) -
+    reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.std_));
+  // @@protoc_insertion_point(copy_constructor:caffe.FillerParameter)
+}
+
+inline void FillerParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.value_){0}
+    , decltype(_impl_.min_){0}
+    , decltype(_impl_.mean_){0}
+    , decltype(_impl_.variance_norm_){0}
+    , decltype(_impl_.sparse_){-1}
+    , decltype(_impl_.max_){1}
+    , decltype(_impl_.std_){1}
+  };
+  _impl_.type_.InitDefault();
+}
+
+FillerParameter::~FillerParameter() {
+  // @@protoc_insertion_point(destructor:caffe.FillerParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FillerParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.type_.Destroy();
+}
+
+void FillerParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FillerParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.FillerParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.type_.ClearToDefault(::caffe::FillerParameter::Impl_::_i_give_permission_to_break_this_code_default_type_, GetArenaForAllocation());
+     }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.value_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.variance_norm_) -
+        reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.variance_norm_));
+    _impl_.sparse_ = -1;
+    _impl_.max_ = 1;
+    _impl_.std_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FillerParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string type = 1 [default = "constant"];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.FillerParameter.type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float value = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_value(&has_bits);
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float min = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_min(&has_bits);
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float max = 4 [default = 1];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_max(&has_bits);
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float mean = 5 [default = 0];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_mean(&has_bits);
+          _impl_.mean_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float std = 6 [default = 1];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _Internal::set_has_std(&has_bits);
+          _impl_.std_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 sparse = 7 [default = -1];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_sparse(&has_bits);
+          _impl_.sparse_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter.VarianceNorm variance_norm = 8 [default = FAN_IN];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::FillerParameter_VarianceNorm_IsValid(val))) {
+            _internal_set_variance_norm(static_cast<::caffe::FillerParameter_VarianceNorm>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(8, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FillerParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.FillerParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string type = 1 [default = "constant"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.FillerParameter.type");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_type(), target);
+  }
+
+  // optional float value = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_value(), target);
+  }
+
+  // optional float min = 3 [default = 0];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_min(), target);
+  }
+
+  // optional float max = 4 [default = 1];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_max(), target);
+  }
+
+  // optional float mean = 5 [default = 0];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_mean(), target);
+  }
+
+  // optional float std = 6 [default = 1];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_std(), target);
+  }
+
+  // optional int32 sparse = 7 [default = -1];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_sparse(), target);
+  }
+
+  // optional .caffe.FillerParameter.VarianceNorm variance_norm = 8 [default = FAN_IN];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_variance_norm(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.FillerParameter)
+  return target;
+}
+
+size_t FillerParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.FillerParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string type = 1 [default = "constant"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_type());
+    }
+
+    // optional float value = 2 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float min = 3 [default = 0];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float mean = 5 [default = 0];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+    // optional .caffe.FillerParameter.VarianceNorm variance_norm = 8 [default = FAN_IN];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_variance_norm());
+    }
+
+    // optional int32 sparse = 7 [default = -1];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sparse());
+    }
+
+    // optional float max = 4 [default = 1];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float std = 6 [default = 1];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FillerParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FillerParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FillerParameter::GetClassData() const { return &_class_data_; }
+
+
+void FillerParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FillerParameter*>(&to_msg);
+  auto& from = static_cast<const FillerParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.FillerParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_type(from._internal_type());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.value_ = from._impl_.value_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.min_ = from._impl_.min_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.mean_ = from._impl_.mean_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.variance_norm_ = from._impl_.variance_norm_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.sparse_ = from._impl_.sparse_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.max_ = from._impl_.max_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.std_ = from._impl_.std_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FillerParameter::CopyFrom(const FillerParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.FillerParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FillerParameter::IsInitialized() const {
+  return true;
+}
+
+void FillerParameter::InternalSwap(FillerParameter* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FillerParameter, _impl_.variance_norm_)
+      + sizeof(FillerParameter::_impl_.variance_norm_)
+      - PROTOBUF_FIELD_OFFSET(FillerParameter, _impl_.value_)>(
+          reinterpret_cast<char*>(&_impl_.value_),
+          reinterpret_cast<char*>(&other->_impl_.value_));
+  swap(_impl_.sparse_, other->_impl_.sparse_);
+  swap(_impl_.max_, other->_impl_.max_);
+  swap(_impl_.std_, other->_impl_.std_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FillerParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[4]);
+}
+
+// ===================================================================
+
+class NetParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NetParameter>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_force_backward(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::caffe::NetState& state(const NetParameter* msg);
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_debug_info(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_optimize_memory(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_parallel_branches(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_channel_block(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_fuse_layers(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+};
+
+const ::caffe::NetState&
+NetParameter::_Internal::state(const NetParameter* msg) {
+  return *msg->_impl_.state_;
+}
+NetParameter::NetParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.NetParameter)
+}
+NetParameter::NetParameter(const NetParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NetParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.layers_){from._impl_.layers_}
+    , decltype(_impl_.input_){from._impl_.input_}
+    , decltype(_impl_.input_dim_){from._impl_.input_dim_}
+    , decltype(_impl_.input_shape_){from._impl_.input_shape_}
+    , decltype(_impl_.layer_){from._impl_.layer_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.state_){nullptr}
+    , decltype(_impl_.force_backward_){}
+    , decltype(_impl_.debug_info_){}
+    , decltype(_impl_.optimize_memory_){}
+    , decltype(_impl_.parallel_branches_){}
+    , decltype(_impl_.channel_block_){}
+    , decltype(_impl_.fuse_layers_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_state()) {
+    _this->_impl_.state_ = new ::caffe::NetState(*from._impl_.state_);
+  }
+  ::memcpy(&_impl_.force_backward_, &from._impl_.force_backward_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.fuse_layers_) -
+    reinterpret_cast<char*>(&_impl_.force_backward_)) + sizeof(_impl_.fuse_layers_));
+  // @@protoc_insertion_point(copy_constructor:caffe.NetParameter)
+}
+
+inline void NetParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.layers_){arena}
+    , decltype(_impl_.input_){arena}
+    , decltype(_impl_.input_dim_){arena}
+    , decltype(_impl_.input_shape_){arena}
+    , decltype(_impl_.layer_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.state_){nullptr}
+    , decltype(_impl_.force_backward_){false}
+    , decltype(_impl_.debug_info_){false}
+    , decltype(_impl_.optimize_memory_){false}
+    , decltype(_impl_.parallel_branches_){false}
+    , decltype(_impl_.channel_block_){0u}
+    , decltype(_impl_.fuse_layers_){false}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NetParameter::~NetParameter() {
+  // @@protoc_insertion_point(destructor:caffe.NetParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NetParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.layers_.~RepeatedPtrField();
+  _impl_.input_.~RepeatedPtrField();
+  _impl_.input_dim_.~RepeatedField();
+  _impl_.input_shape_.~RepeatedPtrField();
+  _impl_.layer_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.state_;
+}
+
+void NetParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NetParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.NetParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.layers_.Clear();
+  _impl_.input_.Clear();
+  _impl_.input_dim_.Clear();
+  _impl_.input_shape_.Clear();
+  _impl_.layer_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.state_ != nullptr);
+      _impl_.state_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.force_backward_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.fuse_layers_) -
+        reinterpret_cast<char*>(&_impl_.force_backward_)) + sizeof(_impl_.fuse_layers_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NetParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.NetParameter.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.V1LayerParameter layers = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_layers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string input = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_input();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "caffe.NetParameter.input");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 input_dim = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_input_dim(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<32>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_input_dim(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool force_backward = 5 [default = false];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_force_backward(&has_bits);
+          _impl_.force_backward_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.NetState state = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool debug_info = 7 [default = false];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_debug_info(&has_bits);
+          _impl_.debug_info_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.BlobShape input_shape = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_input_shape(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool optimize_memory = 9 [default = false];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_optimize_memory(&has_bits);
+          _impl_.optimize_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool parallel_branches = 10 [default = false];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_parallel_branches(&has_bits);
+          _impl_.parallel_branches_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 channel_block = 11 [default = 0];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_channel_block(&has_bits);
+          _impl_.channel_block_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool fuse_layers = 12 [default = false];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_fuse_layers(&has_bits);
+          _impl_.fuse_layers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.LayerParameter layer = 100;
+      case 100:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_layer(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<802>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NetParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.NetParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.NetParameter.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // repeated .caffe.V1LayerParameter layers = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_layers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_layers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated string input = 3;
+  for (int i = 0, n = this->_internal_input_size(); i < n; i++) {
+    const auto& s = this->_internal_input(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.NetParameter.input");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // repeated int32 input_dim = 4;
+  for (int i = 0, n = this->_internal_input_dim_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_input_dim(i), target);
+  }
+
+  // optional bool force_backward = 5 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_force_backward(), target);
+  }
+
+  // optional .caffe.NetState state = 6;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::state(this),
+        _Internal::state(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bool debug_info = 7 [default = false];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_debug_info(), target);
+  }
+
+  // repeated .caffe.BlobShape input_shape = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_input_shape_size()); i < n; i++) {
+    const auto& repfield = this->_internal_input_shape(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional bool optimize_memory = 9 [default = false];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_optimize_memory(), target);
+  }
+
+  // optional bool parallel_branches = 10 [default = false];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_parallel_branches(), target);
+  }
+
+  // optional uint32 channel_block = 11 [default = 0];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_channel_block(), target);
+  }
+
+  // optional bool fuse_layers = 12 [default = false];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_fuse_layers(), target);
+  }
+
+  // repeated .caffe.LayerParameter layer = 100;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_layer_size()); i < n; i++) {
+    const auto& repfield = this->_internal_layer(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(100, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.NetParameter)
+  return target;
+}
+
+size_t NetParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.NetParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .caffe.V1LayerParameter layers = 2;
+  total_size += 1UL * this->_internal_layers_size();
+  for (const auto& msg : this->_impl_.layers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string input = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.input_.size());
+  for (int i = 0, n = _impl_.input_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.input_.Get(i));
+  }
+
+  // repeated int32 input_dim = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.input_dim_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_input_dim_size());
+    total_size += data_size;
+  }
+
+  // repeated .caffe.BlobShape input_shape = 8;
+  total_size += 1UL * this->_internal_input_shape_size();
+  for (const auto& msg : this->_impl_.input_shape_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .caffe.LayerParameter layer = 100;
+  total_size += 2UL * this->_internal_layer_size();
+  for (const auto& msg : this->_impl_.layer_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional .caffe.NetState state = 6;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.state_);
+    }
+
+    // optional bool force_backward = 5 [default = false];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool debug_info = 7 [default = false];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool optimize_memory = 9 [default = false];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool parallel_branches = 10 [default = false];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 channel_block = 11 [default = 0];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_channel_block());
+    }
+
+    // optional bool fuse_layers = 12 [default = false];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NetParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NetParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NetParameter::GetClassData() const { return &_class_data_; }
+
+
+void NetParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NetParameter*>(&to_msg);
+  auto& from = static_cast<const NetParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.NetParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.layers_.MergeFrom(from._impl_.layers_);
+  _this->_impl_.input_.MergeFrom(from._impl_.input_);
+  _this->_impl_.input_dim_.MergeFrom(from._impl_.input_dim_);
+  _this->_impl_.input_shape_.MergeFrom(from._impl_.input_shape_);
+  _this->_impl_.layer_.MergeFrom(from._impl_.layer_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_state()->::caffe::NetState::MergeFrom(
+          from._internal_state());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.force_backward_ = from._impl_.force_backward_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.debug_info_ = from._impl_.debug_info_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.optimize_memory_ = from._impl_.optimize_memory_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.parallel_branches_ = from._impl_.parallel_branches_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.channel_block_ = from._impl_.channel_block_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.fuse_layers_ = from._impl_.fuse_layers_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NetParameter::CopyFrom(const NetParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.NetParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NetParameter::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.layer_))
+    return false;
+  return true;
+}
+
+void NetParameter::InternalSwap(NetParameter* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.layers_.InternalSwap(&other->_impl_.layers_);
+  _impl_.input_.InternalSwap(&other->_impl_.input_);
+  _impl_.input_dim_.InternalSwap(&other->_impl_.input_dim_);
+  _impl_.input_shape_.InternalSwap(&other->_impl_.input_shape_);
+  _impl_.layer_.InternalSwap(&other->_impl_.layer_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NetParameter, _impl_.fuse_layers_)
+      + sizeof(NetParameter::_impl_.fuse_layers_)
+      - PROTOBUF_FIELD_OFFSET(NetParameter, _impl_.state_)>(
+          reinterpret_cast<char*>(&_impl_.state_),
+          reinterpret_cast<char*>(&other->_impl_.state_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NetParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[5]);
+}
+
+// ===================================================================
+
+class NetState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NetState>()._impl_._has_bits_);
+  static void set_has_phase(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_level(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+NetState::NetState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.NetState)
+}
+NetState::NetState(const NetState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NetState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stage_){from._impl_.stage_}
+    , decltype(_impl_.level_){}
+    , decltype(_impl_.phase_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.level_, &from._impl_.level_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.phase_) -
+    reinterpret_cast<char*>(&_impl_.level_)) + sizeof(_impl_.phase_));
+  // @@protoc_insertion_point(copy_constructor:caffe.NetState)
+}
+
+inline void NetState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stage_){arena}
+    , decltype(_impl_.level_){0}
+    , decltype(_impl_.phase_){1}
+  };
+}
+
+NetState::~NetState() {
+  // @@protoc_insertion_point(destructor:caffe.NetState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NetState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stage_.~RepeatedPtrField();
+}
+
+void NetState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NetState::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.NetState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stage_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.level_ = 0;
+    _impl_.phase_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NetState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.Phase phase = 1 [default = TEST];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::Phase_IsValid(val))) {
+            _internal_set_phase(static_cast<::caffe::Phase>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 level = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_level(&has_bits);
+          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string stage = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_stage();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "caffe.NetState.stage");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NetState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.NetState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.Phase phase = 1 [default = TEST];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_phase(), target);
+  }
+
+  // optional int32 level = 2 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_level(), target);
+  }
+
+  // repeated string stage = 3;
+  for (int i = 0, n = this->_internal_stage_size(); i < n; i++) {
+    const auto& s = this->_internal_stage(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.NetState.stage");
+    target = stream->WriteString(3, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.NetState)
+  return target;
+}
+
+size_t NetState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.NetState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string stage = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.stage_.size());
+  for (int i = 0, n = _impl_.stage_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.stage_.Get(i));
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 level = 2 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_level());
+    }
+
+    // optional .caffe.Phase phase = 1 [default = TEST];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_phase());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NetState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NetState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NetState::GetClassData() const { return &_class_data_; }
+
+
+void NetState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NetState*>(&to_msg);
+  auto& from = static_cast<const NetState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.NetState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stage_.MergeFrom(from._impl_.stage_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.level_ = from._impl_.level_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.phase_ = from._impl_.phase_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NetState::CopyFrom(const NetState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.NetState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NetState::IsInitialized() const {
+  return true;
+}
+
+void NetState::InternalSwap(NetState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.stage_.InternalSwap(&other->_impl_.stage_);
+  swap(_impl_.level_, other->_impl_.level_);
+  swap(_impl_.phase_, other->_impl_.phase_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NetState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[6]);
+}
+
+// ===================================================================
+
+class NetStateRule::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NetStateRule>()._impl_._has_bits_);
+  static void set_has_phase(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_min_level(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_max_level(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+NetStateRule::NetStateRule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.NetStateRule)
+}
+NetStateRule::NetStateRule(const NetStateRule& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NetStateRule* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stage_){from._impl_.stage_}
+    , decltype(_impl_.not_stage_){from._impl_.not_stage_}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.min_level_){}
+    , decltype(_impl_.max_level_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.phase_, &from._impl_.phase_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_level_) -
+    reinterpret_cast<char*>(&_impl_.phase_)) + sizeof(_impl_.max_level_));
+  // @@protoc_insertion_point(copy_constructor:caffe.NetStateRule)
+}
+
+inline void NetStateRule::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stage_){arena}
+    , decltype(_impl_.not_stage_){arena}
+    , decltype(_impl_.phase_){0}
+    , decltype(_impl_.min_level_){0}
+    , decltype(_impl_.max_level_){0}
+  };
+}
+
+NetStateRule::~NetStateRule() {
+  // @@protoc_insertion_point(destructor:caffe.NetStateRule)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NetStateRule::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stage_.~RepeatedPtrField();
+  _impl_.not_stage_.~RepeatedPtrField();
+}
+
+void NetStateRule::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NetStateRule::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.NetStateRule)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stage_.Clear();
+  _impl_.not_stage_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.phase_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_level_) -
+        reinterpret_cast<char*>(&_impl_.phase_)) + sizeof(_impl_.max_level_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NetStateRule::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.Phase phase = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::Phase_IsValid(val))) {
+            _internal_set_phase(static_cast<::caffe::Phase>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 min_level = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_min_level(&has_bits);
+          _impl_.min_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 max_level = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_max_level(&has_bits);
+          _impl_.max_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string stage = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_stage();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "caffe.NetStateRule.stage");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string not_stage = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_not_stage();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "caffe.NetStateRule.not_stage");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NetStateRule::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.NetStateRule)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.Phase phase = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_phase(), target);
+  }
+
+  // optional int32 min_level = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_min_level(), target);
+  }
+
+  // optional int32 max_level = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_max_level(), target);
+  }
+
+  // repeated string stage = 4;
+  for (int i = 0, n = this->_internal_stage_size(); i < n; i++) {
+    const auto& s = this->_internal_stage(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.NetStateRule.stage");
+    target = stream->WriteString(4, s, target);
+  }
+
+  // repeated string not_stage = 5;
+  for (int i = 0, n = this->_internal_not_stage_size(); i < n; i++) {
+    const auto& s = this->_internal_not_stage(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.NetStateRule.not_stage");
+    target = stream->WriteString(5, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.NetStateRule)
+  return target;
+}
+
+size_t NetStateRule::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.NetStateRule)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string stage = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.stage_.size());
+  for (int i = 0, n = _impl_.stage_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.stage_.Get(i));
+  }
+
+  // repeated string not_stage = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.not_stage_.size());
+  for (int i = 0, n = _impl_.not_stage_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.not_stage_.Get(i));
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .caffe.Phase phase = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_phase());
+    }
+
+    // optional int32 min_level = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_min_level());
+    }
+
+    // optional int32 max_level = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_level());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NetStateRule::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NetStateRule::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NetStateRule::GetClassData() const { return &_class_data_; }
+
+
+void NetStateRule::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NetStateRule*>(&to_msg);
+  auto& from = static_cast<const NetStateRule&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.NetStateRule)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stage_.MergeFrom(from._impl_.stage_);
+  _this->_impl_.not_stage_.MergeFrom(from._impl_.not_stage_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.phase_ = from._impl_.phase_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.min_level_ = from._impl_.min_level_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.max_level_ = from._impl_.max_level_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NetStateRule::CopyFrom(const NetStateRule& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.NetStateRule)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NetStateRule::IsInitialized() const {
+  return true;
+}
+
+void NetStateRule::InternalSwap(NetStateRule* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.stage_.InternalSwap(&other->_impl_.stage_);
+  _impl_.not_stage_.InternalSwap(&other->_impl_.not_stage_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NetStateRule, _impl_.max_level_)
+      + sizeof(NetStateRule::_impl_.max_level_)
+      - PROTOBUF_FIELD_OFFSET(NetStateRule, _impl_.phase_)>(
+          reinterpret_cast<char*>(&_impl_.phase_),
+          reinterpret_cast<char*>(&other->_impl_.phase_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NetStateRule::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[7]);
+}
+
+// ===================================================================
+
+class ParamSpec::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ParamSpec>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_share_mode(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lr_mult(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_decay_mult(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+ParamSpec::ParamSpec(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ParamSpec)
+}
+ParamSpec::ParamSpec(const ParamSpec& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ParamSpec* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.share_mode_){}
+    , decltype(_impl_.lr_mult_){}
+    , decltype(_impl_.decay_mult_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.share_mode_, &from._impl_.share_mode_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.decay_mult_) -
+    reinterpret_cast<char*>(&_impl_.share_mode_)) + sizeof(_impl_.decay_mult_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ParamSpec)
+}
+
+inline void ParamSpec::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.share_mode_){0}
+    , decltype(_impl_.lr_mult_){1}
+    , decltype(_impl_.decay_mult_){1}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ParamSpec::~ParamSpec() {
+  // @@protoc_insertion_point(destructor:caffe.ParamSpec)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ParamSpec::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void ParamSpec::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ParamSpec::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ParamSpec)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    _impl_.share_mode_ = 0;
+    _impl_.lr_mult_ = 1;
+    _impl_.decay_mult_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ParamSpec::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.ParamSpec.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ParamSpec.DimCheckMode share_mode = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::ParamSpec_DimCheckMode_IsValid(val))) {
+            _internal_set_share_mode(static_cast<::caffe::ParamSpec_DimCheckMode>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float lr_mult = 3 [default = 1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_lr_mult(&has_bits);
+          _impl_.lr_mult_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float decay_mult = 4 [default = 1];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_decay_mult(&has_bits);
+          _impl_.decay_mult_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ParamSpec::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ParamSpec)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.ParamSpec.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional .caffe.ParamSpec.DimCheckMode share_mode = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_share_mode(), target);
+  }
+
+  // optional float lr_mult = 3 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_lr_mult(), target);
+  }
+
+  // optional float decay_mult = 4 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_decay_mult(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ParamSpec)
+  return target;
+}
+
+size_t ParamSpec::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ParamSpec)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional .caffe.ParamSpec.DimCheckMode share_mode = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_share_mode());
+    }
+
+    // optional float lr_mult = 3 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float decay_mult = 4 [default = 1];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParamSpec::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ParamSpec::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParamSpec::GetClassData() const { return &_class_data_; }
+
+
+void ParamSpec::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ParamSpec*>(&to_msg);
+  auto& from = static_cast<const ParamSpec&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ParamSpec)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.share_mode_ = from._impl_.share_mode_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lr_mult_ = from._impl_.lr_mult_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.decay_mult_ = from._impl_.decay_mult_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ParamSpec::CopyFrom(const ParamSpec& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ParamSpec)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ParamSpec::IsInitialized() const {
+  return true;
+}
+
+void ParamSpec::InternalSwap(ParamSpec* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.share_mode_, other->_impl_.share_mode_);
+  swap(_impl_.lr_mult_, other->_impl_.lr_mult_);
+  swap(_impl_.decay_mult_, other->_impl_.decay_mult_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ParamSpec::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[8]);
+}
+
+// ===================================================================
+
+class LayerParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LayerParameter>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_phase(HasBits* has_bits) {
+    (*has_bits)[1] |= 16384u;
+  }
+  static const ::caffe::LossParameter& loss_param(const LayerParameter* msg);
+  static void set_has_loss_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::caffe::ArgMaxParameter& argmax_param(const LayerParameter* msg);
+  static void set_has_argmax_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::caffe::BatchNormParameter& batch_norm_param(const LayerParameter* msg);
+  static void set_has_batch_norm_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::caffe::BiasParameter& bias_param(const LayerParameter* msg);
+  static void set_has_bias_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::caffe::BNParameter& bn_param(const LayerParameter* msg);
+  static void set_has_bn_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::caffe::ConcatParameter& concat_param(const LayerParameter* msg);
+  static void set_has_concat_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::caffe::ConvolutionParameter& convolution_param(const LayerParameter* msg);
+  static void set_has_convolution_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::caffe::CropParameter& crop_param(const LayerParameter* msg);
+  static void set_has_crop_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::caffe::DropoutParameter& dropout_param(const LayerParameter* msg);
+  static void set_has_dropout_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::caffe::EltwiseParameter& eltwise_param(const LayerParameter* msg);
+  static void set_has_eltwise_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static const ::caffe::ELUParameter& elu_param(const LayerParameter* msg);
+  static void set_has_elu_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static const ::caffe::EmbedParameter& embed_param(const LayerParameter* msg);
+  static void set_has_embed_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static const ::caffe::ExpParameter& exp_param(const LayerParameter* msg);
+  static void set_has_exp_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static const ::caffe::FlattenParameter& flatten_param(const LayerParameter* msg);
+  static void set_has_flatten_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static const ::caffe::InnerProductParameter& inner_product_param(const LayerParameter* msg);
+  static void set_has_inner_product_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static const ::caffe::InputParameter& input_param(const LayerParameter* msg);
+  static void set_has_input_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static const ::caffe::LogParameter& log_param(const LayerParameter* msg);
+  static void set_has_log_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static const ::caffe::LRNParameter& lrn_param(const LayerParameter* msg);
+  static void set_has_lrn_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static const ::caffe::MVNParameter& mvn_param(const LayerParameter* msg);
+  static void set_has_mvn_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static const ::caffe::ParameterParameter& parameter_param(const LayerParameter* msg);
+  static void set_has_parameter_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static const ::caffe::PoolingParameter& pooling_param(const LayerParameter* msg);
+  static void set_has_pooling_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+  static const ::caffe::PowerParameter& power_param(const LayerParameter* msg);
+  static void set_has_power_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 8388608u;
+  }
+  static const ::caffe::PReLUParameter& prelu_param(const LayerParameter* msg);
+  static void set_has_prelu_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 16777216u;
+  }
+  static const ::caffe::ProposalParameter& proposal_param(const LayerParameter* msg);
+  static void set_has_proposal_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 33554432u;
+  }
+  static const ::caffe::PSROIPoolingParameter& psroi_pooling_param(const LayerParameter* msg);
+  static void set_has_psroi_pooling_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 67108864u;
+  }
+  static const ::caffe::ReductionParameter& reduction_param(const LayerParameter* msg);
+  static void set_has_reduction_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 134217728u;
+  }
+  static const ::caffe::ReLUParameter& relu_param(const LayerParameter* msg);
+  static void set_has_relu_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 268435456u;
+  }
+  static const ::caffe::ReshapeParameter& reshape_param(const LayerParameter* msg);
+  static void set_has_reshape_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 536870912u;
+  }
+  static const ::caffe::ROIPoolingParameter& roi_pooling_param(const LayerParameter* msg);
+  static void set_has_roi_pooling_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 1073741824u;
+  }
+  static const ::caffe::ScaleParameter& scale_param(const LayerParameter* msg);
+  static void set_has_scale_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 2147483648u;
+  }
+  static const ::caffe::SigmoidParameter& sigmoid_param(const LayerParameter* msg);
+  static void set_has_sigmoid_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 1u;
+  }
+  static const ::caffe::SoftmaxParameter& softmax_param(const LayerParameter* msg);
+  static void set_has_softmax_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 2u;
+  }
+  static const ::caffe::SPPParameter& spp_param(const LayerParameter* msg);
+  static void set_has_spp_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 4u;
+  }
+  static const ::caffe::SliceParameter& slice_param(const LayerParameter* msg);
+  static void set_has_slice_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 8u;
+  }
+  static const ::caffe::TanHParameter& tanh_param(const LayerParameter* msg);
+  static void set_has_tanh_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 16u;
+  }
+  static const ::caffe::ThresholdParameter& threshold_param(const LayerParameter* msg);
+  static void set_has_threshold_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 32u;
+  }
+  static const ::caffe::TileParameter& tile_param(const LayerParameter* msg);
+  static void set_has_tile_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 64u;
+  }
+  static const ::caffe::DetectionOutputParameter& detection_output_param(const LayerParameter* msg);
+  static void set_has_detection_output_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 128u;
+  }
+  static const ::caffe::PermuteParameter& permute_param(const LayerParameter* msg);
+  static void set_has_permute_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 256u;
+  }
+  static const ::caffe::PriorBoxParameter& prior_box_param(const LayerParameter* msg);
+  static void set_has_prior_box_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 512u;
+  }
+  static const ::caffe::ShuffleChannelParameter& shuffle_channel_param(const LayerParameter* msg);
+  static void set_has_shuffle_channel_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 1024u;
+  }
+  static const ::caffe::NormalizeParameter& norm_param(const LayerParameter* msg);
+  static void set_has_norm_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 2048u;
+  }
+  static const ::caffe::ReorderParameter& reorder_param(const LayerParameter* msg);
+  static void set_has_reorder_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 4096u;
+  }
+  static const ::caffe::QuantizationParameter& quantization_param(const LayerParameter* msg);
+  static void set_has_quantization_param(HasBits* has_bits) {
+    (*has_bits)[1] |= 8192u;
+  }
+};
+
+const ::caffe::LossParameter&
+LayerParameter::_Internal::loss_param(const LayerParameter* msg) {
+  return *msg->_impl_.loss_param_;
+}
+const ::caffe::ArgMaxParameter&
+LayerParameter::_Internal::argmax_param(const LayerParameter* msg) {
+  return *msg->_impl_.argmax_param_;
+}
+const ::caffe::BatchNormParameter&
+LayerParameter::_Internal::batch_norm_param(const LayerParameter* msg) {
+  return *msg->_impl_.batch_norm_param_;
+}
+const ::caffe::BiasParameter&
+LayerParameter::_Internal::bias_param(const LayerParameter* msg) {
+  return *msg->_impl_.bias_param_;
+}
+const ::caffe::BNParameter&
+LayerParameter::_Internal::bn_param(const LayerParameter* msg) {
+  return *msg->_impl_.bn_param_;
+}
+const ::caffe::ConcatParameter&
+LayerParameter::_Internal::concat_param(const LayerParameter* msg) {
+  return *msg->_impl_.concat_param_;
+}
+const ::caffe::ConvolutionParameter&
+LayerParameter::_Internal::convolution_param(const LayerParameter* msg) {
+  return *msg->_impl_.convolution_param_;
+}
+const ::caffe::CropParameter&
+LayerParameter::_Internal::crop_param(const LayerParameter* msg) {
+  return *msg->_impl_.crop_param_;
+}
+const ::caffe::DropoutParameter&
+LayerParameter::_Internal::dropout_param(const LayerParameter* msg) {
+  return *msg->_impl_.dropout_param_;
+}
+const ::caffe::EltwiseParameter&
+LayerParameter::_Internal::eltwise_param(const LayerParameter* msg) {
+  return *msg->_impl_.eltwise_param_;
+}
+const ::caffe::ELUParameter&
+LayerParameter::_Internal::elu_param(const LayerParameter* msg) {
+  return *msg->_impl_.elu_param_;
+}
+const ::caffe::EmbedParameter&
+LayerParameter::_Internal::embed_param(const LayerParameter* msg) {
+  return *msg->_impl_.embed_param_;
+}
+const ::caffe::ExpParameter&
+LayerParameter::_Internal::exp_param(const LayerParameter* msg) {
+  return *msg->_impl_.exp_param_;
+}
+const ::caffe::FlattenParameter&
+LayerParameter::_Internal::flatten_param(const LayerParameter* msg) {
+  return *msg->_impl_.flatten_param_;
+}
+const ::caffe::InnerProductParameter&
+LayerParameter::_Internal::inner_product_param(const LayerParameter* msg) {
+  return *msg->_impl_.inner_product_param_;
+}
+const ::caffe::InputParameter&
+LayerParameter::_Internal::input_param(const LayerParameter* msg) {
+  return *msg->_impl_.input_param_;
+}
+const ::caffe::LogParameter&
+LayerParameter::_Internal::log_param(const LayerParameter* msg) {
+  return *msg->_impl_.log_param_;
+}
+const ::caffe::LRNParameter&
+LayerParameter::_Internal::lrn_param(const LayerParameter* msg) {
+  return *msg->_impl_.lrn_param_;
+}
+const ::caffe::MVNParameter&
+LayerParameter::_Internal::mvn_param(const LayerParameter* msg) {
+  return *msg->_impl_.mvn_param_;
+}
+const ::caffe::ParameterParameter&
+LayerParameter::_Internal::parameter_param(const LayerParameter* msg) {
+  return *msg->_impl_.parameter_param_;
+}
+const ::caffe::PoolingParameter&
+LayerParameter::_Internal::pooling_param(const LayerParameter* msg) {
+  return *msg->_impl_.pooling_param_;
+}
+const ::caffe::PowerParameter&
+LayerParameter::_Internal::power_param(const LayerParameter* msg) {
+  return *msg->_impl_.power_param_;
+}
+const ::caffe::PReLUParameter&
+LayerParameter::_Internal::prelu_param(const LayerParameter* msg) {
+  return *msg->_impl_.prelu_param_;
+}
+const ::caffe::ProposalParameter&
+LayerParameter::_Internal::proposal_param(const LayerParameter* msg) {
+  return *msg->_impl_.proposal_param_;
+}
+const ::caffe::PSROIPoolingParameter&
+LayerParameter::_Internal::psroi_pooling_param(const LayerParameter* msg) {
+  return *msg->_impl_.psroi_pooling_param_;
+}
+const ::caffe::ReductionParameter&
+LayerParameter::_Internal::reduction_param(const LayerParameter* msg) {
+  return *msg->_impl_.reduction_param_;
+}
+const ::caffe::ReLUParameter&
+LayerParameter::_Internal::relu_param(const LayerParameter* msg) {
+  return *msg->_impl_.relu_param_;
+}
+const ::caffe::ReshapeParameter&
+LayerParameter::_Internal::reshape_param(const LayerParameter* msg) {
+  return *msg->_impl_.reshape_param_;
+}
+const ::caffe::ROIPoolingParameter&
+LayerParameter::_Internal::roi_pooling_param(const LayerParameter* msg) {
+  return *msg->_impl_.roi_pooling_param_;
+}
+const ::caffe::ScaleParameter&
+LayerParameter::_Internal::scale_param(const LayerParameter* msg) {
+  return *msg->_impl_.scale_param_;
+}
+const ::caffe::SigmoidParameter&
+LayerParameter::_Internal::sigmoid_param(const LayerParameter* msg) {
+  return *msg->_impl_.sigmoid_param_;
+}
+const ::caffe::SoftmaxParameter&
+LayerParameter::_Internal::softmax_param(const LayerParameter* msg) {
+  return *msg->_impl_.softmax_param_;
+}
+const ::caffe::SPPParameter&
+LayerParameter::_Internal::spp_param(const LayerParameter* msg) {
+  return *msg->_impl_.spp_param_;
+}
+const ::caffe::SliceParameter&
+LayerParameter::_Internal::slice_param(const LayerParameter* msg) {
+  return *msg->_impl_.slice_param_;
+}
+const ::caffe::TanHParameter&
+LayerParameter::_Internal::tanh_param(const LayerParameter* msg) {
+  return *msg->_impl_.tanh_param_;
+}
+const ::caffe::ThresholdParameter&
+LayerParameter::_Internal::threshold_param(const LayerParameter* msg) {
+  return *msg->_impl_.threshold_param_;
+}
+const ::caffe::TileParameter&
+LayerParameter::_Internal::tile_param(const LayerParameter* msg) {
+  return *msg->_impl_.tile_param_;
+}
+const ::caffe::DetectionOutputParameter&
+LayerParameter::_Internal::detection_output_param(const LayerParameter* msg) {
+  return *msg->_impl_.detection_output_param_;
+}
+const ::caffe::PermuteParameter&
+LayerParameter::_Internal::permute_param(const LayerParameter* msg) {
+  return *msg->_impl_.permute_param_;
+}
+const ::caffe::PriorBoxParameter&
+LayerParameter::_Internal::prior_box_param(const LayerParameter* msg) {
+  return *msg->_impl_.prior_box_param_;
+}
+const ::caffe::ShuffleChannelParameter&
+LayerParameter::_Internal::shuffle_channel_param(const LayerParameter* msg) {
+  return *msg->_impl_.shuffle_channel_param_;
+}
+const ::caffe::NormalizeParameter&
+LayerParameter::_Internal::norm_param(const LayerParameter* msg) {
+  return *msg->_impl_.norm_param_;
+}
+const ::caffe::ReorderParameter&
+LayerParameter::_Internal::reorder_param(const LayerParameter* msg) {
+  return *msg->_impl_.reorder_param_;
+}
+const ::caffe::QuantizationParameter&
+LayerParameter::_Internal::quantization_param(const LayerParameter* msg) {
+  return *msg->_impl_.quantization_param_;
+}
+LayerParameter::LayerParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.LayerParameter)
+}
+LayerParameter::LayerParameter(const LayerParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LayerParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_){from._impl_.bottom_}
+    , decltype(_impl_.top_){from._impl_.top_}
+    , decltype(_impl_.loss_weight_){from._impl_.loss_weight_}
+    , decltype(_impl_.param_){from._impl_.param_}
+    , decltype(_impl_.blobs_){from._impl_.blobs_}
+    , decltype(_impl_.include_){from._impl_.include_}
+    , decltype(_impl_.exclude_){from._impl_.exclude_}
+    , decltype(_impl_.propagate_down_){from._impl_.propagate_down_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.loss_param_){nullptr}
+    , decltype(_impl_.argmax_param_){nullptr}
+    , decltype(_impl_.batch_norm_param_){nullptr}
+    , decltype(_impl_.bias_param_){nullptr}
+    , decltype(_impl_.bn_param_){nullptr}
+    , decltype(_impl_.concat_param_){nullptr}
+    , decltype(_impl_.convolution_param_){nullptr}
+    , decltype(_impl_.crop_param_){nullptr}
+    , decltype(_impl_.dropout_param_){nullptr}
+    , decltype(_impl_.eltwise_param_){nullptr}
+    , decltype(_impl_.elu_param_){nullptr}
+    , decltype(_impl_.embed_param_){nullptr}
+    , decltype(_impl_.exp_param_){nullptr}
+    , decltype(_impl_.flatten_param_){nullptr}
+    , decltype(_impl_.inner_product_param_){nullptr}
+    , decltype(_impl_.input_param_){nullptr}
+    , decltype(_impl_.log_param_){nullptr}
+    , decltype(_impl_.lrn_param_){nullptr}
+    , decltype(_impl_.mvn_param_){nullptr}
+    , decltype(_impl_.parameter_param_){nullptr}
+    , decltype(_impl_.pooling_param_){nullptr}
+    , decltype(_impl_.power_param_){nullptr}
+    , decltype(_impl_.prelu_param_){nullptr}
+    , decltype(_impl_.proposal_param_){nullptr}
+    , decltype(_impl_.psroi_pooling_param_){nullptr}
+    , decltype(_impl_.reduction_param_){nullptr}
+    , decltype(_impl_.relu_param_){nullptr}
+    , decltype(_impl_.reshape_param_){nullptr}
+    , decltype(_impl_.roi_pooling_param_){nullptr}
+    , decltype(_impl_.scale_param_){nullptr}
+    , decltype(_impl_.sigmoid_param_){nullptr}
+    , decltype(_impl_.softmax_param_){nullptr}
+    , decltype(_impl_.spp_param_){nullptr}
+    , decltype(_impl_.slice_param_){nullptr}
+    , decltype(_impl_.tanh_param_){nullptr}
+    , decltype(_impl_.threshold_param_){nullptr}
+    , decltype(_impl_.tile_param_){nullptr}
+    , decltype(_impl_.detection_output_param_){nullptr}
+    , decltype(_impl_.permute_param_){nullptr}
+    , decltype(_impl_.prior_box_param_){nullptr}
+    , decltype(_impl_.shuffle_channel_param_){nullptr}
+    , decltype(_impl_.norm_param_){nullptr}
+    , decltype(_impl_.reorder_param_){nullptr}
+    , decltype(_impl_.quantization_param_){nullptr}
+    , decltype(_impl_.phase_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_type()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_loss_param()) {
+    _this->_impl_.loss_param_ = new ::caffe::LossParameter(*from._impl_.loss_param_);
+  }
+  if (from._internal_has_argmax_param()) {
+    _this->_impl_.argmax_param_ = new ::caffe::ArgMaxParameter(*from._impl_.argmax_param_);
+  }
+  if (from._internal_has_batch_norm_param()) {
+    _this->_impl_.batch_norm_param_ = new ::caffe::BatchNormParameter(*from._impl_.batch_norm_param_);
+  }
+  if (from._internal_has_bias_param()) {
+    _this->_impl_.bias_param_ = new ::caffe::BiasParameter(*from._impl_.bias_param_);
+  }
+  if (from._internal_has_bn_param()) {
+    _this->_impl_.bn_param_ = new ::caffe::BNParameter(*from._impl_.bn_param_);
+  }
+  if (from._internal_has_concat_param()) {
+    _this->_impl_.concat_param_ = new ::caffe::ConcatParameter(*from._impl_.concat_param_);
+  }
+  if (from._internal_has_convolution_param()) {
+    _this->_impl_.convolution_param_ = new ::caffe::ConvolutionParameter(*from._impl_.convolution_param_);
+  }
+  if (from._internal_has_crop_param()) {
+    _this->_impl_.crop_param_ = new ::caffe::CropParameter(*from._impl_.crop_param_);
+  }
+  if (from._internal_has_dropout_param()) {
+    _this->_impl_.dropout_param_ = new ::caffe::DropoutParameter(*from._impl_.dropout_param_);
+  }
+  if (from._internal_has_eltwise_param()) {
+    _this->_impl_.eltwise_param_ = new ::caffe::EltwiseParameter(*from._impl_.eltwise_param_);
+  }
+  if (from._internal_has_elu_param()) {
+    _this->_impl_.elu_param_ = new ::caffe::ELUParameter(*from._impl_.elu_param_);
+  }
+  if (from._internal_has_embed_param()) {
+    _this->_impl_.embed_param_ = new ::caffe::EmbedParameter(*from._impl_.embed_param_);
+  }
+  if (from._internal_has_exp_param()) {
+    _this->_impl_.exp_param_ = new ::caffe::ExpParameter(*from._impl_.exp_param_);
+  }
+  if (from._internal_has_flatten_param()) {
+    _this->_impl_.flatten_param_ = new ::caffe::FlattenParameter(*from._impl_.flatten_param_);
+  }
+  if (from._internal_has_inner_product_param()) {
+    _this->_impl_.inner_product_param_ = new ::caffe::InnerProductParameter(*from._impl_.inner_product_param_);
+  }
+  if (from._internal_has_input_param()) {
+    _this->_impl_.input_param_ = new ::caffe::InputParameter(*from._impl_.input_param_);
+  }
+  if (from._internal_has_log_param()) {
+    _this->_impl_.log_param_ = new ::caffe::LogParameter(*from._impl_.log_param_);
+  }
+  if (from._internal_has_lrn_param()) {
+    _this->_impl_.lrn_param_ = new ::caffe::LRNParameter(*from._impl_.lrn_param_);
+  }
+  if (from._internal_has_mvn_param()) {
+    _this->_impl_.mvn_param_ = new ::caffe::MVNParameter(*from._impl_.mvn_param_);
+  }
+  if (from._internal_has_parameter_param()) {
+    _this->_impl_.parameter_param_ = new ::caffe::ParameterParameter(*from._impl_.parameter_param_);
+  }
+  if (from._internal_has_pooling_param()) {
+    _this->_impl_.pooling_param_ = new ::caffe::PoolingParameter(*from._impl_.pooling_param_);
+  }
+  if (from._internal_has_power_param()) {
+    _this->_impl_.power_param_ = new ::caffe::PowerParameter(*from._impl_.power_param_);
+  }
+  if (from._internal_has_prelu_param()) {
+    _this->_impl_.prelu_param_ = new ::caffe::PReLUParameter(*from._impl_.prelu_param_);
+  }
+  if (from._internal_has_proposal_param()) {
+    _this->_impl_.proposal_param_ = new ::caffe::ProposalParameter(*from._impl_.proposal_param_);
+  }
+  if (from._internal_has_psroi_pooling_param()) {
+    _this->_impl_.psroi_pooling_param_ = new ::caffe::PSROIPoolingParameter(*from._impl_.psroi_pooling_param_);
+  }
+  if (from._internal_has_reduction_param()) {
+    _this->_impl_.reduction_param_ = new ::caffe::ReductionParameter(*from._impl_.reduction_param_);
+  }
+  if (from._internal_has_relu_param()) {
+    _this->_impl_.relu_param_ = new ::caffe::ReLUParameter(*from._impl_.relu_param_);
+  }
+  if (from._internal_has_reshape_param()) {
+    _this->_impl_.reshape_param_ = new ::caffe::ReshapeParameter(*from._impl_.reshape_param_);
+  }
+  if (from._internal_has_roi_pooling_param()) {
+    _this->_impl_.roi_pooling_param_ = new ::caffe::ROIPoolingParameter(*from._impl_.roi_pooling_param_);
+  }
+  if (from._internal_has_scale_param()) {
+    _this->_impl_.scale_param_ = new ::caffe::ScaleParameter(*from._impl_.scale_param_);
+  }
+  if (from._internal_has_sigmoid_param()) {
+    _this->_impl_.sigmoid_param_ = new ::caffe::SigmoidParameter(*from._impl_.sigmoid_param_);
+  }
+  if (from._internal_has_softmax_param()) {
+    _this->_impl_.softmax_param_ = new ::caffe::SoftmaxParameter(*from._impl_.softmax_param_);
+  }
+  if (from._internal_has_spp_param()) {
+    _this->_impl_.spp_param_ = new ::caffe::SPPParameter(*from._impl_.spp_param_);
+  }
+  if (from._internal_has_slice_param()) {
+    _this->_impl_.slice_param_ = new ::caffe::SliceParameter(*from._impl_.slice_param_);
+  }
+  if (from._internal_has_tanh_param()) {
+    _this->_impl_.tanh_param_ = new ::caffe::TanHParameter(*from._impl_.tanh_param_);
+  }
+  if (from._internal_has_threshold_param()) {
+    _this->_impl_.threshold_param_ = new ::caffe::ThresholdParameter(*from._impl_.threshold_param_);
+  }
+  if (from._internal_has_tile_param()) {
+    _this->_impl_.tile_param_ = new ::caffe::TileParameter(*from._impl_.tile_param_);
+  }
+  if (from._internal_has_detection_output_param()) {
+    _this->_impl_.detection_output_param_ = new ::caffe::DetectionOutputParameter(*from._impl_.detection_output_param_);
+  }
+  if (from._internal_has_permute_param()) {
+    _this->_impl_.permute_param_ = new ::caffe::PermuteParameter(*from._impl_.permute_param_);
+  }
+  if (from._internal_has_prior_box_param()) {
+    _this->_impl_.prior_box_param_ = new ::caffe::PriorBoxParameter(*from._impl_.prior_box_param_);
+  }
+  if (from._internal_has_shuffle_channel_param()) {
+    _this->_impl_.shuffle_channel_param_ = new ::caffe::ShuffleChannelParameter(*from._impl_.shuffle_channel_param_);
+  }
+  if (from._internal_has_norm_param()) {
+    _this->_impl_.norm_param_ = new ::caffe::NormalizeParameter(*from._impl_.norm_param_);
+  }
+  if (from._internal_has_reorder_param()) {
+    _this->_impl_.reorder_param_ = new ::caffe::ReorderParameter(*from._impl_.reorder_param_);
+  }
+  if (from._internal_has_quantization_param()) {
+    _this->_impl_.quantization_param_ = new ::caffe::QuantizationParameter(*from._impl_.quantization_param_);
+  }
+  _this->_impl_.phase_ = from._impl_.phase_;
+  // @@protoc_insertion_point(copy_constructor:caffe.LayerParameter)
+}
+
+inline void LayerParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_){arena}
+    , decltype(_impl_.top_){arena}
+    , decltype(_impl_.loss_weight_){arena}
+    , decltype(_impl_.param_){arena}
+    , decltype(_impl_.blobs_){arena}
+    , decltype(_impl_.include_){arena}
+    , decltype(_impl_.exclude_){arena}
+    , decltype(_impl_.propagate_down_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.loss_param_){nullptr}
+    , decltype(_impl_.argmax_param_){nullptr}
+    , decltype(_impl_.batch_norm_param_){nullptr}
+    , decltype(_impl_.bias_param_){nullptr}
+    , decltype(_impl_.bn_param_){nullptr}
+    , decltype(_impl_.concat_param_){nullptr}
+    , decltype(_impl_.convolution_param_){nullptr}
+    , decltype(_impl_.crop_param_){nullptr}
+    , decltype(_impl_.dropout_param_){nullptr}
+    , decltype(_impl_.eltwise_param_){nullptr}
+    , decltype(_impl_.elu_param_){nullptr}
+    , decltype(_impl_.embed_param_){nullptr}
+    , decltype(_impl_.exp_param_){nullptr}
+    , decltype(_impl_.flatten_param_){nullptr}
+    , decltype(_impl_.inner_product_param_){nullptr}
+    , decltype(_impl_.input_param_){nullptr}
+    , decltype(_impl_.log_param_){nullptr}
+    , decltype(_impl_.lrn_param_){nullptr}
+    , decltype(_impl_.mvn_param_){nullptr}
+    , decltype(_impl_.parameter_param_){nullptr}
+    , decltype(_impl_.pooling_param_){nullptr}
+    , decltype(_impl_.power_param_){nullptr}
+    , decltype(_impl_.prelu_param_){nullptr}
+    , decltype(_impl_.proposal_param_){nullptr}
+    , decltype(_impl_.psroi_pooling_param_){nullptr}
+    , decltype(_impl_.reduction_param_){nullptr}
+    , decltype(_impl_.relu_param_){nullptr}
+    , decltype(_impl_.reshape_param_){nullptr}
+    , decltype(_impl_.roi_pooling_param_){nullptr}
+    , decltype(_impl_.scale_param_){nullptr}
+    , decltype(_impl_.sigmoid_param_){nullptr}
+    , decltype(_impl_.softmax_param_){nullptr}
+    , decltype(_impl_.spp_param_){nullptr}
+    , decltype(_impl_.slice_param_){nullptr}
+    , decltype(_impl_.tanh_param_){nullptr}
+    , decltype(_impl_.threshold_param_){nullptr}
+    , decltype(_impl_.tile_param_){nullptr}
+    , decltype(_impl_.detection_output_param_){nullptr}
+    , decltype(_impl_.permute_param_){nullptr}
+    , decltype(_impl_.prior_box_param_){nullptr}
+    , decltype(_impl_.shuffle_channel_param_){nullptr}
+    , decltype(_impl_.norm_param_){nullptr}
+    , decltype(_impl_.reorder_param_){nullptr}
+    , decltype(_impl_.quantization_param_){nullptr}
+    , decltype(_impl_.phase_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LayerParameter::~LayerParameter() {
+  // @@protoc_insertion_point(destructor:caffe.LayerParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LayerParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bottom_.~RepeatedPtrField();
+  _impl_.top_.~RepeatedPtrField();
+  _impl_.loss_weight_.~RepeatedField();
+  _impl_.param_.~RepeatedPtrField();
+  _impl_.blobs_.~RepeatedPtrField();
+  _impl_.include_.~RepeatedPtrField();
+  _impl_.exclude_.~RepeatedPtrField();
+  _impl_.propagate_down_.~RepeatedField();
+  _impl_.name_.Destroy();
+  _impl_.type_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.loss_param_;
+  if (this != internal_default_instance()) delete _impl_.argmax_param_;
+  if (this != internal_default_instance()) delete _impl_.batch_norm_param_;
+  if (this != internal_default_instance()) delete _impl_.bias_param_;
+  if (this != internal_default_instance()) delete _impl_.bn_param_;
+  if (this != internal_default_instance()) delete _impl_.concat_param_;
+  if (this != internal_default_instance()) delete _impl_.convolution_param_;
+  if (this != internal_default_instance()) delete _impl_.crop_param_;
+  if (this != internal_default_instance()) delete _impl_.dropout_param_;
+  if (this != internal_default_instance()) delete _impl_.eltwise_param_;
+  if (this != internal_default_instance()) delete _impl_.elu_param_;
+  if (this != internal_default_instance()) delete _impl_.embed_param_;
+  if (this != internal_default_instance()) delete _impl_.exp_param_;
+  if (this != internal_default_instance()) delete _impl_.flatten_param_;
+  if (this != internal_default_instance()) delete _impl_.inner_product_param_;
+  if (this != internal_default_instance()) delete _impl_.input_param_;
+  if (this != internal_default_instance()) delete _impl_.log_param_;
+  if (this != internal_default_instance()) delete _impl_.lrn_param_;
+  if (this != internal_default_instance()) delete _impl_.mvn_param_;
+  if (this != internal_default_instance()) delete _impl_.parameter_param_;
+  if (this != internal_default_instance()) delete _impl_.pooling_param_;
+  if (this != internal_default_instance()) delete _impl_.power_param_;
+  if (this != internal_default_instance()) delete _impl_.prelu_param_;
+  if (this != internal_default_instance()) delete _impl_.proposal_param_;
+  if (this != internal_default_instance()) delete _impl_.psroi_pooling_param_;
+  if (this != internal_default_instance()) delete _impl_.reduction_param_;
+  if (this != internal_default_instance()) delete _impl_.relu_param_;
+  if (this != internal_default_instance()) delete _impl_.reshape_param_;
+  if (this != internal_default_instance()) delete _impl_.roi_pooling_param_;
+  if (this != internal_default_instance()) delete _impl_.scale_param_;
+  if (this != internal_default_instance()) delete _impl_.sigmoid_param_;
+  if (this != internal_default_instance()) delete _impl_.softmax_param_;
+  if (this != internal_default_instance()) delete _impl_.spp_param_;
+  if (this != internal_default_instance()) delete _impl_.slice_param_;
+  if (this != internal_default_instance()) delete _impl_.tanh_param_;
+  if (this != internal_default_instance()) delete _impl_.threshold_param_;
+  if (this != internal_default_instance()) delete _impl_.tile_param_;
+  if (this != internal_default_instance()) delete _impl_.detection_output_param_;
+  if (this != internal_default_instance()) delete _impl_.permute_param_;
+  if (this != internal_default_instance()) delete _impl_.prior_box_param_;
+  if (this != internal_default_instance()) delete _impl_.shuffle_channel_param_;
+  if (this != internal_default_instance()) delete _impl_.norm_param_;
+  if (this != internal_default_instance()) delete _impl_.reorder_param_;
+  if (this != internal_default_instance()) delete _impl_.quantization_param_;
+}
+
+void LayerParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LayerParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.LayerParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bottom_.Clear();
+  _impl_.top_.Clear();
+  _impl_.loss_weight_.Clear();
+  _impl_.param_.Clear();
+  _impl_.blobs_.Clear();
+  _impl_.include_.Clear();
+  _impl_.exclude_.Clear();
+  _impl_.propagate_down_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.loss_param_ != nullptr);
+      _impl_.loss_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.argmax_param_ != nullptr);
+      _impl_.argmax_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.batch_norm_param_ != nullptr);
+      _impl_.batch_norm_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.bias_param_ != nullptr);
+      _impl_.bias_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.bn_param_ != nullptr);
+      _impl_.bn_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.concat_param_ != nullptr);
+      _impl_.concat_param_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.convolution_param_ != nullptr);
+      _impl_.convolution_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.crop_param_ != nullptr);
+      _impl_.crop_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      GOOGLE_DCHECK(_impl_.dropout_param_ != nullptr);
+      _impl_.dropout_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      GOOGLE_DCHECK(_impl_.eltwise_param_ != nullptr);
+      _impl_.eltwise_param_->Clear();
+    }
+    if (cached_has_bits & 0x00001000u) {
+      GOOGLE_DCHECK(_impl_.elu_param_ != nullptr);
+      _impl_.elu_param_->Clear();
+    }
+    if (cached_has_bits & 0x00002000u) {
+      GOOGLE_DCHECK(_impl_.embed_param_ != nullptr);
+      _impl_.embed_param_->Clear();
+    }
+    if (cached_has_bits & 0x00004000u) {
+      GOOGLE_DCHECK(_impl_.exp_param_ != nullptr);
+      _impl_.exp_param_->Clear();
+    }
+    if (cached_has_bits & 0x00008000u) {
+      GOOGLE_DCHECK(_impl_.flatten_param_ != nullptr);
+      _impl_.flatten_param_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      GOOGLE_DCHECK(_impl_.inner_product_param_ != nullptr);
+      _impl_.inner_product_param_->Clear();
+    }
+    if (cached_has_bits & 0x00020000u) {
+      GOOGLE_DCHECK(_impl_.input_param_ != nullptr);
+      _impl_.input_param_->Clear();
+    }
+    if (cached_has_bits & 0x00040000u) {
+      GOOGLE_DCHECK(_impl_.log_param_ != nullptr);
+      _impl_.log_param_->Clear();
+    }
+    if (cached_has_bits & 0x00080000u) {
+      GOOGLE_DCHECK(_impl_.lrn_param_ != nullptr);
+      _impl_.lrn_param_->Clear();
+    }
+    if (cached_has_bits & 0x00100000u) {
+      GOOGLE_DCHECK(_impl_.mvn_param_ != nullptr);
+      _impl_.mvn_param_->Clear();
+    }
+    if (cached_has_bits & 0x00200000u) {
+      GOOGLE_DCHECK(_impl_.parameter_param_ != nullptr);
+      _impl_.parameter_param_->Clear();
+    }
+    if (cached_has_bits & 0x00400000u) {
+      GOOGLE_DCHECK(_impl_.pooling_param_ != nullptr);
+      _impl_.pooling_param_->Clear();
+    }
+    if (cached_has_bits & 0x00800000u) {
+      GOOGLE_DCHECK(_impl_.power_param_ != nullptr);
+      _impl_.power_param_->Clear();
+    }
+  }
+  if (cached_has_bits & 0xff000000u) {
+    if (cached_has_bits & 0x01000000u) {
+      GOOGLE_DCHECK(_impl_.prelu_param_ != nullptr);
+      _impl_.prelu_param_->Clear();
+    }
+    if (cached_has_bits & 0x02000000u) {
+      GOOGLE_DCHECK(_impl_.proposal_param_ != nullptr);
+      _impl_.proposal_param_->Clear();
+    }
+    if (cached_has_bits & 0x04000000u) {
+      GOOGLE_DCHECK(_impl_.psroi_pooling_param_ != nullptr);
+      _impl_.psroi_pooling_param_->Clear();
+    }
+    if (cached_has_bits & 0x08000000u) {
+      GOOGLE_DCHECK(_impl_.reduction_param_ != nullptr);
+      _impl_.reduction_param_->Clear();
+    }
+    if (cached_has_bits & 0x10000000u) {
+      GOOGLE_DCHECK(_impl_.relu_param_ != nullptr);
+      _impl_.relu_param_->Clear();
+    }
+    if (cached_has_bits & 0x20000000u) {
+      GOOGLE_DCHECK(_impl_.reshape_param_ != nullptr);
+      _impl_.reshape_param_->Clear();
+    }
+    if (cached_has_bits & 0x40000000u) {
+      GOOGLE_DCHECK(_impl_.roi_pooling_param_ != nullptr);
+      _impl_.roi_pooling_param_->Clear();
+    }
+    if (cached_has_bits & 0x80000000u) {
+      GOOGLE_DCHECK(_impl_.scale_param_ != nullptr);
+      _impl_.scale_param_->Clear();
+    }
+  }
+  cached_has_bits = _impl_._has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.sigmoid_param_ != nullptr);
+      _impl_.sigmoid_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.softmax_param_ != nullptr);
+      _impl_.softmax_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.spp_param_ != nullptr);
+      _impl_.spp_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.slice_param_ != nullptr);
+      _impl_.slice_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.tanh_param_ != nullptr);
+      _impl_.tanh_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.threshold_param_ != nullptr);
+      _impl_.threshold_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.tile_param_ != nullptr);
+      _impl_.tile_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.detection_output_param_ != nullptr);
+      _impl_.detection_output_param_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.permute_param_ != nullptr);
+      _impl_.permute_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.prior_box_param_ != nullptr);
+      _impl_.prior_box_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      GOOGLE_DCHECK(_impl_.shuffle_channel_param_ != nullptr);
+      _impl_.shuffle_channel_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      GOOGLE_DCHECK(_impl_.norm_param_ != nullptr);
+      _impl_.norm_param_->Clear();
+    }
+    if (cached_has_bits & 0x00001000u) {
+      GOOGLE_DCHECK(_impl_.reorder_param_ != nullptr);
+      _impl_.reorder_param_->Clear();
+    }
+    if (cached_has_bits & 0x00002000u) {
+      GOOGLE_DCHECK(_impl_.quantization_param_ != nullptr);
+      _impl_.quantization_param_->Clear();
+    }
+  }
+  _impl_.phase_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LayerParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.LayerParameter.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.LayerParameter.type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string bottom = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_bottom();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "caffe.LayerParameter.bottom");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string top = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_top();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "caffe.LayerParameter.top");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float loss_weight = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_loss_weight(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<45>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 42) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_loss_weight(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.ParamSpec param = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_param(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.BlobProto blobs = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_blobs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.NetStateRule include = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_include(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.NetStateRule exclude = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_exclude(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.Phase phase = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::Phase_IsValid(val))) {
+            _internal_set_phase(static_cast<::caffe::Phase>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(10, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bool propagate_down = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_propagate_down(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<88>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 90) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_propagate_down(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.LossParameter loss_param = 200;
+      case 200:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_loss_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ArgMaxParameter argmax_param = 201;
+      case 201:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_argmax_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.BatchNormParameter batch_norm_param = 202;
+      case 202:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch_norm_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.BiasParameter bias_param = 203;
+      case 203:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bias_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.BNParameter bn_param = 204;
+      case 204:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bn_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ConcatParameter concat_param = 205;
+      case 205:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_concat_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ConvolutionParameter convolution_param = 206;
+      case 206:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_convolution_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.CropParameter crop_param = 207;
+      case 207:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_crop_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.DropoutParameter dropout_param = 208;
+      case 208:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_dropout_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.EltwiseParameter eltwise_param = 209;
+      case 209:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_eltwise_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ELUParameter elu_param = 210;
+      case 210:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_elu_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.EmbedParameter embed_param = 211;
+      case 211:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_embed_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ExpParameter exp_param = 212;
+      case 212:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_exp_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FlattenParameter flatten_param = 213;
+      case 213:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr = ctx->ParseMessage(_internal_mutable_flatten_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.InnerProductParameter inner_product_param = 214;
+      case 214:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr = ctx->ParseMessage(_internal_mutable_inner_product_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.InputParameter input_param = 215;
+      case 215:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 186)) {
+          ptr = ctx->ParseMessage(_internal_mutable_input_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.LogParameter log_param = 216;
+      case 216:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          ptr = ctx->ParseMessage(_internal_mutable_log_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.LRNParameter lrn_param = 217;
+      case 217:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 202)) {
+          ptr = ctx->ParseMessage(_internal_mutable_lrn_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.MVNParameter mvn_param = 218;
+      case 218:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 210)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mvn_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ParameterParameter parameter_param = 219;
+      case 219:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 218)) {
+          ptr = ctx->ParseMessage(_internal_mutable_parameter_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PoolingParameter pooling_param = 220;
+      case 220:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 226)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pooling_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PowerParameter power_param = 222;
+      case 222:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
+          ptr = ctx->ParseMessage(_internal_mutable_power_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PReLUParameter prelu_param = 223;
+      case 223:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 250)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prelu_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ProposalParameter proposal_param = 224;
+      case 224:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          ptr = ctx->ParseMessage(_internal_mutable_proposal_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PSROIPoolingParameter psroi_pooling_param = 225;
+      case 225:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_psroi_pooling_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ReductionParameter reduction_param = 226;
+      case 226:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reduction_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ReLUParameter relu_param = 227;
+      case 227:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_relu_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ReshapeParameter reshape_param = 228;
+      case 228:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reshape_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ROIPoolingParameter roi_pooling_param = 229;
+      case 229:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_roi_pooling_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ScaleParameter scale_param = 230;
+      case 230:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_scale_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SigmoidParameter sigmoid_param = 231;
+      case 231:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sigmoid_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SoftmaxParameter softmax_param = 232;
+      case 232:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_softmax_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SPPParameter spp_param = 233;
+      case 233:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_spp_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SliceParameter slice_param = 234;
+      case 234:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_slice_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.TanHParameter tanh_param = 235;
+      case 235:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tanh_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ThresholdParameter threshold_param = 236;
+      case 236:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_threshold_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.TileParameter tile_param = 237;
+      case 237:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tile_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.DetectionOutputParameter detection_output_param = 238;
+      case 238:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_detection_output_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PermuteParameter permute_param = 239;
+      case 239:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_permute_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PriorBoxParameter prior_box_param = 240;
+      case 240:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prior_box_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ShuffleChannelParameter shuffle_channel_param = 241;
+      case 241:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shuffle_channel_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.NormalizeParameter norm_param = 242;
+      case 242:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_norm_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ReorderParameter reorder_param = 243;
+      case 243:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reorder_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.QuantizationParameter quantization_param = 244;
+      case 244:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_quantization_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LayerParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.LayerParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.LayerParameter.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.LayerParameter.type");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_type(), target);
+  }
+
+  // repeated string bottom = 3;
+  for (int i = 0, n = this->_internal_bottom_size(); i < n; i++) {
+    const auto& s = this->_internal_bottom(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.LayerParameter.bottom");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // repeated string top = 4;
+  for (int i = 0, n = this->_internal_top_size(); i < n; i++) {
+    const auto& s = this->_internal_top(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.LayerParameter.top");
+    target = stream->WriteString(4, s, target);
+  }
+
+  // repeated float loss_weight = 5;
+  for (int i = 0, n = this->_internal_loss_weight_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_loss_weight(i), target);
+  }
+
+  // repeated .caffe.ParamSpec param = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_param_size()); i < n; i++) {
+    const auto& repfield = this->_internal_param(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .caffe.BlobProto blobs = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blobs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blobs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .caffe.NetStateRule include = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_include_size()); i < n; i++) {
+    const auto& repfield = this->_internal_include(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .caffe.NetStateRule exclude = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_exclude_size()); i < n; i++) {
+    const auto& repfield = this->_internal_exclude(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[1];
+  // optional .caffe.Phase phase = 10;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      10, this->_internal_phase(), target);
+  }
+
+  // repeated bool propagate_down = 11;
+  for (int i = 0, n = this->_internal_propagate_down_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_propagate_down(i), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.LossParameter loss_param = 200;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(200, _Internal::loss_param(this),
+        _Internal::loss_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ArgMaxParameter argmax_param = 201;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(201, _Internal::argmax_param(this),
+        _Internal::argmax_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.BatchNormParameter batch_norm_param = 202;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(202, _Internal::batch_norm_param(this),
+        _Internal::batch_norm_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.BiasParameter bias_param = 203;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(203, _Internal::bias_param(this),
+        _Internal::bias_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.BNParameter bn_param = 204;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(204, _Internal::bn_param(this),
+        _Internal::bn_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ConcatParameter concat_param = 205;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(205, _Internal::concat_param(this),
+        _Internal::concat_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ConvolutionParameter convolution_param = 206;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(206, _Internal::convolution_param(this),
+        _Internal::convolution_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.CropParameter crop_param = 207;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(207, _Internal::crop_param(this),
+        _Internal::crop_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.DropoutParameter dropout_param = 208;
+  if (cached_has_bits & 0x00000400u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(208, _Internal::dropout_param(this),
+        _Internal::dropout_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.EltwiseParameter eltwise_param = 209;
+  if (cached_has_bits & 0x00000800u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(209, _Internal::eltwise_param(this),
+        _Internal::eltwise_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ELUParameter elu_param = 210;
+  if (cached_has_bits & 0x00001000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(210, _Internal::elu_param(this),
+        _Internal::elu_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.EmbedParameter embed_param = 211;
+  if (cached_has_bits & 0x00002000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(211, _Internal::embed_param(this),
+        _Internal::embed_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ExpParameter exp_param = 212;
+  if (cached_has_bits & 0x00004000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(212, _Internal::exp_param(this),
+        _Internal::exp_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.FlattenParameter flatten_param = 213;
+  if (cached_has_bits & 0x00008000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(213, _Internal::flatten_param(this),
+        _Internal::flatten_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.InnerProductParameter inner_product_param = 214;
+  if (cached_has_bits & 0x00010000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(214, _Internal::inner_product_param(this),
+        _Internal::inner_product_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.InputParameter input_param = 215;
+  if (cached_has_bits & 0x00020000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(215, _Internal::input_param(this),
+        _Internal::input_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.LogParameter log_param = 216;
+  if (cached_has_bits & 0x00040000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(216, _Internal::log_param(this),
+        _Internal::log_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.LRNParameter lrn_param = 217;
+  if (cached_has_bits & 0x00080000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(217, _Internal::lrn_param(this),
+        _Internal::lrn_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.MVNParameter mvn_param = 218;
+  if (cached_has_bits & 0x00100000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(218, _Internal::mvn_param(this),
+        _Internal::mvn_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ParameterParameter parameter_param = 219;
+  if (cached_has_bits & 0x00200000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(219, _Internal::parameter_param(this),
+        _Internal::parameter_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.PoolingParameter pooling_param = 220;
+  if (cached_has_bits & 0x00400000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(220, _Internal::pooling_param(this),
+        _Internal::pooling_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.PowerParameter power_param = 222;
+  if (cached_has_bits & 0x00800000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(222, _Internal::power_param(this),
+        _Internal::power_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.PReLUParameter prelu_param = 223;
+  if (cached_has_bits & 0x01000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(223, _Internal::prelu_param(this),
+        _Internal::prelu_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ProposalParameter proposal_param = 224;
+  if (cached_has_bits & 0x02000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(224, _Internal::proposal_param(this),
+        _Internal::proposal_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.PSROIPoolingParameter psroi_pooling_param = 225;
+  if (cached_has_bits & 0x04000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(225, _Internal::psroi_pooling_param(this),
+        _Internal::psroi_pooling_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ReductionParameter reduction_param = 226;
+  if (cached_has_bits & 0x08000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(226, _Internal::reduction_param(this),
+        _Internal::reduction_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ReLUParameter relu_param = 227;
+  if (cached_has_bits & 0x10000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(227, _Internal::relu_param(this),
+        _Internal::relu_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ReshapeParameter reshape_param = 228;
+  if (cached_has_bits & 0x20000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(228, _Internal::reshape_param(this),
+        _Internal::reshape_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ROIPoolingParameter roi_pooling_param = 229;
+  if (cached_has_bits & 0x40000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(229, _Internal::roi_pooling_param(this),
+        _Internal::roi_pooling_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ScaleParameter scale_param = 230;
+  if (cached_has_bits & 0x80000000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(230, _Internal::scale_param(this),
+        _Internal::scale_param(this).GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[1];
+  // optional .caffe.SigmoidParameter sigmoid_param = 231;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(231, _Internal::sigmoid_param(this),
+        _Internal::sigmoid_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.SoftmaxParameter softmax_param = 232;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(232, _Internal::softmax_param(this),
+        _Internal::softmax_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.SPPParameter spp_param = 233;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(233, _Internal::spp_param(this),
+        _Internal::spp_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.SliceParameter slice_param = 234;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(234, _Internal::slice_param(this),
+        _Internal::slice_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.TanHParameter tanh_param = 235;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(235, _Internal::tanh_param(this),
+        _Internal::tanh_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ThresholdParameter threshold_param = 236;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(236, _Internal::threshold_param(this),
+        _Internal::threshold_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.TileParameter tile_param = 237;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(237, _Internal::tile_param(this),
+        _Internal::tile_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.DetectionOutputParameter detection_output_param = 238;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(238, _Internal::detection_output_param(this),
+        _Internal::detection_output_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.PermuteParameter permute_param = 239;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(239, _Internal::permute_param(this),
+        _Internal::permute_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.PriorBoxParameter prior_box_param = 240;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(240, _Internal::prior_box_param(this),
+        _Internal::prior_box_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ShuffleChannelParameter shuffle_channel_param = 241;
+  if (cached_has_bits & 0x00000400u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(241, _Internal::shuffle_channel_param(this),
+        _Internal::shuffle_channel_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.NormalizeParameter norm_param = 242;
+  if (cached_has_bits & 0x00000800u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(242, _Internal::norm_param(this),
+        _Internal::norm_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ReorderParameter reorder_param = 243;
+  if (cached_has_bits & 0x00001000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(243, _Internal::reorder_param(this),
+        _Internal::reorder_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.QuantizationParameter quantization_param = 244;
+  if (cached_has_bits & 0x00002000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(244, _Internal::quantization_param(this),
+        _Internal::quantization_param(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.LayerParameter)
+  return target;
+}
+
+size_t LayerParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.LayerParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string bottom = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.bottom_.size());
+  for (int i = 0, n = _impl_.bottom_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.bottom_.Get(i));
+  }
+
+  // repeated string top = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.top_.size());
+  for (int i = 0, n = _impl_.top_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.top_.Get(i));
+  }
+
+  // repeated float loss_weight = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_loss_weight_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_loss_weight_size());
+    total_size += data_size;
+  }
+
+  // repeated .caffe.ParamSpec param = 6;
+  total_size += 1UL * this->_internal_param_size();
+  for (const auto& msg : this->_impl_.param_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .caffe.BlobProto blobs = 7;
+  total_size += 1UL * this->_internal_blobs_size();
+  for (const auto& msg : this->_impl_.blobs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .caffe.NetStateRule include = 8;
+  total_size += 1UL * this->_internal_include_size();
+  for (const auto& msg : this->_impl_.include_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .caffe.NetStateRule exclude = 9;
+  total_size += 1UL * this->_internal_exclude_size();
+  for (const auto& msg : this->_impl_.exclude_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated bool propagate_down = 11;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_propagate_down_size());
+    size_t data_size = 1UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_propagate_down_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string type = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_type());
+    }
+
+    // optional .caffe.LossParameter loss_param = 200;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.loss_param_);
+    }
+
+    // optional .caffe.ArgMaxParameter argmax_param = 201;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.argmax_param_);
+    }
+
+    // optional .caffe.BatchNormParameter batch_norm_param = 202;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.batch_norm_param_);
+    }
+
+    // optional .caffe.BiasParameter bias_param = 203;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.bias_param_);
+    }
+
+    // optional .caffe.BNParameter bn_param = 204;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.bn_param_);
+    }
+
+    // optional .caffe.ConcatParameter concat_param = 205;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.concat_param_);
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional .caffe.ConvolutionParameter convolution_param = 206;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.convolution_param_);
+    }
+
+    // optional .caffe.CropParameter crop_param = 207;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.crop_param_);
+    }
+
+    // optional .caffe.DropoutParameter dropout_param = 208;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.dropout_param_);
+    }
+
+    // optional .caffe.EltwiseParameter eltwise_param = 209;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.eltwise_param_);
+    }
+
+    // optional .caffe.ELUParameter elu_param = 210;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.elu_param_);
+    }
+
+    // optional .caffe.EmbedParameter embed_param = 211;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.embed_param_);
+    }
+
+    // optional .caffe.ExpParameter exp_param = 212;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.exp_param_);
+    }
+
+    // optional .caffe.FlattenParameter flatten_param = 213;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.flatten_param_);
+    }
+
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    // optional .caffe.InnerProductParameter inner_product_param = 214;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.inner_product_param_);
+    }
+
+    // optional .caffe.InputParameter input_param = 215;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.input_param_);
+    }
+
+    // optional .caffe.LogParameter log_param = 216;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.log_param_);
+    }
+
+    // optional .caffe.LRNParameter lrn_param = 217;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.lrn_param_);
+    }
+
+    // optional .caffe.MVNParameter mvn_param = 218;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.mvn_param_);
+    }
+
+    // optional .caffe.ParameterParameter parameter_param = 219;
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.parameter_param_);
+    }
+
+    // optional .caffe.PoolingParameter pooling_param = 220;
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pooling_param_);
+    }
+
+    // optional .caffe.PowerParameter power_param = 222;
+    if (cached_has_bits & 0x00800000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.power_param_);
+    }
+
+  }
+  if (cached_has_bits & 0xff000000u) {
+    // optional .caffe.PReLUParameter prelu_param = 223;
+    if (cached_has_bits & 0x01000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.prelu_param_);
+    }
+
+    // optional .caffe.ProposalParameter proposal_param = 224;
+    if (cached_has_bits & 0x02000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.proposal_param_);
+    }
+
+    // optional .caffe.PSROIPoolingParameter psroi_pooling_param = 225;
+    if (cached_has_bits & 0x04000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.psroi_pooling_param_);
+    }
+
+    // optional .caffe.ReductionParameter reduction_param = 226;
+    if (cached_has_bits & 0x08000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.reduction_param_);
+    }
+
+    // optional .caffe.ReLUParameter relu_param = 227;
+    if (cached_has_bits & 0x10000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.relu_param_);
+    }
+
+    // optional .caffe.ReshapeParameter reshape_param = 228;
+    if (cached_has_bits & 0x20000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.reshape_param_);
+    }
+
+    // optional .caffe.ROIPoolingParameter roi_pooling_param = 229;
+    if (cached_has_bits & 0x40000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.roi_pooling_param_);
+    }
+
+    // optional .caffe.ScaleParameter scale_param = 230;
+    if (cached_has_bits & 0x80000000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.scale_param_);
+    }
+
+  }
+  cached_has_bits = _impl_._has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .caffe.SigmoidParameter sigmoid_param = 231;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sigmoid_param_);
+    }
+
+    // optional .caffe.SoftmaxParameter softmax_param = 232;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.softmax_param_);
+    }
+
+    // optional .caffe.SPPParameter spp_param = 233;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.spp_param_);
+    }
+
+    // optional .caffe.SliceParameter slice_param = 234;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.slice_param_);
+    }
+
+    // optional .caffe.TanHParameter tanh_param = 235;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.tanh_param_);
+    }
+
+    // optional .caffe.ThresholdParameter threshold_param = 236;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.threshold_param_);
+    }
+
+    // optional .caffe.TileParameter tile_param = 237;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.tile_param_);
+    }
+
+    // optional .caffe.DetectionOutputParameter detection_output_param = 238;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.detection_output_param_);
+    }
+
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    // optional .caffe.PermuteParameter permute_param = 239;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.permute_param_);
+    }
+
+    // optional .caffe.PriorBoxParameter prior_box_param = 240;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.prior_box_param_);
+    }
+
+    // optional .caffe.ShuffleChannelParameter shuffle_channel_param = 241;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.shuffle_channel_param_);
+    }
+
+    // optional .caffe.NormalizeParameter norm_param = 242;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.norm_param_);
+    }
+
+    // optional .caffe.ReorderParameter reorder_param = 243;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.reorder_param_);
+    }
+
+    // optional .caffe.QuantizationParameter quantization_param = 244;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.quantization_param_);
+    }
+
+    // optional .caffe.Phase phase = 10;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_phase());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LayerParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LayerParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LayerParameter::GetClassData() const { return &_class_data_; }
+
+
+void LayerParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LayerParameter*>(&to_msg);
+  auto& from = static_cast<const LayerParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.LayerParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bottom_.MergeFrom(from._impl_.bottom_);
+  _this->_impl_.top_.MergeFrom(from._impl_.top_);
+  _this->_impl_.loss_weight_.MergeFrom(from._impl_.loss_weight_);
+  _this->_impl_.param_.MergeFrom(from._impl_.param_);
+  _this->_impl_.blobs_.MergeFrom(from._impl_.blobs_);
+  _this->_impl_.include_.MergeFrom(from._impl_.include_);
+  _this->_impl_.exclude_.MergeFrom(from._impl_.exclude_);
+  _this->_impl_.propagate_down_.MergeFrom(from._impl_.propagate_down_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_type(from._internal_type());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_loss_param()->::caffe::LossParameter::MergeFrom(
+          from._internal_loss_param());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_argmax_param()->::caffe::ArgMaxParameter::MergeFrom(
+          from._internal_argmax_param());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_batch_norm_param()->::caffe::BatchNormParameter::MergeFrom(
+          from._internal_batch_norm_param());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_bias_param()->::caffe::BiasParameter::MergeFrom(
+          from._internal_bias_param());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_bn_param()->::caffe::BNParameter::MergeFrom(
+          from._internal_bn_param());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_concat_param()->::caffe::ConcatParameter::MergeFrom(
+          from._internal_concat_param());
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_convolution_param()->::caffe::ConvolutionParameter::MergeFrom(
+          from._internal_convolution_param());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_crop_param()->::caffe::CropParameter::MergeFrom(
+          from._internal_crop_param());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_internal_mutable_dropout_param()->::caffe::DropoutParameter::MergeFrom(
+          from._internal_dropout_param());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_internal_mutable_eltwise_param()->::caffe::EltwiseParameter::MergeFrom(
+          from._internal_eltwise_param());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_internal_mutable_elu_param()->::caffe::ELUParameter::MergeFrom(
+          from._internal_elu_param());
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_internal_mutable_embed_param()->::caffe::EmbedParameter::MergeFrom(
+          from._internal_embed_param());
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_internal_mutable_exp_param()->::caffe::ExpParameter::MergeFrom(
+          from._internal_exp_param());
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_internal_mutable_flatten_param()->::caffe::FlattenParameter::MergeFrom(
+          from._internal_flatten_param());
+    }
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_internal_mutable_inner_product_param()->::caffe::InnerProductParameter::MergeFrom(
+          from._internal_inner_product_param());
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_internal_mutable_input_param()->::caffe::InputParameter::MergeFrom(
+          from._internal_input_param());
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_internal_mutable_log_param()->::caffe::LogParameter::MergeFrom(
+          from._internal_log_param());
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_internal_mutable_lrn_param()->::caffe::LRNParameter::MergeFrom(
+          from._internal_lrn_param());
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_internal_mutable_mvn_param()->::caffe::MVNParameter::MergeFrom(
+          from._internal_mvn_param());
+    }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_internal_mutable_parameter_param()->::caffe::ParameterParameter::MergeFrom(
+          from._internal_parameter_param());
+    }
+    if (cached_has_bits & 0x00400000u) {
+      _this->_internal_mutable_pooling_param()->::caffe::PoolingParameter::MergeFrom(
+          from._internal_pooling_param());
+    }
+    if (cached_has_bits & 0x00800000u) {
+      _this->_internal_mutable_power_param()->::caffe::PowerParameter::MergeFrom(
+          from._internal_power_param());
+    }
+  }
+  if (cached_has_bits & 0xff000000u) {
+    if (cached_has_bits & 0x01000000u) {
+      _this->_internal_mutable_prelu_param()->::caffe::PReLUParameter::MergeFrom(
+          from._internal_prelu_param());
+    }
+    if (cached_has_bits & 0x02000000u) {
+      _this->_internal_mutable_proposal_param()->::caffe::ProposalParameter::MergeFrom(
+          from._internal_proposal_param());
+    }
+    if (cached_has_bits & 0x04000000u) {
+      _this->_internal_mutable_psroi_pooling_param()->::caffe::PSROIPoolingParameter::MergeFrom(
+          from._internal_psroi_pooling_param());
+    }
+    if (cached_has_bits & 0x08000000u) {
+      _this->_internal_mutable_reduction_param()->::caffe::ReductionParameter::MergeFrom(
+          from._internal_reduction_param());
+    }
+    if (cached_has_bits & 0x10000000u) {
+      _this->_internal_mutable_relu_param()->::caffe::ReLUParameter::MergeFrom(
+          from._internal_relu_param());
+    }
+    if (cached_has_bits & 0x20000000u) {
+      _this->_internal_mutable_reshape_param()->::caffe::ReshapeParameter::MergeFrom(
+          from._internal_reshape_param());
+    }
+    if (cached_has_bits & 0x40000000u) {
+      _this->_internal_mutable_roi_pooling_param()->::caffe::ROIPoolingParameter::MergeFrom(
+          from._internal_roi_pooling_param());
+    }
+    if (cached_has_bits & 0x80000000u) {
+      _this->_internal_mutable_scale_param()->::caffe::ScaleParameter::MergeFrom(
+          from._internal_scale_param());
+    }
+  }
+  cached_has_bits = from._impl_._has_bits_[1];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_sigmoid_param()->::caffe::SigmoidParameter::MergeFrom(
+          from._internal_sigmoid_param());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_softmax_param()->::caffe::SoftmaxParameter::MergeFrom(
+          from._internal_softmax_param());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_spp_param()->::caffe::SPPParameter::MergeFrom(
+          from._internal_spp_param());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_slice_param()->::caffe::SliceParameter::MergeFrom(
+          from._internal_slice_param());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_tanh_param()->::caffe::TanHParameter::MergeFrom(
+          from._internal_tanh_param());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_threshold_param()->::caffe::ThresholdParameter::MergeFrom(
+          from._internal_threshold_param());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_tile_param()->::caffe::TileParameter::MergeFrom(
+          from._internal_tile_param());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_detection_output_param()->::caffe::DetectionOutputParameter::MergeFrom(
+          from._internal_detection_output_param());
+    }
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_permute_param()->::caffe::PermuteParameter::MergeFrom(
+          from._internal_permute_param());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_prior_box_param()->::caffe::PriorBoxParameter::MergeFrom(
+          from._internal_prior_box_param());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_internal_mutable_shuffle_channel_param()->::caffe::ShuffleChannelParameter::MergeFrom(
+          from._internal_shuffle_channel_param());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_internal_mutable_norm_param()->::caffe::NormalizeParameter::MergeFrom(
+          from._internal_norm_param());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_internal_mutable_reorder_param()->::caffe::ReorderParameter::MergeFrom(
+          from._internal_reorder_param());
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_internal_mutable_quantization_param()->::caffe::QuantizationParameter::MergeFrom(
+          from._internal_quantization_param());
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.phase_ = from._impl_.phase_;
+    }
+    _this->_impl_._has_bits_[1] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LayerParameter::CopyFrom(const LayerParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.LayerParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LayerParameter::IsInitialized() const {
+  if (_internal_has_psroi_pooling_param()) {
+    if (!_impl_.psroi_pooling_param_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void LayerParameter::InternalSwap(LayerParameter* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_._has_bits_[1], other->_impl_._has_bits_[1]);
+  _impl_.bottom_.InternalSwap(&other->_impl_.bottom_);
+  _impl_.top_.InternalSwap(&other->_impl_.top_);
+  _impl_.loss_weight_.InternalSwap(&other->_impl_.loss_weight_);
+  _impl_.param_.InternalSwap(&other->_impl_.param_);
+  _impl_.blobs_.InternalSwap(&other->_impl_.blobs_);
+  _impl_.include_.InternalSwap(&other->_impl_.include_);
+  _impl_.exclude_.InternalSwap(&other->_impl_.exclude_);
+  _impl_.propagate_down_.InternalSwap(&other->_impl_.propagate_down_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LayerParameter, _impl_.phase_)
+      + sizeof(LayerParameter::_impl_.phase_)
+      - PROTOBUF_FIELD_OFFSET(LayerParameter, _impl_.loss_param_)>(
+          reinterpret_cast<char*>(&_impl_.loss_param_),
+          reinterpret_cast<char*>(&other->_impl_.loss_param_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LayerParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[9]);
+}
+
+// ===================================================================
+
+class LossParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LossParameter>()._impl_._has_bits_);
+  static void set_has_ignore_label(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_normalization(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_normalize(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+LossParameter::LossParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.LossParameter)
+}
+LossParameter::LossParameter(const LossParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LossParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ignore_label_){}
+    , decltype(_impl_.normalize_){}
+    , decltype(_impl_.normalization_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ignore_label_, &from._impl_.ignore_label_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.normalization_) -
+    reinterpret_cast<char*>(&_impl_.ignore_label_)) + sizeof(_impl_.normalization_));
+  // @@protoc_insertion_point(copy_constructor:caffe.LossParameter)
+}
+
+inline void LossParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ignore_label_){0}
+    , decltype(_impl_.normalize_){false}
+    , decltype(_impl_.normalization_){1}
+  };
+}
+
+LossParameter::~LossParameter() {
+  // @@protoc_insertion_point(destructor:caffe.LossParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LossParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LossParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LossParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.LossParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.ignore_label_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.normalize_) -
+        reinterpret_cast<char*>(&_impl_.ignore_label_)) + sizeof(_impl_.normalize_));
+    _impl_.normalization_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LossParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 ignore_label = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_ignore_label(&has_bits);
+          _impl_.ignore_label_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool normalize = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_normalize(&has_bits);
+          _impl_.normalize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.LossParameter.NormalizationMode normalization = 3 [default = VALID];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::LossParameter_NormalizationMode_IsValid(val))) {
+            _internal_set_normalization(static_cast<::caffe::LossParameter_NormalizationMode>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LossParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.LossParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 ignore_label = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_ignore_label(), target);
+  }
+
+  // optional bool normalize = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_normalize(), target);
+  }
+
+  // optional .caffe.LossParameter.NormalizationMode normalization = 3 [default = VALID];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_normalization(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.LossParameter)
+  return target;
+}
+
+size_t LossParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.LossParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 ignore_label = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_ignore_label());
+    }
+
+    // optional bool normalize = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional .caffe.LossParameter.NormalizationMode normalization = 3 [default = VALID];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_normalization());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LossParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LossParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LossParameter::GetClassData() const { return &_class_data_; }
+
+
+void LossParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LossParameter*>(&to_msg);
+  auto& from = static_cast<const LossParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.LossParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.ignore_label_ = from._impl_.ignore_label_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.normalize_ = from._impl_.normalize_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.normalization_ = from._impl_.normalization_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LossParameter::CopyFrom(const LossParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.LossParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LossParameter::IsInitialized() const {
+  return true;
+}
+
+void LossParameter::InternalSwap(LossParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LossParameter, _impl_.normalize_)
+      + sizeof(LossParameter::_impl_.normalize_)
+      - PROTOBUF_FIELD_OFFSET(LossParameter, _impl_.ignore_label_)>(
+          reinterpret_cast<char*>(&_impl_.ignore_label_),
+          reinterpret_cast<char*>(&other->_impl_.ignore_label_));
+  swap(_impl_.normalization_, other->_impl_.normalization_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LossParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[10]);
+}
+
+// ===================================================================
+
+class ArgMaxParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ArgMaxParameter>()._impl_._has_bits_);
+  static void set_has_out_max_val(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_top_k(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ArgMaxParameter::ArgMaxParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ArgMaxParameter)
+}
+ArgMaxParameter::ArgMaxParameter(const ArgMaxParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ArgMaxParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.out_max_val_){}
+    , decltype(_impl_.axis_){}
+    , decltype(_impl_.top_k_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.out_max_val_, &from._impl_.out_max_val_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.top_k_) -
+    reinterpret_cast<char*>(&_impl_.out_max_val_)) + sizeof(_impl_.top_k_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ArgMaxParameter)
+}
+
+inline void ArgMaxParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.out_max_val_){false}
+    , decltype(_impl_.axis_){0}
+    , decltype(_impl_.top_k_){1u}
+  };
+}
+
+ArgMaxParameter::~ArgMaxParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ArgMaxParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ArgMaxParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ArgMaxParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ArgMaxParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ArgMaxParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.out_max_val_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.axis_) -
+        reinterpret_cast<char*>(&_impl_.out_max_val_)) + sizeof(_impl_.axis_));
+    _impl_.top_k_ = 1u;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ArgMaxParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool out_max_val = 1 [default = false];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_out_max_val(&has_bits);
+          _impl_.out_max_val_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 top_k = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_top_k(&has_bits);
+          _impl_.top_k_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 axis = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ArgMaxParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ArgMaxParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool out_max_val = 1 [default = false];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_out_max_val(), target);
+  }
+
+  // optional uint32 top_k = 2 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_top_k(), target);
+  }
+
+  // optional int32 axis = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_axis(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ArgMaxParameter)
+  return target;
+}
+
+size_t ArgMaxParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ArgMaxParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bool out_max_val = 1 [default = false];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 axis = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+    // optional uint32 top_k = 2 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_top_k());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ArgMaxParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ArgMaxParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ArgMaxParameter::GetClassData() const { return &_class_data_; }
+
+
+void ArgMaxParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ArgMaxParameter*>(&to_msg);
+  auto& from = static_cast<const ArgMaxParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ArgMaxParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.out_max_val_ = from._impl_.out_max_val_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.top_k_ = from._impl_.top_k_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ArgMaxParameter::CopyFrom(const ArgMaxParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ArgMaxParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ArgMaxParameter::IsInitialized() const {
+  return true;
+}
+
+void ArgMaxParameter::InternalSwap(ArgMaxParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ArgMaxParameter, _impl_.axis_)
+      + sizeof(ArgMaxParameter::_impl_.axis_)
+      - PROTOBUF_FIELD_OFFSET(ArgMaxParameter, _impl_.out_max_val_)>(
+          reinterpret_cast<char*>(&_impl_.out_max_val_),
+          reinterpret_cast<char*>(&other->_impl_.out_max_val_));
+  swap(_impl_.top_k_, other->_impl_.top_k_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ArgMaxParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[11]);
+}
+
+// ===================================================================
+
+class ConcatParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConcatParameter>()._impl_._has_bits_);
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_concat_dim(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ConcatParameter::ConcatParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ConcatParameter)
+}
+ConcatParameter::ConcatParameter(const ConcatParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConcatParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.concat_dim_){}
+    , decltype(_impl_.axis_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.concat_dim_, &from._impl_.concat_dim_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.axis_) -
+    reinterpret_cast<char*>(&_impl_.concat_dim_)) + sizeof(_impl_.axis_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ConcatParameter)
+}
+
+inline void ConcatParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.concat_dim_){1u}
+    , decltype(_impl_.axis_){1}
+  };
+}
+
+ConcatParameter::~ConcatParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ConcatParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConcatParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ConcatParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConcatParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ConcatParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.concat_dim_ = 1u;
+    _impl_.axis_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConcatParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 concat_dim = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_concat_dim(&has_bits);
+          _impl_.concat_dim_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 axis = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConcatParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ConcatParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 concat_dim = 1 [default = 1];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_concat_dim(), target);
+  }
+
+  // optional int32 axis = 2 [default = 1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_axis(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ConcatParameter)
+  return target;
+}
+
+size_t ConcatParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ConcatParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 concat_dim = 1 [default = 1];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_concat_dim());
+    }
+
+    // optional int32 axis = 2 [default = 1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConcatParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConcatParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConcatParameter::GetClassData() const { return &_class_data_; }
+
+
+void ConcatParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConcatParameter*>(&to_msg);
+  auto& from = static_cast<const ConcatParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ConcatParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.concat_dim_ = from._impl_.concat_dim_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConcatParameter::CopyFrom(const ConcatParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ConcatParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConcatParameter::IsInitialized() const {
+  return true;
+}
+
+void ConcatParameter::InternalSwap(ConcatParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.concat_dim_, other->_impl_.concat_dim_);
+  swap(_impl_.axis_, other->_impl_.axis_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConcatParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[12]);
+}
+
+// ===================================================================
+
+class BatchNormParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BatchNormParameter>()._impl_._has_bits_);
+  static void set_has_use_global_stats(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_moving_average_fraction(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_eps(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+BatchNormParameter::BatchNormParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.BatchNormParameter)
+}
+BatchNormParameter::BatchNormParameter(const BatchNormParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchNormParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.use_global_stats_){}
+    , decltype(_impl_.moving_average_fraction_){}
+    , decltype(_impl_.eps_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.use_global_stats_, &from._impl_.use_global_stats_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.eps_) -
+    reinterpret_cast<char*>(&_impl_.use_global_stats_)) + sizeof(_impl_.eps_));
+  // @@protoc_insertion_point(copy_constructor:caffe.BatchNormParameter)
+}
+
+inline void BatchNormParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.use_global_stats_){false}
+    , decltype(_impl_.moving_average_fraction_){0.999f}
+    , decltype(_impl_.eps_){1e-05f}
+  };
+}
+
+BatchNormParameter::~BatchNormParameter() {
+  // @@protoc_insertion_point(destructor:caffe.BatchNormParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchNormParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void BatchNormParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchNormParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.BatchNormParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    _impl_.use_global_stats_ = false;
+    _impl_.moving_average_fraction_ = 0.999f;
+    _impl_.eps_ = 1e-05f;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchNormParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool use_global_stats = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_use_global_stats(&has_bits);
+          _impl_.use_global_stats_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float moving_average_fraction = 2 [default = 0.999];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_moving_average_fraction(&has_bits);
+          _impl_.moving_average_fraction_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float eps = 3 [default = 1e-05];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_eps(&has_bits);
+          _impl_.eps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchNormParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.BatchNormParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool use_global_stats = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_use_global_stats(), target);
+  }
+
+  // optional float moving_average_fraction = 2 [default = 0.999];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_moving_average_fraction(), target);
+  }
+
+  // optional float eps = 3 [default = 1e-05];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_eps(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.BatchNormParameter)
+  return target;
+}
+
+size_t BatchNormParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.BatchNormParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bool use_global_stats = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 1;
+    }
+
+    // optional float moving_average_fraction = 2 [default = 0.999];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float eps = 3 [default = 1e-05];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchNormParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchNormParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchNormParameter::GetClassData() const { return &_class_data_; }
+
+
+void BatchNormParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchNormParameter*>(&to_msg);
+  auto& from = static_cast<const BatchNormParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.BatchNormParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.use_global_stats_ = from._impl_.use_global_stats_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.moving_average_fraction_ = from._impl_.moving_average_fraction_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.eps_ = from._impl_.eps_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchNormParameter::CopyFrom(const BatchNormParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.BatchNormParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchNormParameter::IsInitialized() const {
+  return true;
+}
+
+void BatchNormParameter::InternalSwap(BatchNormParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.use_global_stats_, other->_impl_.use_global_stats_);
+  swap(_impl_.moving_average_fraction_, other->_impl_.moving_average_fraction_);
+  swap(_impl_.eps_, other->_impl_.eps_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchNormParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[13]);
+}
+
+// ===================================================================
+
+class BiasParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BiasParameter>()._impl_._has_bits_);
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_axes(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::caffe::FillerParameter& filler(const BiasParameter* msg);
+  static void set_has_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::caffe::FillerParameter&
+BiasParameter::_Internal::filler(const BiasParameter* msg) {
+  return *msg->_impl_.filler_;
+}
+BiasParameter::BiasParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.BiasParameter)
+}
+BiasParameter::BiasParameter(const BiasParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BiasParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.filler_){nullptr}
+    , decltype(_impl_.axis_){}
+    , decltype(_impl_.num_axes_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_filler()) {
+    _this->_impl_.filler_ = new ::caffe::FillerParameter(*from._impl_.filler_);
+  }
+  ::memcpy(&_impl_.axis_, &from._impl_.axis_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_axes_) -
+    reinterpret_cast<char*>(&_impl_.axis_)) + sizeof(_impl_.num_axes_));
+  // @@protoc_insertion_point(copy_constructor:caffe.BiasParameter)
+}
+
+inline void BiasParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.filler_){nullptr}
+    , decltype(_impl_.axis_){1}
+    , decltype(_impl_.num_axes_){1}
+  };
+}
+
+BiasParameter::~BiasParameter() {
+  // @@protoc_insertion_point(destructor:caffe.BiasParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BiasParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.filler_;
+}
+
+void BiasParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BiasParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.BiasParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.filler_ != nullptr);
+      _impl_.filler_->Clear();
+    }
+    _impl_.axis_ = 1;
+    _impl_.num_axes_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BiasParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 axis = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_axes = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_axes(&has_bits);
+          _impl_.num_axes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter filler = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BiasParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.BiasParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 axis = 1 [default = 1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_axis(), target);
+  }
+
+  // optional int32 num_axes = 2 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_num_axes(), target);
+  }
+
+  // optional .caffe.FillerParameter filler = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::filler(this),
+        _Internal::filler(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.BiasParameter)
+  return target;
+}
+
+size_t BiasParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.BiasParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .caffe.FillerParameter filler = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.filler_);
+    }
+
+    // optional int32 axis = 1 [default = 1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+    // optional int32 num_axes = 2 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_axes());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BiasParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BiasParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BiasParameter::GetClassData() const { return &_class_data_; }
+
+
+void BiasParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BiasParameter*>(&to_msg);
+  auto& from = static_cast<const BiasParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.BiasParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_filler());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_axes_ = from._impl_.num_axes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BiasParameter::CopyFrom(const BiasParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.BiasParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BiasParameter::IsInitialized() const {
+  return true;
+}
+
+void BiasParameter::InternalSwap(BiasParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.filler_, other->_impl_.filler_);
+  swap(_impl_.axis_, other->_impl_.axis_);
+  swap(_impl_.num_axes_, other->_impl_.num_axes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BiasParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[14]);
+}
+
+// ===================================================================
+
+class BNParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BNParameter>()._impl_._has_bits_);
+  static const ::caffe::FillerParameter& slope_filler(const BNParameter* msg);
+  static void set_has_slope_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::caffe::FillerParameter& bias_filler(const BNParameter* msg);
+  static void set_has_bias_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_momentum(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_eps(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_frozen(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::caffe::FillerParameter&
+BNParameter::_Internal::slope_filler(const BNParameter* msg) {
+  return *msg->_impl_.slope_filler_;
+}
+const ::caffe::FillerParameter&
+BNParameter::_Internal::bias_filler(const BNParameter* msg) {
+  return *msg->_impl_.bias_filler_;
+}
+BNParameter::BNParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.BNParameter)
+}
+BNParameter::BNParameter(const BNParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BNParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slope_filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.frozen_){}
+    , decltype(_impl_.engine_){}
+    , decltype(_impl_.momentum_){}
+    , decltype(_impl_.eps_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_slope_filler()) {
+    _this->_impl_.slope_filler_ = new ::caffe::FillerParameter(*from._impl_.slope_filler_);
+  }
+  if (from._internal_has_bias_filler()) {
+    _this->_impl_.bias_filler_ = new ::caffe::FillerParameter(*from._impl_.bias_filler_);
+  }
+  ::memcpy(&_impl_.frozen_, &from._impl_.frozen_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.eps_) -
+    reinterpret_cast<char*>(&_impl_.frozen_)) + sizeof(_impl_.eps_));
+  // @@protoc_insertion_point(copy_constructor:caffe.BNParameter)
+}
+
+inline void BNParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slope_filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.frozen_){false}
+    , decltype(_impl_.engine_){0}
+    , decltype(_impl_.momentum_){0.9f}
+    , decltype(_impl_.eps_){1e-05f}
+  };
+}
+
+BNParameter::~BNParameter() {
+  // @@protoc_insertion_point(destructor:caffe.BNParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BNParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.slope_filler_;
+  if (this != internal_default_instance()) delete _impl_.bias_filler_;
+}
+
+void BNParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BNParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.BNParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.slope_filler_ != nullptr);
+      _impl_.slope_filler_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.bias_filler_ != nullptr);
+      _impl_.bias_filler_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000003cu) {
+    ::memset(&_impl_.frozen_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.engine_) -
+        reinterpret_cast<char*>(&_impl_.frozen_)) + sizeof(_impl_.engine_));
+    _impl_.momentum_ = 0.9f;
+    _impl_.eps_ = 1e-05f;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BNParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.FillerParameter slope_filler = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_slope_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter bias_filler = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bias_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float momentum = 3 [default = 0.9];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_momentum(&has_bits);
+          _impl_.momentum_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float eps = 4 [default = 1e-05];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_eps(&has_bits);
+          _impl_.eps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool frozen = 5 [default = false];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_frozen(&has_bits);
+          _impl_.frozen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.BNParameter.Engine engine = 6 [default = DEFAULT];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::BNParameter_Engine_IsValid(val))) {
+            _internal_set_engine(static_cast<::caffe::BNParameter_Engine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BNParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.BNParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.FillerParameter slope_filler = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::slope_filler(this),
+        _Internal::slope_filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.FillerParameter bias_filler = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::bias_filler(this),
+        _Internal::bias_filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional float momentum = 3 [default = 0.9];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_momentum(), target);
+  }
+
+  // optional float eps = 4 [default = 1e-05];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_eps(), target);
+  }
+
+  // optional bool frozen = 5 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_frozen(), target);
+  }
+
+  // optional .caffe.BNParameter.Engine engine = 6 [default = DEFAULT];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_engine(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.BNParameter)
+  return target;
+}
+
+size_t BNParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.BNParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional .caffe.FillerParameter slope_filler = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.slope_filler_);
+    }
+
+    // optional .caffe.FillerParameter bias_filler = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.bias_filler_);
+    }
+
+    // optional bool frozen = 5 [default = false];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional .caffe.BNParameter.Engine engine = 6 [default = DEFAULT];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+    }
+
+    // optional float momentum = 3 [default = 0.9];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float eps = 4 [default = 1e-05];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BNParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BNParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BNParameter::GetClassData() const { return &_class_data_; }
+
+
+void BNParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BNParameter*>(&to_msg);
+  auto& from = static_cast<const BNParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.BNParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_slope_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_slope_filler());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_bias_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_bias_filler());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.frozen_ = from._impl_.frozen_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.engine_ = from._impl_.engine_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.momentum_ = from._impl_.momentum_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.eps_ = from._impl_.eps_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BNParameter::CopyFrom(const BNParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.BNParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BNParameter::IsInitialized() const {
+  return true;
+}
+
+void BNParameter::InternalSwap(BNParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BNParameter, _impl_.engine_)
+      + sizeof(BNParameter::_impl_.engine_)
+      - PROTOBUF_FIELD_OFFSET(BNParameter, _impl_.slope_filler_)>(
+          reinterpret_cast<char*>(&_impl_.slope_filler_),
+          reinterpret_cast<char*>(&other->_impl_.slope_filler_));
+  swap(_impl_.momentum_, other->_impl_.momentum_);
+  swap(_impl_.eps_, other->_impl_.eps_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BNParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[15]);
+}
+
+// ===================================================================
+
+class ConvolutionParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConvolutionParameter>()._impl_._has_bits_);
+  static void set_has_num_output(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_bias_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_pad_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_pad_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_kernel_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_kernel_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_stride_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_stride_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static const ::caffe::FillerParameter& weight_filler(const ConvolutionParameter* msg);
+  static void set_has_weight_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::caffe::FillerParameter& bias_filler(const ConvolutionParameter* msg);
+  static void set_has_bias_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_winograd_tile(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_force_nd_im2col(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+};
+
+const ::caffe::FillerParameter&
+ConvolutionParameter::_Internal::weight_filler(const ConvolutionParameter* msg) {
+  return *msg->_impl_.weight_filler_;
+}
+const ::caffe::FillerParameter&
+ConvolutionParameter::_Internal::bias_filler(const ConvolutionParameter* msg) {
+  return *msg->_impl_.bias_filler_;
+}
+ConvolutionParameter::ConvolutionParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ConvolutionParameter)
+}
+ConvolutionParameter::ConvolutionParameter(const ConvolutionParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConvolutionParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pad_){from._impl_.pad_}
+    , decltype(_impl_.kernel_size_){from._impl_.kernel_size_}
+    , decltype(_impl_.stride_){from._impl_.stride_}
+    , decltype(_impl_.dilation_){from._impl_.dilation_}
+    , decltype(_impl_.weight_filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.num_output_){}
+    , decltype(_impl_.pad_h_){}
+    , decltype(_impl_.pad_w_){}
+    , decltype(_impl_.kernel_h_){}
+    , decltype(_impl_.kernel_w_){}
+    , decltype(_impl_.stride_h_){}
+    , decltype(_impl_.stride_w_){}
+    , decltype(_impl_.engine_){}
+    , decltype(_impl_.force_nd_im2col_){}
+    , decltype(_impl_.winograd_tile_){}
+    , decltype(_impl_.axis_){}
+    , decltype(_impl_.bias_term_){}
+    , decltype(_impl_.group_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_weight_filler()) {
+    _this->_impl_.weight_filler_ = new ::caffe::FillerParameter(*from._impl_.weight_filler_);
+  }
+  if (from._internal_has_bias_filler()) {
+    _this->_impl_.bias_filler_ = new ::caffe::FillerParameter(*from._impl_.bias_filler_);
+  }
+  ::memcpy(&_impl_.num_output_, &from._impl_.num_output_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.group_) -
+    reinterpret_cast<char*>(&_impl_.num_output_)) + sizeof(_impl_.group_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ConvolutionParameter)
+}
+
+inline void ConvolutionParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pad_){arena}
+    , decltype(_impl_.kernel_size_){arena}
+    , decltype(_impl_.stride_){arena}
+    , decltype(_impl_.dilation_){arena}
+    , decltype(_impl_.weight_filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.num_output_){0u}
+    , decltype(_impl_.pad_h_){0u}
+    , decltype(_impl_.pad_w_){0u}
+    , decltype(_impl_.kernel_h_){0u}
+    , decltype(_impl_.kernel_w_){0u}
+    , decltype(_impl_.stride_h_){0u}
+    , decltype(_impl_.stride_w_){0u}
+    , decltype(_impl_.engine_){0}
+    , decltype(_impl_.force_nd_im2col_){false}
+    , decltype(_impl_.winograd_tile_){0u}
+    , decltype(_impl_.axis_){1}
+    , decltype(_impl_.bias_term_){true}
+    , decltype(_impl_.group_){1u}
+  };
+}
+
+ConvolutionParameter::~ConvolutionParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ConvolutionParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConvolutionParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pad_.~RepeatedField();
+  _impl_.kernel_size_.~RepeatedField();
+  _impl_.stride_.~RepeatedField();
+  _impl_.dilation_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.weight_filler_;
+  if (this != internal_default_instance()) delete _impl_.bias_filler_;
+}
+
+void ConvolutionParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConvolutionParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ConvolutionParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pad_.Clear();
+  _impl_.kernel_size_.Clear();
+  _impl_.stride_.Clear();
+  _impl_.dilation_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.weight_filler_ != nullptr);
+      _impl_.weight_filler_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.bias_filler_ != nullptr);
+      _impl_.bias_filler_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.num_output_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.stride_h_) -
+        reinterpret_cast<char*>(&_impl_.num_output_)) + sizeof(_impl_.stride_h_));
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    ::memset(&_impl_.stride_w_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.winograd_tile_) -
+        reinterpret_cast<char*>(&_impl_.stride_w_)) + sizeof(_impl_.winograd_tile_));
+    _impl_.axis_ = 1;
+    _impl_.bias_term_ = true;
+    _impl_.group_ = 1u;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConvolutionParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 num_output = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_output(&has_bits);
+          _impl_.num_output_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool bias_term = 2 [default = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_bias_term(&has_bits);
+          _impl_.bias_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 pad = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_pad(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_pad(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 kernel_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_kernel_size(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<32>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_kernel_size(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 group = 5 [default = 1];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_group(&has_bits);
+          _impl_.group_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 stride = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_stride(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_stride(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter weight_filler = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_weight_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter bias_filler = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bias_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 pad_h = 9 [default = 0];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_pad_h(&has_bits);
+          _impl_.pad_h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 pad_w = 10 [default = 0];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_pad_w(&has_bits);
+          _impl_.pad_w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 kernel_h = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_kernel_h(&has_bits);
+          _impl_.kernel_h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 kernel_w = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_kernel_w(&has_bits);
+          _impl_.kernel_w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 stride_h = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_stride_h(&has_bits);
+          _impl_.stride_h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 stride_w = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_stride_w(&has_bits);
+          _impl_.stride_w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ConvolutionParameter.Engine engine = 15 [default = DEFAULT];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::ConvolutionParameter_Engine_IsValid(val))) {
+            _internal_set_engine(static_cast<::caffe::ConvolutionParameter_Engine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(15, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 axis = 16 [default = 1];
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool force_nd_im2col = 17 [default = false];
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_force_nd_im2col(&has_bits);
+          _impl_.force_nd_im2col_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 dilation = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_dilation(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<144>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 146) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_dilation(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 winograd_tile = 19 [default = 0];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_winograd_tile(&has_bits);
+          _impl_.winograd_tile_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConvolutionParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ConvolutionParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 num_output = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_num_output(), target);
+  }
+
+  // optional bool bias_term = 2 [default = true];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_bias_term(), target);
+  }
+
+  // repeated uint32 pad = 3;
+  for (int i = 0, n = this->_internal_pad_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_pad(i), target);
+  }
+
+  // repeated uint32 kernel_size = 4;
+  for (int i = 0, n = this->_internal_kernel_size_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_kernel_size(i), target);
+  }
+
+  // optional uint32 group = 5 [default = 1];
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_group(), target);
+  }
+
+  // repeated uint32 stride = 6;
+  for (int i = 0, n = this->_internal_stride_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_stride(i), target);
+  }
+
+  // optional .caffe.FillerParameter weight_filler = 7;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::weight_filler(this),
+        _Internal::weight_filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.FillerParameter bias_filler = 8;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::bias_filler(this),
+        _Internal::bias_filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 pad_h = 9 [default = 0];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_pad_h(), target);
+  }
+
+  // optional uint32 pad_w = 10 [default = 0];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_pad_w(), target);
+  }
+
+  // optional uint32 kernel_h = 11;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_kernel_h(), target);
+  }
+
+  // optional uint32 kernel_w = 12;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_kernel_w(), target);
+  }
+
+  // optional uint32 stride_h = 13;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_stride_h(), target);
+  }
+
+  // optional uint32 stride_w = 14;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(14, this->_internal_stride_w(), target);
+  }
+
+  // optional .caffe.ConvolutionParameter.Engine engine = 15 [default = DEFAULT];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      15, this->_internal_engine(), target);
+  }
+
+  // optional int32 axis = 16 [default = 1];
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(16, this->_internal_axis(), target);
+  }
+
+  // optional bool force_nd_im2col = 17 [default = false];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(17, this->_internal_force_nd_im2col(), target);
+  }
+
+  // repeated uint32 dilation = 18;
+  for (int i = 0, n = this->_internal_dilation_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(18, this->_internal_dilation(i), target);
+  }
+
+  // optional uint32 winograd_tile = 19 [default = 0];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(19, this->_internal_winograd_tile(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ConvolutionParameter)
+  return target;
+}
+
+size_t ConvolutionParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ConvolutionParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 pad = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.pad_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_pad_size());
+    total_size += data_size;
+  }
+
+  // repeated uint32 kernel_size = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.kernel_size_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_kernel_size_size());
+    total_size += data_size;
+  }
+
+  // repeated uint32 stride = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.stride_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_stride_size());
+    total_size += data_size;
+  }
+
+  // repeated uint32 dilation = 18;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.dilation_);
+    total_size += 2 *
+                  ::_pbi::FromIntSize(this->_internal_dilation_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .caffe.FillerParameter weight_filler = 7;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.weight_filler_);
+    }
+
+    // optional .caffe.FillerParameter bias_filler = 8;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.bias_filler_);
+    }
+
+    // optional uint32 num_output = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_output());
+    }
+
+    // optional uint32 pad_h = 9 [default = 0];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pad_h());
+    }
+
+    // optional uint32 pad_w = 10 [default = 0];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pad_w());
+    }
+
+    // optional uint32 kernel_h = 11;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_kernel_h());
+    }
+
+    // optional uint32 kernel_w = 12;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_kernel_w());
+    }
+
+    // optional uint32 stride_h = 13;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stride_h());
+    }
+
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    // optional uint32 stride_w = 14;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stride_w());
+    }
+
+    // optional .caffe.ConvolutionParameter.Engine engine = 15 [default = DEFAULT];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+    }
+
+    // optional bool force_nd_im2col = 17 [default = false];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 + 1;
+    }
+
+    // optional uint32 winograd_tile = 19 [default = 0];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_winograd_tile());
+    }
+
+    // optional int32 axis = 16 [default = 1];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_axis());
+    }
+
+    // optional bool bias_term = 2 [default = true];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 group = 5 [default = 1];
+    if (cached_has_bits & 0x00004000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_group());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConvolutionParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConvolutionParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConvolutionParameter::GetClassData() const { return &_class_data_; }
+
+
+void ConvolutionParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConvolutionParameter*>(&to_msg);
+  auto& from = static_cast<const ConvolutionParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ConvolutionParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.pad_.MergeFrom(from._impl_.pad_);
+  _this->_impl_.kernel_size_.MergeFrom(from._impl_.kernel_size_);
+  _this->_impl_.stride_.MergeFrom(from._impl_.stride_);
+  _this->_impl_.dilation_.MergeFrom(from._impl_.dilation_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_weight_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_weight_filler());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_bias_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_bias_filler());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_output_ = from._impl_.num_output_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.pad_h_ = from._impl_.pad_h_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.pad_w_ = from._impl_.pad_w_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.kernel_h_ = from._impl_.kernel_h_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.kernel_w_ = from._impl_.kernel_w_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.stride_h_ = from._impl_.stride_h_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00007f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.stride_w_ = from._impl_.stride_w_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.engine_ = from._impl_.engine_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.force_nd_im2col_ = from._impl_.force_nd_im2col_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.winograd_tile_ = from._impl_.winograd_tile_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.bias_term_ = from._impl_.bias_term_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.group_ = from._impl_.group_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConvolutionParameter::CopyFrom(const ConvolutionParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ConvolutionParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConvolutionParameter::IsInitialized() const {
+  return true;
+}
+
+void ConvolutionParameter::InternalSwap(ConvolutionParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.pad_.InternalSwap(&other->_impl_.pad_);
+  _impl_.kernel_size_.InternalSwap(&other->_impl_.kernel_size_);
+  _impl_.stride_.InternalSwap(&other->_impl_.stride_);
+  _impl_.dilation_.InternalSwap(&other->_impl_.dilation_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConvolutionParameter, _impl_.winograd_tile_)
+      + sizeof(ConvolutionParameter::_impl_.winograd_tile_)
+      - PROTOBUF_FIELD_OFFSET(ConvolutionParameter, _impl_.weight_filler_)>(
+          reinterpret_cast<char*>(&_impl_.weight_filler_),
+          reinterpret_cast<char*>(&other->_impl_.weight_filler_));
+  swap(_impl_.axis_, other->_impl_.axis_);
+  swap(_impl_.bias_term_, other->_impl_.bias_term_);
+  swap(_impl_.group_, other->_impl_.group_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConvolutionParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[16]);
+}
+
+// ===================================================================
+
+class CropParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CropParameter>()._impl_._has_bits_);
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CropParameter::CropParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.CropParameter)
+}
+CropParameter::CropParameter(const CropParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CropParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.offset_){from._impl_.offset_}
+    , decltype(_impl_.axis_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.axis_ = from._impl_.axis_;
+  // @@protoc_insertion_point(copy_constructor:caffe.CropParameter)
+}
+
+inline void CropParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.offset_){arena}
+    , decltype(_impl_.axis_){2}
+  };
+}
+
+CropParameter::~CropParameter() {
+  // @@protoc_insertion_point(destructor:caffe.CropParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CropParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.offset_.~RepeatedField();
+}
+
+void CropParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CropParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.CropParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.offset_.Clear();
+  _impl_.axis_ = 2;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CropParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 axis = 1 [default = 2];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_offset(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_offset(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CropParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.CropParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 axis = 1 [default = 2];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_axis(), target);
+  }
+
+  // repeated uint32 offset = 2;
+  for (int i = 0, n = this->_internal_offset_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_offset(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.CropParameter)
+  return target;
+}
+
+size_t CropParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.CropParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 offset = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.offset_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_offset_size());
+    total_size += data_size;
+  }
+
+  // optional int32 axis = 1 [default = 2];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CropParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CropParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CropParameter::GetClassData() const { return &_class_data_; }
+
+
+void CropParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CropParameter*>(&to_msg);
+  auto& from = static_cast<const CropParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.CropParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.offset_.MergeFrom(from._impl_.offset_);
+  if (from._internal_has_axis()) {
+    _this->_internal_set_axis(from._internal_axis());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CropParameter::CopyFrom(const CropParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.CropParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CropParameter::IsInitialized() const {
+  return true;
+}
+
+void CropParameter::InternalSwap(CropParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.offset_.InternalSwap(&other->_impl_.offset_);
+  swap(_impl_.axis_, other->_impl_.axis_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CropParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[17]);
+}
+
+// ===================================================================
+
+class DropoutParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DropoutParameter>()._impl_._has_bits_);
+  static void set_has_dropout_ratio(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+DropoutParameter::DropoutParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.DropoutParameter)
+}
+DropoutParameter::DropoutParameter(const DropoutParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DropoutParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dropout_ratio_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.dropout_ratio_ = from._impl_.dropout_ratio_;
+  // @@protoc_insertion_point(copy_constructor:caffe.DropoutParameter)
+}
+
+inline void DropoutParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dropout_ratio_){0.5f}
+  };
+}
+
+DropoutParameter::~DropoutParameter() {
+  // @@protoc_insertion_point(destructor:caffe.DropoutParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DropoutParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void DropoutParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DropoutParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.DropoutParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dropout_ratio_ = 0.5f;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DropoutParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float dropout_ratio = 1 [default = 0.5];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_dropout_ratio(&has_bits);
+          _impl_.dropout_ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DropoutParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.DropoutParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float dropout_ratio = 1 [default = 0.5];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_dropout_ratio(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.DropoutParameter)
+  return target;
+}
+
+size_t DropoutParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.DropoutParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional float dropout_ratio = 1 [default = 0.5];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DropoutParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DropoutParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DropoutParameter::GetClassData() const { return &_class_data_; }
+
+
+void DropoutParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DropoutParameter*>(&to_msg);
+  auto& from = static_cast<const DropoutParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.DropoutParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_dropout_ratio()) {
+    _this->_internal_set_dropout_ratio(from._internal_dropout_ratio());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DropoutParameter::CopyFrom(const DropoutParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.DropoutParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DropoutParameter::IsInitialized() const {
+  return true;
+}
+
+void DropoutParameter::InternalSwap(DropoutParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.dropout_ratio_, other->_impl_.dropout_ratio_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DropoutParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[18]);
+}
+
+// ===================================================================
+
+class EltwiseParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EltwiseParameter>()._impl_._has_bits_);
+  static void set_has_operation(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_stable_prod_grad(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+EltwiseParameter::EltwiseParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.EltwiseParameter)
+}
+EltwiseParameter::EltwiseParameter(const EltwiseParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EltwiseParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.coeff_){from._impl_.coeff_}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.stable_prod_grad_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.operation_, &from._impl_.operation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stable_prod_grad_) -
+    reinterpret_cast<char*>(&_impl_.operation_)) + sizeof(_impl_.stable_prod_grad_));
+  // @@protoc_insertion_point(copy_constructor:caffe.EltwiseParameter)
+}
+
+inline void EltwiseParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.coeff_){arena}
+    , decltype(_impl_.operation_){1}
+    , decltype(_impl_.stable_prod_grad_){true}
+  };
+}
+
+EltwiseParameter::~EltwiseParameter() {
+  // @@protoc_insertion_point(destructor:caffe.EltwiseParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EltwiseParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.coeff_.~RepeatedField();
+}
+
+void EltwiseParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EltwiseParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.EltwiseParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.coeff_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.operation_ = 1;
+    _impl_.stable_prod_grad_ = true;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EltwiseParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.EltwiseParameter.EltwiseOp operation = 1 [default = SUM];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::EltwiseParameter_EltwiseOp_IsValid(val))) {
+            _internal_set_operation(static_cast<::caffe::EltwiseParameter_EltwiseOp>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float coeff = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_coeff(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<21>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_coeff(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool stable_prod_grad = 3 [default = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_stable_prod_grad(&has_bits);
+          _impl_.stable_prod_grad_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EltwiseParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.EltwiseParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.EltwiseParameter.EltwiseOp operation = 1 [default = SUM];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  // repeated float coeff = 2;
+  for (int i = 0, n = this->_internal_coeff_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_coeff(i), target);
+  }
+
+  // optional bool stable_prod_grad = 3 [default = true];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_stable_prod_grad(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.EltwiseParameter)
+  return target;
+}
+
+size_t EltwiseParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.EltwiseParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float coeff = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_coeff_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_coeff_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .caffe.EltwiseParameter.EltwiseOp operation = 1 [default = SUM];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+    }
+
+    // optional bool stable_prod_grad = 3 [default = true];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EltwiseParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EltwiseParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EltwiseParameter::GetClassData() const { return &_class_data_; }
+
+
+void EltwiseParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EltwiseParameter*>(&to_msg);
+  auto& from = static_cast<const EltwiseParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.EltwiseParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.coeff_.MergeFrom(from._impl_.coeff_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.operation_ = from._impl_.operation_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.stable_prod_grad_ = from._impl_.stable_prod_grad_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EltwiseParameter::CopyFrom(const EltwiseParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.EltwiseParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EltwiseParameter::IsInitialized() const {
+  return true;
+}
+
+void EltwiseParameter::InternalSwap(EltwiseParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.coeff_.InternalSwap(&other->_impl_.coeff_);
+  swap(_impl_.operation_, other->_impl_.operation_);
+  swap(_impl_.stable_prod_grad_, other->_impl_.stable_prod_grad_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EltwiseParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[19]);
+}
+
+// ===================================================================
+
+class ELUParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ELUParameter>()._impl_._has_bits_);
+  static void set_has_alpha(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ELUParameter::ELUParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ELUParameter)
+}
+ELUParameter::ELUParameter(const ELUParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ELUParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.alpha_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.alpha_ = from._impl_.alpha_;
+  // @@protoc_insertion_point(copy_constructor:caffe.ELUParameter)
+}
+
+inline void ELUParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.alpha_){1}
+  };
+}
+
+ELUParameter::~ELUParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ELUParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ELUParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ELUParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ELUParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ELUParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.alpha_ = 1;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ELUParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float alpha = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_alpha(&has_bits);
+          _impl_.alpha_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ELUParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ELUParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float alpha = 1 [default = 1];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_alpha(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ELUParameter)
+  return target;
+}
+
+size_t ELUParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ELUParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional float alpha = 1 [default = 1];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ELUParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ELUParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ELUParameter::GetClassData() const { return &_class_data_; }
+
+
+void ELUParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ELUParameter*>(&to_msg);
+  auto& from = static_cast<const ELUParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ELUParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_alpha()) {
+    _this->_internal_set_alpha(from._internal_alpha());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ELUParameter::CopyFrom(const ELUParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ELUParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ELUParameter::IsInitialized() const {
+  return true;
+}
+
+void ELUParameter::InternalSwap(ELUParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.alpha_, other->_impl_.alpha_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ELUParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[20]);
+}
+
+// ===================================================================
+
+class EmbedParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EmbedParameter>()._impl_._has_bits_);
+  static void set_has_num_output(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_input_dim(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_bias_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::caffe::FillerParameter& weight_filler(const EmbedParameter* msg);
+  static void set_has_weight_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::caffe::FillerParameter& bias_filler(const EmbedParameter* msg);
+  static void set_has_bias_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::caffe::FillerParameter&
+EmbedParameter::_Internal::weight_filler(const EmbedParameter* msg) {
+  return *msg->_impl_.weight_filler_;
+}
+const ::caffe::FillerParameter&
+EmbedParameter::_Internal::bias_filler(const EmbedParameter* msg) {
+  return *msg->_impl_.bias_filler_;
+}
+EmbedParameter::EmbedParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.EmbedParameter)
+}
+EmbedParameter::EmbedParameter(const EmbedParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EmbedParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.weight_filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.num_output_){}
+    , decltype(_impl_.input_dim_){}
+    , decltype(_impl_.bias_term_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_weight_filler()) {
+    _this->_impl_.weight_filler_ = new ::caffe::FillerParameter(*from._impl_.weight_filler_);
+  }
+  if (from._internal_has_bias_filler()) {
+    _this->_impl_.bias_filler_ = new ::caffe::FillerParameter(*from._impl_.bias_filler_);
+  }
+  ::memcpy(&_impl_.num_output_, &from._impl_.num_output_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bias_term_) -
+    reinterpret_cast<char*>(&_impl_.num_output_)) + sizeof(_impl_.bias_term_));
+  // @@protoc_insertion_point(copy_constructor:caffe.EmbedParameter)
+}
+
+inline void EmbedParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.weight_filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.num_output_){0u}
+    , decltype(_impl_.input_dim_){0u}
+    , decltype(_impl_.bias_term_){true}
+  };
+}
+
+EmbedParameter::~EmbedParameter() {
+  // @@protoc_insertion_point(destructor:caffe.EmbedParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EmbedParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.weight_filler_;
+  if (this != internal_default_instance()) delete _impl_.bias_filler_;
+}
+
+void EmbedParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EmbedParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.EmbedParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.weight_filler_ != nullptr);
+      _impl_.weight_filler_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.bias_filler_ != nullptr);
+      _impl_.bias_filler_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000001cu) {
+    ::memset(&_impl_.num_output_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.input_dim_) -
+        reinterpret_cast<char*>(&_impl_.num_output_)) + sizeof(_impl_.input_dim_));
+    _impl_.bias_term_ = true;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EmbedParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 num_output = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_output(&has_bits);
+          _impl_.num_output_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 input_dim = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_input_dim(&has_bits);
+          _impl_.input_dim_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool bias_term = 3 [default = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_bias_term(&has_bits);
+          _impl_.bias_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter weight_filler = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_weight_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter bias_filler = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bias_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EmbedParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.EmbedParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 num_output = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_num_output(), target);
+  }
+
+  // optional uint32 input_dim = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_input_dim(), target);
+  }
+
+  // optional bool bias_term = 3 [default = true];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_bias_term(), target);
+  }
+
+  // optional .caffe.FillerParameter weight_filler = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::weight_filler(this),
+        _Internal::weight_filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.FillerParameter bias_filler = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::bias_filler(this),
+        _Internal::bias_filler(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.EmbedParameter)
+  return target;
+}
+
+size_t EmbedParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.EmbedParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .caffe.FillerParameter weight_filler = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.weight_filler_);
+    }
+
+    // optional .caffe.FillerParameter bias_filler = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.bias_filler_);
+    }
+
+    // optional uint32 num_output = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_output());
+    }
+
+    // optional uint32 input_dim = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_input_dim());
+    }
+
+    // optional bool bias_term = 3 [default = true];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EmbedParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EmbedParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EmbedParameter::GetClassData() const { return &_class_data_; }
+
+
+void EmbedParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EmbedParameter*>(&to_msg);
+  auto& from = static_cast<const EmbedParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.EmbedParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_weight_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_weight_filler());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_bias_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_bias_filler());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_output_ = from._impl_.num_output_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.input_dim_ = from._impl_.input_dim_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.bias_term_ = from._impl_.bias_term_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EmbedParameter::CopyFrom(const EmbedParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.EmbedParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EmbedParameter::IsInitialized() const {
+  return true;
+}
+
+void EmbedParameter::InternalSwap(EmbedParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EmbedParameter, _impl_.input_dim_)
+      + sizeof(EmbedParameter::_impl_.input_dim_)
+      - PROTOBUF_FIELD_OFFSET(EmbedParameter, _impl_.weight_filler_)>(
+          reinterpret_cast<char*>(&_impl_.weight_filler_),
+          reinterpret_cast<char*>(&other->_impl_.weight_filler_));
+  swap(_impl_.bias_term_, other->_impl_.bias_term_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EmbedParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[21]);
+}
+
+// ===================================================================
+
+class ExpParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ExpParameter>()._impl_._has_bits_);
+  static void set_has_base(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_scale(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_shift(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ExpParameter::ExpParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ExpParameter)
+}
+ExpParameter::ExpParameter(const ExpParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExpParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shift_){}
+    , decltype(_impl_.base_){}
+    , decltype(_impl_.scale_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.shift_, &from._impl_.shift_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.scale_) -
+    reinterpret_cast<char*>(&_impl_.shift_)) + sizeof(_impl_.scale_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ExpParameter)
+}
+
+inline void ExpParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shift_){0}
+    , decltype(_impl_.base_){-1}
+    , decltype(_impl_.scale_){1}
+  };
+}
+
+ExpParameter::~ExpParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ExpParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExpParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ExpParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExpParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ExpParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    _impl_.shift_ = 0;
+    _impl_.base_ = -1;
+    _impl_.scale_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExpParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float base = 1 [default = -1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_base(&has_bits);
+          _impl_.base_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float scale = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_scale(&has_bits);
+          _impl_.scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float shift = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_shift(&has_bits);
+          _impl_.shift_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExpParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ExpParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float base = 1 [default = -1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_base(), target);
+  }
+
+  // optional float scale = 2 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_scale(), target);
+  }
+
+  // optional float shift = 3 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_shift(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ExpParameter)
+  return target;
+}
+
+size_t ExpParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ExpParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional float shift = 3 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float base = 1 [default = -1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float scale = 2 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExpParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExpParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExpParameter::GetClassData() const { return &_class_data_; }
+
+
+void ExpParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExpParameter*>(&to_msg);
+  auto& from = static_cast<const ExpParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ExpParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.shift_ = from._impl_.shift_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.base_ = from._impl_.base_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.scale_ = from._impl_.scale_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExpParameter::CopyFrom(const ExpParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ExpParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExpParameter::IsInitialized() const {
+  return true;
+}
+
+void ExpParameter::InternalSwap(ExpParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.shift_, other->_impl_.shift_);
+  swap(_impl_.base_, other->_impl_.base_);
+  swap(_impl_.scale_, other->_impl_.scale_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExpParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[22]);
+}
+
+// ===================================================================
+
+class FlattenParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FlattenParameter>()._impl_._has_bits_);
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_end_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+FlattenParameter::FlattenParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.FlattenParameter)
+}
+FlattenParameter::FlattenParameter(const FlattenParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FlattenParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.axis_){}
+    , decltype(_impl_.end_axis_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.axis_, &from._impl_.axis_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_axis_) -
+    reinterpret_cast<char*>(&_impl_.axis_)) + sizeof(_impl_.end_axis_));
+  // @@protoc_insertion_point(copy_constructor:caffe.FlattenParameter)
+}
+
+inline void FlattenParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.axis_){1}
+    , decltype(_impl_.end_axis_){-1}
+  };
+}
+
+FlattenParameter::~FlattenParameter() {
+  // @@protoc_insertion_point(destructor:caffe.FlattenParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FlattenParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void FlattenParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FlattenParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.FlattenParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.axis_ = 1;
+    _impl_.end_axis_ = -1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FlattenParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 axis = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 end_axis = 2 [default = -1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_end_axis(&has_bits);
+          _impl_.end_axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FlattenParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.FlattenParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 axis = 1 [default = 1];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_axis(), target);
+  }
+
+  // optional int32 end_axis = 2 [default = -1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_end_axis(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.FlattenParameter)
+  return target;
+}
+
+size_t FlattenParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.FlattenParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 axis = 1 [default = 1];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+    // optional int32 end_axis = 2 [default = -1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_end_axis());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FlattenParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FlattenParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FlattenParameter::GetClassData() const { return &_class_data_; }
+
+
+void FlattenParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FlattenParameter*>(&to_msg);
+  auto& from = static_cast<const FlattenParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.FlattenParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.end_axis_ = from._impl_.end_axis_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FlattenParameter::CopyFrom(const FlattenParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.FlattenParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FlattenParameter::IsInitialized() const {
+  return true;
+}
+
+void FlattenParameter::InternalSwap(FlattenParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.axis_, other->_impl_.axis_);
+  swap(_impl_.end_axis_, other->_impl_.end_axis_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FlattenParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[23]);
+}
+
+// ===================================================================
+
+class InnerProductParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<InnerProductParameter>()._impl_._has_bits_);
+  static void set_has_num_output(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_bias_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::caffe::FillerParameter& weight_filler(const InnerProductParameter* msg);
+  static void set_has_weight_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::caffe::FillerParameter& bias_filler(const InnerProductParameter* msg);
+  static void set_has_bias_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_transpose(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::caffe::FillerParameter&
+InnerProductParameter::_Internal::weight_filler(const InnerProductParameter* msg) {
+  return *msg->_impl_.weight_filler_;
+}
+const ::caffe::FillerParameter&
+InnerProductParameter::_Internal::bias_filler(const InnerProductParameter* msg) {
+  return *msg->_impl_.bias_filler_;
+}
+InnerProductParameter::InnerProductParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.InnerProductParameter)
+}
+InnerProductParameter::InnerProductParameter(const InnerProductParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InnerProductParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.weight_filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.num_output_){}
+    , decltype(_impl_.transpose_){}
+    , decltype(_impl_.bias_term_){}
+    , decltype(_impl_.axis_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_weight_filler()) {
+    _this->_impl_.weight_filler_ = new ::caffe::FillerParameter(*from._impl_.weight_filler_);
+  }
+  if (from._internal_has_bias_filler()) {
+    _this->_impl_.bias_filler_ = new ::caffe::FillerParameter(*from._impl_.bias_filler_);
+  }
+  ::memcpy(&_impl_.num_output_, &from._impl_.num_output_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.axis_) -
+    reinterpret_cast<char*>(&_impl_.num_output_)) + sizeof(_impl_.axis_));
+  // @@protoc_insertion_point(copy_constructor:caffe.InnerProductParameter)
+}
+
+inline void InnerProductParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.weight_filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.num_output_){0u}
+    , decltype(_impl_.transpose_){false}
+    , decltype(_impl_.bias_term_){true}
+    , decltype(_impl_.axis_){1}
+  };
+}
+
+InnerProductParameter::~InnerProductParameter() {
+  // @@protoc_insertion_point(destructor:caffe.InnerProductParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InnerProductParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.weight_filler_;
+  if (this != internal_default_instance()) delete _impl_.bias_filler_;
+}
+
+void InnerProductParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InnerProductParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.InnerProductParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.weight_filler_ != nullptr);
+      _impl_.weight_filler_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.bias_filler_ != nullptr);
+      _impl_.bias_filler_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000003cu) {
+    ::memset(&_impl_.num_output_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.transpose_) -
+        reinterpret_cast<char*>(&_impl_.num_output_)) + sizeof(_impl_.transpose_));
+    _impl_.bias_term_ = true;
+    _impl_.axis_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InnerProductParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 num_output = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_output(&has_bits);
+          _impl_.num_output_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool bias_term = 2 [default = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_bias_term(&has_bits);
+          _impl_.bias_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter weight_filler = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_weight_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter bias_filler = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bias_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 axis = 5 [default = 1];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool transpose = 6 [default = false];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_transpose(&has_bits);
+          _impl_.transpose_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InnerProductParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.InnerProductParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 num_output = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_num_output(), target);
+  }
+
+  // optional bool bias_term = 2 [default = true];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_bias_term(), target);
+  }
+
+  // optional .caffe.FillerParameter weight_filler = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::weight_filler(this),
+        _Internal::weight_filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.FillerParameter bias_filler = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::bias_filler(this),
+        _Internal::bias_filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int32 axis = 5 [default = 1];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_axis(), target);
+  }
+
+  // optional bool transpose = 6 [default = false];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_transpose(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.InnerProductParameter)
+  return target;
+}
+
+size_t InnerProductParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.InnerProductParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional .caffe.FillerParameter weight_filler = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.weight_filler_);
+    }
+
+    // optional .caffe.FillerParameter bias_filler = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.bias_filler_);
+    }
+
+    // optional uint32 num_output = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_output());
+    }
+
+    // optional bool transpose = 6 [default = false];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool bias_term = 2 [default = true];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 axis = 5 [default = 1];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InnerProductParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InnerProductParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InnerProductParameter::GetClassData() const { return &_class_data_; }
+
+
+void InnerProductParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InnerProductParameter*>(&to_msg);
+  auto& from = static_cast<const InnerProductParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.InnerProductParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_weight_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_weight_filler());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_bias_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_bias_filler());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_output_ = from._impl_.num_output_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.transpose_ = from._impl_.transpose_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.bias_term_ = from._impl_.bias_term_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InnerProductParameter::CopyFrom(const InnerProductParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.InnerProductParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InnerProductParameter::IsInitialized() const {
+  return true;
+}
+
+void InnerProductParameter::InternalSwap(InnerProductParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InnerProductParameter, _impl_.transpose_)
+      + sizeof(InnerProductParameter::_impl_.transpose_)
+      - PROTOBUF_FIELD_OFFSET(InnerProductParameter, _impl_.weight_filler_)>(
+          reinterpret_cast<char*>(&_impl_.weight_filler_),
+          reinterpret_cast<char*>(&other->_impl_.weight_filler_));
+  swap(_impl_.bias_term_, other->_impl_.bias_term_);
+  swap(_impl_.axis_, other->_impl_.axis_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InnerProductParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[24]);
+}
+
+// ===================================================================
+
+class InputParameter::_Internal {
+ public:
+};
+
+InputParameter::InputParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.InputParameter)
+}
+InputParameter::InputParameter(const InputParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InputParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.shape_){from._impl_.shape_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:caffe.InputParameter)
+}
+
+inline void InputParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.shape_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InputParameter::~InputParameter() {
+  // @@protoc_insertion_point(destructor:caffe.InputParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InputParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.shape_.~RepeatedPtrField();
+}
+
+void InputParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InputParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.InputParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.shape_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InputParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .caffe.BlobShape shape = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_shape(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InputParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.InputParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .caffe.BlobShape shape = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_shape_size()); i < n; i++) {
+    const auto& repfield = this->_internal_shape(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.InputParameter)
+  return target;
+}
+
+size_t InputParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.InputParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .caffe.BlobShape shape = 1;
+  total_size += 1UL * this->_internal_shape_size();
+  for (const auto& msg : this->_impl_.shape_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InputParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InputParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InputParameter::GetClassData() const { return &_class_data_; }
+
+
+void InputParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InputParameter*>(&to_msg);
+  auto& from = static_cast<const InputParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.InputParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.shape_.MergeFrom(from._impl_.shape_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InputParameter::CopyFrom(const InputParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.InputParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InputParameter::IsInitialized() const {
+  return true;
+}
+
+void InputParameter::InternalSwap(InputParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.shape_.InternalSwap(&other->_impl_.shape_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InputParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[25]);
+}
+
+// ===================================================================
+
+class LogParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LogParameter>()._impl_._has_bits_);
+  static void set_has_base(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_scale(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_shift(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+LogParameter::LogParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.LogParameter)
+}
+LogParameter::LogParameter(const LogParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shift_){}
+    , decltype(_impl_.base_){}
+    , decltype(_impl_.scale_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.shift_, &from._impl_.shift_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.scale_) -
+    reinterpret_cast<char*>(&_impl_.shift_)) + sizeof(_impl_.scale_));
+  // @@protoc_insertion_point(copy_constructor:caffe.LogParameter)
+}
+
+inline void LogParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shift_){0}
+    , decltype(_impl_.base_){-1}
+    , decltype(_impl_.scale_){1}
+  };
+}
+
+LogParameter::~LogParameter() {
+  // @@protoc_insertion_point(destructor:caffe.LogParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LogParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LogParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LogParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.LogParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    _impl_.shift_ = 0;
+    _impl_.base_ = -1;
+    _impl_.scale_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LogParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float base = 1 [default = -1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_base(&has_bits);
+          _impl_.base_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float scale = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_scale(&has_bits);
+          _impl_.scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float shift = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_shift(&has_bits);
+          _impl_.shift_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LogParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.LogParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float base = 1 [default = -1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_base(), target);
+  }
+
+  // optional float scale = 2 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_scale(), target);
+  }
+
+  // optional float shift = 3 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_shift(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.LogParameter)
+  return target;
+}
+
+size_t LogParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.LogParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional float shift = 3 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float base = 1 [default = -1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float scale = 2 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogParameter::GetClassData() const { return &_class_data_; }
+
+
+void LogParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogParameter*>(&to_msg);
+  auto& from = static_cast<const LogParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.LogParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.shift_ = from._impl_.shift_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.base_ = from._impl_.base_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.scale_ = from._impl_.scale_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogParameter::CopyFrom(const LogParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.LogParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogParameter::IsInitialized() const {
+  return true;
+}
+
+void LogParameter::InternalSwap(LogParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.shift_, other->_impl_.shift_);
+  swap(_impl_.base_, other->_impl_.base_);
+  swap(_impl_.scale_, other->_impl_.scale_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[26]);
+}
+
+// ===================================================================
+
+class LRNParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LRNParameter>()._impl_._has_bits_);
+  static void set_has_local_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_alpha(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_beta(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_norm_region(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_k(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+LRNParameter::LRNParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.LRNParameter)
+}
+LRNParameter::LRNParameter(const LRNParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LRNParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.norm_region_){}
+    , decltype(_impl_.engine_){}
+    , decltype(_impl_.local_size_){}
+    , decltype(_impl_.alpha_){}
+    , decltype(_impl_.beta_){}
+    , decltype(_impl_.k_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.norm_region_, &from._impl_.norm_region_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.k_) -
+    reinterpret_cast<char*>(&_impl_.norm_region_)) + sizeof(_impl_.k_));
+  // @@protoc_insertion_point(copy_constructor:caffe.LRNParameter)
+}
+
+inline void LRNParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.norm_region_){0}
+    , decltype(_impl_.engine_){0}
+    , decltype(_impl_.local_size_){5u}
+    , decltype(_impl_.alpha_){1}
+    , decltype(_impl_.beta_){0.75f}
+    , decltype(_impl_.k_){1}
+  };
+}
+
+LRNParameter::~LRNParameter() {
+  // @@protoc_insertion_point(destructor:caffe.LRNParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LRNParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LRNParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LRNParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.LRNParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.norm_region_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.engine_) -
+        reinterpret_cast<char*>(&_impl_.norm_region_)) + sizeof(_impl_.engine_));
+    _impl_.local_size_ = 5u;
+    _impl_.alpha_ = 1;
+    _impl_.beta_ = 0.75f;
+    _impl_.k_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LRNParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 local_size = 1 [default = 5];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_local_size(&has_bits);
+          _impl_.local_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float alpha = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_alpha(&has_bits);
+          _impl_.alpha_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float beta = 3 [default = 0.75];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_beta(&has_bits);
+          _impl_.beta_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.LRNParameter.NormRegion norm_region = 4 [default = ACROSS_CHANNELS];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::LRNParameter_NormRegion_IsValid(val))) {
+            _internal_set_norm_region(static_cast<::caffe::LRNParameter_NormRegion>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float k = 5 [default = 1];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_k(&has_bits);
+          _impl_.k_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.LRNParameter.Engine engine = 6 [default = DEFAULT];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::LRNParameter_Engine_IsValid(val))) {
+            _internal_set_engine(static_cast<::caffe::LRNParameter_Engine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LRNParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.LRNParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 local_size = 1 [default = 5];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_local_size(), target);
+  }
+
+  // optional float alpha = 2 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_alpha(), target);
+  }
+
+  // optional float beta = 3 [default = 0.75];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_beta(), target);
+  }
+
+  // optional .caffe.LRNParameter.NormRegion norm_region = 4 [default = ACROSS_CHANNELS];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_norm_region(), target);
+  }
+
+  // optional float k = 5 [default = 1];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_k(), target);
+  }
+
+  // optional .caffe.LRNParameter.Engine engine = 6 [default = DEFAULT];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_engine(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.LRNParameter)
+  return target;
+}
+
+size_t LRNParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.LRNParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional .caffe.LRNParameter.NormRegion norm_region = 4 [default = ACROSS_CHANNELS];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_norm_region());
+    }
+
+    // optional .caffe.LRNParameter.Engine engine = 6 [default = DEFAULT];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+    }
+
+    // optional uint32 local_size = 1 [default = 5];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_local_size());
+    }
+
+    // optional float alpha = 2 [default = 1];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float beta = 3 [default = 0.75];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float k = 5 [default = 1];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LRNParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LRNParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LRNParameter::GetClassData() const { return &_class_data_; }
+
+
+void LRNParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LRNParameter*>(&to_msg);
+  auto& from = static_cast<const LRNParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.LRNParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.norm_region_ = from._impl_.norm_region_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.engine_ = from._impl_.engine_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.local_size_ = from._impl_.local_size_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.alpha_ = from._impl_.alpha_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.beta_ = from._impl_.beta_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.k_ = from._impl_.k_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LRNParameter::CopyFrom(const LRNParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.LRNParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LRNParameter::IsInitialized() const {
+  return true;
+}
+
+void LRNParameter::InternalSwap(LRNParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LRNParameter, _impl_.engine_)
+      + sizeof(LRNParameter::_impl_.engine_)
+      - PROTOBUF_FIELD_OFFSET(LRNParameter, _impl_.norm_region_)>(
+          reinterpret_cast<char*>(&_impl_.norm_region_),
+          reinterpret_cast<char*>(&other->_impl_.norm_region_));
+  swap(_impl_.local_size_, other->_impl_.local_size_);
+  swap(_impl_.alpha_, other->_impl_.alpha_);
+  swap(_impl_.beta_, other->_impl_.beta_);
+  swap(_impl_.k_, other->_impl_.k_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LRNParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[27]);
+}
+
+// ===================================================================
+
+class MVNParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MVNParameter>()._impl_._has_bits_);
+  static void set_has_normalize_variance(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_across_channels(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_eps(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+MVNParameter::MVNParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.MVNParameter)
+}
+MVNParameter::MVNParameter(const MVNParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MVNParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.across_channels_){}
+    , decltype(_impl_.normalize_variance_){}
+    , decltype(_impl_.eps_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.across_channels_, &from._impl_.across_channels_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.eps_) -
+    reinterpret_cast<char*>(&_impl_.across_channels_)) + sizeof(_impl_.eps_));
+  // @@protoc_insertion_point(copy_constructor:caffe.MVNParameter)
+}
+
+inline void MVNParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.across_channels_){false}
+    , decltype(_impl_.normalize_variance_){true}
+    , decltype(_impl_.eps_){1e-09f}
+  };
+}
+
+MVNParameter::~MVNParameter() {
+  // @@protoc_insertion_point(destructor:caffe.MVNParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MVNParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MVNParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MVNParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.MVNParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    _impl_.across_channels_ = false;
+    _impl_.normalize_variance_ = true;
+    _impl_.eps_ = 1e-09f;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MVNParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool normalize_variance = 1 [default = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_normalize_variance(&has_bits);
+          _impl_.normalize_variance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool across_channels = 2 [default = false];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_across_channels(&has_bits);
+          _impl_.across_channels_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float eps = 3 [default = 1e-09];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_eps(&has_bits);
+          _impl_.eps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MVNParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.MVNParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool normalize_variance = 1 [default = true];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_normalize_variance(), target);
+  }
+
+  // optional bool across_channels = 2 [default = false];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_across_channels(), target);
+  }
+
+  // optional float eps = 3 [default = 1e-09];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_eps(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.MVNParameter)
+  return target;
+}
+
+size_t MVNParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.MVNParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bool across_channels = 2 [default = false];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool normalize_variance = 1 [default = true];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional float eps = 3 [default = 1e-09];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MVNParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MVNParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MVNParameter::GetClassData() const { return &_class_data_; }
+
+
+void MVNParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MVNParameter*>(&to_msg);
+  auto& from = static_cast<const MVNParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.MVNParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.across_channels_ = from._impl_.across_channels_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.normalize_variance_ = from._impl_.normalize_variance_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.eps_ = from._impl_.eps_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MVNParameter::CopyFrom(const MVNParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.MVNParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MVNParameter::IsInitialized() const {
+  return true;
+}
+
+void MVNParameter::InternalSwap(MVNParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.across_channels_, other->_impl_.across_channels_);
+  swap(_impl_.normalize_variance_, other->_impl_.normalize_variance_);
+  swap(_impl_.eps_, other->_impl_.eps_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MVNParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[28]);
+}
+
+// ===================================================================
+
+class ParameterParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ParameterParameter>()._impl_._has_bits_);
+  static const ::caffe::BlobShape& shape(const ParameterParameter* msg);
+  static void set_has_shape(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::caffe::BlobShape&
+ParameterParameter::_Internal::shape(const ParameterParameter* msg) {
+  return *msg->_impl_.shape_;
+}
+ParameterParameter::ParameterParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ParameterParameter)
+}
+ParameterParameter::ParameterParameter(const ParameterParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ParameterParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shape_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_shape()) {
+    _this->_impl_.shape_ = new ::caffe::BlobShape(*from._impl_.shape_);
+  }
+  // @@protoc_insertion_point(copy_constructor:caffe.ParameterParameter)
+}
+
+inline void ParameterParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shape_){nullptr}
+  };
+}
+
+ParameterParameter::~ParameterParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ParameterParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ParameterParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.shape_;
+}
+
+void ParameterParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ParameterParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ParameterParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.shape_ != nullptr);
+    _impl_.shape_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ParameterParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.BlobShape shape = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shape(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ParameterParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ParameterParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.BlobShape shape = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::shape(this),
+        _Internal::shape(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ParameterParameter)
+  return target;
+}
+
+size_t ParameterParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ParameterParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .caffe.BlobShape shape = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.shape_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ParameterParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ParameterParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ParameterParameter::GetClassData() const { return &_class_data_; }
+
+
+void ParameterParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ParameterParameter*>(&to_msg);
+  auto& from = static_cast<const ParameterParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ParameterParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_shape()) {
+    _this->_internal_mutable_shape()->::caffe::BlobShape::MergeFrom(
+        from._internal_shape());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ParameterParameter::CopyFrom(const ParameterParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ParameterParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ParameterParameter::IsInitialized() const {
+  return true;
+}
+
+void ParameterParameter::InternalSwap(ParameterParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.shape_, other->_impl_.shape_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ParameterParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[29]);
+}
+
+// ===================================================================
+
+class PoolingParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PoolingParameter>()._impl_._has_bits_);
+  static void set_has_pool(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_pad(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_pad_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_pad_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_kernel_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_kernel_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_kernel_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_stride(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_stride_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_stride_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_global_pooling(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+};
+
+PoolingParameter::PoolingParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.PoolingParameter)
+}
+PoolingParameter::PoolingParameter(const PoolingParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PoolingParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pool_){}
+    , decltype(_impl_.kernel_size_){}
+    , decltype(_impl_.pad_){}
+    , decltype(_impl_.kernel_h_){}
+    , decltype(_impl_.kernel_w_){}
+    , decltype(_impl_.stride_h_){}
+    , decltype(_impl_.stride_w_){}
+    , decltype(_impl_.pad_h_){}
+    , decltype(_impl_.pad_w_){}
+    , decltype(_impl_.engine_){}
+    , decltype(_impl_.global_pooling_){}
+    , decltype(_impl_.stride_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.pool_, &from._impl_.pool_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stride_) -
+    reinterpret_cast<char*>(&_impl_.pool_)) + sizeof(_impl_.stride_));
+  // @@protoc_insertion_point(copy_constructor:caffe.PoolingParameter)
+}
+
+inline void PoolingParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pool_){0}
+    , decltype(_impl_.kernel_size_){0u}
+    , decltype(_impl_.pad_){0u}
+    , decltype(_impl_.kernel_h_){0u}
+    , decltype(_impl_.kernel_w_){0u}
+    , decltype(_impl_.stride_h_){0u}
+    , decltype(_impl_.stride_w_){0u}
+    , decltype(_impl_.pad_h_){0u}
+    , decltype(_impl_.pad_w_){0u}
+    , decltype(_impl_.engine_){0}
+    , decltype(_impl_.global_pooling_){false}
+    , decltype(_impl_.stride_){1u}
+  };
+}
+
+PoolingParameter::~PoolingParameter() {
+  // @@protoc_insertion_point(destructor:caffe.PoolingParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PoolingParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PoolingParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PoolingParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.PoolingParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.pool_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.pad_h_) -
+        reinterpret_cast<char*>(&_impl_.pool_)) + sizeof(_impl_.pad_h_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.pad_w_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.global_pooling_) -
+        reinterpret_cast<char*>(&_impl_.pad_w_)) + sizeof(_impl_.global_pooling_));
+    _impl_.stride_ = 1u;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PoolingParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.PoolingParameter.PoolMethod pool = 1 [default = MAX];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::PoolingParameter_PoolMethod_IsValid(val))) {
+            _internal_set_pool(static_cast<::caffe::PoolingParameter_PoolMethod>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 kernel_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_kernel_size(&has_bits);
+          _impl_.kernel_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 stride = 3 [default = 1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_stride(&has_bits);
+          _impl_.stride_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 pad = 4 [default = 0];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_pad(&has_bits);
+          _impl_.pad_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 kernel_h = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_kernel_h(&has_bits);
+          _impl_.kernel_h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 kernel_w = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_kernel_w(&has_bits);
+          _impl_.kernel_w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 stride_h = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_stride_h(&has_bits);
+          _impl_.stride_h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 stride_w = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_stride_w(&has_bits);
+          _impl_.stride_w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 pad_h = 9 [default = 0];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_pad_h(&has_bits);
+          _impl_.pad_h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 pad_w = 10 [default = 0];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_pad_w(&has_bits);
+          _impl_.pad_w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PoolingParameter.Engine engine = 11 [default = DEFAULT];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::PoolingParameter_Engine_IsValid(val))) {
+            _internal_set_engine(static_cast<::caffe::PoolingParameter_Engine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(11, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool global_pooling = 12 [default = false];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_global_pooling(&has_bits);
+          _impl_.global_pooling_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PoolingParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.PoolingParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.PoolingParameter.PoolMethod pool = 1 [default = MAX];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_pool(), target);
+  }
+
+  // optional uint32 kernel_size = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_kernel_size(), target);
+  }
+
+  // optional uint32 stride = 3 [default = 1];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_stride(), target);
+  }
+
+  // optional uint32 pad = 4 [default = 0];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_pad(), target);
+  }
+
+  // optional uint32 kernel_h = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_kernel_h(), target);
+  }
+
+  // optional uint32 kernel_w = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_kernel_w(), target);
+  }
+
+  // optional uint32 stride_h = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_stride_h(), target);
+  }
+
+  // optional uint32 stride_w = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_stride_w(), target);
+  }
+
+  // optional uint32 pad_h = 9 [default = 0];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_pad_h(), target);
+  }
+
+  // optional uint32 pad_w = 10 [default = 0];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_pad_w(), target);
+  }
+
+  // optional .caffe.PoolingParameter.Engine engine = 11 [default = DEFAULT];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      11, this->_internal_engine(), target);
+  }
+
+  // optional bool global_pooling = 12 [default = false];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_global_pooling(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.PoolingParameter)
+  return target;
+}
+
+size_t PoolingParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.PoolingParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .caffe.PoolingParameter.PoolMethod pool = 1 [default = MAX];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_pool());
+    }
+
+    // optional uint32 kernel_size = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_kernel_size());
+    }
+
+    // optional uint32 pad = 4 [default = 0];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pad());
+    }
+
+    // optional uint32 kernel_h = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_kernel_h());
+    }
+
+    // optional uint32 kernel_w = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_kernel_w());
+    }
+
+    // optional uint32 stride_h = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stride_h());
+    }
+
+    // optional uint32 stride_w = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stride_w());
+    }
+
+    // optional uint32 pad_h = 9 [default = 0];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pad_h());
+    }
+
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    // optional uint32 pad_w = 10 [default = 0];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pad_w());
+    }
+
+    // optional .caffe.PoolingParameter.Engine engine = 11 [default = DEFAULT];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+    }
+
+    // optional bool global_pooling = 12 [default = false];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 stride = 3 [default = 1];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stride());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PoolingParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PoolingParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PoolingParameter::GetClassData() const { return &_class_data_; }
+
+
+void PoolingParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PoolingParameter*>(&to_msg);
+  auto& from = static_cast<const PoolingParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.PoolingParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.pool_ = from._impl_.pool_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.kernel_size_ = from._impl_.kernel_size_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.pad_ = from._impl_.pad_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.kernel_h_ = from._impl_.kernel_h_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.kernel_w_ = from._impl_.kernel_w_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.stride_h_ = from._impl_.stride_h_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.stride_w_ = from._impl_.stride_w_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.pad_h_ = from._impl_.pad_h_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.pad_w_ = from._impl_.pad_w_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.engine_ = from._impl_.engine_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.global_pooling_ = from._impl_.global_pooling_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.stride_ = from._impl_.stride_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PoolingParameter::CopyFrom(const PoolingParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.PoolingParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PoolingParameter::IsInitialized() const {
+  return true;
+}
+
+void PoolingParameter::InternalSwap(PoolingParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PoolingParameter, _impl_.global_pooling_)
+      + sizeof(PoolingParameter::_impl_.global_pooling_)
+      - PROTOBUF_FIELD_OFFSET(PoolingParameter, _impl_.pool_)>(
+          reinterpret_cast<char*>(&_impl_.pool_),
+          reinterpret_cast<char*>(&other->_impl_.pool_));
+  swap(_impl_.stride_, other->_impl_.stride_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PoolingParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[30]);
+}
+
+// ===================================================================
+
+class PowerParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PowerParameter>()._impl_._has_bits_);
+  static void set_has_power(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_scale(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_shift(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+PowerParameter::PowerParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.PowerParameter)
+}
+PowerParameter::PowerParameter(const PowerParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PowerParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shift_){}
+    , decltype(_impl_.power_){}
+    , decltype(_impl_.scale_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.shift_, &from._impl_.shift_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.scale_) -
+    reinterpret_cast<char*>(&_impl_.shift_)) + sizeof(_impl_.scale_));
+  // @@protoc_insertion_point(copy_constructor:caffe.PowerParameter)
+}
+
+inline void PowerParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shift_){0}
+    , decltype(_impl_.power_){1}
+    , decltype(_impl_.scale_){1}
+  };
+}
+
+PowerParameter::~PowerParameter() {
+  // @@protoc_insertion_point(destructor:caffe.PowerParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PowerParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PowerParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PowerParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.PowerParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    _impl_.shift_ = 0;
+    _impl_.power_ = 1;
+    _impl_.scale_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PowerParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float power = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_power(&has_bits);
+          _impl_.power_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float scale = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_scale(&has_bits);
+          _impl_.scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float shift = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_shift(&has_bits);
+          _impl_.shift_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PowerParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.PowerParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float power = 1 [default = 1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_power(), target);
+  }
+
+  // optional float scale = 2 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_scale(), target);
+  }
+
+  // optional float shift = 3 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_shift(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.PowerParameter)
+  return target;
+}
+
+size_t PowerParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.PowerParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional float shift = 3 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float power = 1 [default = 1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float scale = 2 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PowerParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PowerParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PowerParameter::GetClassData() const { return &_class_data_; }
+
+
+void PowerParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PowerParameter*>(&to_msg);
+  auto& from = static_cast<const PowerParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.PowerParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.shift_ = from._impl_.shift_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.power_ = from._impl_.power_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.scale_ = from._impl_.scale_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PowerParameter::CopyFrom(const PowerParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.PowerParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PowerParameter::IsInitialized() const {
+  return true;
+}
+
+void PowerParameter::InternalSwap(PowerParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.shift_, other->_impl_.shift_);
+  swap(_impl_.power_, other->_impl_.power_);
+  swap(_impl_.scale_, other->_impl_.scale_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PowerParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[31]);
+}
+
+// ===================================================================
+
+class PReLUParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PReLUParameter>()._impl_._has_bits_);
+  static const ::caffe::FillerParameter& filler(const PReLUParameter* msg);
+  static void set_has_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_channel_shared(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::caffe::FillerParameter&
+PReLUParameter::_Internal::filler(const PReLUParameter* msg) {
+  return *msg->_impl_.filler_;
+}
+PReLUParameter::PReLUParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.PReLUParameter)
+}
+PReLUParameter::PReLUParameter(const PReLUParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PReLUParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.filler_){nullptr}
+    , decltype(_impl_.channel_shared_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_filler()) {
+    _this->_impl_.filler_ = new ::caffe::FillerParameter(*from._impl_.filler_);
+  }
+  _this->_impl_.channel_shared_ = from._impl_.channel_shared_;
+  // @@protoc_insertion_point(copy_constructor:caffe.PReLUParameter)
+}
+
+inline void PReLUParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.filler_){nullptr}
+    , decltype(_impl_.channel_shared_){false}
+  };
+}
+
+PReLUParameter::~PReLUParameter() {
+  // @@protoc_insertion_point(destructor:caffe.PReLUParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PReLUParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.filler_;
+}
+
+void PReLUParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PReLUParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.PReLUParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.filler_ != nullptr);
+    _impl_.filler_->Clear();
+  }
+  _impl_.channel_shared_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PReLUParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.FillerParameter filler = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool channel_shared = 2 [default = false];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_channel_shared(&has_bits);
+          _impl_.channel_shared_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PReLUParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.PReLUParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.FillerParameter filler = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::filler(this),
+        _Internal::filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bool channel_shared = 2 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_channel_shared(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.PReLUParameter)
+  return target;
+}
+
+size_t PReLUParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.PReLUParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .caffe.FillerParameter filler = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.filler_);
+    }
+
+    // optional bool channel_shared = 2 [default = false];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PReLUParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PReLUParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PReLUParameter::GetClassData() const { return &_class_data_; }
+
+
+void PReLUParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PReLUParameter*>(&to_msg);
+  auto& from = static_cast<const PReLUParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.PReLUParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_filler());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.channel_shared_ = from._impl_.channel_shared_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PReLUParameter::CopyFrom(const PReLUParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.PReLUParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PReLUParameter::IsInitialized() const {
+  return true;
+}
+
+void PReLUParameter::InternalSwap(PReLUParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PReLUParameter, _impl_.channel_shared_)
+      + sizeof(PReLUParameter::_impl_.channel_shared_)
+      - PROTOBUF_FIELD_OFFSET(PReLUParameter, _impl_.filler_)>(
+          reinterpret_cast<char*>(&_impl_.filler_),
+          reinterpret_cast<char*>(&other->_impl_.filler_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PReLUParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[32]);
+}
+
+// ===================================================================
+
+class ProposalParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProposalParameter>()._impl_._has_bits_);
+  static void set_has_feat_stride(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_base_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_min_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_pre_nms_topn(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_post_nms_topn(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_nms_thresh(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+ProposalParameter::ProposalParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ProposalParameter)
+}
+ProposalParameter::ProposalParameter(const ProposalParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProposalParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ratio_){from._impl_.ratio_}
+    , decltype(_impl_.scale_){from._impl_.scale_}
+    , decltype(_impl_.feat_stride_){}
+    , decltype(_impl_.base_size_){}
+    , decltype(_impl_.min_size_){}
+    , decltype(_impl_.pre_nms_topn_){}
+    , decltype(_impl_.post_nms_topn_){}
+    , decltype(_impl_.nms_thresh_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.feat_stride_, &from._impl_.feat_stride_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.nms_thresh_) -
+    reinterpret_cast<char*>(&_impl_.feat_stride_)) + sizeof(_impl_.nms_thresh_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ProposalParameter)
+}
+
+inline void ProposalParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ratio_){arena}
+    , decltype(_impl_.scale_){arena}
+    , decltype(_impl_.feat_stride_){16u}
+    , decltype(_impl_.base_size_){16u}
+    , decltype(_impl_.min_size_){16u}
+    , decltype(_impl_.pre_nms_topn_){6000u}
+    , decltype(_impl_.post_nms_topn_){300u}
+    , decltype(_impl_.nms_thresh_){0.7f}
+  };
+}
+
+ProposalParameter::~ProposalParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ProposalParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProposalParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ratio_.~RepeatedField();
+  _impl_.scale_.~RepeatedField();
+}
+
+void ProposalParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProposalParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ProposalParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ratio_.Clear();
+  _impl_.scale_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    _impl_.feat_stride_ = 16u;
+    _impl_.base_size_ = 16u;
+    _impl_.min_size_ = 16u;
+    _impl_.pre_nms_topn_ = 6000u;
+    _impl_.post_nms_topn_ = 300u;
+    _impl_.nms_thresh_ = 0.7f;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProposalParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 feat_stride = 1 [default = 16];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_feat_stride(&has_bits);
+          _impl_.feat_stride_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 base_size = 2 [default = 16];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_base_size(&has_bits);
+          _impl_.base_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 min_size = 3 [default = 16];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_min_size(&has_bits);
+          _impl_.min_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float ratio = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_ratio(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<37>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_ratio(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float scale = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_scale(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<45>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 42) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_scale(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 pre_nms_topn = 6 [default = 6000];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_pre_nms_topn(&has_bits);
+          _impl_.pre_nms_topn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 post_nms_topn = 7 [default = 300];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_post_nms_topn(&has_bits);
+          _impl_.post_nms_topn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float nms_thresh = 8 [default = 0.7];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_nms_thresh(&has_bits);
+          _impl_.nms_thresh_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProposalParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ProposalParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 feat_stride = 1 [default = 16];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_feat_stride(), target);
+  }
+
+  // optional uint32 base_size = 2 [default = 16];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_base_size(), target);
+  }
+
+  // optional uint32 min_size = 3 [default = 16];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_min_size(), target);
+  }
+
+  // repeated float ratio = 4;
+  for (int i = 0, n = this->_internal_ratio_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_ratio(i), target);
+  }
+
+  // repeated float scale = 5;
+  for (int i = 0, n = this->_internal_scale_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_scale(i), target);
+  }
+
+  // optional uint32 pre_nms_topn = 6 [default = 6000];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_pre_nms_topn(), target);
+  }
+
+  // optional uint32 post_nms_topn = 7 [default = 300];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_post_nms_topn(), target);
+  }
+
+  // optional float nms_thresh = 8 [default = 0.7];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_nms_thresh(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ProposalParameter)
+  return target;
+}
+
+size_t ProposalParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ProposalParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float ratio = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_ratio_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_ratio_size());
+    total_size += data_size;
+  }
+
+  // repeated float scale = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_scale_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_scale_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional uint32 feat_stride = 1 [default = 16];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_feat_stride());
+    }
+
+    // optional uint32 base_size = 2 [default = 16];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_base_size());
+    }
+
+    // optional uint32 min_size = 3 [default = 16];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_min_size());
+    }
+
+    // optional uint32 pre_nms_topn = 6 [default = 6000];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pre_nms_topn());
+    }
+
+    // optional uint32 post_nms_topn = 7 [default = 300];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_post_nms_topn());
+    }
+
+    // optional float nms_thresh = 8 [default = 0.7];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProposalParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProposalParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProposalParameter::GetClassData() const { return &_class_data_; }
+
+
+void ProposalParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProposalParameter*>(&to_msg);
+  auto& from = static_cast<const ProposalParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ProposalParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ratio_.MergeFrom(from._impl_.ratio_);
+  _this->_impl_.scale_.MergeFrom(from._impl_.scale_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.feat_stride_ = from._impl_.feat_stride_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.base_size_ = from._impl_.base_size_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.min_size_ = from._impl_.min_size_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.pre_nms_topn_ = from._impl_.pre_nms_topn_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.post_nms_topn_ = from._impl_.post_nms_topn_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.nms_thresh_ = from._impl_.nms_thresh_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProposalParameter::CopyFrom(const ProposalParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ProposalParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProposalParameter::IsInitialized() const {
+  return true;
+}
+
+void ProposalParameter::InternalSwap(ProposalParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.ratio_.InternalSwap(&other->_impl_.ratio_);
+  _impl_.scale_.InternalSwap(&other->_impl_.scale_);
+  swap(_impl_.feat_stride_, other->_impl_.feat_stride_);
+  swap(_impl_.base_size_, other->_impl_.base_size_);
+  swap(_impl_.min_size_, other->_impl_.min_size_);
+  swap(_impl_.pre_nms_topn_, other->_impl_.pre_nms_topn_);
+  swap(_impl_.post_nms_topn_, other->_impl_.post_nms_topn_);
+  swap(_impl_.nms_thresh_, other->_impl_.nms_thresh_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProposalParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[33]);
+}
+
+// ===================================================================
+
+class PSROIPoolingParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PSROIPoolingParameter>()._impl_._has_bits_);
+  static void set_has_spatial_scale(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_output_dim(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_group_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+PSROIPoolingParameter::PSROIPoolingParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.PSROIPoolingParameter)
+}
+PSROIPoolingParameter::PSROIPoolingParameter(const PSROIPoolingParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PSROIPoolingParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.spatial_scale_){}
+    , decltype(_impl_.output_dim_){}
+    , decltype(_impl_.group_size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.spatial_scale_, &from._impl_.spatial_scale_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.group_size_) -
+    reinterpret_cast<char*>(&_impl_.spatial_scale_)) + sizeof(_impl_.group_size_));
+  // @@protoc_insertion_point(copy_constructor:caffe.PSROIPoolingParameter)
+}
+
+inline void PSROIPoolingParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.spatial_scale_){0}
+    , decltype(_impl_.output_dim_){0}
+    , decltype(_impl_.group_size_){0}
+  };
+}
+
+PSROIPoolingParameter::~PSROIPoolingParameter() {
+  // @@protoc_insertion_point(destructor:caffe.PSROIPoolingParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PSROIPoolingParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PSROIPoolingParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PSROIPoolingParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.PSROIPoolingParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.spatial_scale_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.group_size_) -
+        reinterpret_cast<char*>(&_impl_.spatial_scale_)) + sizeof(_impl_.group_size_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PSROIPoolingParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required float spatial_scale = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_spatial_scale(&has_bits);
+          _impl_.spatial_scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 output_dim = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_output_dim(&has_bits);
+          _impl_.output_dim_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 group_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_group_size(&has_bits);
+          _impl_.group_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PSROIPoolingParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.PSROIPoolingParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required float spatial_scale = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_spatial_scale(), target);
+  }
+
+  // required int32 output_dim = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_output_dim(), target);
+  }
+
+  // required int32 group_size = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_group_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.PSROIPoolingParameter)
+  return target;
+}
+
+size_t PSROIPoolingParameter::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:caffe.PSROIPoolingParameter)
+  size_t total_size = 0;
+
+  if (_internal_has_spatial_scale()) {
+    // required float spatial_scale = 1;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_output_dim()) {
+    // required int32 output_dim = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_output_dim());
+  }
+
+  if (_internal_has_group_size()) {
+    // required int32 group_size = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_group_size());
+  }
+
+  return total_size;
+}
+size_t PSROIPoolingParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.PSROIPoolingParameter)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required float spatial_scale = 1;
+    total_size += 1 + 4;
+
+    // required int32 output_dim = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_output_dim());
+
+    // required int32 group_size = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_group_size());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PSROIPoolingParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PSROIPoolingParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PSROIPoolingParameter::GetClassData() const { return &_class_data_; }
+
+
+void PSROIPoolingParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PSROIPoolingParameter*>(&to_msg);
+  auto& from = static_cast<const PSROIPoolingParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.PSROIPoolingParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.spatial_scale_ = from._impl_.spatial_scale_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.output_dim_ = from._impl_.output_dim_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.group_size_ = from._impl_.group_size_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PSROIPoolingParameter::CopyFrom(const PSROIPoolingParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.PSROIPoolingParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PSROIPoolingParameter::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PSROIPoolingParameter::InternalSwap(PSROIPoolingParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PSROIPoolingParameter, _impl_.group_size_)
+      + sizeof(PSROIPoolingParameter::_impl_.group_size_)
+      - PROTOBUF_FIELD_OFFSET(PSROIPoolingParameter, _impl_.spatial_scale_)>(
+          reinterpret_cast<char*>(&_impl_.spatial_scale_),
+          reinterpret_cast<char*>(&other->_impl_.spatial_scale_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PSROIPoolingParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[34]);
+}
+
+// ===================================================================
+
+class QuantizationParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<QuantizationParameter>()._impl_._has_bits_);
+  static void set_has_bottom_scale(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_bottom_zero_point(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+QuantizationParameter::QuantizationParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.QuantizationParameter)
+}
+QuantizationParameter::QuantizationParameter(const QuantizationParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QuantizationParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_scale_){}
+    , decltype(_impl_.bottom_zero_point_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.bottom_scale_, &from._impl_.bottom_scale_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bottom_zero_point_) -
+    reinterpret_cast<char*>(&_impl_.bottom_scale_)) + sizeof(_impl_.bottom_zero_point_));
+  // @@protoc_insertion_point(copy_constructor:caffe.QuantizationParameter)
+}
+
+inline void QuantizationParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_scale_){0}
+    , decltype(_impl_.bottom_zero_point_){128u}
+  };
+}
+
+QuantizationParameter::~QuantizationParameter() {
+  // @@protoc_insertion_point(destructor:caffe.QuantizationParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void QuantizationParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void QuantizationParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void QuantizationParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.QuantizationParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.bottom_scale_ = 0;
+    _impl_.bottom_zero_point_ = 128u;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* QuantizationParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float bottom_scale = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_bottom_scale(&has_bits);
+          _impl_.bottom_scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bottom_zero_point = 2 [default = 128];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_bottom_zero_point(&has_bits);
+          _impl_.bottom_zero_point_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QuantizationParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.QuantizationParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float bottom_scale = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_bottom_scale(), target);
+  }
+
+  // optional uint32 bottom_zero_point = 2 [default = 128];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_bottom_zero_point(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.QuantizationParameter)
+  return target;
+}
+
+size_t QuantizationParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.QuantizationParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional float bottom_scale = 1 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 bottom_zero_point = 2 [default = 128];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bottom_zero_point());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QuantizationParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QuantizationParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QuantizationParameter::GetClassData() const { return &_class_data_; }
+
+
+void QuantizationParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QuantizationParameter*>(&to_msg);
+  auto& from = static_cast<const QuantizationParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.QuantizationParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.bottom_scale_ = from._impl_.bottom_scale_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.bottom_zero_point_ = from._impl_.bottom_zero_point_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void QuantizationParameter::CopyFrom(const QuantizationParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.QuantizationParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool QuantizationParameter::IsInitialized() const {
+  return true;
+}
+
+void QuantizationParameter::InternalSwap(QuantizationParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.bottom_scale_, other->_impl_.bottom_scale_);
+  swap(_impl_.bottom_zero_point_, other->_impl_.bottom_zero_point_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata QuantizationParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[35]);
+}
+
+// ===================================================================
+
+class ReductionParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReductionParameter>()._impl_._has_bits_);
+  static void set_has_operation(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_coeff(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+ReductionParameter::ReductionParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ReductionParameter)
+}
+ReductionParameter::ReductionParameter(const ReductionParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReductionParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.axis_){}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.coeff_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.axis_, &from._impl_.axis_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.coeff_) -
+    reinterpret_cast<char*>(&_impl_.axis_)) + sizeof(_impl_.coeff_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ReductionParameter)
+}
+
+inline void ReductionParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.axis_){0}
+    , decltype(_impl_.operation_){1}
+    , decltype(_impl_.coeff_){1}
+  };
+}
+
+ReductionParameter::~ReductionParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ReductionParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReductionParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReductionParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReductionParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ReductionParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    _impl_.axis_ = 0;
+    _impl_.operation_ = 1;
+    _impl_.coeff_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReductionParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.ReductionParameter.ReductionOp operation = 1 [default = SUM];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::ReductionParameter_ReductionOp_IsValid(val))) {
+            _internal_set_operation(static_cast<::caffe::ReductionParameter_ReductionOp>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 axis = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float coeff = 3 [default = 1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_coeff(&has_bits);
+          _impl_.coeff_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReductionParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ReductionParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.ReductionParameter.ReductionOp operation = 1 [default = SUM];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  // optional int32 axis = 2 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_axis(), target);
+  }
+
+  // optional float coeff = 3 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_coeff(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ReductionParameter)
+  return target;
+}
+
+size_t ReductionParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ReductionParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 axis = 2 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+    // optional .caffe.ReductionParameter.ReductionOp operation = 1 [default = SUM];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+    }
+
+    // optional float coeff = 3 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReductionParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReductionParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReductionParameter::GetClassData() const { return &_class_data_; }
+
+
+void ReductionParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReductionParameter*>(&to_msg);
+  auto& from = static_cast<const ReductionParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ReductionParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.operation_ = from._impl_.operation_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.coeff_ = from._impl_.coeff_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReductionParameter::CopyFrom(const ReductionParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ReductionParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReductionParameter::IsInitialized() const {
+  return true;
+}
+
+void ReductionParameter::InternalSwap(ReductionParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.axis_, other->_impl_.axis_);
+  swap(_impl_.operation_, other->_impl_.operation_);
+  swap(_impl_.coeff_, other->_impl_.coeff_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReductionParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[36]);
+}
+
+// ===================================================================
+
+class ReLUParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReLUParameter>()._impl_._has_bits_);
+  static void set_has_negative_slope(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ReLUParameter::ReLUParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ReLUParameter)
+}
+ReLUParameter::ReLUParameter(const ReLUParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReLUParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.negative_slope_){}
+    , decltype(_impl_.engine_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.negative_slope_, &from._impl_.negative_slope_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.engine_) -
+    reinterpret_cast<char*>(&_impl_.negative_slope_)) + sizeof(_impl_.engine_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ReLUParameter)
+}
+
+inline void ReLUParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.negative_slope_){0}
+    , decltype(_impl_.engine_){0}
+  };
+}
+
+ReLUParameter::~ReLUParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ReLUParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReLUParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReLUParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReLUParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ReLUParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.negative_slope_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.engine_) -
+        reinterpret_cast<char*>(&_impl_.negative_slope_)) + sizeof(_impl_.engine_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReLUParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float negative_slope = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_negative_slope(&has_bits);
+          _impl_.negative_slope_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ReLUParameter.Engine engine = 2 [default = DEFAULT];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::ReLUParameter_Engine_IsValid(val))) {
+            _internal_set_engine(static_cast<::caffe::ReLUParameter_Engine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReLUParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ReLUParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float negative_slope = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_negative_slope(), target);
+  }
+
+  // optional .caffe.ReLUParameter.Engine engine = 2 [default = DEFAULT];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_engine(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ReLUParameter)
+  return target;
+}
+
+size_t ReLUParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ReLUParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional float negative_slope = 1 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional .caffe.ReLUParameter.Engine engine = 2 [default = DEFAULT];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReLUParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReLUParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReLUParameter::GetClassData() const { return &_class_data_; }
+
+
+void ReLUParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReLUParameter*>(&to_msg);
+  auto& from = static_cast<const ReLUParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ReLUParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.negative_slope_ = from._impl_.negative_slope_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.engine_ = from._impl_.engine_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReLUParameter::CopyFrom(const ReLUParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ReLUParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReLUParameter::IsInitialized() const {
+  return true;
+}
+
+void ReLUParameter::InternalSwap(ReLUParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReLUParameter, _impl_.engine_)
+      + sizeof(ReLUParameter::_impl_.engine_)
+      - PROTOBUF_FIELD_OFFSET(ReLUParameter, _impl_.negative_slope_)>(
+          reinterpret_cast<char*>(&_impl_.negative_slope_),
+          reinterpret_cast<char*>(&other->_impl_.negative_slope_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReLUParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[37]);
+}
+
+// ===================================================================
+
+class ReorderParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReorderParameter>()._impl_._has_bits_);
+  static void set_has_bottom_channel_block(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_top_channel_block(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ReorderParameter::ReorderParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ReorderParameter)
+}
+ReorderParameter::ReorderParameter(const ReorderParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReorderParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_channel_block_){}
+    , decltype(_impl_.top_channel_block_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.bottom_channel_block_, &from._impl_.bottom_channel_block_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.top_channel_block_) -
+    reinterpret_cast<char*>(&_impl_.bottom_channel_block_)) + sizeof(_impl_.top_channel_block_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ReorderParameter)
+}
+
+inline void ReorderParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_channel_block_){0u}
+    , decltype(_impl_.top_channel_block_){0u}
+  };
+}
+
+ReorderParameter::~ReorderParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ReorderParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReorderParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReorderParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReorderParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ReorderParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.bottom_channel_block_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.top_channel_block_) -
+        reinterpret_cast<char*>(&_impl_.bottom_channel_block_)) + sizeof(_impl_.top_channel_block_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReorderParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 bottom_channel_block = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_bottom_channel_block(&has_bits);
+          _impl_.bottom_channel_block_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 top_channel_block = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_top_channel_block(&has_bits);
+          _impl_.top_channel_block_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReorderParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ReorderParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 bottom_channel_block = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_bottom_channel_block(), target);
+  }
+
+  // optional uint32 top_channel_block = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_top_channel_block(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ReorderParameter)
+  return target;
+}
+
+size_t ReorderParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ReorderParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 bottom_channel_block = 1 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bottom_channel_block());
+    }
+
+    // optional uint32 top_channel_block = 2 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_top_channel_block());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReorderParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReorderParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReorderParameter::GetClassData() const { return &_class_data_; }
+
+
+void ReorderParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReorderParameter*>(&to_msg);
+  auto& from = static_cast<const ReorderParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ReorderParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.bottom_channel_block_ = from._impl_.bottom_channel_block_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.top_channel_block_ = from._impl_.top_channel_block_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReorderParameter::CopyFrom(const ReorderParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ReorderParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReorderParameter::IsInitialized() const {
+  return true;
+}
+
+void ReorderParameter::InternalSwap(ReorderParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReorderParameter, _impl_.top_channel_block_)
+      + sizeof(ReorderParameter::_impl_.top_channel_block_)
+      - PROTOBUF_FIELD_OFFSET(ReorderParameter, _impl_.bottom_channel_block_)>(
+          reinterpret_cast<char*>(&_impl_.bottom_channel_block_),
+          reinterpret_cast<char*>(&other->_impl_.bottom_channel_block_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReorderParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[38]);
+}
+
+// ===================================================================
+
+class ReshapeParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReshapeParameter>()._impl_._has_bits_);
+  static const ::caffe::BlobShape& shape(const ReshapeParameter* msg);
+  static void set_has_shape(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_axes(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::caffe::BlobShape&
+ReshapeParameter::_Internal::shape(const ReshapeParameter* msg) {
+  return *msg->_impl_.shape_;
+}
+ReshapeParameter::ReshapeParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ReshapeParameter)
+}
+ReshapeParameter::ReshapeParameter(const ReshapeParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReshapeParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.axis_){}
+    , decltype(_impl_.num_axes_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_shape()) {
+    _this->_impl_.shape_ = new ::caffe::BlobShape(*from._impl_.shape_);
+  }
+  ::memcpy(&_impl_.axis_, &from._impl_.axis_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_axes_) -
+    reinterpret_cast<char*>(&_impl_.axis_)) + sizeof(_impl_.num_axes_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ReshapeParameter)
+}
+
+inline void ReshapeParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.axis_){0}
+    , decltype(_impl_.num_axes_){-1}
+  };
+}
+
+ReshapeParameter::~ReshapeParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ReshapeParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReshapeParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.shape_;
+}
+
+void ReshapeParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReshapeParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ReshapeParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.shape_ != nullptr);
+    _impl_.shape_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    _impl_.axis_ = 0;
+    _impl_.num_axes_ = -1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReshapeParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.BlobShape shape = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shape(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 axis = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_axes = 3 [default = -1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_num_axes(&has_bits);
+          _impl_.num_axes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReshapeParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ReshapeParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.BlobShape shape = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::shape(this),
+        _Internal::shape(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int32 axis = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_axis(), target);
+  }
+
+  // optional int32 num_axes = 3 [default = -1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_num_axes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ReshapeParameter)
+  return target;
+}
+
+size_t ReshapeParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ReshapeParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .caffe.BlobShape shape = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.shape_);
+    }
+
+    // optional int32 axis = 2 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+    // optional int32 num_axes = 3 [default = -1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_axes());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReshapeParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReshapeParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReshapeParameter::GetClassData() const { return &_class_data_; }
+
+
+void ReshapeParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReshapeParameter*>(&to_msg);
+  auto& from = static_cast<const ReshapeParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ReshapeParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_shape()->::caffe::BlobShape::MergeFrom(
+          from._internal_shape());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_axes_ = from._impl_.num_axes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReshapeParameter::CopyFrom(const ReshapeParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ReshapeParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReshapeParameter::IsInitialized() const {
+  return true;
+}
+
+void ReshapeParameter::InternalSwap(ReshapeParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReshapeParameter, _impl_.axis_)
+      + sizeof(ReshapeParameter::_impl_.axis_)
+      - PROTOBUF_FIELD_OFFSET(ReshapeParameter, _impl_.shape_)>(
+          reinterpret_cast<char*>(&_impl_.shape_),
+          reinterpret_cast<char*>(&other->_impl_.shape_));
+  swap(_impl_.num_axes_, other->_impl_.num_axes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReshapeParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[39]);
+}
+
+// ===================================================================
+
+class ROIPoolingParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ROIPoolingParameter>()._impl_._has_bits_);
+  static void set_has_pooled_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_pooled_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_spatial_scale(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+ROIPoolingParameter::ROIPoolingParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ROIPoolingParameter)
+}
+ROIPoolingParameter::ROIPoolingParameter(const ROIPoolingParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ROIPoolingParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pooled_h_){}
+    , decltype(_impl_.pooled_w_){}
+    , decltype(_impl_.spatial_scale_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.pooled_h_, &from._impl_.pooled_h_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.spatial_scale_) -
+    reinterpret_cast<char*>(&_impl_.pooled_h_)) + sizeof(_impl_.spatial_scale_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ROIPoolingParameter)
+}
+
+inline void ROIPoolingParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pooled_h_){0u}
+    , decltype(_impl_.pooled_w_){0u}
+    , decltype(_impl_.spatial_scale_){1}
+  };
+}
+
+ROIPoolingParameter::~ROIPoolingParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ROIPoolingParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ROIPoolingParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ROIPoolingParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ROIPoolingParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ROIPoolingParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.pooled_h_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.pooled_w_) -
+        reinterpret_cast<char*>(&_impl_.pooled_h_)) + sizeof(_impl_.pooled_w_));
+    _impl_.spatial_scale_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ROIPoolingParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 pooled_h = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_pooled_h(&has_bits);
+          _impl_.pooled_h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 pooled_w = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_pooled_w(&has_bits);
+          _impl_.pooled_w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float spatial_scale = 3 [default = 1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_spatial_scale(&has_bits);
+          _impl_.spatial_scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ROIPoolingParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ROIPoolingParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 pooled_h = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_pooled_h(), target);
+  }
+
+  // optional uint32 pooled_w = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_pooled_w(), target);
+  }
+
+  // optional float spatial_scale = 3 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_spatial_scale(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ROIPoolingParameter)
+  return target;
+}
+
+size_t ROIPoolingParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ROIPoolingParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional uint32 pooled_h = 1 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pooled_h());
+    }
+
+    // optional uint32 pooled_w = 2 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pooled_w());
+    }
+
+    // optional float spatial_scale = 3 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ROIPoolingParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ROIPoolingParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ROIPoolingParameter::GetClassData() const { return &_class_data_; }
+
+
+void ROIPoolingParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ROIPoolingParameter*>(&to_msg);
+  auto& from = static_cast<const ROIPoolingParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ROIPoolingParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.pooled_h_ = from._impl_.pooled_h_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.pooled_w_ = from._impl_.pooled_w_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.spatial_scale_ = from._impl_.spatial_scale_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ROIPoolingParameter::CopyFrom(const ROIPoolingParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ROIPoolingParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ROIPoolingParameter::IsInitialized() const {
+  return true;
+}
+
+void ROIPoolingParameter::InternalSwap(ROIPoolingParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ROIPoolingParameter, _impl_.pooled_w_)
+      + sizeof(ROIPoolingParameter::_impl_.pooled_w_)
+      - PROTOBUF_FIELD_OFFSET(ROIPoolingParameter, _impl_.pooled_h_)>(
+          reinterpret_cast<char*>(&_impl_.pooled_h_),
+          reinterpret_cast<char*>(&other->_impl_.pooled_h_));
+  swap(_impl_.spatial_scale_, other->_impl_.spatial_scale_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ROIPoolingParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[40]);
+}
+
+// ===================================================================
+
+class ScaleParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ScaleParameter>()._impl_._has_bits_);
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_num_axes(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::caffe::FillerParameter& filler(const ScaleParameter* msg);
+  static void set_has_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_bias_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::caffe::FillerParameter& bias_filler(const ScaleParameter* msg);
+  static void set_has_bias_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::caffe::FillerParameter&
+ScaleParameter::_Internal::filler(const ScaleParameter* msg) {
+  return *msg->_impl_.filler_;
+}
+const ::caffe::FillerParameter&
+ScaleParameter::_Internal::bias_filler(const ScaleParameter* msg) {
+  return *msg->_impl_.bias_filler_;
+}
+ScaleParameter::ScaleParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ScaleParameter)
+}
+ScaleParameter::ScaleParameter(const ScaleParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScaleParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.bias_term_){}
+    , decltype(_impl_.axis_){}
+    , decltype(_impl_.num_axes_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_filler()) {
+    _this->_impl_.filler_ = new ::caffe::FillerParameter(*from._impl_.filler_);
+  }
+  if (from._internal_has_bias_filler()) {
+    _this->_impl_.bias_filler_ = new ::caffe::FillerParameter(*from._impl_.bias_filler_);
+  }
+  ::memcpy(&_impl_.bias_term_, &from._impl_.bias_term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_axes_) -
+    reinterpret_cast<char*>(&_impl_.bias_term_)) + sizeof(_impl_.num_axes_));
+  // @@protoc_insertion_point(copy_constructor:caffe.ScaleParameter)
+}
+
+inline void ScaleParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.filler_){nullptr}
+    , decltype(_impl_.bias_filler_){nullptr}
+    , decltype(_impl_.bias_term_){false}
+    , decltype(_impl_.axis_){1}
+    , decltype(_impl_.num_axes_){1}
+  };
+}
+
+ScaleParameter::~ScaleParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ScaleParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScaleParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.filler_;
+  if (this != internal_default_instance()) delete _impl_.bias_filler_;
+}
+
+void ScaleParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScaleParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ScaleParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.filler_ != nullptr);
+      _impl_.filler_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.bias_filler_ != nullptr);
+      _impl_.bias_filler_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000001cu) {
+    _impl_.bias_term_ = false;
+    _impl_.axis_ = 1;
+    _impl_.num_axes_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScaleParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 axis = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_axes = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_axes(&has_bits);
+          _impl_.num_axes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter filler = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool bias_term = 4 [default = false];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_bias_term(&has_bits);
+          _impl_.bias_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter bias_filler = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bias_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScaleParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ScaleParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 axis = 1 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_axis(), target);
+  }
+
+  // optional int32 num_axes = 2 [default = 1];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_num_axes(), target);
+  }
+
+  // optional .caffe.FillerParameter filler = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::filler(this),
+        _Internal::filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bool bias_term = 4 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_bias_term(), target);
+  }
+
+  // optional .caffe.FillerParameter bias_filler = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::bias_filler(this),
+        _Internal::bias_filler(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ScaleParameter)
+  return target;
+}
+
+size_t ScaleParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ScaleParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .caffe.FillerParameter filler = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.filler_);
+    }
+
+    // optional .caffe.FillerParameter bias_filler = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.bias_filler_);
+    }
+
+    // optional bool bias_term = 4 [default = false];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 axis = 1 [default = 1];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+    // optional int32 num_axes = 2 [default = 1];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_axes());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScaleParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScaleParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScaleParameter::GetClassData() const { return &_class_data_; }
+
+
+void ScaleParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScaleParameter*>(&to_msg);
+  auto& from = static_cast<const ScaleParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ScaleParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_filler());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_bias_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_bias_filler());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.bias_term_ = from._impl_.bias_term_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.num_axes_ = from._impl_.num_axes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScaleParameter::CopyFrom(const ScaleParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ScaleParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScaleParameter::IsInitialized() const {
+  return true;
+}
+
+void ScaleParameter::InternalSwap(ScaleParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScaleParameter, _impl_.bias_term_)
+      + sizeof(ScaleParameter::_impl_.bias_term_)
+      - PROTOBUF_FIELD_OFFSET(ScaleParameter, _impl_.filler_)>(
+          reinterpret_cast<char*>(&_impl_.filler_),
+          reinterpret_cast<char*>(&other->_impl_.filler_));
+  swap(_impl_.axis_, other->_impl_.axis_);
+  swap(_impl_.num_axes_, other->_impl_.num_axes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScaleParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[41]);
+}
+
+// ===================================================================
+
+class SigmoidParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SigmoidParameter>()._impl_._has_bits_);
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+SigmoidParameter::SigmoidParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.SigmoidParameter)
+}
+SigmoidParameter::SigmoidParameter(const SigmoidParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SigmoidParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.engine_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.engine_ = from._impl_.engine_;
+  // @@protoc_insertion_point(copy_constructor:caffe.SigmoidParameter)
+}
+
+inline void SigmoidParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.engine_){0}
+  };
+}
+
+SigmoidParameter::~SigmoidParameter() {
+  // @@protoc_insertion_point(destructor:caffe.SigmoidParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SigmoidParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SigmoidParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SigmoidParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.SigmoidParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.engine_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SigmoidParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.SigmoidParameter.Engine engine = 1 [default = DEFAULT];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::SigmoidParameter_Engine_IsValid(val))) {
+            _internal_set_engine(static_cast<::caffe::SigmoidParameter_Engine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SigmoidParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.SigmoidParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.SigmoidParameter.Engine engine = 1 [default = DEFAULT];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_engine(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.SigmoidParameter)
+  return target;
+}
+
+size_t SigmoidParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.SigmoidParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .caffe.SigmoidParameter.Engine engine = 1 [default = DEFAULT];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SigmoidParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SigmoidParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SigmoidParameter::GetClassData() const { return &_class_data_; }
+
+
+void SigmoidParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SigmoidParameter*>(&to_msg);
+  auto& from = static_cast<const SigmoidParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.SigmoidParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_engine()) {
+    _this->_internal_set_engine(from._internal_engine());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SigmoidParameter::CopyFrom(const SigmoidParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.SigmoidParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SigmoidParameter::IsInitialized() const {
+  return true;
+}
+
+void SigmoidParameter::InternalSwap(SigmoidParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.engine_, other->_impl_.engine_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SigmoidParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[42]);
+}
+
+// ===================================================================
+
+class SliceParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SliceParameter>()._impl_._has_bits_);
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_slice_dim(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+SliceParameter::SliceParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.SliceParameter)
+}
+SliceParameter::SliceParameter(const SliceParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SliceParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slice_point_){from._impl_.slice_point_}
+    , decltype(_impl_.slice_dim_){}
+    , decltype(_impl_.axis_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.slice_dim_, &from._impl_.slice_dim_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.axis_) -
+    reinterpret_cast<char*>(&_impl_.slice_dim_)) + sizeof(_impl_.axis_));
+  // @@protoc_insertion_point(copy_constructor:caffe.SliceParameter)
+}
+
+inline void SliceParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slice_point_){arena}
+    , decltype(_impl_.slice_dim_){1u}
+    , decltype(_impl_.axis_){1}
+  };
+}
+
+SliceParameter::~SliceParameter() {
+  // @@protoc_insertion_point(destructor:caffe.SliceParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SliceParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.slice_point_.~RepeatedField();
+}
+
+void SliceParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SliceParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.SliceParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slice_point_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.slice_dim_ = 1u;
+    _impl_.axis_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SliceParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 slice_dim = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_slice_dim(&has_bits);
+          _impl_.slice_dim_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 slice_point = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_slice_point(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_slice_point(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 axis = 3 [default = 1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SliceParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.SliceParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 slice_dim = 1 [default = 1];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_slice_dim(), target);
+  }
+
+  // repeated uint32 slice_point = 2;
+  for (int i = 0, n = this->_internal_slice_point_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_slice_point(i), target);
+  }
+
+  // optional int32 axis = 3 [default = 1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_axis(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.SliceParameter)
+  return target;
+}
+
+size_t SliceParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.SliceParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 slice_point = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.slice_point_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_slice_point_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 slice_dim = 1 [default = 1];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_slice_dim());
+    }
+
+    // optional int32 axis = 3 [default = 1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SliceParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SliceParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SliceParameter::GetClassData() const { return &_class_data_; }
+
+
+void SliceParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SliceParameter*>(&to_msg);
+  auto& from = static_cast<const SliceParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.SliceParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.slice_point_.MergeFrom(from._impl_.slice_point_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.slice_dim_ = from._impl_.slice_dim_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SliceParameter::CopyFrom(const SliceParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.SliceParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SliceParameter::IsInitialized() const {
+  return true;
+}
+
+void SliceParameter::InternalSwap(SliceParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.slice_point_.InternalSwap(&other->_impl_.slice_point_);
+  swap(_impl_.slice_dim_, other->_impl_.slice_dim_);
+  swap(_impl_.axis_, other->_impl_.axis_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SliceParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[43]);
+}
+
+// ===================================================================
+
+class SoftmaxParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SoftmaxParameter>()._impl_._has_bits_);
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+SoftmaxParameter::SoftmaxParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.SoftmaxParameter)
+}
+SoftmaxParameter::SoftmaxParameter(const SoftmaxParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SoftmaxParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.engine_){}
+    , decltype(_impl_.axis_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.engine_, &from._impl_.engine_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.axis_) -
+    reinterpret_cast<char*>(&_impl_.engine_)) + sizeof(_impl_.axis_));
+  // @@protoc_insertion_point(copy_constructor:caffe.SoftmaxParameter)
+}
+
+inline void SoftmaxParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.engine_){0}
+    , decltype(_impl_.axis_){1}
+  };
+}
+
+SoftmaxParameter::~SoftmaxParameter() {
+  // @@protoc_insertion_point(destructor:caffe.SoftmaxParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SoftmaxParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SoftmaxParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SoftmaxParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.SoftmaxParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.engine_ = 0;
+    _impl_.axis_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SoftmaxParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.SoftmaxParameter.Engine engine = 1 [default = DEFAULT];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::SoftmaxParameter_Engine_IsValid(val))) {
+            _internal_set_engine(static_cast<::caffe::SoftmaxParameter_Engine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 axis = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SoftmaxParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.SoftmaxParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.SoftmaxParameter.Engine engine = 1 [default = DEFAULT];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_engine(), target);
+  }
+
+  // optional int32 axis = 2 [default = 1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_axis(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.SoftmaxParameter)
+  return target;
+}
+
+size_t SoftmaxParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.SoftmaxParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .caffe.SoftmaxParameter.Engine engine = 1 [default = DEFAULT];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+    }
+
+    // optional int32 axis = 2 [default = 1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SoftmaxParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SoftmaxParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SoftmaxParameter::GetClassData() const { return &_class_data_; }
+
+
+void SoftmaxParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SoftmaxParameter*>(&to_msg);
+  auto& from = static_cast<const SoftmaxParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.SoftmaxParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.engine_ = from._impl_.engine_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SoftmaxParameter::CopyFrom(const SoftmaxParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.SoftmaxParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SoftmaxParameter::IsInitialized() const {
+  return true;
+}
+
+void SoftmaxParameter::InternalSwap(SoftmaxParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.engine_, other->_impl_.engine_);
+  swap(_impl_.axis_, other->_impl_.axis_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SoftmaxParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[44]);
+}
+
+// ===================================================================
+
+class TanHParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TanHParameter>()._impl_._has_bits_);
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TanHParameter::TanHParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.TanHParameter)
+}
+TanHParameter::TanHParameter(const TanHParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TanHParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.engine_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.engine_ = from._impl_.engine_;
+  // @@protoc_insertion_point(copy_constructor:caffe.TanHParameter)
+}
+
+inline void TanHParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.engine_){0}
+  };
+}
+
+TanHParameter::~TanHParameter() {
+  // @@protoc_insertion_point(destructor:caffe.TanHParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TanHParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TanHParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TanHParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.TanHParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.engine_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TanHParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .caffe.TanHParameter.Engine engine = 1 [default = DEFAULT];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::TanHParameter_Engine_IsValid(val))) {
+            _internal_set_engine(static_cast<::caffe::TanHParameter_Engine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TanHParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.TanHParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .caffe.TanHParameter.Engine engine = 1 [default = DEFAULT];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_engine(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.TanHParameter)
+  return target;
+}
+
+size_t TanHParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.TanHParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .caffe.TanHParameter.Engine engine = 1 [default = DEFAULT];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TanHParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TanHParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TanHParameter::GetClassData() const { return &_class_data_; }
+
+
+void TanHParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TanHParameter*>(&to_msg);
+  auto& from = static_cast<const TanHParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.TanHParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_engine()) {
+    _this->_internal_set_engine(from._internal_engine());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TanHParameter::CopyFrom(const TanHParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.TanHParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TanHParameter::IsInitialized() const {
+  return true;
+}
+
+void TanHParameter::InternalSwap(TanHParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.engine_, other->_impl_.engine_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TanHParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[45]);
+}
+
+// ===================================================================
+
+class TileParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TileParameter>()._impl_._has_bits_);
+  static void set_has_axis(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_tiles(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TileParameter::TileParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.TileParameter)
+}
+TileParameter::TileParameter(const TileParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TileParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tiles_){}
+    , decltype(_impl_.axis_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.tiles_, &from._impl_.tiles_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.axis_) -
+    reinterpret_cast<char*>(&_impl_.tiles_)) + sizeof(_impl_.axis_));
+  // @@protoc_insertion_point(copy_constructor:caffe.TileParameter)
+}
+
+inline void TileParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tiles_){0}
+    , decltype(_impl_.axis_){1}
+  };
+}
+
+TileParameter::~TileParameter() {
+  // @@protoc_insertion_point(destructor:caffe.TileParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TileParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TileParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TileParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.TileParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.tiles_ = 0;
+    _impl_.axis_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TileParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 axis = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_axis(&has_bits);
+          _impl_.axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 tiles = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_tiles(&has_bits);
+          _impl_.tiles_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TileParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.TileParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 axis = 1 [default = 1];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_axis(), target);
+  }
+
+  // optional int32 tiles = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_tiles(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.TileParameter)
+  return target;
+}
+
+size_t TileParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.TileParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 tiles = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tiles());
+    }
+
+    // optional int32 axis = 1 [default = 1];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_axis());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TileParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TileParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TileParameter::GetClassData() const { return &_class_data_; }
+
+
+void TileParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TileParameter*>(&to_msg);
+  auto& from = static_cast<const TileParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.TileParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.tiles_ = from._impl_.tiles_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.axis_ = from._impl_.axis_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TileParameter::CopyFrom(const TileParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.TileParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TileParameter::IsInitialized() const {
+  return true;
+}
+
+void TileParameter::InternalSwap(TileParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.tiles_, other->_impl_.tiles_);
+  swap(_impl_.axis_, other->_impl_.axis_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TileParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[46]);
+}
+
+// ===================================================================
+
+class ThresholdParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ThresholdParameter>()._impl_._has_bits_);
+  static void set_has_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ThresholdParameter::ThresholdParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ThresholdParameter)
+}
+ThresholdParameter::ThresholdParameter(const ThresholdParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ThresholdParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.threshold_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.threshold_ = from._impl_.threshold_;
+  // @@protoc_insertion_point(copy_constructor:caffe.ThresholdParameter)
+}
+
+inline void ThresholdParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.threshold_){0}
+  };
+}
+
+ThresholdParameter::~ThresholdParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ThresholdParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ThresholdParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ThresholdParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ThresholdParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ThresholdParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.threshold_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ThresholdParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float threshold = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_threshold(&has_bits);
+          _impl_.threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ThresholdParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ThresholdParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float threshold = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_threshold(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ThresholdParameter)
+  return target;
+}
+
+size_t ThresholdParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ThresholdParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional float threshold = 1 [default = 0];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ThresholdParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ThresholdParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ThresholdParameter::GetClassData() const { return &_class_data_; }
+
+
+void ThresholdParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ThresholdParameter*>(&to_msg);
+  auto& from = static_cast<const ThresholdParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ThresholdParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_threshold()) {
+    _this->_internal_set_threshold(from._internal_threshold());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ThresholdParameter::CopyFrom(const ThresholdParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ThresholdParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ThresholdParameter::IsInitialized() const {
+  return true;
+}
+
+void ThresholdParameter::InternalSwap(ThresholdParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.threshold_, other->_impl_.threshold_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ThresholdParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[47]);
+}
+
+// ===================================================================
+
+class SPPParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SPPParameter>()._impl_._has_bits_);
+  static void set_has_pyramid_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_pool(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+SPPParameter::SPPParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.SPPParameter)
+}
+SPPParameter::SPPParameter(const SPPParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SPPParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pyramid_height_){}
+    , decltype(_impl_.pool_){}
+    , decltype(_impl_.engine_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.pyramid_height_, &from._impl_.pyramid_height_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.engine_) -
+    reinterpret_cast<char*>(&_impl_.pyramid_height_)) + sizeof(_impl_.engine_));
+  // @@protoc_insertion_point(copy_constructor:caffe.SPPParameter)
+}
+
+inline void SPPParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pyramid_height_){0u}
+    , decltype(_impl_.pool_){0}
+    , decltype(_impl_.engine_){0}
+  };
+}
+
+SPPParameter::~SPPParameter() {
+  // @@protoc_insertion_point(destructor:caffe.SPPParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SPPParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SPPParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SPPParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.SPPParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.pyramid_height_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.engine_) -
+        reinterpret_cast<char*>(&_impl_.pyramid_height_)) + sizeof(_impl_.engine_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SPPParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 pyramid_height = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_pyramid_height(&has_bits);
+          _impl_.pyramid_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SPPParameter.PoolMethod pool = 2 [default = MAX];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::SPPParameter_PoolMethod_IsValid(val))) {
+            _internal_set_pool(static_cast<::caffe::SPPParameter_PoolMethod>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SPPParameter.Engine engine = 6 [default = DEFAULT];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::SPPParameter_Engine_IsValid(val))) {
+            _internal_set_engine(static_cast<::caffe::SPPParameter_Engine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SPPParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.SPPParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 pyramid_height = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_pyramid_height(), target);
+  }
+
+  // optional .caffe.SPPParameter.PoolMethod pool = 2 [default = MAX];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_pool(), target);
+  }
+
+  // optional .caffe.SPPParameter.Engine engine = 6 [default = DEFAULT];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_engine(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.SPPParameter)
+  return target;
+}
+
+size_t SPPParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.SPPParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional uint32 pyramid_height = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pyramid_height());
+    }
+
+    // optional .caffe.SPPParameter.PoolMethod pool = 2 [default = MAX];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_pool());
+    }
+
+    // optional .caffe.SPPParameter.Engine engine = 6 [default = DEFAULT];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SPPParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SPPParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SPPParameter::GetClassData() const { return &_class_data_; }
+
+
+void SPPParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SPPParameter*>(&to_msg);
+  auto& from = static_cast<const SPPParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.SPPParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.pyramid_height_ = from._impl_.pyramid_height_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.pool_ = from._impl_.pool_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.engine_ = from._impl_.engine_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SPPParameter::CopyFrom(const SPPParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.SPPParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SPPParameter::IsInitialized() const {
+  return true;
+}
+
+void SPPParameter::InternalSwap(SPPParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SPPParameter, _impl_.engine_)
+      + sizeof(SPPParameter::_impl_.engine_)
+      - PROTOBUF_FIELD_OFFSET(SPPParameter, _impl_.pyramid_height_)>(
+          reinterpret_cast<char*>(&_impl_.pyramid_height_),
+          reinterpret_cast<char*>(&other->_impl_.pyramid_height_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SPPParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[48]);
+}
+
+// ===================================================================
+
+class NonMaximumSuppressionParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NonMaximumSuppressionParameter>()._impl_._has_bits_);
+  static void set_has_nms_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_top_k(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_eta(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+NonMaximumSuppressionParameter::NonMaximumSuppressionParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.NonMaximumSuppressionParameter)
+}
+NonMaximumSuppressionParameter::NonMaximumSuppressionParameter(const NonMaximumSuppressionParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NonMaximumSuppressionParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.top_k_){}
+    , decltype(_impl_.nms_threshold_){}
+    , decltype(_impl_.eta_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.top_k_, &from._impl_.top_k_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.eta_) -
+    reinterpret_cast<char*>(&_impl_.top_k_)) + sizeof(_impl_.eta_));
+  // @@protoc_insertion_point(copy_constructor:caffe.NonMaximumSuppressionParameter)
+}
+
+inline void NonMaximumSuppressionParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.top_k_){0}
+    , decltype(_impl_.nms_threshold_){0.3f}
+    , decltype(_impl_.eta_){1}
+  };
+}
+
+NonMaximumSuppressionParameter::~NonMaximumSuppressionParameter() {
+  // @@protoc_insertion_point(destructor:caffe.NonMaximumSuppressionParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NonMaximumSuppressionParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void NonMaximumSuppressionParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NonMaximumSuppressionParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.NonMaximumSuppressionParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    _impl_.top_k_ = 0;
+    _impl_.nms_threshold_ = 0.3f;
+    _impl_.eta_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NonMaximumSuppressionParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float nms_threshold = 1 [default = 0.3];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_nms_threshold(&has_bits);
+          _impl_.nms_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 top_k = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_top_k(&has_bits);
+          _impl_.top_k_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float eta = 3 [default = 1];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_eta(&has_bits);
+          _impl_.eta_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NonMaximumSuppressionParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.NonMaximumSuppressionParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float nms_threshold = 1 [default = 0.3];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_nms_threshold(), target);
+  }
+
+  // optional int32 top_k = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_top_k(), target);
+  }
+
+  // optional float eta = 3 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_eta(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.NonMaximumSuppressionParameter)
+  return target;
+}
+
+size_t NonMaximumSuppressionParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.NonMaximumSuppressionParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 top_k = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_top_k());
+    }
+
+    // optional float nms_threshold = 1 [default = 0.3];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float eta = 3 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NonMaximumSuppressionParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NonMaximumSuppressionParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NonMaximumSuppressionParameter::GetClassData() const { return &_class_data_; }
+
+
+void NonMaximumSuppressionParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NonMaximumSuppressionParameter*>(&to_msg);
+  auto& from = static_cast<const NonMaximumSuppressionParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.NonMaximumSuppressionParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.top_k_ = from._impl_.top_k_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.nms_threshold_ = from._impl_.nms_threshold_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.eta_ = from._impl_.eta_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NonMaximumSuppressionParameter::CopyFrom(const NonMaximumSuppressionParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.NonMaximumSuppressionParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NonMaximumSuppressionParameter::IsInitialized() const {
+  return true;
+}
+
+void NonMaximumSuppressionParameter::InternalSwap(NonMaximumSuppressionParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.top_k_, other->_impl_.top_k_);
+  swap(_impl_.nms_threshold_, other->_impl_.nms_threshold_);
+  swap(_impl_.eta_, other->_impl_.eta_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NonMaximumSuppressionParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[49]);
+}
+
+// ===================================================================
+
+class SaveOutputParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SaveOutputParameter>()._impl_._has_bits_);
+  static void set_has_output_directory(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_output_name_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_output_format(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_label_map_file(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_name_size_file(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_num_test_image(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+SaveOutputParameter::SaveOutputParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.SaveOutputParameter)
+}
+SaveOutputParameter::SaveOutputParameter(const SaveOutputParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SaveOutputParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.output_directory_){}
+    , decltype(_impl_.output_name_prefix_){}
+    , decltype(_impl_.output_format_){}
+    , decltype(_impl_.label_map_file_){}
+    , decltype(_impl_.name_size_file_){}
+    , decltype(_impl_.num_test_image_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.output_directory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_directory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_output_directory()) {
+    _this->_impl_.output_directory_.Set(from._internal_output_directory(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.output_name_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_name_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_output_name_prefix()) {
+    _this->_impl_.output_name_prefix_.Set(from._internal_output_name_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.output_format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_output_format()) {
+    _this->_impl_.output_format_.Set(from._internal_output_format(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.label_map_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_map_file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_label_map_file()) {
+    _this->_impl_.label_map_file_.Set(from._internal_label_map_file(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_size_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_size_file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name_size_file()) {
+    _this->_impl_.name_size_file_.Set(from._internal_name_size_file(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.num_test_image_ = from._impl_.num_test_image_;
+  // @@protoc_insertion_point(copy_constructor:caffe.SaveOutputParameter)
+}
+
+inline void SaveOutputParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.output_directory_){}
+    , decltype(_impl_.output_name_prefix_){}
+    , decltype(_impl_.output_format_){}
+    , decltype(_impl_.label_map_file_){}
+    , decltype(_impl_.name_size_file_){}
+    , decltype(_impl_.num_test_image_){0u}
+  };
+  _impl_.output_directory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_directory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.output_name_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_name_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.output_format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.label_map_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_map_file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_size_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_size_file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SaveOutputParameter::~SaveOutputParameter() {
+  // @@protoc_insertion_point(destructor:caffe.SaveOutputParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SaveOutputParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.output_directory_.Destroy();
+  _impl_.output_name_prefix_.Destroy();
+  _impl_.output_format_.Destroy();
+  _impl_.label_map_file_.Destroy();
+  _impl_.name_size_file_.Destroy();
+}
+
+void SaveOutputParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SaveOutputParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.SaveOutputParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.output_directory_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.output_name_prefix_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.output_format_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.label_map_file_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.name_size_file_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.num_test_image_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SaveOutputParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string output_directory = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_output_directory();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.SaveOutputParameter.output_directory");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string output_name_prefix = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_output_name_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.SaveOutputParameter.output_name_prefix");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string output_format = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_output_format();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.SaveOutputParameter.output_format");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string label_map_file = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_label_map_file();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.SaveOutputParameter.label_map_file");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string name_size_file = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_name_size_file();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.SaveOutputParameter.name_size_file");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 num_test_image = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_num_test_image(&has_bits);
+          _impl_.num_test_image_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SaveOutputParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.SaveOutputParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string output_directory = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_output_directory().data(), static_cast<int>(this->_internal_output_directory().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.SaveOutputParameter.output_directory");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_output_directory(), target);
+  }
+
+  // optional string output_name_prefix = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_output_name_prefix().data(), static_cast<int>(this->_internal_output_name_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.SaveOutputParameter.output_name_prefix");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_output_name_prefix(), target);
+  }
+
+  // optional string output_format = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_output_format().data(), static_cast<int>(this->_internal_output_format().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.SaveOutputParameter.output_format");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_output_format(), target);
+  }
+
+  // optional string label_map_file = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_label_map_file().data(), static_cast<int>(this->_internal_label_map_file().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.SaveOutputParameter.label_map_file");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_label_map_file(), target);
+  }
+
+  // optional string name_size_file = 5;
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name_size_file().data(), static_cast<int>(this->_internal_name_size_file().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.SaveOutputParameter.name_size_file");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_name_size_file(), target);
+  }
+
+  // optional uint32 num_test_image = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_num_test_image(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.SaveOutputParameter)
+  return target;
+}
+
+size_t SaveOutputParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.SaveOutputParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string output_directory = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_output_directory());
+    }
+
+    // optional string output_name_prefix = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_output_name_prefix());
+    }
+
+    // optional string output_format = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_output_format());
+    }
+
+    // optional string label_map_file = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_label_map_file());
+    }
+
+    // optional string name_size_file = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name_size_file());
+    }
+
+    // optional uint32 num_test_image = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_test_image());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SaveOutputParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SaveOutputParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SaveOutputParameter::GetClassData() const { return &_class_data_; }
+
+
+void SaveOutputParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SaveOutputParameter*>(&to_msg);
+  auto& from = static_cast<const SaveOutputParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.SaveOutputParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_output_directory(from._internal_output_directory());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_output_name_prefix(from._internal_output_name_prefix());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_output_format(from._internal_output_format());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_label_map_file(from._internal_label_map_file());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_name_size_file(from._internal_name_size_file());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.num_test_image_ = from._impl_.num_test_image_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SaveOutputParameter::CopyFrom(const SaveOutputParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.SaveOutputParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SaveOutputParameter::IsInitialized() const {
+  return true;
+}
+
+void SaveOutputParameter::InternalSwap(SaveOutputParameter* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.output_directory_, lhs_arena,
+      &other->_impl_.output_directory_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.output_name_prefix_, lhs_arena,
+      &other->_impl_.output_name_prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.output_format_, lhs_arena,
+      &other->_impl_.output_format_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.label_map_file_, lhs_arena,
+      &other->_impl_.label_map_file_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_size_file_, lhs_arena,
+      &other->_impl_.name_size_file_, rhs_arena
+  );
+  swap(_impl_.num_test_image_, other->_impl_.num_test_image_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SaveOutputParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[50]);
+}
+
+// ===================================================================
+
+class DetectionOutputParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DetectionOutputParameter>()._impl_._has_bits_);
+  static void set_has_num_classes(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_share_location(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_background_label_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::caffe::NonMaximumSuppressionParameter& nms_param(const DetectionOutputParameter* msg);
+  static void set_has_nms_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::caffe::SaveOutputParameter& save_output_param(const DetectionOutputParameter* msg);
+  static void set_has_save_output_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_code_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_variance_encoded_in_target(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_keep_top_k(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_confidence_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_visualize(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_visualize_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_save_file(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::caffe::NonMaximumSuppressionParameter&
+DetectionOutputParameter::_Internal::nms_param(const DetectionOutputParameter* msg) {
+  return *msg->_impl_.nms_param_;
+}
+const ::caffe::SaveOutputParameter&
+DetectionOutputParameter::_Internal::save_output_param(const DetectionOutputParameter* msg) {
+  return *msg->_impl_.save_output_param_;
+}
+DetectionOutputParameter::DetectionOutputParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.DetectionOutputParameter)
+}
+DetectionOutputParameter::DetectionOutputParameter(const DetectionOutputParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DetectionOutputParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.save_file_){}
+    , decltype(_impl_.nms_param_){nullptr}
+    , decltype(_impl_.save_output_param_){nullptr}
+    , decltype(_impl_.num_classes_){}
+    , decltype(_impl_.background_label_id_){}
+    , decltype(_impl_.confidence_threshold_){}
+    , decltype(_impl_.variance_encoded_in_target_){}
+    , decltype(_impl_.visualize_){}
+    , decltype(_impl_.visualize_threshold_){}
+    , decltype(_impl_.keep_top_k_){}
+    , decltype(_impl_.share_location_){}
+    , decltype(_impl_.code_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.save_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.save_file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_save_file()) {
+    _this->_impl_.save_file_.Set(from._internal_save_file(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_nms_param()) {
+    _this->_impl_.nms_param_ = new ::caffe::NonMaximumSuppressionParameter(*from._impl_.nms_param_);
+  }
+  if (from._internal_has_save_output_param()) {
+    _this->_impl_.save_output_param_ = new ::caffe::SaveOutputParameter(*from._impl_.save_output_param_);
+  }
+  ::memcpy(&_impl_.num_classes_, &from._impl_.num_classes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.code_type_) -
+    reinterpret_cast<char*>(&_impl_.num_classes_)) + sizeof(_impl_.code_type_));
+  // @@protoc_insertion_point(copy_constructor:caffe.DetectionOutputParameter)
+}
+
+inline void DetectionOutputParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.save_file_){}
+    , decltype(_impl_.nms_param_){nullptr}
+    , decltype(_impl_.save_output_param_){nullptr}
+    , decltype(_impl_.num_classes_){0u}
+    , decltype(_impl_.background_label_id_){0}
+    , decltype(_impl_.confidence_threshold_){0}
+    , decltype(_impl_.variance_encoded_in_target_){false}
+    , decltype(_impl_.visualize_){false}
+    , decltype(_impl_.visualize_threshold_){0}
+    , decltype(_impl_.keep_top_k_){-1}
+    , decltype(_impl_.share_location_){true}
+    , decltype(_impl_.code_type_){1}
+  };
+  _impl_.save_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.save_file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DetectionOutputParameter::~DetectionOutputParameter() {
+  // @@protoc_insertion_point(destructor:caffe.DetectionOutputParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DetectionOutputParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.save_file_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.nms_param_;
+  if (this != internal_default_instance()) delete _impl_.save_output_param_;
+}
+
+void DetectionOutputParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DetectionOutputParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.DetectionOutputParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.save_file_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.nms_param_ != nullptr);
+      _impl_.nms_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.save_output_param_ != nullptr);
+      _impl_.save_output_param_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.num_classes_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.visualize_) -
+        reinterpret_cast<char*>(&_impl_.num_classes_)) + sizeof(_impl_.visualize_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    _impl_.visualize_threshold_ = 0;
+    _impl_.keep_top_k_ = -1;
+    _impl_.share_location_ = true;
+    _impl_.code_type_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DetectionOutputParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 num_classes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_classes(&has_bits);
+          _impl_.num_classes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool share_location = 2 [default = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_share_location(&has_bits);
+          _impl_.share_location_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 background_label_id = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_background_label_id(&has_bits);
+          _impl_.background_label_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.NonMaximumSuppressionParameter nms_param = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_nms_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SaveOutputParameter save_output_param = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_save_output_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PriorBoxParameter.CodeType code_type = 6 [default = CORNER];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::PriorBoxParameter_CodeType_IsValid(val))) {
+            _internal_set_code_type(static_cast<::caffe::PriorBoxParameter_CodeType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 keep_top_k = 7 [default = -1];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_keep_top_k(&has_bits);
+          _impl_.keep_top_k_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool variance_encoded_in_target = 8 [default = false];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_variance_encoded_in_target(&has_bits);
+          _impl_.variance_encoded_in_target_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float confidence_threshold = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_confidence_threshold(&has_bits);
+          _impl_.confidence_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool visualize = 10 [default = false];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_visualize(&has_bits);
+          _impl_.visualize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float visualize_threshold = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _Internal::set_has_visualize_threshold(&has_bits);
+          _impl_.visualize_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string save_file = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          auto str = _internal_mutable_save_file();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.DetectionOutputParameter.save_file");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DetectionOutputParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.DetectionOutputParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 num_classes = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_num_classes(), target);
+  }
+
+  // optional bool share_location = 2 [default = true];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_share_location(), target);
+  }
+
+  // optional int32 background_label_id = 3 [default = 0];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_background_label_id(), target);
+  }
+
+  // optional .caffe.NonMaximumSuppressionParameter nms_param = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::nms_param(this),
+        _Internal::nms_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.SaveOutputParameter save_output_param = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::save_output_param(this),
+        _Internal::save_output_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.PriorBoxParameter.CodeType code_type = 6 [default = CORNER];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_code_type(), target);
+  }
+
+  // optional int32 keep_top_k = 7 [default = -1];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_keep_top_k(), target);
+  }
+
+  // optional bool variance_encoded_in_target = 8 [default = false];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_variance_encoded_in_target(), target);
+  }
+
+  // optional float confidence_threshold = 9;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_confidence_threshold(), target);
+  }
+
+  // optional bool visualize = 10 [default = false];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_visualize(), target);
+  }
+
+  // optional float visualize_threshold = 11;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(11, this->_internal_visualize_threshold(), target);
+  }
+
+  // optional string save_file = 12;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_save_file().data(), static_cast<int>(this->_internal_save_file().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.DetectionOutputParameter.save_file");
+    target = stream->WriteStringMaybeAliased(
+        12, this->_internal_save_file(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.DetectionOutputParameter)
+  return target;
+}
+
+size_t DetectionOutputParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.DetectionOutputParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string save_file = 12;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_save_file());
+    }
+
+    // optional .caffe.NonMaximumSuppressionParameter nms_param = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.nms_param_);
+    }
+
+    // optional .caffe.SaveOutputParameter save_output_param = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.save_output_param_);
+    }
+
+    // optional uint32 num_classes = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_classes());
+    }
+
+    // optional int32 background_label_id = 3 [default = 0];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_background_label_id());
+    }
+
+    // optional float confidence_threshold = 9;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool variance_encoded_in_target = 8 [default = false];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool visualize = 10 [default = false];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    // optional float visualize_threshold = 11;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 keep_top_k = 7 [default = -1];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_keep_top_k());
+    }
+
+    // optional bool share_location = 2 [default = true];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 1;
+    }
+
+    // optional .caffe.PriorBoxParameter.CodeType code_type = 6 [default = CORNER];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_code_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DetectionOutputParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DetectionOutputParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DetectionOutputParameter::GetClassData() const { return &_class_data_; }
+
+
+void DetectionOutputParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DetectionOutputParameter*>(&to_msg);
+  auto& from = static_cast<const DetectionOutputParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.DetectionOutputParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_save_file(from._internal_save_file());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_nms_param()->::caffe::NonMaximumSuppressionParameter::MergeFrom(
+          from._internal_nms_param());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_save_output_param()->::caffe::SaveOutputParameter::MergeFrom(
+          from._internal_save_output_param());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.num_classes_ = from._impl_.num_classes_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.background_label_id_ = from._impl_.background_label_id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.confidence_threshold_ = from._impl_.confidence_threshold_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.variance_encoded_in_target_ = from._impl_.variance_encoded_in_target_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.visualize_ = from._impl_.visualize_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.visualize_threshold_ = from._impl_.visualize_threshold_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.keep_top_k_ = from._impl_.keep_top_k_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.share_location_ = from._impl_.share_location_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.code_type_ = from._impl_.code_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DetectionOutputParameter::CopyFrom(const DetectionOutputParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.DetectionOutputParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DetectionOutputParameter::IsInitialized() const {
+  return true;
+}
+
+void DetectionOutputParameter::InternalSwap(DetectionOutputParameter* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.save_file_, lhs_arena,
+      &other->_impl_.save_file_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DetectionOutputParameter, _impl_.visualize_threshold_)
+      + sizeof(DetectionOutputParameter::_impl_.visualize_threshold_)
+      - PROTOBUF_FIELD_OFFSET(DetectionOutputParameter, _impl_.nms_param_)>(
+          reinterpret_cast<char*>(&_impl_.nms_param_),
+          reinterpret_cast<char*>(&other->_impl_.nms_param_));
+  swap(_impl_.keep_top_k_, other->_impl_.keep_top_k_);
+  swap(_impl_.share_location_, other->_impl_.share_location_);
+  swap(_impl_.code_type_, other->_impl_.code_type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DetectionOutputParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[51]);
+}
+
+// ===================================================================
+
+class PermuteParameter::_Internal {
+ public:
+};
+
+PermuteParameter::PermuteParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.PermuteParameter)
+}
+PermuteParameter::PermuteParameter(const PermuteParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PermuteParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.order_){from._impl_.order_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:caffe.PermuteParameter)
+}
+
+inline void PermuteParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.order_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PermuteParameter::~PermuteParameter() {
+  // @@protoc_insertion_point(destructor:caffe.PermuteParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PermuteParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.order_.~RepeatedField();
+}
+
+void PermuteParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PermuteParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.PermuteParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.order_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PermuteParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 order = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_order(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_order(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PermuteParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.PermuteParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 order = 1;
+  for (int i = 0, n = this->_internal_order_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_order(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.PermuteParameter)
+  return target;
+}
+
+size_t PermuteParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.PermuteParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 order = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.order_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_order_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PermuteParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PermuteParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PermuteParameter::GetClassData() const { return &_class_data_; }
+
+
+void PermuteParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PermuteParameter*>(&to_msg);
+  auto& from = static_cast<const PermuteParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.PermuteParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.order_.MergeFrom(from._impl_.order_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PermuteParameter::CopyFrom(const PermuteParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.PermuteParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PermuteParameter::IsInitialized() const {
+  return true;
+}
+
+void PermuteParameter::InternalSwap(PermuteParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.order_.InternalSwap(&other->_impl_.order_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PermuteParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[52]);
+}
+
+// ===================================================================
+
+class PriorBoxParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PriorBoxParameter>()._impl_._has_bits_);
+  static void set_has_flip(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_clip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_img_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_img_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_img_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_step(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_step_h(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_step_w(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+};
+
+PriorBoxParameter::PriorBoxParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.PriorBoxParameter)
+}
+PriorBoxParameter::PriorBoxParameter(const PriorBoxParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PriorBoxParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_size_){from._impl_.min_size_}
+    , decltype(_impl_.max_size_){from._impl_.max_size_}
+    , decltype(_impl_.aspect_ratio_){from._impl_.aspect_ratio_}
+    , decltype(_impl_.variance_){from._impl_.variance_}
+    , decltype(_impl_.clip_){}
+    , decltype(_impl_.img_size_){}
+    , decltype(_impl_.img_h_){}
+    , decltype(_impl_.img_w_){}
+    , decltype(_impl_.step_){}
+    , decltype(_impl_.step_h_){}
+    , decltype(_impl_.step_w_){}
+    , decltype(_impl_.flip_){}
+    , decltype(_impl_.offset_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.clip_, &from._impl_.clip_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.clip_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:caffe.PriorBoxParameter)
+}
+
+inline void PriorBoxParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_size_){arena}
+    , decltype(_impl_.max_size_){arena}
+    , decltype(_impl_.aspect_ratio_){arena}
+    , decltype(_impl_.variance_){arena}
+    , decltype(_impl_.clip_){false}
+    , decltype(_impl_.img_size_){0u}
+    , decltype(_impl_.img_h_){0u}
+    , decltype(_impl_.img_w_){0u}
+    , decltype(_impl_.step_){0}
+    , decltype(_impl_.step_h_){0}
+    , decltype(_impl_.step_w_){0}
+    , decltype(_impl_.flip_){true}
+    , decltype(_impl_.offset_){0.5f}
+  };
+}
+
+PriorBoxParameter::~PriorBoxParameter() {
+  // @@protoc_insertion_point(destructor:caffe.PriorBoxParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PriorBoxParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.min_size_.~RepeatedField();
+  _impl_.max_size_.~RepeatedField();
+  _impl_.aspect_ratio_.~RepeatedField();
+  _impl_.variance_.~RepeatedField();
+}
+
+void PriorBoxParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PriorBoxParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.PriorBoxParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.min_size_.Clear();
+  _impl_.max_size_.Clear();
+  _impl_.aspect_ratio_.Clear();
+  _impl_.variance_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.clip_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.step_w_) -
+        reinterpret_cast<char*>(&_impl_.clip_)) + sizeof(_impl_.step_w_));
+    _impl_.flip_ = true;
+  }
+  _impl_.offset_ = 0.5f;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PriorBoxParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated float min_size = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_min_size(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<13>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_min_size(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float max_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_max_size(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<21>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_max_size(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float aspect_ratio = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_aspect_ratio(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<29>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_aspect_ratio(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool flip = 4 [default = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_flip(&has_bits);
+          _impl_.flip_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool clip = 5 [default = false];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_clip(&has_bits);
+          _impl_.clip_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float variance = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_variance(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<53>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_variance(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 img_size = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_img_size(&has_bits);
+          _impl_.img_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 img_h = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_img_h(&has_bits);
+          _impl_.img_h_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 img_w = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_img_w(&has_bits);
+          _impl_.img_w_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float step = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _Internal::set_has_step(&has_bits);
+          _impl_.step_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float step_h = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _Internal::set_has_step_h(&has_bits);
+          _impl_.step_h_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float step_w = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 101)) {
+          _Internal::set_has_step_w(&has_bits);
+          _impl_.step_w_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float offset = 13 [default = 0.5];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 109)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PriorBoxParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.PriorBoxParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated float min_size = 1;
+  for (int i = 0, n = this->_internal_min_size_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_min_size(i), target);
+  }
+
+  // repeated float max_size = 2;
+  for (int i = 0, n = this->_internal_max_size_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_max_size(i), target);
+  }
+
+  // repeated float aspect_ratio = 3;
+  for (int i = 0, n = this->_internal_aspect_ratio_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_aspect_ratio(i), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool flip = 4 [default = true];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_flip(), target);
+  }
+
+  // optional bool clip = 5 [default = false];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_clip(), target);
+  }
+
+  // repeated float variance = 6;
+  for (int i = 0, n = this->_internal_variance_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_variance(i), target);
+  }
+
+  // optional uint32 img_size = 7;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_img_size(), target);
+  }
+
+  // optional uint32 img_h = 8;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_img_h(), target);
+  }
+
+  // optional uint32 img_w = 9;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_img_w(), target);
+  }
+
+  // optional float step = 10;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(10, this->_internal_step(), target);
+  }
+
+  // optional float step_h = 11;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(11, this->_internal_step_h(), target);
+  }
+
+  // optional float step_w = 12;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(12, this->_internal_step_w(), target);
+  }
+
+  // optional float offset = 13 [default = 0.5];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(13, this->_internal_offset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.PriorBoxParameter)
+  return target;
+}
+
+size_t PriorBoxParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.PriorBoxParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float min_size = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_min_size_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_min_size_size());
+    total_size += data_size;
+  }
+
+  // repeated float max_size = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_max_size_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_max_size_size());
+    total_size += data_size;
+  }
+
+  // repeated float aspect_ratio = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_aspect_ratio_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_aspect_ratio_size());
+    total_size += data_size;
+  }
+
+  // repeated float variance = 6;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_variance_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_variance_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional bool clip = 5 [default = false];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 img_size = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_img_size());
+    }
+
+    // optional uint32 img_h = 8;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_img_h());
+    }
+
+    // optional uint32 img_w = 9;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_img_w());
+    }
+
+    // optional float step = 10;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float step_h = 11;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float step_w = 12;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool flip = 4 [default = true];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  // optional float offset = 13 [default = 0.5];
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PriorBoxParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PriorBoxParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PriorBoxParameter::GetClassData() const { return &_class_data_; }
+
+
+void PriorBoxParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PriorBoxParameter*>(&to_msg);
+  auto& from = static_cast<const PriorBoxParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.PriorBoxParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.min_size_.MergeFrom(from._impl_.min_size_);
+  _this->_impl_.max_size_.MergeFrom(from._impl_.max_size_);
+  _this->_impl_.aspect_ratio_.MergeFrom(from._impl_.aspect_ratio_);
+  _this->_impl_.variance_.MergeFrom(from._impl_.variance_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.clip_ = from._impl_.clip_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.img_size_ = from._impl_.img_size_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.img_h_ = from._impl_.img_h_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.img_w_ = from._impl_.img_w_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.step_ = from._impl_.step_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.step_h_ = from._impl_.step_h_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.step_w_ = from._impl_.step_w_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.flip_ = from._impl_.flip_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PriorBoxParameter::CopyFrom(const PriorBoxParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.PriorBoxParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PriorBoxParameter::IsInitialized() const {
+  return true;
+}
+
+void PriorBoxParameter::InternalSwap(PriorBoxParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.min_size_.InternalSwap(&other->_impl_.min_size_);
+  _impl_.max_size_.InternalSwap(&other->_impl_.max_size_);
+  _impl_.aspect_ratio_.InternalSwap(&other->_impl_.aspect_ratio_);
+  _impl_.variance_.InternalSwap(&other->_impl_.variance_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PriorBoxParameter, _impl_.step_w_)
+      + sizeof(PriorBoxParameter::_impl_.step_w_)
+      - PROTOBUF_FIELD_OFFSET(PriorBoxParameter, _impl_.clip_)>(
+          reinterpret_cast<char*>(&_impl_.clip_),
+          reinterpret_cast<char*>(&other->_impl_.clip_));
+  swap(_impl_.flip_, other->_impl_.flip_);
+  swap(_impl_.offset_, other->_impl_.offset_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PriorBoxParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[53]);
+}
+
+// ===================================================================
+
+class ShuffleChannelParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ShuffleChannelParameter>()._impl_._has_bits_);
+  static void set_has_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ShuffleChannelParameter::ShuffleChannelParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.ShuffleChannelParameter)
+}
+ShuffleChannelParameter::ShuffleChannelParameter(const ShuffleChannelParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ShuffleChannelParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.group_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.group_ = from._impl_.group_;
+  // @@protoc_insertion_point(copy_constructor:caffe.ShuffleChannelParameter)
+}
+
+inline void ShuffleChannelParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.group_){1u}
+  };
+}
+
+ShuffleChannelParameter::~ShuffleChannelParameter() {
+  // @@protoc_insertion_point(destructor:caffe.ShuffleChannelParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ShuffleChannelParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ShuffleChannelParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ShuffleChannelParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.ShuffleChannelParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.group_ = 1u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ShuffleChannelParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 group = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_group(&has_bits);
+          _impl_.group_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ShuffleChannelParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.ShuffleChannelParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 group = 1 [default = 1];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_group(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.ShuffleChannelParameter)
+  return target;
+}
+
+size_t ShuffleChannelParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.ShuffleChannelParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint32 group = 1 [default = 1];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_group());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ShuffleChannelParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ShuffleChannelParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ShuffleChannelParameter::GetClassData() const { return &_class_data_; }
+
+
+void ShuffleChannelParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ShuffleChannelParameter*>(&to_msg);
+  auto& from = static_cast<const ShuffleChannelParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.ShuffleChannelParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_group()) {
+    _this->_internal_set_group(from._internal_group());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ShuffleChannelParameter::CopyFrom(const ShuffleChannelParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.ShuffleChannelParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ShuffleChannelParameter::IsInitialized() const {
+  return true;
+}
+
+void ShuffleChannelParameter::InternalSwap(ShuffleChannelParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.group_, other->_impl_.group_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ShuffleChannelParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[54]);
+}
+
+// ===================================================================
+
+class NormalizeParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NormalizeParameter>()._impl_._has_bits_);
+  static void set_has_across_spatial(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::caffe::FillerParameter& scale_filler(const NormalizeParameter* msg);
+  static void set_has_scale_filler(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_channel_shared(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_eps(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::caffe::FillerParameter&
+NormalizeParameter::_Internal::scale_filler(const NormalizeParameter* msg) {
+  return *msg->_impl_.scale_filler_;
+}
+NormalizeParameter::NormalizeParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.NormalizeParameter)
+}
+NormalizeParameter::NormalizeParameter(const NormalizeParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NormalizeParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scale_filler_){nullptr}
+    , decltype(_impl_.across_spatial_){}
+    , decltype(_impl_.channel_shared_){}
+    , decltype(_impl_.eps_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_scale_filler()) {
+    _this->_impl_.scale_filler_ = new ::caffe::FillerParameter(*from._impl_.scale_filler_);
+  }
+  ::memcpy(&_impl_.across_spatial_, &from._impl_.across_spatial_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.eps_) -
+    reinterpret_cast<char*>(&_impl_.across_spatial_)) + sizeof(_impl_.eps_));
+  // @@protoc_insertion_point(copy_constructor:caffe.NormalizeParameter)
+}
+
+inline void NormalizeParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scale_filler_){nullptr}
+    , decltype(_impl_.across_spatial_){true}
+    , decltype(_impl_.channel_shared_){true}
+    , decltype(_impl_.eps_){1e-10f}
+  };
+}
+
+NormalizeParameter::~NormalizeParameter() {
+  // @@protoc_insertion_point(destructor:caffe.NormalizeParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NormalizeParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.scale_filler_;
+}
+
+void NormalizeParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NormalizeParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.NormalizeParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.scale_filler_ != nullptr);
+      _impl_.scale_filler_->Clear();
+    }
+    _impl_.across_spatial_ = true;
+    _impl_.channel_shared_ = true;
+    _impl_.eps_ = 1e-10f;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NormalizeParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool across_spatial = 1 [default = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_across_spatial(&has_bits);
+          _impl_.across_spatial_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.FillerParameter scale_filler = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_scale_filler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool channel_shared = 3 [default = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_channel_shared(&has_bits);
+          _impl_.channel_shared_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float eps = 4 [default = 1e-10];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_eps(&has_bits);
+          _impl_.eps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NormalizeParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.NormalizeParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool across_spatial = 1 [default = true];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_across_spatial(), target);
+  }
+
+  // optional .caffe.FillerParameter scale_filler = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::scale_filler(this),
+        _Internal::scale_filler(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bool channel_shared = 3 [default = true];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_channel_shared(), target);
+  }
+
+  // optional float eps = 4 [default = 1e-10];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_eps(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.NormalizeParameter)
+  return target;
+}
+
+size_t NormalizeParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.NormalizeParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional .caffe.FillerParameter scale_filler = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.scale_filler_);
+    }
+
+    // optional bool across_spatial = 1 [default = true];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool channel_shared = 3 [default = true];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional float eps = 4 [default = 1e-10];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NormalizeParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NormalizeParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NormalizeParameter::GetClassData() const { return &_class_data_; }
+
+
+void NormalizeParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NormalizeParameter*>(&to_msg);
+  auto& from = static_cast<const NormalizeParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.NormalizeParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_scale_filler()->::caffe::FillerParameter::MergeFrom(
+          from._internal_scale_filler());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.across_spatial_ = from._impl_.across_spatial_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.channel_shared_ = from._impl_.channel_shared_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.eps_ = from._impl_.eps_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NormalizeParameter::CopyFrom(const NormalizeParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.NormalizeParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NormalizeParameter::IsInitialized() const {
+  return true;
+}
+
+void NormalizeParameter::InternalSwap(NormalizeParameter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.scale_filler_, other->_impl_.scale_filler_);
+  swap(_impl_.across_spatial_, other->_impl_.across_spatial_);
+  swap(_impl_.channel_shared_, other->_impl_.channel_shared_);
+  swap(_impl_.eps_, other->_impl_.eps_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NormalizeParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[55]);
+}
+
+// ===================================================================
+
+class V1LayerParameter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<V1LayerParameter>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static const ::caffe::ConcatParameter& concat_param(const V1LayerParameter* msg);
+  static void set_has_concat_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::caffe::ConvolutionParameter& convolution_param(const V1LayerParameter* msg);
+  static void set_has_convolution_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::caffe::DropoutParameter& dropout_param(const V1LayerParameter* msg);
+  static void set_has_dropout_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::caffe::EltwiseParameter& eltwise_param(const V1LayerParameter* msg);
+  static void set_has_eltwise_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::caffe::ExpParameter& exp_param(const V1LayerParameter* msg);
+  static void set_has_exp_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static const ::caffe::InnerProductParameter& inner_product_param(const V1LayerParameter* msg);
+  static void set_has_inner_product_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::caffe::LRNParameter& lrn_param(const V1LayerParameter* msg);
+  static void set_has_lrn_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::caffe::MVNParameter& mvn_param(const V1LayerParameter* msg);
+  static void set_has_mvn_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static const ::caffe::PoolingParameter& pooling_param(const V1LayerParameter* msg);
+  static void set_has_pooling_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::caffe::PowerParameter& power_param(const V1LayerParameter* msg);
+  static void set_has_power_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::caffe::ReLUParameter& relu_param(const V1LayerParameter* msg);
+  static void set_has_relu_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::caffe::SigmoidParameter& sigmoid_param(const V1LayerParameter* msg);
+  static void set_has_sigmoid_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static const ::caffe::SoftmaxParameter& softmax_param(const V1LayerParameter* msg);
+  static void set_has_softmax_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static const ::caffe::SliceParameter& slice_param(const V1LayerParameter* msg);
+  static void set_has_slice_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static const ::caffe::TanHParameter& tanh_param(const V1LayerParameter* msg);
+  static void set_has_tanh_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static const ::caffe::ThresholdParameter& threshold_param(const V1LayerParameter* msg);
+  static void set_has_threshold_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::caffe::LossParameter& loss_param(const V1LayerParameter* msg);
+  static void set_has_loss_param(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+};
+
+const ::caffe::ConcatParameter&
+V1LayerParameter::_Internal::concat_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.concat_param_;
+}
+const ::caffe::ConvolutionParameter&
+V1LayerParameter::_Internal::convolution_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.convolution_param_;
+}
+const ::caffe::DropoutParameter&
+V1LayerParameter::_Internal::dropout_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.dropout_param_;
+}
+const ::caffe::EltwiseParameter&
+V1LayerParameter::_Internal::eltwise_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.eltwise_param_;
+}
+const ::caffe::ExpParameter&
+V1LayerParameter::_Internal::exp_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.exp_param_;
+}
+const ::caffe::InnerProductParameter&
+V1LayerParameter::_Internal::inner_product_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.inner_product_param_;
+}
+const ::caffe::LRNParameter&
+V1LayerParameter::_Internal::lrn_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.lrn_param_;
+}
+const ::caffe::MVNParameter&
+V1LayerParameter::_Internal::mvn_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.mvn_param_;
+}
+const ::caffe::PoolingParameter&
+V1LayerParameter::_Internal::pooling_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.pooling_param_;
+}
+const ::caffe::PowerParameter&
+V1LayerParameter::_Internal::power_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.power_param_;
+}
+const ::caffe::ReLUParameter&
+V1LayerParameter::_Internal::relu_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.relu_param_;
+}
+const ::caffe::SigmoidParameter&
+V1LayerParameter::_Internal::sigmoid_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.sigmoid_param_;
+}
+const ::caffe::SoftmaxParameter&
+V1LayerParameter::_Internal::softmax_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.softmax_param_;
+}
+const ::caffe::SliceParameter&
+V1LayerParameter::_Internal::slice_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.slice_param_;
+}
+const ::caffe::TanHParameter&
+V1LayerParameter::_Internal::tanh_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.tanh_param_;
+}
+const ::caffe::ThresholdParameter&
+V1LayerParameter::_Internal::threshold_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.threshold_param_;
+}
+const ::caffe::LossParameter&
+V1LayerParameter::_Internal::loss_param(const V1LayerParameter* msg) {
+  return *msg->_impl_.loss_param_;
+}
+V1LayerParameter::V1LayerParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:caffe.V1LayerParameter)
+}
+V1LayerParameter::V1LayerParameter(const V1LayerParameter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  V1LayerParameter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_){from._impl_.bottom_}
+    , decltype(_impl_.top_){from._impl_.top_}
+    , decltype(_impl_.blobs_){from._impl_.blobs_}
+    , decltype(_impl_.blobs_lr_){from._impl_.blobs_lr_}
+    , decltype(_impl_.weight_decay_){from._impl_.weight_decay_}
+    , decltype(_impl_.include_){from._impl_.include_}
+    , decltype(_impl_.exclude_){from._impl_.exclude_}
+    , decltype(_impl_.loss_weight_){from._impl_.loss_weight_}
+    , decltype(_impl_.param_){from._impl_.param_}
+    , decltype(_impl_.blob_share_mode_){from._impl_.blob_share_mode_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.concat_param_){nullptr}
+    , decltype(_impl_.convolution_param_){nullptr}
+    , decltype(_impl_.dropout_param_){nullptr}
+    , decltype(_impl_.inner_product_param_){nullptr}
+    , decltype(_impl_.lrn_param_){nullptr}
+    , decltype(_impl_.pooling_param_){nullptr}
+    , decltype(_impl_.power_param_){nullptr}
+    , decltype(_impl_.eltwise_param_){nullptr}
+    , decltype(_impl_.threshold_param_){nullptr}
+    , decltype(_impl_.relu_param_){nullptr}
+    , decltype(_impl_.slice_param_){nullptr}
+    , decltype(_impl_.mvn_param_){nullptr}
+    , decltype(_impl_.tanh_param_){nullptr}
+    , decltype(_impl_.sigmoid_param_){nullptr}
+    , decltype(_impl_.softmax_param_){nullptr}
+    , decltype(_impl_.exp_param_){nullptr}
+    , decltype(_impl_.loss_param_){nullptr}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_concat_param()) {
+    _this->_impl_.concat_param_ = new ::caffe::ConcatParameter(*from._impl_.concat_param_);
+  }
+  if (from._internal_has_convolution_param()) {
+    _this->_impl_.convolution_param_ = new ::caffe::ConvolutionParameter(*from._impl_.convolution_param_);
+  }
+  if (from._internal_has_dropout_param()) {
+    _this->_impl_.dropout_param_ = new ::caffe::DropoutParameter(*from._impl_.dropout_param_);
+  }
+  if (from._internal_has_inner_product_param()) {
+    _this->_impl_.inner_product_param_ = new ::caffe::InnerProductParameter(*from._impl_.inner_product_param_);
+  }
+  if (from._internal_has_lrn_param()) {
+    _this->_impl_.lrn_param_ = new ::caffe::LRNParameter(*from._impl_.lrn_param_);
+  }
+  if (from._internal_has_pooling_param()) {
+    _this->_impl_.pooling_param_ = new ::caffe::PoolingParameter(*from._impl_.pooling_param_);
+  }
+  if (from._internal_has_power_param()) {
+    _this->_impl_.power_param_ = new ::caffe::PowerParameter(*from._impl_.power_param_);
+  }
+  if (from._internal_has_eltwise_param()) {
+    _this->_impl_.eltwise_param_ = new ::caffe::EltwiseParameter(*from._impl_.eltwise_param_);
+  }
+  if (from._internal_has_threshold_param()) {
+    _this->_impl_.threshold_param_ = new ::caffe::ThresholdParameter(*from._impl_.threshold_param_);
+  }
+  if (from._internal_has_relu_param()) {
+    _this->_impl_.relu_param_ = new ::caffe::ReLUParameter(*from._impl_.relu_param_);
+  }
+  if (from._internal_has_slice_param()) {
+    _this->_impl_.slice_param_ = new ::caffe::SliceParameter(*from._impl_.slice_param_);
+  }
+  if (from._internal_has_mvn_param()) {
+    _this->_impl_.mvn_param_ = new ::caffe::MVNParameter(*from._impl_.mvn_param_);
+  }
+  if (from._internal_has_tanh_param()) {
+    _this->_impl_.tanh_param_ = new ::caffe::TanHParameter(*from._impl_.tanh_param_);
+  }
+  if (from._internal_has_sigmoid_param()) {
+    _this->_impl_.sigmoid_param_ = new ::caffe::SigmoidParameter(*from._impl_.sigmoid_param_);
+  }
+  if (from._internal_has_softmax_param()) {
+    _this->_impl_.softmax_param_ = new ::caffe::SoftmaxParameter(*from._impl_.softmax_param_);
+  }
+  if (from._internal_has_exp_param()) {
+    _this->_impl_.exp_param_ = new ::caffe::ExpParameter(*from._impl_.exp_param_);
+  }
+  if (from._internal_has_loss_param()) {
+    _this->_impl_.loss_param_ = new ::caffe::LossParameter(*from._impl_.loss_param_);
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:caffe.V1LayerParameter)
+}
+
+inline void V1LayerParameter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bottom_){arena}
+    , decltype(_impl_.top_){arena}
+    , decltype(_impl_.blobs_){arena}
+    , decltype(_impl_.blobs_lr_){arena}
+    , decltype(_impl_.weight_decay_){arena}
+    , decltype(_impl_.include_){arena}
+    , decltype(_impl_.exclude_){arena}
+    , decltype(_impl_.loss_weight_){arena}
+    , decltype(_impl_.param_){arena}
+    , decltype(_impl_.blob_share_mode_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.concat_param_){nullptr}
+    , decltype(_impl_.convolution_param_){nullptr}
+    , decltype(_impl_.dropout_param_){nullptr}
+    , decltype(_impl_.inner_product_param_){nullptr}
+    , decltype(_impl_.lrn_param_){nullptr}
+    , decltype(_impl_.pooling_param_){nullptr}
+    , decltype(_impl_.power_param_){nullptr}
+    , decltype(_impl_.eltwise_param_){nullptr}
+    , decltype(_impl_.threshold_param_){nullptr}
+    , decltype(_impl_.relu_param_){nullptr}
+    , decltype(_impl_.slice_param_){nullptr}
+    , decltype(_impl_.mvn_param_){nullptr}
+    , decltype(_impl_.tanh_param_){nullptr}
+    , decltype(_impl_.sigmoid_param_){nullptr}
+    , decltype(_impl_.softmax_param_){nullptr}
+    , decltype(_impl_.exp_param_){nullptr}
+    , decltype(_impl_.loss_param_){nullptr}
+    , decltype(_impl_.type_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+V1LayerParameter::~V1LayerParameter() {
+  // @@protoc_insertion_point(destructor:caffe.V1LayerParameter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void V1LayerParameter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bottom_.~RepeatedPtrField();
+  _impl_.top_.~RepeatedPtrField();
+  _impl_.blobs_.~RepeatedPtrField();
+  _impl_.blobs_lr_.~RepeatedField();
+  _impl_.weight_decay_.~RepeatedField();
+  _impl_.include_.~RepeatedPtrField();
+  _impl_.exclude_.~RepeatedPtrField();
+  _impl_.loss_weight_.~RepeatedField();
+  _impl_.param_.~RepeatedPtrField();
+  _impl_.blob_share_mode_.~RepeatedField();
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.concat_param_;
+  if (this != internal_default_instance()) delete _impl_.convolution_param_;
+  if (this != internal_default_instance()) delete _impl_.dropout_param_;
+  if (this != internal_default_instance()) delete _impl_.inner_product_param_;
+  if (this != internal_default_instance()) delete _impl_.lrn_param_;
+  if (this != internal_default_instance()) delete _impl_.pooling_param_;
+  if (this != internal_default_instance()) delete _impl_.power_param_;
+  if (this != internal_default_instance()) delete _impl_.eltwise_param_;
+  if (this != internal_default_instance()) delete _impl_.threshold_param_;
+  if (this != internal_default_instance()) delete _impl_.relu_param_;
+  if (this != internal_default_instance()) delete _impl_.slice_param_;
+  if (this != internal_default_instance()) delete _impl_.mvn_param_;
+  if (this != internal_default_instance()) delete _impl_.tanh_param_;
+  if (this != internal_default_instance()) delete _impl_.sigmoid_param_;
+  if (this != internal_default_instance()) delete _impl_.softmax_param_;
+  if (this != internal_default_instance()) delete _impl_.exp_param_;
+  if (this != internal_default_instance()) delete _impl_.loss_param_;
+}
+
+void V1LayerParameter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void V1LayerParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:caffe.V1LayerParameter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bottom_.Clear();
+  _impl_.top_.Clear();
+  _impl_.blobs_.Clear();
+  _impl_.blobs_lr_.Clear();
+  _impl_.weight_decay_.Clear();
+  _impl_.include_.Clear();
+  _impl_.exclude_.Clear();
+  _impl_.loss_weight_.Clear();
+  _impl_.param_.Clear();
+  _impl_.blob_share_mode_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.concat_param_ != nullptr);
+      _impl_.concat_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.convolution_param_ != nullptr);
+      _impl_.convolution_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.dropout_param_ != nullptr);
+      _impl_.dropout_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.inner_product_param_ != nullptr);
+      _impl_.inner_product_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.lrn_param_ != nullptr);
+      _impl_.lrn_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.pooling_param_ != nullptr);
+      _impl_.pooling_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.power_param_ != nullptr);
+      _impl_.power_param_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.eltwise_param_ != nullptr);
+      _impl_.eltwise_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.threshold_param_ != nullptr);
+      _impl_.threshold_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      GOOGLE_DCHECK(_impl_.relu_param_ != nullptr);
+      _impl_.relu_param_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      GOOGLE_DCHECK(_impl_.slice_param_ != nullptr);
+      _impl_.slice_param_->Clear();
+    }
+    if (cached_has_bits & 0x00001000u) {
+      GOOGLE_DCHECK(_impl_.mvn_param_ != nullptr);
+      _impl_.mvn_param_->Clear();
+    }
+    if (cached_has_bits & 0x00002000u) {
+      GOOGLE_DCHECK(_impl_.tanh_param_ != nullptr);
+      _impl_.tanh_param_->Clear();
+    }
+    if (cached_has_bits & 0x00004000u) {
+      GOOGLE_DCHECK(_impl_.sigmoid_param_ != nullptr);
+      _impl_.sigmoid_param_->Clear();
+    }
+    if (cached_has_bits & 0x00008000u) {
+      GOOGLE_DCHECK(_impl_.softmax_param_ != nullptr);
+      _impl_.softmax_param_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00030000u) {
+    if (cached_has_bits & 0x00010000u) {
+      GOOGLE_DCHECK(_impl_.exp_param_ != nullptr);
+      _impl_.exp_param_->Clear();
+    }
+    if (cached_has_bits & 0x00020000u) {
+      GOOGLE_DCHECK(_impl_.loss_param_ != nullptr);
+      _impl_.loss_param_->Clear();
+    }
+  }
+  _impl_.type_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* V1LayerParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string bottom = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_bottom();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "caffe.V1LayerParameter.bottom");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string top = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_top();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "caffe.V1LayerParameter.top");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "caffe.V1LayerParameter.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.V1LayerParameter.LayerType type = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::caffe::V1LayerParameter_LayerType_IsValid(val))) {
+            _internal_set_type(static_cast<::caffe::V1LayerParameter_LayerType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(5, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.BlobProto blobs = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_blobs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float blobs_lr = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_blobs_lr(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<61>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 58) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_blobs_lr(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float weight_decay = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_weight_decay(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<69>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 66) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_weight_decay(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ConcatParameter concat_param = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_concat_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ConvolutionParameter convolution_param = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_convolution_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.DropoutParameter dropout_param = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_dropout_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.InnerProductParameter inner_product_param = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_inner_product_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.LRNParameter lrn_param = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_lrn_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PoolingParameter pooling_param = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pooling_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.PowerParameter power_param = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr = ctx->ParseMessage(_internal_mutable_power_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.EltwiseParameter eltwise_param = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          ptr = ctx->ParseMessage(_internal_mutable_eltwise_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ThresholdParameter threshold_param = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 202)) {
+          ptr = ctx->ParseMessage(_internal_mutable_threshold_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ReLUParameter relu_param = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
+          ptr = ctx->ParseMessage(_internal_mutable_relu_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SliceParameter slice_param = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 250)) {
+          ptr = ctx->ParseMessage(_internal_mutable_slice_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.NetStateRule include = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_include(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<258>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.NetStateRule exclude = 33;
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_exclude(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<266>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.MVNParameter mvn_param = 34;
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mvn_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float loss_weight = 35;
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_loss_weight(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<285>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_loss_weight(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.TanHParameter tanh_param = 37;
+      case 37:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tanh_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SigmoidParameter sigmoid_param = 38;
+      case 38:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sigmoid_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.SoftmaxParameter softmax_param = 39;
+      case 39:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_softmax_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.ExpParameter exp_param = 41;
+      case 41:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_exp_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .caffe.LossParameter loss_param = 42;
+      case 42:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_loss_param(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string param = 1001;
+      case 1001:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_param();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "caffe.V1LayerParameter.param");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8010>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .caffe.V1LayerParameter.DimCheckMode blob_share_mode = 1002;
+      case 1002:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+            CHK_(ptr);
+            if (PROTOBUF_PREDICT_TRUE(::caffe::V1LayerParameter_DimCheckMode_IsValid(val))) {
+              _internal_add_blob_share_mode(static_cast<::caffe::V1LayerParameter_DimCheckMode>(val));
+            } else {
+              ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1002, val, mutable_unknown_fields());
+            }
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8016>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 82) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(_internal_mutable_blob_share_mode(), ptr, ctx, ::caffe::V1LayerParameter_DimCheckMode_IsValid, &_internal_metadata_, 1002);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* V1LayerParameter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:caffe.V1LayerParameter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string bottom = 2;
+  for (int i = 0, n = this->_internal_bottom_size(); i < n; i++) {
+    const auto& s = this->_internal_bottom(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.V1LayerParameter.bottom");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // repeated string top = 3;
+  for (int i = 0, n = this->_internal_top_size(); i < n; i++) {
+    const auto& s = this->_internal_top(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.V1LayerParameter.top");
+    target = stream->WriteString(3, s, target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 4;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.V1LayerParameter.name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_name(), target);
+  }
+
+  // optional .caffe.V1LayerParameter.LayerType type = 5;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_type(), target);
+  }
+
+  // repeated .caffe.BlobProto blobs = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blobs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blobs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated float blobs_lr = 7;
+  for (int i = 0, n = this->_internal_blobs_lr_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_blobs_lr(i), target);
+  }
+
+  // repeated float weight_decay = 8;
+  for (int i = 0, n = this->_internal_weight_decay_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_weight_decay(i), target);
+  }
+
+  // optional .caffe.ConcatParameter concat_param = 9;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::concat_param(this),
+        _Internal::concat_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ConvolutionParameter convolution_param = 10;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::convolution_param(this),
+        _Internal::convolution_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.DropoutParameter dropout_param = 12;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::dropout_param(this),
+        _Internal::dropout_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.InnerProductParameter inner_product_param = 17;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, _Internal::inner_product_param(this),
+        _Internal::inner_product_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.LRNParameter lrn_param = 18;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::lrn_param(this),
+        _Internal::lrn_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.PoolingParameter pooling_param = 19;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, _Internal::pooling_param(this),
+        _Internal::pooling_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.PowerParameter power_param = 21;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(21, _Internal::power_param(this),
+        _Internal::power_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.EltwiseParameter eltwise_param = 24;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(24, _Internal::eltwise_param(this),
+        _Internal::eltwise_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ThresholdParameter threshold_param = 25;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(25, _Internal::threshold_param(this),
+        _Internal::threshold_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ReLUParameter relu_param = 30;
+  if (cached_has_bits & 0x00000400u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(30, _Internal::relu_param(this),
+        _Internal::relu_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.SliceParameter slice_param = 31;
+  if (cached_has_bits & 0x00000800u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(31, _Internal::slice_param(this),
+        _Internal::slice_param(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .caffe.NetStateRule include = 32;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_include_size()); i < n; i++) {
+    const auto& repfield = this->_internal_include(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(32, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .caffe.NetStateRule exclude = 33;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_exclude_size()); i < n; i++) {
+    const auto& repfield = this->_internal_exclude(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(33, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.MVNParameter mvn_param = 34;
+  if (cached_has_bits & 0x00001000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(34, _Internal::mvn_param(this),
+        _Internal::mvn_param(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated float loss_weight = 35;
+  for (int i = 0, n = this->_internal_loss_weight_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(35, this->_internal_loss_weight(i), target);
+  }
+
+  // optional .caffe.TanHParameter tanh_param = 37;
+  if (cached_has_bits & 0x00002000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(37, _Internal::tanh_param(this),
+        _Internal::tanh_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.SigmoidParameter sigmoid_param = 38;
+  if (cached_has_bits & 0x00004000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(38, _Internal::sigmoid_param(this),
+        _Internal::sigmoid_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.SoftmaxParameter softmax_param = 39;
+  if (cached_has_bits & 0x00008000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(39, _Internal::softmax_param(this),
+        _Internal::softmax_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.ExpParameter exp_param = 41;
+  if (cached_has_bits & 0x00010000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(41, _Internal::exp_param(this),
+        _Internal::exp_param(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .caffe.LossParameter loss_param = 42;
+  if (cached_has_bits & 0x00020000u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(42, _Internal::loss_param(this),
+        _Internal::loss_param(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated string param = 1001;
+  for (int i = 0, n = this->_internal_param_size(); i < n; i++) {
+    const auto& s = this->_internal_param(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "caffe.V1LayerParameter.param");
+    target = stream->WriteString(1001, s, target);
+  }
+
+  // repeated .caffe.V1LayerParameter.DimCheckMode blob_share_mode = 1002;
+  for (int i = 0, n = this->_internal_blob_share_mode_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        1002, this->_internal_blob_share_mode(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:caffe.V1LayerParameter)
+  return target;
+}
+
+size_t V1LayerParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:caffe.V1LayerParameter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string bottom = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.bottom_.size());
+  for (int i = 0, n = _impl_.bottom_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.bottom_.Get(i));
+  }
+
+  // repeated string top = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.top_.size());
+  for (int i = 0, n = _impl_.top_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.top_.Get(i));
+  }
+
+  // repeated .caffe.BlobProto blobs = 6;
+  total_size += 1UL * this->_internal_blobs_size();
+  for (const auto& msg : this->_impl_.blobs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated float blobs_lr = 7;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_blobs_lr_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_blobs_lr_size());
+    total_size += data_size;
+  }
+
+  // repeated float weight_decay = 8;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_weight_decay_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_weight_decay_size());
+    total_size += data_size;
+  }
+
+  // repeated .caffe.NetStateRule include = 32;
+  total_size += 2UL * this->_internal_include_size();
+  for (const auto& msg : this->_impl_.include_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .caffe.NetStateRule exclude = 33;
+  total_size += 2UL * this->_internal_exclude_size();
+  for (const auto& msg : this->_impl_.exclude_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated float loss_weight = 35;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_loss_weight_size());
+    size_t data_size = 4UL * count;
+    total_size += 2 *
+                  ::_pbi::FromIntSize(this->_internal_loss_weight_size());
+    total_size += data_size;
+  }
+
+  // repeated string param = 1001;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.param_.size());
+  for (int i = 0, n = _impl_.param_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.param_.Get(i));
+  }
+
+  // repeated .caffe.V1LayerParameter.DimCheckMode blob_share_mode = 1002;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_blob_share_mode_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_blob_share_mode(static_cast<int>(i)));
+    }
+    total_size += (2UL * count) + data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string name = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional .caffe.ConcatParameter concat_param = 9;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.concat_param_);
+    }
+
+    // optional .caffe.ConvolutionParameter convolution_param = 10;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.convolution_param_);
+    }
+
+    // optional .caffe.DropoutParameter dropout_param = 12;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.dropout_param_);
+    }
+
+    // optional .caffe.InnerProductParameter inner_product_param = 17;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.inner_product_param_);
+    }
+
+    // optional .caffe.LRNParameter lrn_param = 18;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.lrn_param_);
+    }
+
+    // optional .caffe.PoolingParameter pooling_param = 19;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pooling_param_);
+    }
+
+    // optional .caffe.PowerParameter power_param = 21;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.power_param_);
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional .caffe.EltwiseParameter eltwise_param = 24;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.eltwise_param_);
+    }
+
+    // optional .caffe.ThresholdParameter threshold_param = 25;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.threshold_param_);
+    }
+
+    // optional .caffe.ReLUParameter relu_param = 30;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.relu_param_);
+    }
+
+    // optional .caffe.SliceParameter slice_param = 31;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.slice_param_);
+    }
+
+    // optional .caffe.MVNParameter mvn_param = 34;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.mvn_param_);
+    }
+
+    // optional .caffe.TanHParameter tanh_param = 37;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.tanh_param_);
+    }
+
+    // optional .caffe.SigmoidParameter sigmoid_param = 38;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.sigmoid_param_);
+    }
+
+    // optional .caffe.SoftmaxParameter softmax_param = 39;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.softmax_param_);
+    }
+
+  }
+  if (cached_has_bits & 0x00070000u) {
+    // optional .caffe.ExpParameter exp_param = 41;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.exp_param_);
+    }
+
+    // optional .caffe.LossParameter loss_param = 42;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.loss_param_);
+    }
+
+    // optional .caffe.V1LayerParameter.LayerType type = 5;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData V1LayerParameter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    V1LayerParameter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*V1LayerParameter::GetClassData() const { return &_class_data_; }
+
+
+void V1LayerParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<V1LayerParameter*>(&to_msg);
+  auto& from = static_cast<const V1LayerParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:caffe.V1LayerParameter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bottom_.MergeFrom(from._impl_.bottom_);
+  _this->_impl_.top_.MergeFrom(from._impl_.top_);
+  _this->_impl_.blobs_.MergeFrom(from._impl_.blobs_);
+  _this->_impl_.blobs_lr_.MergeFrom(from._impl_.blobs_lr_);
+  _this->_impl_.weight_decay_.MergeFrom(from._impl_.weight_decay_);
+  _this->_impl_.include_.MergeFrom(from._impl_.include_);
+  _this->_impl_.exclude_.MergeFrom(from._impl_.exclude_);
+  _this->_impl_.loss_weight_.MergeFrom(from._impl_.loss_weight_);
+  _this->_impl_.param_.MergeFrom(from._impl_.param_);
+  _this->_impl_.blob_share_mode_.MergeFrom(from._impl_.blob_share_mode_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_concat_param()->::caffe::ConcatParameter::MergeFrom(
+          from._internal_concat_param());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_convolution_param()->::caffe::ConvolutionParameter::MergeFrom(
+          from._internal_convolution_param());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_dropout_param()->::caffe::DropoutParameter::MergeFrom(
+          from._internal_dropout_param());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_inner_product_param()->::caffe::InnerProductParameter::MergeFrom(
+          from._internal_inner_product_param());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_lrn_param()->::caffe::LRNParameter::MergeFrom(
+          from._internal_lrn_param());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_pooling_param()->::caffe::PoolingParameter::MergeFrom(
+          from._internal_pooling_param());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_power_param()->::caffe::PowerParameter::MergeFrom(
+          from._internal_power_param());
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_eltwise_param()->::caffe::EltwiseParameter::MergeFrom(
+          from._internal_eltwise_param());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_threshold_param()->::caffe::ThresholdParameter::MergeFrom(
+          from._internal_threshold_param());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_internal_mutable_relu_param()->::caffe::ReLUParameter::MergeFrom(
+          from._internal_relu_param());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_internal_mutable_slice_param()->::caffe::SliceParameter::MergeFrom(
+          from._internal_slice_param());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_internal_mutable_mvn_param()->::caffe::MVNParameter::MergeFrom(
+          from._internal_mvn_param());
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_internal_mutable_tanh_param()->::caffe::TanHParameter::MergeFrom(
+          from._internal_tanh_param());
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_internal_mutable_sigmoid_param()->::caffe::SigmoidParameter::MergeFrom(
+          from._internal_sigmoid_param());
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_internal_mutable_softmax_param()->::caffe::SoftmaxParameter::MergeFrom(
+          from._internal_softmax_param());
+    }
+  }
+  if (cached_has_bits & 0x00070000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_internal_mutable_exp_param()->::caffe::ExpParameter::MergeFrom(
+          from._internal_exp_param());
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_internal_mutable_loss_param()->::caffe::LossParameter::MergeFrom(
+          from._internal_loss_param());
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void V1LayerParameter::CopyFrom(const V1LayerParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:caffe.V1LayerParameter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool V1LayerParameter::IsInitialized() const {
+  return true;
+}
+
+void V1LayerParameter::InternalSwap(V1LayerParameter* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.bottom_.InternalSwap(&other->_impl_.bottom_);
+  _impl_.top_.InternalSwap(&other->_impl_.top_);
+  _impl_.blobs_.InternalSwap(&other->_impl_.blobs_);
+  _impl_.blobs_lr_.InternalSwap(&other->_impl_.blobs_lr_);
+  _impl_.weight_decay_.InternalSwap(&other->_impl_.weight_decay_);
+  _impl_.include_.InternalSwap(&other->_impl_.include_);
+  _impl_.exclude_.InternalSwap(&other->_impl_.exclude_);
+  _impl_.loss_weight_.InternalSwap(&other->_impl_.loss_weight_);
+  _impl_.param_.InternalSwap(&other->_impl_.param_);
+  _impl_.blob_share_mode_.InternalSwap(&other->_impl_.blob_share_mode_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(V1LayerParameter, _impl_.type_)
+      + sizeof(V1LayerParameter::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(V1LayerParameter, _impl_.concat_param_)>(
+          reinterpret_cast<char*>(&_impl_.concat_param_),
+          reinterpret_cast<char*>(&other->_impl_.concat_param_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata V1LayerParameter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_caffe_2eproto_getter, &descriptor_table_caffe_2eproto_once,
+      file_level_metadata_caffe_2eproto[56]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace caffe
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::caffe::BlobShape*
+Arena::CreateMaybeMessage< ::caffe::BlobShape >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::BlobShape >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::BlobProto*
+Arena::CreateMaybeMessage< ::caffe::BlobProto >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::BlobProto >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::BlobProtoVector*
+Arena::CreateMaybeMessage< ::caffe::BlobProtoVector >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::BlobProtoVector >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::NormalizedBBox*
+Arena::CreateMaybeMessage< ::caffe::NormalizedBBox >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::NormalizedBBox >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::FillerParameter*
+Arena::CreateMaybeMessage< ::caffe::FillerParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::FillerParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::NetParameter*
+Arena::CreateMaybeMessage< ::caffe::NetParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::NetParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::NetState*
+Arena::CreateMaybeMessage< ::caffe::NetState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::NetState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::NetStateRule*
+Arena::CreateMaybeMessage< ::caffe::NetStateRule >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::NetStateRule >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ParamSpec*
+Arena::CreateMaybeMessage< ::caffe::ParamSpec >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ParamSpec >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::LayerParameter*
+Arena::CreateMaybeMessage< ::caffe::LayerParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::LayerParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::LossParameter*
+Arena::CreateMaybeMessage< ::caffe::LossParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::LossParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ArgMaxParameter*
+Arena::CreateMaybeMessage< ::caffe::ArgMaxParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ArgMaxParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ConcatParameter*
+Arena::CreateMaybeMessage< ::caffe::ConcatParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ConcatParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::BatchNormParameter*
+Arena::CreateMaybeMessage< ::caffe::BatchNormParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::BatchNormParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::BiasParameter*
+Arena::CreateMaybeMessage< ::caffe::BiasParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::BiasParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::BNParameter*
+Arena::CreateMaybeMessage< ::caffe::BNParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::BNParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ConvolutionParameter*
+Arena::CreateMaybeMessage< ::caffe::ConvolutionParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ConvolutionParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::CropParameter*
+Arena::CreateMaybeMessage< ::caffe::CropParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::CropParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::DropoutParameter*
+Arena::CreateMaybeMessage< ::caffe::DropoutParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::DropoutParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::EltwiseParameter*
+Arena::CreateMaybeMessage< ::caffe::EltwiseParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::EltwiseParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ELUParameter*
+Arena::CreateMaybeMessage< ::caffe::ELUParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ELUParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::EmbedParameter*
+Arena::CreateMaybeMessage< ::caffe::EmbedParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::EmbedParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ExpParameter*
+Arena::CreateMaybeMessage< ::caffe::ExpParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ExpParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::FlattenParameter*
+Arena::CreateMaybeMessage< ::caffe::FlattenParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::FlattenParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::InnerProductParameter*
+Arena::CreateMaybeMessage< ::caffe::InnerProductParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::InnerProductParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::InputParameter*
+Arena::CreateMaybeMessage< ::caffe::InputParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::InputParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::LogParameter*
+Arena::CreateMaybeMessage< ::caffe::LogParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::LogParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::LRNParameter*
+Arena::CreateMaybeMessage< ::caffe::LRNParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::LRNParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::MVNParameter*
+Arena::CreateMaybeMessage< ::caffe::MVNParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::MVNParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ParameterParameter*
+Arena::CreateMaybeMessage< ::caffe::ParameterParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ParameterParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::PoolingParameter*
+Arena::CreateMaybeMessage< ::caffe::PoolingParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::PoolingParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::PowerParameter*
+Arena::CreateMaybeMessage< ::caffe::PowerParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::PowerParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::PReLUParameter*
+Arena::CreateMaybeMessage< ::caffe::PReLUParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::PReLUParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ProposalParameter*
+Arena::CreateMaybeMessage< ::caffe::ProposalParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ProposalParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::PSROIPoolingParameter*
+Arena::CreateMaybeMessage< ::caffe::PSROIPoolingParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::PSROIPoolingParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::QuantizationParameter*
+Arena::CreateMaybeMessage< ::caffe::QuantizationParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::QuantizationParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ReductionParameter*
+Arena::CreateMaybeMessage< ::caffe::ReductionParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ReductionParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ReLUParameter*
+Arena::CreateMaybeMessage< ::caffe::ReLUParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ReLUParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ReorderParameter*
+Arena::CreateMaybeMessage< ::caffe::ReorderParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ReorderParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ReshapeParameter*
+Arena::CreateMaybeMessage< ::caffe::ReshapeParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ReshapeParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ROIPoolingParameter*
+Arena::CreateMaybeMessage< ::caffe::ROIPoolingParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ROIPoolingParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ScaleParameter*
+Arena::CreateMaybeMessage< ::caffe::ScaleParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ScaleParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::SigmoidParameter*
+Arena::CreateMaybeMessage< ::caffe::SigmoidParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::SigmoidParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::SliceParameter*
+Arena::CreateMaybeMessage< ::caffe::SliceParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::SliceParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::SoftmaxParameter*
+Arena::CreateMaybeMessage< ::caffe::SoftmaxParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::SoftmaxParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::TanHParameter*
+Arena::CreateMaybeMessage< ::caffe::TanHParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::TanHParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::TileParameter*
+Arena::CreateMaybeMessage< ::caffe::TileParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::TileParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ThresholdParameter*
+Arena::CreateMaybeMessage< ::caffe::ThresholdParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ThresholdParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::SPPParameter*
+Arena::CreateMaybeMessage< ::caffe::SPPParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::SPPParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::NonMaximumSuppressionParameter*
+Arena::CreateMaybeMessage< ::caffe::NonMaximumSuppressionParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::NonMaximumSuppressionParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::SaveOutputParameter*
+Arena::CreateMaybeMessage< ::caffe::SaveOutputParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::SaveOutputParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::DetectionOutputParameter*
+Arena::CreateMaybeMessage< ::caffe::DetectionOutputParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::DetectionOutputParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::PermuteParameter*
+Arena::CreateMaybeMessage< ::caffe::PermuteParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::PermuteParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::PriorBoxParameter*
+Arena::CreateMaybeMessage< ::caffe::PriorBoxParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::PriorBoxParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::ShuffleChannelParameter*
+Arena::CreateMaybeMessage< ::caffe::ShuffleChannelParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::ShuffleChannelParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::NormalizeParameter*
+Arena::CreateMaybeMessage< ::caffe::NormalizeParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::NormalizeParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::caffe::V1LayerParameter*
+Arena::CreateMaybeMessage< ::caffe::V1LayerParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::caffe::V1LayerParameter >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <sstream>
 #include <iomanip>
 #include "./common.hpp"
@@ -24,8 +25,22 @@ static void CaffeFreeDevice(MemBlock block) {
   MemoryPool::Get()->ReturnGPU(block);
 }
 
+SyncedMemory::SyncedMemory(void* ptr, size_t size,
+                           const std::shared_ptr<void>& owner)
+    : cpu_block_(), gpu_block_(), size_(size), head_(HEAD_AT_CPU),
+      version_(NextVersion()), owner_(owner) {
+  CHECK(ptr);
+  cpu_block_.size = size;
+  cpu_block_.ptr = ptr;
+}
+
+uint64_t SyncedMemory::NextVersion() {
+  static std::atomic<uint64_t> next_version(0);
+  return ++next_version;
+}
+
 SyncedMemory::~SyncedMemory() {
-  if (cpu_block_.ptr) {
+  if (cpu_block_.ptr && !owner_) {
     CaffeFreeHost(cpu_block_);
     cpu_block_.ptr = nullptr;
   }
@@ -106,6 +121,7 @@ const void* SyncedMemory::gpu_data() {
 void* SyncedMemory::mutable_cpu_data() {
   to_cpu();
   head_ = HEAD_AT_CPU;
+  version_ = NextVersion();
   return cpu_block_.ptr;
 }
 
@@ -113,6 +129,7 @@ void* SyncedMemory::mutable_gpu_data() {
 #ifdef USE_CUDA
   to_gpu();
   head_ = HEAD_AT_GPU;
+  version_ = NextVersion();
   return gpu_block_.ptr;
 #else
   NO_GPU;
@@ -1,8 +1,11 @@
 #ifndef CAFFE_SYNCEDMEM_HPP_
 #define CAFFE_SYNCEDMEM_HPP_
 
+#include <stdint.h>
+
 #include <cstdlib>
 #include <map>
+#include <memory>
 #include "./common.hpp"
 #include "./thread_local.hpp"
 
@@ -77,7 +80,13 @@ class MemoryPool {
 class SyncedMemory {
  public:
   explicit SyncedMemory(size_t size)
-      : cpu_block_(), gpu_block_(), size_(size), head_(UNINITIALIZED) {}
+      : cpu_block_(), gpu_block_(), size_(size), head_(UNINITIALIZED),
+        version_(NextVersion()) {}
+  /*!
+   * \brief wrap size bytes of CPU memory not from the pool, like a mapped
+   *  file, owner keeps it alive as long as this
+   */
+  SyncedMemory(void* ptr, size_t size, const std::shared_ptr<void>& owner);
   ~SyncedMemory();
   const void* cpu_data();
   const void* gpu_data();
@@ -86,14 +95,23 @@ class SyncedMemory {
   enum SyncedHead { UNINITIALIZED, HEAD_AT_CPU, HEAD_AT_GPU, SYNCED };
   SyncedHead head() { return head_; }
   size_t size() { return size_; }
+  /*!
+   * \brief changes on every mutable access, unique among all SyncedMemory,
+   *  so data derived from the memory knows when to derive it again
+   */
+  uint64_t version() const { return version_; }
 
  private:
   void to_cpu();
   void to_gpu();
+  static uint64_t NextVersion();
   MemoryPool::MemBlock cpu_block_;
   MemoryPool::MemBlock gpu_block_;
   size_t size_;
   SyncedHead head_;
+  uint64_t version_;
+  /*! \brief owner of the CPU memory if it doesn't come from the pool */
+  std::shared_ptr<void> owner_;
 
   DISABLE_COPY_AND_ASSIGN(SyncedMemory);
 };  // class SyncedMemory
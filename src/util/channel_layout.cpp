@@ -0,0 +1,175 @@
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../layer.hpp"
+#include "channel_layout.hpp"
+
+using namespace std;
+
+namespace caffe {
+
+ChannelLayout::ChannelLayout(const NetParameter& param, int block)
+    : block_(block), blocks_(param.layer_size(), -1),
+      plain_bottoms_(param.layer_size(), false), layers_left_(param.layer_size()) {
+  CHECK(block == 4 || block == 8 || block == 16)
+      << "channel_block is 4, 8 or 16, not " << block;
+  for (int i = 0; i < param.layer_size(); ++i) {
+    const LayerParameter& layer_param = param.layer(i);
+    names_.insert(layer_param.bottom().begin(), layer_param.bottom().end());
+    names_.insert(layer_param.top().begin(), layer_param.top().end());
+  }
+}
+
+int ChannelLayout::Plan(NetParameter* param, int layer_id, const Layer& layer,
+                        const BlobLookup& blob) {
+  if (blocks_[layer_id] >= 0) {
+    return 0;
+  }
+  const LayerParameter layer_param = param->layer(layer_id);
+  const int num_bottom = layer_param.bottom_size();
+  // the layout of the layer, from what its bottoms can be
+  bool all_can_block = num_bottom > 0;
+  bool any_blocked = false;
+  int in_place = -1;
+  vector<const Blob*> bottoms(num_bottom);
+  for (int j = 0; j < num_bottom; ++j) {
+    map<string, Version>::const_iterator it =
+        versions_.find(layer_param.bottom(j));
+    const Blob* bottom = it == versions_.end() ? NULL : blob(it->second.name);
+    bottoms[j] = bottom;
+    all_can_block = all_can_block && bottom && bottom->num_axes() == 4 &&
+                    bottom->channels() % block_ == 0;
+    any_blocked = any_blocked || (bottom && it->second.block != 0);
+    if (in_place < 0 && j < layer_param.top_size() &&
+        layer_param.top(j) == layer_param.bottom(j)) {
+      in_place = j;
+    }
+  }
+  int block = 0;
+  bool plain_bottoms = false;
+  if (layer.IsLayoutAgnostic()) {
+    // in-place layers keep the layout the blob has
+    const bool blocked = in_place >= 0
+        ? versions_[layer_param.bottom(in_place)].block != 0 : any_blocked;
+    block = blocked && all_can_block ? block_ : 0;
+  } else if (layer.AcceptsChannelBlock(block_, bottoms)) {
+    plain_bottoms = !all_can_block;
+    block = !plain_bottoms || (num_bottom > 0 && layer.AcceptsPlainBottoms())
+        ? block_ : 0;
+  }
+  const int bottom_block = plain_bottoms ? 0 : block;
+  // copies of the bottoms that come in another layout
+  int inserted = 0;
+  vector<string> bottom_names(num_bottom);
+  for (int j = 0; j < num_bottom; ++j) {
+    const string& name = layer_param.bottom(j);
+    map<string, Version>::const_iterator it = versions_.find(name);
+    if (it == versions_.end()) {
+      // unknown, Net::AppendBottom tells
+      bottom_names[j] = name;
+      continue;
+    }
+    if (it->second.block != bottom_block) {
+      InsertReorder(param, layer_id + inserted++, name, bottom_block);
+    }
+    bottom_names[j] = versions_[name].name;
+    outputs_.erase(name);
+  }
+  LayerParameter* planned_param = param->mutable_layer(layer_id + inserted);
+  for (int j = 0; j < num_bottom; ++j) {
+    planned_param->set_bottom(j, bottom_names[j]);
+  }
+  for (int j = 0; j < layer_param.top_size(); ++j) {
+    const string& name = layer_param.top(j);
+    Version& version = versions_[name];
+    if (j < num_bottom && name == layer_param.bottom(j)) {
+      version.name = bottom_names[j];
+    } else {
+      version.name = block ? NewBlobName(name, block) : name;
+      created_.insert(version.name);
+    }
+    version.block = block;
+    planned_param->set_top(j, version.name);
+    outputs_.insert(name);
+  }
+  blocks_[layer_id + inserted] = block;
+  plain_bottoms_[layer_id + inserted] = plain_bottoms && block != 0;
+  if (--layers_left_ == 0) {
+    // every blob of the net description ends NCHW under its own name, the
+    // blocked ones are copied back after the last layer
+    for (map<string, Version>::iterator it = versions_.begin();
+         it != versions_.end(); ++it) {
+      if (it->second.block != 0) {
+        InsertReorder(param, param->layer_size(), it->first, 0);
+        if (!outputs_.count(it->first)) {
+          copies_.insert(it->second.name);
+        }
+      }
+    }
+  }
+  return inserted;
+}
+
+map<string, string> ChannelLayout::BlobNames() const {
+  map<string, string> blob_names;
+  for (map<string, Version>::const_iterator it = versions_.begin();
+       it != versions_.end(); ++it) {
+    blob_names[it->first] = it->second.name;
+  }
+  return blob_names;
+}
+
+string ChannelLayout::NewBlobName(const string& name, int block) {
+  if (block == 0 && !created_.count(name)) {
+    created_.insert(name);
+    return name;
+  }
+  const string base = block ? ChannelBlockBlobName(name, block)
+                            : name + "_nchw";
+  string new_name = base;
+  for (int i = 1; names_.count(new_name); ++i) {
+    ostringstream numbered;
+    numbered << base << "_" << i;
+    new_name = numbered.str();
+  }
+  names_.insert(new_name);
+  created_.insert(new_name);
+  return new_name;
+}
+
+string ChannelLayout::InsertReorder(NetParameter* param, int layer_id,
+                                    const string& name, int block) {
+  Version& version = versions_[name];
+  const string top = NewBlobName(name, block);
+  ConfigureReorderLayer(version.name, version.block, top, block,
+                        param->add_layer());
+  for (int i = param->layer_size() - 1; i > layer_id; --i) {
+    param->mutable_layer()->SwapElements(i, i - 1);
+  }
+  blocks_.insert(blocks_.begin() + layer_id, 0);
+  plain_bottoms_.insert(plain_bottoms_.begin() + layer_id, false);
+  version.name = top;
+  version.block = block;
+  return top;
+}
+
+void ConfigureReorderLayer(const string& bottom, int bottom_block,
+    const string& top, int top_block, LayerParameter* reorder_layer_param) {
+  reorder_layer_param->Clear();
+  reorder_layer_param->set_name(top + "_reorder");
+  reorder_layer_param->set_type("Reorder");
+  reorder_layer_param->add_bottom(bottom);
+  reorder_layer_param->add_top(top);
+  ReorderParameter* reorder_param = reorder_layer_param->mutable_reorder_param();
+  reorder_param->set_bottom_channel_block(bottom_block);
+  reorder_param->set_top_channel_block(top_block);
+}
+
+string ChannelBlockBlobName(const string& blob_name, int block) {
+  ostringstream blocked_name;
+  blocked_name << blob_name << "_nchw" << block << "c";
+  return blocked_name.str();
+}
+
+}  // namespace caffe
@@ -0,0 +1,92 @@
+#ifndef _CAFFE_UTIL_CHANNEL_LAYOUT_HPP_
+#define _CAFFE_UTIL_CHANNEL_LAYOUT_HPP_
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../proto/caffe.pb.h"
+
+namespace caffe {
+
+class Blob;
+class Layer;
+
+// Plans which layers of a net run blocked in channels, see
+// NetParameter.channel_block, while Net::Init sets them up one by one. Layers
+// that accept the block run blocked when all their bottoms can be, or on
+// NCHW bottoms if they accept those, layout agnostic layers follow their
+// bottoms, the rest run NCHW. Reorder layers go in front of a layer for the
+// bottoms that come in another layout, and after the last layer for the
+// blobs that end blocked, so that every name of the net description is an
+// NCHW blob once Forward is done. Blobs that are blocked get names of their
+// own, see ChannelBlockBlobName.
+class ChannelLayout {
+ public:
+  // the blob of a name, or NULL if there is none
+  typedef std::function<const Blob*(const std::string& name)> BlobLookup;
+
+  ChannelLayout(const NetParameter& param, int block);
+
+  // Plans layer layer_id of param, layer being made of it, unless that was
+  // done. Renames its bottoms and tops to those of their layout and puts
+  // Reorder layers in front of it, which are planned already. Returns the
+  // number of them, layer_id is one of those then.
+  int Plan(NetParameter* param, int layer_id, const Layer& layer,
+           const BlobLookup& blob);
+  // the channel block layer layer_id runs with, once planned
+  int block(int layer_id) const { return blocks_[layer_id]; }
+  // whether its bottoms stay NCHW anyway, see Layer::AcceptsPlainBottoms
+  bool plain_bottoms(int layer_id) const { return plain_bottoms_[layer_id]; }
+  // once all layers are planned, the blob every name of the net description
+  // ends in, which is NCHW
+  std::map<std::string, std::string> BlobNames() const;
+  // the blobs copied back to NCHW that no layer reads, which are not outputs
+  // of the net
+  const std::set<std::string>& copies() const { return copies_; }
+
+ private:
+  // the blob written last under a name of the net description
+  struct Version {
+    std::string name;
+    int block;
+  };
+
+  // the name of a new blob from the one in the net description
+  std::string NewBlobName(const std::string& name, int block);
+  // adds a Reorder layer in front of layer_id to layout block of blob name,
+  // returns the name of the copy
+  std::string InsertReorder(NetParameter* param, int layer_id,
+                            const std::string& name, int block);
+
+  int block_;
+  // the channel block of every layer, -1 unless planned
+  std::vector<int> blocks_;
+  std::vector<bool> plain_bottoms_;
+  // the blobs of the net description by name
+  std::map<std::string, Version> versions_;
+  // every name a blob has or may get from the net description
+  std::set<std::string> names_;
+  // the names of the blobs planned so far
+  std::set<std::string> created_;
+  // names of the net description not used as bottom since written
+  std::set<std::string> outputs_;
+  // see copies()
+  std::set<std::string> copies_;
+  // layers of the net description not planned yet
+  int layers_left_;
+};
+
+// Configures a layer copying bottom of layout bottom_block to top of layout
+// top_block, 0 for NCHW.
+void ConfigureReorderLayer(const std::string& bottom, int bottom_block,
+    const std::string& top, int top_block, LayerParameter* reorder_layer_param);
+
+// The name of a blob blocked in channels of block, "conv1_nchw8c" for conv1.
+std::string ChannelBlockBlobName(const std::string& blob_name, int block);
+
+}  // namespace caffe
+
+#endif  // _CAFFE_UTIL_CHANNEL_LAYOUT_HPP_
@@ -0,0 +1,224 @@
+#include <stdint.h>
+
+#include <cstring>
+#include <fstream>  // NOLINT(readability/streams)
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "./flat_weights.hpp"
+#include "../syncedmem.hpp"
+
+namespace caffe {
+
+static const char kMagic[8] = { 'M', 'C', 'F', 'L', 'A', 'T', 'W', '\0' };
+static const uint32_t kVersion = 1;
+
+/*! \brief file mapped copy on write, the file itself is never written */
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+  char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+#ifdef WIN32
+  HANDLE file_;
+  HANDLE mapping_;
+#endif
+  char* data_;
+  size_t size_;
+
+  DISABLE_COPY_AND_ASSIGN(MappedFile);
+};
+
+#ifdef WIN32
+
+MappedFile::MappedFile(const std::string& filename)
+    : mapping_(NULL), data_(NULL), size_(0) {
+  file_ = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  CHECK(file_ != INVALID_HANDLE_VALUE) << "File not found: " << filename;
+  LARGE_INTEGER size;
+  CHECK(GetFileSizeEx(file_, &size)) << "Failed to stat " << filename;
+  size_ = static_cast<size_t>(size.QuadPart);
+  CHECK_GT(size_, 0) << "Empty file " << filename;
+  mapping_ = CreateFileMappingA(file_, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+  CHECK(mapping_ != NULL) << "Failed to map " << filename;
+  data_ = static_cast<char*>(MapViewOfFile(mapping_, FILE_MAP_COPY, 0, 0, 0));
+  CHECK(data_ != NULL) << "Failed to map " << filename;
+}
+
+MappedFile::~MappedFile() {
+  UnmapViewOfFile(data_);
+  CloseHandle(mapping_);
+  CloseHandle(file_);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filename)
+    : data_(NULL), size_(0) {
+  int fd = open(filename.c_str(), O_RDONLY);
+  CHECK_NE(fd, -1) << "File not found: " << filename;
+  struct stat st;
+  CHECK_EQ(fstat(fd, &st), 0) << "Failed to stat " << filename;
+  size_ = static_cast<size_t>(st.st_size);
+  CHECK_GT(size_, 0) << "Empty file " << filename;
+  void* data = mmap(NULL, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  CHECK(data != MAP_FAILED) << "Failed to map " << filename;
+  data_ = static_cast<char*>(data);
+}
+
+MappedFile::~MappedFile() {
+  munmap(data_, size_);
+}
+
+#endif  // WIN32
+
+/*! \brief read the table of a mapped file, checking it against its size */
+class TableReader {
+ public:
+  TableReader(const char* data, size_t size, const std::string& filename)
+      : data_(data), size_(size), pos_(0), filename_(filename) {}
+  void Read(void* out, size_t n) {
+    CHECK_LE(n, size_ - pos_) << "Truncated flat weight file " << filename_;
+    memcpy(out, data_ + pos_, n);
+    pos_ += n;
+  }
+  template <typename T>
+  T Read() {
+    T value;
+    Read(&value, sizeof(T));
+    return value;
+  }
+
+ private:
+  const char* data_;
+  size_t size_;
+  size_t pos_;
+  const std::string& filename_;
+};
+
+bool IsFlatWeightsFile(const std::string& filename) {
+  std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+  char magic[sizeof(kMagic)];
+  return in.read(magic, sizeof(magic)) &&
+         memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+std::vector<FlatLayer> ReadFlatWeights(const std::string& filename) {
+  std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>(filename);
+  TableReader reader(file->data(), file->size(), filename);
+  char magic[sizeof(kMagic)];
+  reader.Read(magic, sizeof(magic));
+  CHECK_EQ(memcmp(magic, kMagic, sizeof(kMagic)), 0)
+      << filename << " is not a flat weight file";
+  const uint32_t version = reader.Read<uint32_t>();
+  CHECK_EQ(version, kVersion) << "Unsupported flat weight file " << filename;
+  std::vector<FlatLayer> layers(reader.Read<uint32_t>());
+  for (FlatLayer& layer : layers) {
+    layer.name.resize(reader.Read<uint32_t>());
+    reader.Read(&layer.name[0], layer.name.size());
+    layer.blobs.resize(reader.Read<uint32_t>());
+    for (shared_ptr<Blob>& blob : layer.blobs) {
+      std::vector<int> shape(reader.Read<uint32_t>());
+      for (int& dim : shape) {
+        dim = reader.Read<int32_t>();
+      }
+      blob = std::make_shared<Blob>(shape);
+      const uint64_t offset = reader.Read<uint64_t>();
+      const size_t size = blob->count() * sizeof(real_t);
+      CHECK(offset % kFlatWeightsAlignment == 0 && offset <= file->size() &&
+            size <= file->size() - offset)
+          << "Invalid blob of layer " << layer.name << " in " << filename;
+      if (size > 0) {
+        blob->ShareData(std::make_shared<SyncedMemory>(
+            file->data() + offset, size, file));
+      }
+    }
+  }
+  return layers;
+}
+
+template <typename T>
+static void Append(std::string* out, T value) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void WriteFlatWeights(const NetParameter& param, const std::string& filename) {
+  std::vector<const LayerParameter*> layers;
+  for (int i = 0; i < param.layer_size(); ++i) {
+    if (param.layer(i).blobs_size() > 0) {
+      layers.push_back(&param.layer(i));
+    }
+  }
+  // the offsets of the data follow the size of the table
+  std::vector<std::vector<shared_ptr<Blob> > > blobs(layers.size());
+  size_t table_size = sizeof(kMagic) + 2 * sizeof(uint32_t);
+  for (size_t i = 0; i < layers.size(); ++i) {
+    table_size += 2 * sizeof(uint32_t) + layers[i]->name().size();
+    for (int j = 0; j < layers[i]->blobs_size(); ++j) {
+      blobs[i].push_back(std::make_shared<Blob>());
+      blobs[i][j]->FromProto(layers[i]->blobs(j), true);
+      CHECK(!blobs[i][j]->is_int8()) << "Flat weights are float, layer "
+          << layers[i]->name() << " has int8 weights";
+      table_size += sizeof(uint32_t) + sizeof(uint64_t) +
+                    blobs[i][j]->num_axes() * sizeof(int32_t);
+    }
+  }
+  std::string table(kMagic, sizeof(kMagic));
+  Append<uint32_t>(&table, kVersion);
+  Append<uint32_t>(&table, layers.size());
+  uint64_t offset = table_size;
+  for (size_t i = 0; i < layers.size(); ++i) {
+    Append<uint32_t>(&table, layers[i]->name().size());
+    table += layers[i]->name();
+    Append<uint32_t>(&table, blobs[i].size());
+    for (const shared_ptr<Blob>& blob : blobs[i]) {
+      Append<uint32_t>(&table, blob->num_axes());
+      for (int dim : blob->shape()) {
+        Append<int32_t>(&table, dim);
+      }
+      offset = (offset + kFlatWeightsAlignment - 1) / kFlatWeightsAlignment *
+               kFlatWeightsAlignment;
+      Append<uint64_t>(&table, offset);
+      offset += blob->count() * sizeof(real_t);
+    }
+  }
+  CHECK_EQ(table.size(), table_size);
+
+  std::ofstream out(filename.c_str(),
+                    std::ios::out | std::ios::trunc | std::ios::binary);
+  CHECK(out) << "Failed to open " << filename;
+  out.write(table.data(), table.size());
+  const std::vector<char> padding(kFlatWeightsAlignment, 0);
+  offset = table_size;
+  for (size_t i = 0; i < layers.size(); ++i) {
+    for (const shared_ptr<Blob>& blob : blobs[i]) {
+      const uint64_t begin =
+          (offset + kFlatWeightsAlignment - 1) / kFlatWeightsAlignment *
+          kFlatWeightsAlignment;
+      out.write(padding.data(), begin - offset);
+      const size_t size = blob->count() * sizeof(real_t);
+      if (size > 0) {
+        out.write(reinterpret_cast<const char*>(blob->cpu_data()), size);
+      }
+      offset = begin + size;
+    }
+  }
+  CHECK(out) << "Failed to write " << filename;
+}
+
+}  // namespace caffe
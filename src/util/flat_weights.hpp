@@ -0,0 +1,59 @@
+#ifndef CAFFE_UTIL_FLAT_WEIGHTS_HPP_
+#define CAFFE_UTIL_FLAT_WEIGHTS_HPP_
+
+#include <string>
+#include <vector>
+
+#include "caffe/blob.hpp"
+#include "../proto/caffe.pb.h"
+
+namespace caffe {
+
+/*!
+ * \brief Flat weight file, mapped into memory and used by the parameter
+ *  blobs as is instead of parsed and copied like a caffemodel.
+ *
+ *  All integers and floats are in the byte order of the host.
+ *
+ * ```
+ * char     magic[8]            "MCFLATW\0"
+ * uint32   version             1
+ * uint32   num_layers
+ * for each layer:
+ *   uint32 name_length
+ *   char   name[name_length]
+ *   uint32 num_blobs
+ *   for each blob:
+ *     uint32 num_axes
+ *     int32  shape[num_axes]
+ *     uint64 offset            of the data from the start of the file
+ * float    data of every blob, each aligned to kFlatWeightsAlignment
+ * ```
+ */
+const int kFlatWeightsAlignment = 64;
+
+/*! \brief layer of a flat weight file */
+struct FlatLayer {
+  std::string name;
+  /*! \brief blobs backed by the mapped file */
+  std::vector<shared_ptr<Blob> > blobs;
+};
+
+/*! \brief whether filename starts like a flat weight file */
+bool IsFlatWeightsFile(const std::string& filename);
+
+/*!
+ * \brief map a flat weight file, the blobs keep the mapping alive. Writing
+ *  to them copies the pages they touch and leaves the file alone.
+ */
+std::vector<FlatLayer> ReadFlatWeights(const std::string& filename);
+
+/*!
+ * \brief write the blobs of the layers in param as a flat weight file, legacy
+ *  num, channels, height and width as a 4-D shape
+ */
+void WriteFlatWeights(const NetParameter& param, const std::string& filename);
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_FLAT_WEIGHTS_HPP_
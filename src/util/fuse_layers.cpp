@@ -0,0 +1,257 @@
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "caffe/blob.hpp"
+#include "../common.hpp"
+#include "fuse_layers.hpp"
+
+using namespace std;
+
+namespace caffe {
+
+// Return true iff layer f is the only reader of the blob layer p writes to
+// its first top.
+static bool IsOnlyConsumer(const NetParameter& param, const vector<bool>& removed,
+                           int p, int f) {
+  const string& blob_name = param.layer(p).top(0);
+  const LayerParameter& follower = param.layer(f);
+  const bool in_place = follower.top(0) == blob_name;
+  for (int i = p + 1; i < param.layer_size(); ++i) {
+    if (removed[i]) { continue; }
+    const LayerParameter& layer_param = param.layer(i);
+    if (i == f) {
+      // an in-place follower starts a new version of the blob
+      if (in_place) { return true; }
+      continue;
+    }
+    for (int j = 0; j < layer_param.bottom_size(); ++j) {
+      if (layer_param.bottom(j) == blob_name) { return false; }
+    }
+    for (int j = 0; j < layer_param.top_size(); ++j) {
+      if (layer_param.top(j) == blob_name) { return i > f; }
+    }
+  }
+  return true;
+}
+
+// Number of output channels of a layer weights can be folded into, or 0.
+static int FoldableChannels(const LayerParameter& layer_param) {
+  if (layer_param.top_size() != 1 || layer_param.blobs_size() == 0) {
+    return 0;
+  }
+  const string& type = layer_param.type();
+  if (type == "Convolution" || type == "ConvolutionDepthwise") {
+    // weights may still use the deprecated 4D dimensions
+    const BlobProto& weight = layer_param.blobs(0);
+    return weight.has_num() ? weight.num() : weight.shape().dim(0);
+  }
+  if (type == "Deconvolution") {
+    return layer_param.convolution_param().num_output();
+  }
+  if (type == "InnerProduct") {
+    return layer_param.inner_product_param().num_output();
+  }
+  return 0;
+}
+
+// Get the per-channel y = scale * x + shift computed by the follower, return
+// false if it is not such a layer.
+static bool GetAffine(const LayerParameter& layer_param, int channels,
+                      vector<real_t>* scale, vector<real_t>* shift) {
+  if (layer_param.bottom_size() != 1 || layer_param.top_size() != 1 ||
+      layer_param.blobs_size() == 0) {
+    return false;
+  }
+  vector<Blob> blobs(layer_param.blobs_size());
+  for (int i = 0; i < layer_param.blobs_size(); ++i) {
+    blobs[i].FromProto(layer_param.blobs(i));
+    if (i < 2 && blobs[i].count() != channels) { return false; }
+  }
+  scale->assign(channels, 1);
+  shift->assign(channels, 0);
+  const string& type = layer_param.type();
+  if (type == "BatchNorm") {
+    const BatchNormParameter& bn_param = layer_param.batch_norm_param();
+    if (blobs.size() != 3 ||
+        (bn_param.has_use_global_stats() && !bn_param.use_global_stats())) {
+      return false;
+    }
+    const real_t scale_factor = blobs[2].cpu_data()[0] == 0 ?
+        0 : 1 / blobs[2].cpu_data()[0];
+    for (int c = 0; c < channels; ++c) {
+      const real_t mean = blobs[0].cpu_data()[c] * scale_factor;
+      const real_t variance = blobs[1].cpu_data()[c] * scale_factor;
+      (*scale)[c] = 1 / std::sqrt(variance + bn_param.eps());
+      (*shift)[c] = -mean * (*scale)[c];
+    }
+    return true;
+  }
+  if (type == "BN") {
+    // blobs: slope, bias, mean and inverse std
+    if (blobs.size() != 4 || blobs[2].count() != channels ||
+        blobs[3].count() != channels) {
+      return false;
+    }
+    for (int c = 0; c < channels; ++c) {
+      (*scale)[c] = blobs[0].cpu_data()[c] * blobs[3].cpu_data()[c];
+      (*shift)[c] = blobs[1].cpu_data()[c] - blobs[2].cpu_data()[c] * (*scale)[c];
+    }
+    return true;
+  }
+  if (type == "Scale") {
+    const ScaleParameter& scale_param = layer_param.scale_param();
+    if (scale_param.axis() != 1 || scale_param.num_axes() != 1) {
+      return false;
+    }
+    for (int c = 0; c < channels; ++c) {
+      (*scale)[c] = blobs[0].cpu_data()[c];
+      if (scale_param.bias_term()) {
+        (*shift)[c] = blobs[1].cpu_data()[c];
+      }
+    }
+    return true;
+  }
+  if (type == "Bias") {
+    const BiasParameter& bias_param = layer_param.bias_param();
+    if (bias_param.axis() != 1 || bias_param.num_axes() != 1) {
+      return false;
+    }
+    for (int c = 0; c < channels; ++c) {
+      (*shift)[c] = blobs[0].cpu_data()[c];
+    }
+    return true;
+  }
+  return false;
+}
+
+// Scale the float weights of the layer by output channel.
+static void FoldScale(const vector<real_t>& scale, LayerParameter* layer_param) {
+  const int channels = scale.size();
+  const string& type = layer_param->type();
+  Blob weight;
+  weight.FromProto(layer_param->blobs(0));
+  real_t* weight_data = weight.mutable_cpu_data();
+  if (type == "Deconvolution") {
+    // weight is (input channels, output channels / group, kernel...)
+    const int group = layer_param->convolution_param().group();
+    const int out_per_group = channels / group;
+    const int kernel_dim = weight.count(2);
+    const int in_channels = weight.count() / (out_per_group * kernel_dim);
+    const int in_per_group = in_channels / group;
+    for (int i = 0; i < in_channels; ++i) {
+      for (int j = 0; j < out_per_group; ++j) {
+        const int c = i / in_per_group * out_per_group + j;
+        real_t* data = weight_data + (i * out_per_group + j) * kernel_dim;
+        for (int k = 0; k < kernel_dim; ++k) {
+          data[k] *= scale[c];
+        }
+      }
+    }
+  }
+  else if (type == "InnerProduct" &&
+           layer_param->inner_product_param().transpose()) {
+    // weight is (input size, output channels)
+    const int dim = weight.count() / channels;
+    for (int i = 0; i < dim; ++i) {
+      for (int c = 0; c < channels; ++c) {
+        weight_data[i * channels + c] *= scale[c];
+      }
+    }
+  }
+  else {
+    // weight is (output channels, ...)
+    const int dim = weight.count() / channels;
+    for (int c = 0; c < channels; ++c) {
+      for (int k = 0; k < dim; ++k) {
+        weight_data[c * dim + k] *= scale[c];
+      }
+    }
+  }
+  layer_param->mutable_blobs(0)->Clear();
+  weight.ToProto(layer_param->mutable_blobs(0));
+}
+
+// Apply y = scale * x + shift to the output of the layer.
+static void FoldAffine(const vector<real_t>& scale, const vector<real_t>& shift,
+                       LayerParameter* layer_param) {
+  const int channels = scale.size();
+  const string& type = layer_param->type();
+  if (layer_param->blobs(0).has_int8_data()) {
+    // int8 weights are (output channels, ...) with a scale per output channel
+    BlobProto* weight = layer_param->mutable_blobs(0);
+    CHECK_EQ(weight->int8_scale_size(), channels);
+    for (int c = 0; c < channels; ++c) {
+      weight->set_int8_scale(c, weight->int8_scale(c) * scale[c]);
+    }
+  }
+  else {
+    FoldScale(scale, layer_param);
+  }
+
+  Blob bias(vector<int>(1, channels));
+  real_t* bias_data = bias.mutable_cpu_data();
+  if (layer_param->blobs_size() > 1) {
+    bias.FromProto(layer_param->blobs(1), false);
+  }
+  else {
+    for (int c = 0; c < channels; ++c) {
+      bias_data[c] = 0;
+    }
+    layer_param->add_blobs();
+    if (type == "InnerProduct") {
+      layer_param->mutable_inner_product_param()->set_bias_term(true);
+    }
+    else {
+      layer_param->mutable_convolution_param()->set_bias_term(true);
+    }
+  }
+  for (int c = 0; c < channels; ++c) {
+    bias_data[c] = bias_data[c] * scale[c] + shift[c];
+  }
+  layer_param->mutable_blobs(1)->Clear();
+  bias.ToProto(layer_param->mutable_blobs(1));
+}
+
+int FoldBatchNorm(const NetParameter& param, NetParameter* param_folded) {
+  NetParameter net_param(param);
+  vector<bool> removed(net_param.layer_size(), false);
+  // the layer that last wrote each blob
+  map<string, int> blob_name_to_producer;
+  int num_folded = 0;
+  for (int i = 0; i < net_param.layer_size(); ++i) {
+    const LayerParameter& layer_param = net_param.layer(i);
+    if (layer_param.bottom_size() == 1 && layer_param.top_size() == 1 &&
+        blob_name_to_producer.count(layer_param.bottom(0))) {
+      const int p = blob_name_to_producer[layer_param.bottom(0)];
+      const int channels = FoldableChannels(net_param.layer(p));
+      vector<real_t> scale, shift;
+      if (channels > 0 && IsOnlyConsumer(net_param, removed, p, i) &&
+          GetAffine(layer_param, channels, &scale, &shift)) {
+        LayerParameter* producer = net_param.mutable_layer(p);
+        LOG(INFO) << "Folding " << layer_param.name() << " into "
+                  << producer->name();
+        FoldAffine(scale, shift, producer);
+        producer->set_top(0, layer_param.top(0));
+        blob_name_to_producer[layer_param.top(0)] = p;
+        removed[i] = true;
+        ++num_folded;
+        continue;
+      }
+    }
+    for (int j = 0; j < layer_param.top_size(); ++j) {
+      blob_name_to_producer[layer_param.top(j)] = i;
+    }
+  }
+  param_folded->CopyFrom(net_param);
+  param_folded->clear_layer();
+  for (int i = 0; i < net_param.layer_size(); ++i) {
+    if (!removed[i]) {
+      param_folded->add_layer()->CopyFrom(net_param.layer(i));
+    }
+  }
+  return num_folded;
+}
+
+}  // namespace caffe
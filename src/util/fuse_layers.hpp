@@ -0,0 +1,16 @@
+#ifndef _CAFFE_UTIL_FUSE_LAYERS_HPP_
+#define _CAFFE_UTIL_FUSE_LAYERS_HPP_
+
+#include "../proto/caffe.pb.h"
+
+namespace caffe {
+
+// Copy NetParameters with BatchNorm, BN, Scale and Bias layers folded into the
+// weights of the Convolution, ConvolutionDepthwise, Deconvolution or
+// InnerProduct layer feeding them. The layers must carry their trained blobs,
+// layers without blobs are left alone. Return the number of layers folded.
+int FoldBatchNorm(const NetParameter& param, NetParameter* param_folded);
+
+}  // namespace caffe
+
+#endif  // _CAFFE_UTIL_FUSE_LAYERS_HPP_
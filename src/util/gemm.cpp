@@ -0,0 +1,504 @@
+#include <algorithm>
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CAFFE_GEMM_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define CAFFE_GEMM_NEON
+#include <arm_neon.h>
+#endif
+
+#include "./gemm.hpp"
+#include "./math_functions.hpp"
+#include "./thread_pool.hpp"
+#include "../syncedmem.hpp"
+
+namespace caffe {
+
+// depth of A and B packed at a time, a panel of B stays in L1
+static const int kGemmKC = 256;
+// rows of A and columns of B of a block of C, the block of A stays in L2
+static const int kGemmMC = 96;
+static const int kGemmNC = 512;
+// largest tile of a GemmKernel
+static const int kGemmMaxTile = 256;
+
+#if defined(CAFFE_GEMM_SSE)
+
+struct VecSSE {
+  typedef __m128 type;
+  static const int kWidth = 4;
+  static type zero() { return _mm_setzero_ps(); }
+  static type load(const real_t* p) { return _mm_loadu_ps(p); }
+  static void store(real_t* p, type v) { _mm_storeu_ps(p, v); }
+  static type add(type a, type b) { return _mm_add_ps(a, b); }
+  static type broadcast(const real_t* p) { return _mm_set1_ps(*p); }
+  static type fma(type a, type b, type c) {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+  }
+};
+
+// 6 x 8 tile: 12 accumulators, 2 vectors of B and A in 16 registers
+static const GemmKernel kKernelSIMD = {
+  "sse", 6, 8, GemmTile<VecSSE, 6, 2>, GemmTileGemv<VecSSE, 6>,
+  DepthwiseRow3x3<VecSSE>
+};
+
+#elif defined(CAFFE_GEMM_NEON)
+
+struct VecNEON {
+  typedef float32x4_t type;
+  static const int kWidth = 4;
+  static type zero() { return vdupq_n_f32(0); }
+  static type load(const real_t* p) { return vld1q_f32(p); }
+  static void store(real_t* p, type v) { vst1q_f32(p, v); }
+  static type add(type a, type b) { return vaddq_f32(a, b); }
+  static type broadcast(const real_t* p) { return vld1q_dup_f32(p); }
+  static type fma(type a, type b, type c) { return vmlaq_f32(c, a, b); }
+};
+
+// 6 x 8 tile, fits the 16 registers of armv7 as well
+static const GemmKernel kKernelSIMD = {
+  "neon", 6, 8, GemmTile<VecNEON, 6, 2>, GemmTileGemv<VecNEON, 6>,
+  DepthwiseRow3x3<VecNEON>
+};
+
+#endif  // CAFFE_GEMM_SSE
+
+struct VecScalar {
+  typedef real_t type;
+  static const int kWidth = 1;
+  static type zero() { return 0; }
+  static type load(const real_t* p) { return *p; }
+  static void store(real_t* p, type v) { *p = v; }
+  static type add(type a, type b) { return a + b; }
+  static type broadcast(const real_t* p) { return *p; }
+  static type fma(type a, type b, type c) { return a * b + c; }
+};
+
+// for BLAS=internal on CPUs without a SIMD kernel
+static const GemmKernel kKernelScalar = {
+  "scalar", 4, 4, GemmTile<VecScalar, 4, 4>, GemmTileGemv<VecScalar, 4>,
+  DepthwiseRow3x3<VecScalar>
+};
+
+// int8 in plain code where there is no SIMD kernel
+static const GemmKernelInt8 kKernelInt8Scalar = {
+  "scalar", 4, 4, GemmTileInt8<4, 4>, DepthwiseRowInt8<VecScalar>,
+  QuantizeInt8<VecScalar, uint8_t, false>,
+  QuantizeInt8<VecScalar, int16_t, true>
+};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+static bool CpuSupportsAVX2() {
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+static bool CpuSupportsAVX512() {
+  return __builtin_cpu_supports("avx512f");
+}
+static bool CpuSupportsAVX512VNNI() {
+  return __builtin_cpu_supports("avx512bw") &&
+         __builtin_cpu_supports("avx512vnni");
+}
+
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
+// registers the OS saves, XCR0
+static unsigned long long OsSavedState() {  // NOLINT(runtime/int)
+  int info[4];
+  __cpuid(info, 1);
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  return osxsave ? _xgetbv(0) : 0;
+}
+static bool CpuSupportsAVX2() {
+  int info[4];
+  __cpuid(info, 1);
+  const bool fma = (info[2] & (1 << 12)) != 0;
+  __cpuidex(info, 7, 0);
+  const bool avx2 = (info[1] & (1 << 5)) != 0;
+  return fma && avx2 && (OsSavedState() & 0x6) == 0x6;
+}
+static bool CpuSupportsAVX512() {
+  int info[4];
+  __cpuidex(info, 7, 0);
+  const bool avx512f = (info[1] & (1 << 16)) != 0;
+  return avx512f && (OsSavedState() & 0xe6) == 0xe6;
+}
+static bool CpuSupportsAVX512VNNI() {
+  int info[4];
+  __cpuidex(info, 7, 0);
+  const bool avx512bw = (info[1] & (1 << 30)) != 0;
+  const bool vnni = (info[2] & (1 << 11)) != 0;
+  return avx512bw && vnni && (OsSavedState() & 0xe6) == 0xe6;
+}
+
+#else
+
+static bool CpuSupportsAVX2() { return false; }
+static bool CpuSupportsAVX512() { return false; }
+static bool CpuSupportsAVX512VNNI() { return false; }
+
+#endif  // __GNUC__
+
+static const GemmKernel* SelectGemmKernel() {
+  if (GemmKernelAVX512() && CpuSupportsAVX512()) {
+    return GemmKernelAVX512();
+  }
+  if (GemmKernelAVX2() && CpuSupportsAVX2()) {
+    return GemmKernelAVX2();
+  }
+#if defined(CAFFE_GEMM_SSE) || defined(CAFFE_GEMM_NEON)
+  return &kKernelSIMD;
+#else
+  return NULL;
+#endif
+}
+
+const GemmKernel* GetGemmKernel() {
+  static const GemmKernel* kernel = SelectGemmKernel();
+  return kernel;
+}
+
+static const GemmKernelInt8* SelectGemmKernelInt8() {
+  if (GemmKernelInt8AVX512VNNI() && CpuSupportsAVX512VNNI()) {
+    return GemmKernelInt8AVX512VNNI();
+  }
+  if (GemmKernelInt8AVX2() && CpuSupportsAVX2()) {
+    return GemmKernelInt8AVX2();
+  }
+  return &kKernelInt8Scalar;
+}
+
+const GemmKernelInt8* GetGemmKernelInt8() {
+  static const GemmKernelInt8* kernel = SelectGemmKernelInt8();
+  return kernel;
+}
+
+//// PackedMatrix
+
+void PackedMatrix::Pack(bool trans, int rows, int cols, const real_t* A) {
+  Pack(trans, rows, cols, A, trans ? rows : cols, 1);
+}
+
+void PackedMatrix::Pack(bool trans, int rows, int cols, const real_t* A,
+                        int lda, real_t alpha) {
+  kernel_ = GetGemmKernel() ? GetGemmKernel() : &kKernelScalar;
+  CHECK_LE(kernel_->mr * kernel_->nr, kGemmMaxTile);
+  rows_ = rows;
+  cols_ = cols;
+  const int mr = kernel_->mr;
+  padded_rows_ = (rows + mr - 1) / mr * mr;
+  // per block of kGemmKC columns, panels of mr rows, column by column
+  data_.assign(static_cast<size_t>(padded_rows_) * cols, 0);
+  transposed_.clear();
+  parallel_for(0, padded_rows_ / mr, [&](int begin, int end) {
+    for (int col = 0; col < cols; col += kGemmKC) {
+      const int kc = std::min(kGemmKC, cols - col);
+      real_t* block = &data_[static_cast<size_t>(col) * padded_rows_];
+      for (int i = begin * mr; i < std::min(end * mr, rows); ++i) {
+        real_t* out = block + (i - i % mr) * kc + i % mr;
+        for (int p = 0; p < kc; ++p) {
+          const real_t a = trans ? A[static_cast<size_t>(col + p) * lda + i]
+                                 : A[static_cast<size_t>(i) * lda + col + p];
+          out[p * mr] = alpha * a;
+        }
+      }
+    }
+  }, parallel_grain(static_cast<int64_t>(mr) * cols));
+}
+
+const real_t* PackedMatrix::panel(int row, int col) const {
+  const int kc = std::min(kGemmKC, cols_ - col);
+  return &data_[static_cast<size_t>(col) * padded_rows_ +
+                static_cast<size_t>(row) * kc];
+}
+
+void PackedMatrix::PackTransposed() {
+  const int nr = kernel_->nr;
+  const int padded_rows = (rows_ + nr - 1) / nr * nr;
+  transposed_.assign(static_cast<size_t>(padded_rows) * cols_, 0);
+  for (int k0 = 0; k0 < cols_; k0 += kGemmKC) {
+    const int kc = std::min(kGemmKC, cols_ - k0);
+    real_t* block = &transposed_[static_cast<size_t>(k0) * padded_rows];
+    for (int i = 0; i < rows_; ++i) {
+      const real_t* in = panel(i - i % kernel_->mr, k0) + i % kernel_->mr;
+      real_t* out = block + (i - i % nr) * kc + i % nr;
+      for (int p = 0; p < kc; ++p) {
+        out[p * nr] = in[p * kernel_->mr];
+      }
+    }
+  }
+}
+
+const real_t* PackedMatrix::transposed_panel(int row, int col) const {
+  const int nr = kernel_->nr;
+  const int padded_rows = (rows_ + nr - 1) / nr * nr;
+  const int kc = std::min(kGemmKC, cols_ - col);
+  return &transposed_[static_cast<size_t>(col) * padded_rows +
+                      static_cast<size_t>(row) * kc];
+}
+
+//// caffe_cpu_gemm_packed
+
+// pack columns [n0, n1) of rows [k0, k0 + kc) of op(B) in panels of nr
+// columns, row by row, padded with zeros
+static void PackB(const CBLAS_TRANSPOSE TransB, const real_t* B, int ldb,
+                  int k0, int kc, int n0, int n1, int nr, real_t* out) {
+  for (int j0 = n0; j0 < n1; j0 += nr) {
+    const int nj = std::min(nr, n1 - j0);
+    if (TransB == CblasNoTrans) {
+      for (int p = 0; p < kc; ++p) {
+        const real_t* in = B + static_cast<size_t>(k0 + p) * ldb + j0;
+        std::copy(in, in + nj, out + p * nr);
+        std::fill(out + p * nr + nj, out + (p + 1) * nr, real_t(0));
+      }
+    } else {
+      for (int j = 0; j < nj; ++j) {
+        const real_t* in = B + static_cast<size_t>(j0 + j) * ldb + k0;
+        for (int p = 0; p < kc; ++p) {
+          out[p * nr + j] = in[p];
+        }
+      }
+      for (int p = 0; p < kc; ++p) {
+        std::fill(out + p * nr + nj, out + (p + 1) * nr, real_t(0));
+      }
+    }
+    out += kc * nr;
+  }
+}
+
+// y = A * x (+ y), rows of A in parallel
+static void GemvPacked(const PackedMatrix& A, const real_t* x, bool accumulate,
+                       real_t* y, int incy) {
+  const GemmKernel* kernel = A.kernel();
+  const int M = A.rows(), K = A.cols(), mr = kernel->mr;
+  parallel_for(0, (M + mr - 1) / mr, [&](int begin, int end) {
+    real_t tile[kGemmMaxTile];
+    for (int panel = begin; panel < end; ++panel) {
+      const int i0 = panel * mr;
+      for (int k0 = 0; k0 < K; k0 += kGemmKC) {
+        kernel->tile_gemv(std::min(kGemmKC, K - k0), A.panel(i0, k0), x + k0,
+                          tile, k0 > 0);
+      }
+      const int mi = std::min(mr, M - i0);
+      for (int i = 0; i < mi; ++i) {
+        real_t& out = y[static_cast<size_t>(i0 + i) * incy];
+        out = accumulate ? out + tile[i] : tile[i];
+      }
+    }
+  }, parallel_grain(static_cast<int64_t>(mr) * K));
+}
+
+// C = A * B (+ C) blocked in rows of channel_block, which divides the nr of
+// the kernel, as C^T = B^T * A^T: the columns of B take the rows of the tiles
+// and the rows of A their vector lanes, so that a row of a tile is nr /
+// channel_block runs of values in a row of C. With nr == channel_block the
+// kernel stores whole tiles.
+static void GemmPackedBlocked(const PackedMatrix& A, const int N,
+    const GemmPackB& pack_b, const bool accumulate, real_t* C,
+    const int channel_block) {
+  const GemmKernel* kernel = A.kernel();
+  const int M = A.rows(), K = A.cols(), mr = kernel->mr, nr = kernel->nr;
+  const int cb = channel_block;
+  CHECK(A.has_transposed()) << "PackTransposed the A of a blocked C";
+  // B packed in more blocks of fewer columns for the threads, every block
+  // once for all of A
+  const int nc = std::min(std::max(kGemmNC / mr, 1) * mr,
+                          std::max((N + 8 * mr - 1) / (8 * mr), 1) * mr);
+  parallel_for(0, (N + nc - 1) / nc, [&](int begin, int end) {
+    static thread_local std::vector<real_t> packed_b;
+    packed_b.resize(std::max<size_t>(packed_b.size(), kGemmKC * nc));
+    real_t tile[kGemmMaxTile];
+    for (int block = begin; block < end; ++block) {
+      const int n0 = block * nc, n1 = std::min(n0 + nc, N);
+      for (int k0 = 0; k0 < K; k0 += kGemmKC) {
+        const int kc = std::min(kGemmKC, K - k0);
+        const bool add = accumulate || k0 > 0;
+        pack_b(k0, kc, n0, n1, mr, packed_b.data());
+        for (int i0 = 0; i0 < M; i0 += nr) {
+          const real_t* a = A.transposed_panel(i0, k0);
+          const int mi = std::min(nr, M - i0);
+          for (int j0 = n0; j0 < n1; j0 += mr) {
+            const real_t* b = &packed_b[static_cast<size_t>(j0 - n0) * kc];
+            const int nj = std::min(mr, n1 - j0);
+            real_t* c = C + (static_cast<size_t>(i0 / cb) * N + j0) * cb;
+            if (nj == mr && mi == nr && nr == cb) {
+              kernel->tile(kc, b, a, c, cb, add);
+              continue;
+            }
+            kernel->tile(kc, b, a, tile, nr, false);
+            for (int i = 0; i < mi; i += cb) {
+              real_t* out = c + static_cast<size_t>(i / cb) * N * cb;
+              for (int j = 0; j < nj; ++j) {
+                const real_t* in = tile + j * nr + i;
+                if (add) {
+                  for (int l = 0; l < cb; ++l) {
+                    out[j * cb + l] += in[l];
+                  }
+                } else {
+                  std::copy(in, in + cb, out + j * cb);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
+// caffe_cpu_gemm_packed, ldc of op(C), B packed by pack_b unless N is 1, C
+// blocked in rows of channel_block unless 0
+static void GemmPacked(const PackedMatrix& A, const CBLAS_TRANSPOSE TransB,
+    const int N, const real_t* B, const int ldb, const GemmPackB& pack_b,
+    const real_t beta, real_t* C, const int ldc,
+    const CBLAS_TRANSPOSE TransC, const int channel_block = 0) {
+  const GemmKernel* kernel = A.kernel();
+  CHECK(kernel) << "Matrix not packed";
+  const int M = A.rows(), K = A.cols();
+  if (channel_block) {
+    CHECK(B == NULL && TransC == CblasNoTrans && ldc == N &&
+          M % channel_block == 0);
+  }
+  if (beta != 0 && beta != 1) {
+    const int rows = TransC == CblasNoTrans ? M : N;
+    for (int i = 0; i < rows; ++i) {
+      caffe_scal(TransC == CblasNoTrans ? N : M, beta,
+                 C + static_cast<size_t>(i) * ldc);
+    }
+  }
+  const bool accumulate = beta != 0;
+  if (channel_block && kernel->nr % channel_block == 0) {
+    GemmPackedBlocked(A, N, pack_b, accumulate, C, channel_block);
+    return;
+  }
+  if (B && N == 1 && (TransB == CblasTrans || ldb == 1)) {
+    GemvPacked(A, B, accumulate, C, TransC == CblasNoTrans ? ldc : 1);
+    return;
+  }
+  const int mr = kernel->mr, nr = kernel->nr;
+  int mc = std::max(kGemmMC / mr, 1) * mr;
+  int nc = std::max(kGemmNC / nr, 1) * nr;
+  if (!B) {
+    // B made by pack_b costs more than copying it, so every block of it is
+    // made once for all of A, in more blocks of fewer columns for the threads
+    mc = (M + mr - 1) / mr * mr;
+    nc = std::min(nc, std::max((N + 8 * nr - 1) / (8 * nr), 1) * nr);
+  }
+  const int m_blocks = (M + mc - 1) / mc;
+  const int n_blocks = (N + nc - 1) / nc;
+  parallel_for(0, m_blocks * n_blocks, [&](int begin, int end) {
+    // kept by every thread, packing allocates nothing after the first call
+    static thread_local std::vector<real_t> packed_b;
+    packed_b.resize(std::max<size_t>(packed_b.size(), kGemmKC * nc));
+    real_t tile[kGemmMaxTile];
+    for (int block = begin; block < end; ++block) {
+      const int m0 = block % m_blocks * mc, m1 = std::min(m0 + mc, M);
+      const int n0 = block / m_blocks * nc, n1 = std::min(n0 + nc, N);
+      for (int k0 = 0; k0 < K; k0 += kGemmKC) {
+        const int kc = std::min(kGemmKC, K - k0);
+        const bool add = accumulate || k0 > 0;
+        pack_b(k0, kc, n0, n1, nr, packed_b.data());
+        for (int j0 = n0; j0 < n1; j0 += nr) {
+          const real_t* b = &packed_b[static_cast<size_t>(j0 - n0) * kc];
+          const int nj = std::min(nr, n1 - j0);
+          for (int i0 = m0; i0 < m1; i0 += mr) {
+            const real_t* a = A.panel(i0, k0);
+            const int mi = std::min(mr, m1 - i0);
+            if (mi == mr && nj == nr && TransC == CblasNoTrans &&
+                !channel_block) {
+              kernel->tile(kc, a, b, C + static_cast<size_t>(i0) * ldc + j0,
+                           ldc, add);
+              continue;
+            }
+            // partial tile, transposed or blocked C, through the tile buffer
+            kernel->tile(kc, a, b, tile, nr, false);
+            if (channel_block) {
+              const int cb = channel_block;
+              for (int i = 0; i < mi; ++i) {
+                real_t* c = C + (static_cast<size_t>((i0 + i) / cb) * N +
+                                 j0) * cb + (i0 + i) % cb;
+                for (int j = 0; j < nj; ++j) {
+                  c[j * cb] = add ? c[j * cb] + tile[i * nr + j]
+                                  : tile[i * nr + j];
+                }
+              }
+              continue;
+            }
+            for (int i = 0; i < mi; ++i) {
+              for (int j = 0; j < nj; ++j) {
+                real_t& c = TransC == CblasNoTrans
+                    ? C[static_cast<size_t>(i0 + i) * ldc + j0 + j]
+                    : C[static_cast<size_t>(j0 + j) * ldc + i0 + i];
+                c = add ? c + tile[i * nr + j] : tile[i * nr + j];
+              }
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
+void caffe_cpu_gemm_packed(const PackedMatrix& A, const CBLAS_TRANSPOSE TransB,
+    const int N, const real_t* B, const real_t beta, real_t* C,
+    const CBLAS_TRANSPOSE TransC) {
+  const int ldb = TransB == CblasNoTrans ? N : A.cols();
+  GemmPacked(A, TransB, N, B, ldb,
+             [&](int k0, int kc, int n0, int n1, int nr, real_t* out) {
+               PackB(TransB, B, ldb, k0, kc, n0, n1, nr, out);
+             },
+             beta, C, TransC == CblasNoTrans ? N : A.rows(), TransC);
+}
+
+void caffe_cpu_gemm_packed(const PackedMatrix& A, const CBLAS_TRANSPOSE TransB,
+    const int N, const real_t* B, const int ldb, const real_t beta, real_t* C,
+    const int ldc) {
+  GemmPacked(A, TransB, N, B, ldb,
+             [&](int k0, int kc, int n0, int n1, int nr, real_t* out) {
+               PackB(TransB, B, ldb, k0, kc, n0, n1, nr, out);
+             },
+             beta, C, ldc, CblasNoTrans);
+}
+
+void caffe_cpu_gemm_packed(const PackedMatrix& A, const int N,
+    const GemmPackB& pack_b, const real_t beta, real_t* C,
+    const int channel_block) {
+  GemmPacked(A, CblasNoTrans, N, NULL, 0, pack_b, beta, C, N, CblasNoTrans,
+             channel_block);
+}
+
+//// PackedWeights
+
+const std::vector<PackedMatrix>& PackedWeights::Get(const Blob& weights,
+    int groups, bool trans, int rows, int cols, bool transposed) {
+  // groups of fewer rows than a tile are left to BLAS, like depthwise
+  // convolution, a single matrix is padded to a tile
+  const GemmKernel* kernel = GetGemmKernel();
+  if (!kernel || (rows < kernel->mr && groups > 1)) {
+    static const std::vector<PackedMatrix> none;
+    return none;
+  }
+  const int layout[] = {groups, trans, rows, cols, transposed};
+  return cache_.Get(weights, std::vector<int>(layout, layout + 5),
+      [&](const Blob& weights, std::vector<PackedMatrix>* packed) {
+        CHECK_EQ(weights.count(), groups * rows * cols);
+        const real_t* data = weights.cpu_data();
+        packed->resize(groups);
+        for (int g = 0; g < groups; ++g) {
+          (*packed)[g].Pack(trans, rows, cols, data + g * rows * cols);
+          if (transposed) {
+            (*packed)[g].PackTransposed();
+          }
+        }
+      });
+}
+
+}  // namespace caffe
@@ -0,0 +1,124 @@
+#ifndef CAFFE_UTIL_GEMM_HPP_
+#define CAFFE_UTIL_GEMM_HPP_
+
+#include <functional>
+#include <vector>
+
+#include "caffe/blob.hpp"
+#include "./gemm_kernel.hpp"
+#include "./mkl_alternate.hpp"
+#include "./weights_cache.hpp"
+
+namespace caffe {
+
+/*!
+ * \brief the fastest GemmKernel this CPU runs, NULL if there is only scalar
+ *  code to run, then BLAS does better
+ */
+const GemmKernel* GetGemmKernel();
+
+/*! \brief the fastest GemmKernelInt8 this CPU runs, plain code if no other */
+const GemmKernelInt8* GetGemmKernelInt8();
+
+/*!
+ * \brief op(A) of a gemm packed in the layout of the GemmKernel, so weights
+ *  which stay the same for every forward are packed once instead of by BLAS
+ *  in every call
+ */
+class PackedMatrix {
+ public:
+  PackedMatrix() : kernel_(NULL), rows_(0), cols_(0), padded_rows_(0) {}
+  /*!
+   * \brief pack op(A) of rows x cols with the kernel of GetGemmKernel, or
+   *  with scalar code if there is none. A is row major, cols x rows if trans.
+   */
+  void Pack(bool trans, int rows, int cols, const real_t* A);
+  /*! \brief pack alpha * op(A) with lda elements from a row of A to the next */
+  void Pack(bool trans, int rows, int cols, const real_t* A, int lda,
+            real_t alpha);
+  const GemmKernel* kernel() const { return kernel_; }
+  int rows() const { return rows_; }
+  int cols() const { return cols_; }
+  /*! \brief panel of the rows from row, of the columns from col on */
+  const real_t* panel(int row, int col) const;
+  /*!
+   * \brief pack op(A)^T like a B of the kernel as well, which
+   *  caffe_cpu_gemm_packed takes to store C blocked in channels
+   */
+  void PackTransposed();
+  bool has_transposed() const { return !transposed_.empty(); }
+  /*!
+   * \brief panel of op(A)^T, nr of the rows from row, of the columns from
+   *  col on, see PackTransposed
+   */
+  const real_t* transposed_panel(int row, int col) const;
+
+ private:
+  const GemmKernel* kernel_;
+  int rows_;
+  int cols_;
+  /*! \brief rows rounded up to the rows of a kernel tile */
+  int padded_rows_;
+  std::vector<real_t> data_;
+  /*! \brief op(A)^T, per block of kGemmKC columns, panels of nr rows */
+  std::vector<real_t> transposed_;
+};
+
+/*!
+ * \brief C = A * op(B) + beta * C like caffe_cpu_gemm with alpha 1 and A
+ *  packed, op(C) instead of C if TransC. Blocks of C run in parallel on the
+ *  thread pool of the calling thread.
+ */
+void caffe_cpu_gemm_packed(const PackedMatrix& A, const CBLAS_TRANSPOSE TransB,
+    const int N, const real_t* B, const real_t beta, real_t* C,
+    const CBLAS_TRANSPOSE TransC = CblasNoTrans);
+
+/*!
+ * \brief caffe_cpu_gemm_packed with ldb and ldc elements from a row of B and
+ *  C to the next, like cblas_sgemm
+ */
+void caffe_cpu_gemm_packed(const PackedMatrix& A, const CBLAS_TRANSPOSE TransB,
+    const int N, const real_t* B, const int ldb, const real_t beta, real_t* C,
+    const int ldc);
+
+/*!
+ * \brief packs the rows [k0, k0 + kc) and the columns [n0, n1) of B into
+ *  out, in panels of nr columns, row by row, padded with zeros
+ */
+typedef std::function<void(int k0, int kc, int n0, int n1, int nr,
+                           real_t* out)> GemmPackB;
+
+/*!
+ * \brief caffe_cpu_gemm_packed of B packed straight from where it comes
+ *  from, like the image of a convolution without a col buffer. pack_b runs
+ *  on the threads of the pool. A channel_block other than 0 stores C blocked
+ *  in rows, M / channel_block x N x channel_block, see
+ *  NetParameter.channel_block.
+ */
+void caffe_cpu_gemm_packed(const PackedMatrix& A, const int N,
+    const GemmPackB& pack_b, const real_t beta, real_t* C,
+    const int channel_block = 0);
+
+/*!
+ * \brief the weights of a layer packed for caffe_cpu_gemm_packed, packed on
+ *  first use and shared like a WeightsCache
+ */
+class PackedWeights {
+ public:
+  /*!
+   * \brief op(A) of rows x cols for each of groups, the A of group g at
+   *  g * rows * cols in weights, with PackTransposed if transposed. Empty if
+   *  there is no GemmKernel or the rows of several groups don't fill a tile
+   *  of it, use BLAS then.
+   */
+  const std::vector<PackedMatrix>& Get(const Blob& weights, int groups,
+                                       bool trans, int rows, int cols,
+                                       bool transposed = false);
+
+ private:
+  WeightsCache<std::vector<PackedMatrix> > cache_;
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_GEMM_HPP_
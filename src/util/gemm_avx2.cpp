@@ -0,0 +1,128 @@
+// Compiled with AVX2 and FMA enabled, see mini-caffe.cmake, and only run
+// where the CPU supports them.
+#include <cstring>
+
+#include "./gemm_kernel.hpp"
+
+// MSVC has no __FMA__, /arch:AVX2 enables FMA as well
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#include <immintrin.h>
+
+namespace caffe {
+
+struct VecAVX2 {
+  typedef __m256 type;
+  static const int kWidth = 8;
+  static type zero() { return _mm256_setzero_ps(); }
+  static type load(const real_t* p) { return _mm256_loadu_ps(p); }
+  static void store(real_t* p, type v) { _mm256_storeu_ps(p, v); }
+  static type add(type a, type b) { return _mm256_add_ps(a, b); }
+  static type broadcast(const real_t* p) { return _mm256_broadcast_ss(p); }
+  static type fma(type a, type b, type c) { return _mm256_fmadd_ps(a, b, c); }
+};
+
+// 6 x 16 tile: 12 accumulators, 2 vectors of B and A in 16 registers
+static const GemmKernel kKernelAVX2 = {
+  "avx2", 6, 16, GemmTile<VecAVX2, 6, 2>, GemmTileGemv<VecAVX2, 6>,
+  DepthwiseRow3x3<VecAVX2>
+};
+
+const GemmKernel* GemmKernelAVX2() { return &kKernelAVX2; }
+
+// 4 x 16 int8 tile with no dot product of bytes: the even and the odd bytes
+// of B widen to 16 bits, as do those of A, and madd sums their products in
+// pairs, exact unlike maddubs, which saturates
+static void GemmTileInt8AVX2(int k, const int8_t* a, const uint8_t* b,
+                             int32_t* c, int ldc) {
+  const int MR = 4, NRV = 2;
+  __m256i acc[MR][NRV];
+  for (int i = 0; i < MR; ++i) {
+    for (int j = 0; j < NRV; ++j) {
+      acc[i][j] = _mm256_setzero_si256();
+    }
+  }
+  const __m256i low_bytes = _mm256_set1_epi16(0xff);
+  for (int p = 0; p < k; p += 4) {
+    __m256i even[NRV], odd[NRV];
+    for (int j = 0; j < NRV; ++j) {
+      const __m256i bv = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(b + j * 32));
+      even[j] = _mm256_and_si256(bv, low_bytes);
+      odd[j] = _mm256_srli_epi16(bv, 8);
+    }
+    for (int i = 0; i < MR; ++i) {
+      int32_t a4;
+      std::memcpy(&a4, a + i * 4, 4);
+      const __m256i av = _mm256_set1_epi32(a4);
+      const __m256i a_even = _mm256_srai_epi16(_mm256_slli_epi16(av, 8), 8);
+      const __m256i a_odd = _mm256_srai_epi16(av, 8);
+      for (int j = 0; j < NRV; ++j) {
+        acc[i][j] = _mm256_add_epi32(acc[i][j], _mm256_add_epi32(
+            _mm256_madd_epi16(even[j], a_even),
+            _mm256_madd_epi16(odd[j], a_odd)));
+      }
+    }
+    a += MR * 4;
+    b += NRV * 32;
+  }
+  for (int i = 0; i < MR; ++i) {
+    for (int j = 0; j < NRV; ++j) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + i * ldc + j * 8),
+                          acc[i][j]);
+    }
+  }
+}
+
+// 16 outputs at a time, the taps in pairs: the int16 inputs of two taps
+// interleaved meet their weights in one madd, within 128 bit lanes, whose
+// order the permutes restore
+static void DepthwiseRowInt8AVX2(const int16_t* const* in, const int16_t* k,
+                                 int taps, int width, int32_t* acc) {
+  int j = 0;
+  for (; j + 16 <= width; j += 16) {
+    __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+    for (int t = 0; t < taps; t += 2) {
+      const __m256i x0 = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(in[t] + j));
+      const __m256i x1 = t + 1 < taps ? _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(in[t + 1] + j)) :
+          _mm256_setzero_si256();
+      const __m256i kv = _mm256_set1_epi32(DepthwisePairInt8(k, t, taps));
+      lo = _mm256_add_epi32(lo, _mm256_madd_epi16(
+          _mm256_unpacklo_epi16(x0, x1), kv));
+      hi = _mm256_add_epi32(hi, _mm256_madd_epi16(
+          _mm256_unpackhi_epi16(x0, x1), kv));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + j),
+                        _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + j + 8),
+                        _mm256_permute2x128_si256(lo, hi, 0x31));
+  }
+  for (; j < width; ++j) {
+    int32_t sum = 0;
+    for (int t = 0; t < taps; ++t) {
+      sum += k[t] * in[t][j];
+    }
+    acc[j] = sum;
+  }
+}
+
+static const GemmKernelInt8 kKernelInt8AVX2 = {
+  "avx2", 4, 16, GemmTileInt8AVX2, DepthwiseRowInt8AVX2,
+  QuantizeInt8<VecAVX2, uint8_t, false>, QuantizeInt8<VecAVX2, int16_t, true>
+};
+
+const GemmKernelInt8* GemmKernelInt8AVX2() { return &kKernelInt8AVX2; }
+
+}  // namespace caffe
+
+#else
+
+namespace caffe {
+
+const GemmKernel* GemmKernelAVX2() { return NULL; }
+const GemmKernelInt8* GemmKernelInt8AVX2() { return NULL; }
+
+}  // namespace caffe
+
+#endif  // __AVX2__
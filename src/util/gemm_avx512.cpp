@@ -0,0 +1,39 @@
+// Compiled with AVX-512 enabled, see mini-caffe.cmake, and only run where the
+// CPU supports it.
+#include "./gemm_kernel.hpp"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+
+namespace caffe {
+
+struct VecAVX512 {
+  typedef __m512 type;
+  static const int kWidth = 16;
+  static type zero() { return _mm512_setzero_ps(); }
+  static type load(const real_t* p) { return _mm512_loadu_ps(p); }
+  static void store(real_t* p, type v) { _mm512_storeu_ps(p, v); }
+  static type add(type a, type b) { return _mm512_add_ps(a, b); }
+  static type broadcast(const real_t* p) { return _mm512_set1_ps(*p); }
+  static type fma(type a, type b, type c) { return _mm512_fmadd_ps(a, b, c); }
+};
+
+// 8 x 32 tile: 16 accumulators, 2 vectors of B and A in 32 registers
+static const GemmKernel kKernelAVX512 = {
+  "avx512", 8, 32, GemmTile<VecAVX512, 8, 2>, GemmTileGemv<VecAVX512, 8>,
+  DepthwiseRow3x3<VecAVX512>
+};
+
+const GemmKernel* GemmKernelAVX512() { return &kKernelAVX512; }
+
+}  // namespace caffe
+
+#else
+
+namespace caffe {
+
+const GemmKernel* GemmKernelAVX512() { return NULL; }
+
+}  // namespace caffe
+
+#endif  // __AVX512F__
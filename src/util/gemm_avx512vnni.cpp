@@ -0,0 +1,102 @@
+// Compiled with AVX-512 BW and VNNI enabled, see mini-caffe.cmake, and only
+// run where the CPU supports them.
+#include <cstring>
+
+#include "./gemm_kernel.hpp"
+
+// MSVC has no __AVX512VNNI__, /arch:AVX512 lets its intrinsics through
+#if defined(__AVX512BW__) && (defined(__AVX512VNNI__) || defined(_MSC_VER))
+#include <immintrin.h>
+
+namespace caffe {
+
+// tells the quantization of this instruction set apart
+struct VecAVX512VNNI {};
+
+// 8 x 32 int8 tile: vpdpbusd sums 4 products of uint8 B and int8 A into each
+// of the 16 accumulators
+static void GemmTileInt8AVX512VNNI(int k, const int8_t* a, const uint8_t* b,
+                                   int32_t* c, int ldc) {
+  const int MR = 8, NRV = 2;
+  __m512i acc[MR][NRV];
+  for (int i = 0; i < MR; ++i) {
+    for (int j = 0; j < NRV; ++j) {
+      acc[i][j] = _mm512_setzero_si512();
+    }
+  }
+  for (int p = 0; p < k; p += 4) {
+    __m512i bv[NRV];
+    for (int j = 0; j < NRV; ++j) {
+      bv[j] = _mm512_loadu_si512(b + j * 64);
+    }
+    for (int i = 0; i < MR; ++i) {
+      int32_t a4;
+      std::memcpy(&a4, a + i * 4, 4);
+      const __m512i av = _mm512_set1_epi32(a4);
+      for (int j = 0; j < NRV; ++j) {
+        acc[i][j] = _mm512_dpbusd_epi32(acc[i][j], bv[j], av);
+      }
+    }
+    a += MR * 4;
+    b += NRV * 64;
+  }
+  for (int i = 0; i < MR; ++i) {
+    for (int j = 0; j < NRV; ++j) {
+      _mm512_storeu_si512(c + i * ldc + j * 16, acc[i][j]);
+    }
+  }
+}
+
+// 32 outputs at a time, the taps in pairs: the int16 inputs of two taps
+// interleaved meet their weights in one vpdpwssd, within 128 bit lanes, whose
+// order the permutes restore
+static void DepthwiseRowInt8AVX512VNNI(const int16_t* const* in,
+                                       const int16_t* k, int taps, int width,
+                                       int32_t* acc) {
+  const __m512i first = _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0);
+  const __m512i second = _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4);
+  int j = 0;
+  for (; j + 32 <= width; j += 32) {
+    __m512i lo = _mm512_setzero_si512(), hi = _mm512_setzero_si512();
+    for (int t = 0; t < taps; t += 2) {
+      const __m512i x0 = _mm512_loadu_si512(in[t] + j);
+      const __m512i x1 = t + 1 < taps ? _mm512_loadu_si512(in[t + 1] + j)
+                                      : _mm512_setzero_si512();
+      const __m512i kv = _mm512_set1_epi32(DepthwisePairInt8(k, t, taps));
+      lo = _mm512_dpwssd_epi32(lo, _mm512_unpacklo_epi16(x0, x1), kv);
+      hi = _mm512_dpwssd_epi32(hi, _mm512_unpackhi_epi16(x0, x1), kv);
+    }
+    _mm512_storeu_si512(acc + j, _mm512_permutex2var_epi64(lo, first, hi));
+    _mm512_storeu_si512(acc + j + 16,
+                        _mm512_permutex2var_epi64(lo, second, hi));
+  }
+  for (; j < width; ++j) {
+    int32_t sum = 0;
+    for (int t = 0; t < taps; ++t) {
+      sum += k[t] * in[t][j];
+    }
+    acc[j] = sum;
+  }
+}
+
+static const GemmKernelInt8 kKernelInt8AVX512VNNI = {
+  "avx512vnni", 8, 32, GemmTileInt8AVX512VNNI, DepthwiseRowInt8AVX512VNNI,
+  QuantizeInt8<VecAVX512VNNI, uint8_t, false>,
+  QuantizeInt8<VecAVX512VNNI, int16_t, true>
+};
+
+const GemmKernelInt8* GemmKernelInt8AVX512VNNI() {
+  return &kKernelInt8AVX512VNNI;
+}
+
+}  // namespace caffe
+
+#else
+
+namespace caffe {
+
+const GemmKernelInt8* GemmKernelInt8AVX512VNNI() { return NULL; }
+
+}  // namespace caffe
+
+#endif  // __AVX512BW__
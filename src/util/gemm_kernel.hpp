@@ -0,0 +1,245 @@
+#ifndef CAFFE_UTIL_GEMM_KERNEL_HPP_
+#define CAFFE_UTIL_GEMM_KERNEL_HPP_
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include "caffe/base.hpp"
+
+namespace caffe {
+
+/*!
+ * \brief Microkernel of the blocked GEMM for one instruction set. A is packed
+ *  in panels of mr rows, B in panels of nr columns, both k major, so a tile
+ *  reads both panels front to back. Carries the depthwise convolution row of
+ *  the same instruction set along.
+ */
+struct GemmKernel {
+  const char* name;
+  int mr;
+  int nr;
+  /*!
+   * \brief c[i * ldc + j] (+)= sum over p of a[p * mr + i] * b[p * nr + j]
+   *  for the full mr x nr tile, added to c if accumulate
+   */
+  void (*tile)(int k, const real_t* a, const real_t* b, real_t* c, int ldc,
+               bool accumulate);
+  /*! \brief y[i] (+)= sum over p of a[p * mr + i] * x[p], for N = 1 */
+  void (*tile_gemv)(int k, const real_t* a, const real_t* x, real_t* y,
+                    bool accumulate);
+  /*!
+   * \brief out[j] = bias + sum over r < 3 of k[r * 3] * in_r[j] +
+   *  k[r * 3 + 1] * in_r[j + mid] + k[r * 3 + 2] * in_r[j + right] for
+   *  j < width, in_r = in + r * ldin: a row of a 3x3 depthwise convolution
+   *  whose input columns are laid out so each tap reads them in order
+   */
+  void (*depthwise3x3)(const real_t* in, int ldin, int mid, int right,
+                       const real_t* k, real_t bias, int width, real_t* out);
+};
+
+/*!
+ * \brief GemmKernel tile of MR rows and NRV vectors of V::kWidth columns.
+ *  Instantiated in the translation unit compiled for the instruction set of
+ *  V, which provides zero, load, store, add, broadcast and fma on V::type.
+ */
+template <class V, int MR, int NRV>
+void GemmTile(int k, const real_t* a, const real_t* b, real_t* c, int ldc,
+              bool accumulate) {
+  typedef typename V::type vec;
+  vec acc[MR][NRV];
+  for (int i = 0; i < MR; ++i) {
+    for (int j = 0; j < NRV; ++j) {
+      acc[i][j] = V::zero();
+    }
+  }
+  for (int p = 0; p < k; ++p) {
+    vec bv[NRV];
+    for (int j = 0; j < NRV; ++j) {
+      bv[j] = V::load(b + j * V::kWidth);
+    }
+    for (int i = 0; i < MR; ++i) {
+      const vec av = V::broadcast(a + i);
+      for (int j = 0; j < NRV; ++j) {
+        acc[i][j] = V::fma(av, bv[j], acc[i][j]);
+      }
+    }
+    a += MR;
+    b += NRV * V::kWidth;
+  }
+  for (int i = 0; i < MR; ++i) {
+    for (int j = 0; j < NRV; ++j) {
+      real_t* out = c + i * ldc + j * V::kWidth;
+      V::store(out, accumulate ? V::add(V::load(out), acc[i][j]) : acc[i][j]);
+    }
+  }
+}
+
+/*!
+ * \brief GemmKernel tile_gemv, streaming A once is memory bound, so leave the
+ *  vectorization to the compiler. V only tells apart the instances compiled
+ *  for different instruction sets, which the linker would merge otherwise.
+ */
+template <class V, int MR>
+void GemmTileGemv(int k, const real_t* a, const real_t* x, real_t* y,
+                  bool accumulate) {
+  real_t acc[MR] = {0};
+  for (int p = 0; p < k; ++p) {
+    for (int i = 0; i < MR; ++i) {
+      acc[i] += a[i] * x[p];
+    }
+    a += MR;
+  }
+  for (int i = 0; i < MR; ++i) {
+    y[i] = accumulate ? y[i] + acc[i] : acc[i];
+  }
+}
+
+/*!
+ * \brief GemmKernel depthwise3x3, V::kWidth outputs per step and the last
+ *  ones left to the compiler.
+ */
+template <class V>
+void DepthwiseRow3x3(const real_t* in, int ldin, int mid, int right,
+                     const real_t* k, real_t bias, int width, real_t* out) {
+  typedef typename V::type vec;
+  const real_t* in0 = in;
+  const real_t* in1 = in + ldin;
+  const real_t* in2 = in + 2 * ldin;
+  vec kv[9];
+  for (int i = 0; i < 9; ++i) {
+    kv[i] = V::broadcast(k + i);
+  }
+  const vec bv = V::broadcast(&bias);
+  int j = 0;
+  for (; j + V::kWidth <= width; j += V::kWidth) {
+    vec acc = bv;
+    acc = V::fma(kv[0], V::load(in0 + j), acc);
+    acc = V::fma(kv[1], V::load(in0 + j + mid), acc);
+    acc = V::fma(kv[2], V::load(in0 + j + right), acc);
+    acc = V::fma(kv[3], V::load(in1 + j), acc);
+    acc = V::fma(kv[4], V::load(in1 + j + mid), acc);
+    acc = V::fma(kv[5], V::load(in1 + j + right), acc);
+    acc = V::fma(kv[6], V::load(in2 + j), acc);
+    acc = V::fma(kv[7], V::load(in2 + j + mid), acc);
+    acc = V::fma(kv[8], V::load(in2 + j + right), acc);
+    V::store(out + j, acc);
+  }
+  for (; j < width; ++j) {
+    out[j] = bias +
+        k[0] * in0[j] + k[1] * in0[j + mid] + k[2] * in0[j + right] +
+        k[3] * in1[j] + k[4] * in1[j + mid] + k[5] * in1[j + right] +
+        k[6] * in2[j] + k[7] * in2[j + mid] + k[8] * in2[j + right];
+  }
+}
+
+/*!
+ * \brief Microkernel of the int8 gemm, see caffe_cpu_gemm_int8. A is int8 in
+ *  panels of mr rows, B uint8 in panels of nr columns, both packed 4 deep at
+ *  a time: (i, p) of an A panel at (p / 4 * mr + i) * 4 + p % 4, (p, j) of a
+ *  B panel at (p / 4 * nr + j) * 4 + p % 4, so a tile takes dot products of
+ *  4 bytes. Carries the int8 depthwise convolution row along.
+ */
+struct GemmKernelInt8 {
+  const char* name;
+  int mr;
+  int nr;
+  /*!
+   * \brief c[i * ldc + j] = sum over p of a(i, p) * b(p, j) for the full
+   *  mr x nr tile, k a multiple of 4
+   */
+  void (*tile)(int k, const int8_t* a, const uint8_t* b, int32_t* c, int ldc);
+  /*!
+   * \brief acc[j] = sum over t < taps of k[t] * in[t][j] for j < width: an
+   *  output row of an int8 depthwise convolution, in[t] what tap t sees
+   */
+  void (*depthwise_row)(const int16_t* const* in, const int16_t* k, int taps,
+                        int width, int32_t* acc);
+  /*!
+   * \brief q[i] = round(x[i] * inv_scale) + zero_point clamped to uint8 for
+   *  i < n, the input of a gemm
+   */
+  void (*quantize)(int n, const real_t* x, real_t inv_scale, int zero_point,
+                   uint8_t* q);
+  /*! \brief quantize less the zero point, the input of depthwise_row */
+  void (*quantize_int16)(int n, const real_t* x, real_t inv_scale,
+                         int zero_point, int16_t* q);
+};
+
+/*! \brief GemmKernelInt8 tile of MR x NR in plain code */
+template <int MR, int NR>
+void GemmTileInt8(int k, const int8_t* a, const uint8_t* b, int32_t* c,
+                  int ldc) {
+  int32_t acc[MR][NR] = {{0}};
+  for (int p = 0; p < k; p += 4) {
+    for (int i = 0; i < MR; ++i) {
+      for (int j = 0; j < NR; ++j) {
+        for (int q = 0; q < 4; ++q) {
+          acc[i][j] += a[i * 4 + q] * b[j * 4 + q];
+        }
+      }
+    }
+    a += MR * 4;
+    b += NR * 4;
+  }
+  for (int i = 0; i < MR; ++i) {
+    for (int j = 0; j < NR; ++j) {
+      c[i * ldc + j] = acc[i][j];
+    }
+  }
+}
+
+/*!
+ * \brief GemmKernelInt8 depthwise_row, left to the vectorizer of the
+ *  instruction set compiled for. V tells the instances apart like for
+ *  GemmTileGemv.
+ */
+template <class V>
+void DepthwiseRowInt8(const int16_t* const* in, const int16_t* k, int taps,
+                      int width, int32_t* acc) {
+  std::fill(acc, acc + width, 0);
+  for (int t = 0; t < taps; ++t) {
+    const int32_t kt = k[t];
+    const int16_t* x = in[t];
+    for (int j = 0; j < width; ++j) {
+      acc[j] += kt * x[j];
+    }
+  }
+}
+
+/*!
+ * \brief the weights of taps t and t + 1 of a depthwise_row in the low and
+ *  the high half of 32 bits, for the multiply-adds of int16 pairs, those of
+ *  t alone past the last tap
+ */
+inline int32_t DepthwisePairInt8(const int16_t* k, int t, int taps) {
+  const uint32_t high = t + 1 < taps ? static_cast<uint16_t>(k[t + 1]) : 0;
+  return static_cast<int32_t>(high << 16 | static_cast<uint16_t>(k[t]));
+}
+
+/*!
+ * \brief GemmKernelInt8 quantize into T less offset, left to the vectorizer
+ *  like DepthwiseRowInt8. The clamps only vectorize if floating point may not
+ *  trap, see mini-caffe.cmake.
+ */
+template <class V, typename T, bool kLessZeroPoint>
+void QuantizeInt8(int n, const real_t* x, real_t inv_scale, int zero_point,
+                  T* q) {
+  const int offset = kLessZeroPoint ? zero_point : 0;
+  for (int i = 0; i < n; ++i) {
+    const real_t v = std::min(std::max(x[i] * inv_scale + zero_point,
+                                       real_t(0)), real_t(255));
+    // through int, which vectorizes unlike a conversion to uint8
+    q[i] = static_cast<T>(static_cast<int>(v + real_t(0.5)) - offset);
+  }
+}
+
+/*! \brief kernels of the instruction sets the compiler may target */
+const GemmKernel* GemmKernelAVX512();
+const GemmKernel* GemmKernelAVX2();
+const GemmKernelInt8* GemmKernelInt8AVX512VNNI();
+const GemmKernelInt8* GemmKernelInt8AVX2();
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_GEMM_KERNEL_HPP_
@@ -1,7 +1,9 @@
+#include <algorithm>
 #include <vector>
 
 #include "./im2col.hpp"
 #include "./math_functions.hpp"
+#include "./thread_pool.hpp"
 
 namespace caffe {
 
@@ -27,31 +29,38 @@ void im2col_cpu(const Dtype* data_im, const int channels,
   const int output_w = (width + 2 * pad_w -
     (dilation_w * (kernel_w - 1) + 1)) / stride_w + 1;
   const int channel_size = height * width;
-  for (int channel = channels; channel--; data_im += channel_size) {
-    for (int kernel_row = 0; kernel_row < kernel_h; kernel_row++) {
-      for (int kernel_col = 0; kernel_col < kernel_w; kernel_col++) {
-        int input_row = -pad_h + kernel_row * dilation_h;
-        for (int output_rows = output_h; output_rows; output_rows--) {
-          if (!is_a_ge_zero_and_a_lt_b(input_row, height)) {
-            for (int output_cols = output_w; output_cols; output_cols--) {
-              *(data_col++) = 0;
-            }
-          } else {
-            int input_col = -pad_w + kernel_col * dilation_w;
-            for (int output_col = output_w; output_col; output_col--) {
-              if (is_a_ge_zero_and_a_lt_b(input_col, width)) {
-                *(data_col++) = data_im[input_row * width + input_col];
-              } else {
-                *(data_col++) = 0;
+  const int col_channel_size = kernel_h * kernel_w * output_h * output_w;
+  // channels fill separate rows of the column buffer
+  parallel_for(0, channels, [&](int begin, int end) {
+    const Dtype* data_im_c = data_im + begin * channel_size;
+    Dtype* data_col_c = data_col + begin * col_channel_size;
+    for (int channel = begin; channel < end;
+         ++channel, data_im_c += channel_size) {
+      for (int kernel_row = 0; kernel_row < kernel_h; kernel_row++) {
+        for (int kernel_col = 0; kernel_col < kernel_w; kernel_col++) {
+          int input_row = -pad_h + kernel_row * dilation_h;
+          for (int output_rows = output_h; output_rows; output_rows--) {
+            if (!is_a_ge_zero_and_a_lt_b(input_row, height)) {
+              for (int output_cols = output_w; output_cols; output_cols--) {
+                *(data_col_c++) = 0;
+              }
+            } else {
+              int input_col = -pad_w + kernel_col * dilation_w;
+              for (int output_col = output_w; output_col; output_col--) {
+                if (is_a_ge_zero_and_a_lt_b(input_col, width)) {
+                  *(data_col_c++) = data_im_c[input_row * width + input_col];
+                } else {
+                  *(data_col_c++) = 0;
+                }
+                input_col += stride_w;
               }
-              input_col += stride_w;
             }
+            input_row += stride_h;
           }
-          input_row += stride_h;
         }
       }
     }
-  }
+  }, parallel_grain(col_channel_size));
 }
 
 // Explicit instantiation
@@ -61,6 +70,210 @@ template void im2col_cpu<float>(const float* data_im, const int channels,
     const int stride_w, const int dilation_h, const int dilation_w,
     float* data_col);
 
+template <typename Dtype>
+void im2col_pack_cpu(const Dtype* data_im, const int channels,
+    const int height, const int width, const int kernel_h, const int kernel_w,
+    const int pad_h, const int pad_w,
+    const int stride_h, const int stride_w,
+    const int dilation_h, const int dilation_w,
+    const int k0, const int kc, const int n0, const int n1, const int nr,
+    Dtype* data_packed, const int channel_block) {
+  const int output_w = (width + 2 * pad_w -
+    (dilation_w * (kernel_w - 1) + 1)) / stride_w + 1;
+  const int kernel_size = kernel_h * kernel_w;
+  if (channel_block) {
+    // a column of the image holds block channels in a row, which are rows
+    // kernel_size apart here, so the columns go by per block of channels
+    const int block = channel_block;
+    const int plane = height * width * block;
+    for (int offset = 0; offset < kernel_size; ++offset) {
+      const int kernel_row = offset / kernel_w, kernel_col = offset % kernel_w;
+      // the channels whose row of this kernel offset is in [k0, k0 + kc)
+      const int c_begin = std::max(0,
+          (k0 - offset + kernel_size - 1) / kernel_size);
+      const int c_end = std::min(channels,
+          (k0 + kc - offset + kernel_size - 1) / kernel_size);
+      for (int c = c_begin; c < c_end;) {
+        const int n = std::min(c_end, (c / block + 1) * block) - c;
+        const Dtype* in_c = data_im + c / block * plane + c % block;
+        Dtype* out_c = data_packed + (c * kernel_size + offset - k0) * nr;
+        const int row_step = kernel_size * nr;
+        int output_row = n0 / output_w, output_col = n0 % output_w;
+        for (int j = n0, lane = 0; j < n1; ++j) {
+          const int input_row = output_row * stride_h - pad_h +
+                                kernel_row * dilation_h;
+          const int input_col = output_col * stride_w - pad_w +
+                                kernel_col * dilation_w;
+          if (is_a_ge_zero_and_a_lt_b(input_row, height) &&
+              is_a_ge_zero_and_a_lt_b(input_col, width)) {
+            const Dtype* in = in_c + (input_row * width + input_col) * block;
+            for (int i = 0; i < n; ++i) {
+              out_c[lane + i * row_step] = in[i];
+            }
+          } else {
+            for (int i = 0; i < n; ++i) {
+              out_c[lane + i * row_step] = Dtype(0);
+            }
+          }
+          if (++output_col == output_w) {
+            ++output_row;
+            output_col = 0;
+          }
+          if (++lane == nr) {
+            out_c += kc * nr;
+            lane = 0;
+          }
+        }
+        c += n;
+      }
+    }
+  } else {
+    for (int p = 0; p < kc; ++p) {
+      // row k0 + p of the column buffer, all the columns of it at once
+      const int channel = (k0 + p) / kernel_size;
+      const int kernel_row = (k0 + p) % kernel_size / kernel_w;
+      const int kernel_col = (k0 + p) % kernel_w;
+      const Dtype* data_im_c = data_im + channel * height * width;
+      int output_row = n0 / output_w, output_col = n0 % output_w;
+      // runs of columns within a panel and a row of the output
+      for (int j = n0; j < n1;) {
+        const int lane = (j - n0) % nr;
+        const int n = std::min(std::min(nr - lane, output_w - output_col),
+                               n1 - j);
+        Dtype* out = data_packed + static_cast<size_t>(j - n0 - lane) * kc +
+                     p * nr + lane;
+        const int input_row = output_row * stride_h - pad_h +
+                              kernel_row * dilation_h;
+        if (!is_a_ge_zero_and_a_lt_b(input_row, height)) {
+          std::fill(out, out + n, Dtype(0));
+        } else {
+          // columns [lo, hi) of the n are within the row, the rest padding
+          const int input_col = output_col * stride_w - pad_w +
+                                kernel_col * dilation_w;
+          const int lo = std::min(n, input_col >= 0 ? 0
+              : (-input_col + stride_w - 1) / stride_w);
+          const int hi = std::max(lo, std::min(n,
+              (width - input_col + stride_w - 1) / stride_w));
+          const Dtype* in = data_im_c + input_row * width + input_col;
+          std::fill(out, out + lo, Dtype(0));
+          if (stride_w == 1) {
+            std::copy(in + lo, in + hi, out + lo);
+          } else {
+            for (int i = lo; i < hi; ++i) {
+              out[i] = in[i * stride_w];
+            }
+          }
+          std::fill(out + hi, out + n, Dtype(0));
+        }
+        j += n;
+        output_col += n;
+        if (output_col == output_w) {
+          ++output_row;
+          output_col = 0;
+        }
+      }
+    }
+  }
+  // the last panel padded with zeros
+  const int tail = (n1 - n0) % nr;
+  if (tail) {
+    Dtype* out = data_packed + static_cast<size_t>(n1 - n0 - tail) * kc;
+    for (int p = 0; p < kc; ++p) {
+      std::fill(out + p * nr + tail, out + (p + 1) * nr, Dtype(0));
+    }
+  }
+}
+
+// Explicit instantiation
+template void im2col_pack_cpu<float>(const float* data_im,
+    const int channels, const int height, const int width,
+    const int kernel_h, const int kernel_w, const int pad_h, const int pad_w,
+    const int stride_h, const int stride_w, const int dilation_h,
+    const int dilation_w, const int k0, const int kc, const int n0,
+    const int n1, const int nr, float* data_packed, const int channel_block);
+
+void im2col_pack_int8(const uint8_t* data_im, const int channels,
+    const int height, const int width, const int kernel_h, const int kernel_w,
+    const int pad_h, const int pad_w, const int stride_h,
+    const int stride_w, const int dilation_h, const int dilation_w,
+    const int zero_point, const int n0, const int n1, const int nr,
+    uint8_t* data_packed) {
+  const int output_w = (width + 2 * pad_w -
+      (dilation_w * (kernel_w - 1) + 1)) / stride_w + 1;
+  const int kernel_size = kernel_h * kernel_w;
+  const int rows = channels * kernel_size;
+  const int depth = (rows + 3) / 4 * 4;
+  const int n = n1 - n0;
+  // 4 rows of the col buffer at a time, interleaved into the panels
+  static thread_local std::vector<uint8_t> buffer;
+  buffer.resize(std::max<size_t>(buffer.size(), 4 * static_cast<size_t>(n)));
+  for (int p0 = 0; p0 < depth; p0 += 4) {
+    for (int q = 0; q < 4; ++q) {
+      uint8_t* row = &buffer[q * n];
+      // the rows past the end meet zero weights
+      if (p0 + q >= rows) {
+        std::fill(row, row + n, 0);
+        continue;
+      }
+      const int channel = (p0 + q) / kernel_size;
+      const int kernel_row = (p0 + q) % kernel_size / kernel_w;
+      const int kernel_col = (p0 + q) % kernel_w;
+      const uint8_t* data_im_c =
+          data_im + static_cast<size_t>(channel) * height * width;
+      int output_row = n0 / output_w, output_col = n0 % output_w;
+      // runs of columns within a row of the output
+      for (int j = 0; j < n;) {
+        const int len = std::min(output_w - output_col, n - j);
+        uint8_t* out = row + j;
+        const int input_row = output_row * stride_h - pad_h +
+                              kernel_row * dilation_h;
+        if (!is_a_ge_zero_and_a_lt_b(input_row, height)) {
+          std::fill(out, out + len, zero_point);
+        } else {
+          // columns [lo, hi) of the run are within the row, the rest padding
+          const int input_col = output_col * stride_w - pad_w +
+                                kernel_col * dilation_w;
+          const int lo = std::min(len, input_col >= 0 ? 0
+              : (-input_col + stride_w - 1) / stride_w);
+          const int hi = std::max(lo, std::min(len,
+              (width - input_col + stride_w - 1) / stride_w));
+          const uint8_t* in = data_im_c + input_row * width + input_col;
+          std::fill(out, out + lo, zero_point);
+          if (stride_w == 1) {
+            std::copy(in + lo, in + hi, out + lo);
+          } else {
+            for (int i = lo; i < hi; ++i) {
+              out[i] = in[i * stride_w];
+            }
+          }
+          std::fill(out + hi, out + len, zero_point);
+        }
+        j += len;
+        output_col += len;
+        if (output_col == output_w) {
+          ++output_row;
+          output_col = 0;
+        }
+      }
+    }
+    const uint8_t* row0 = &buffer[0];
+    const uint8_t* row1 = row0 + n;
+    const uint8_t* row2 = row1 + n;
+    const uint8_t* row3 = row2 + n;
+    // the columns past n1 of the last panel are dropped
+    for (int j0 = 0; j0 < n; j0 += nr) {
+      uint8_t* out = data_packed + static_cast<size_t>(j0) * depth + p0 * nr;
+      const int nj = std::min(nr, n - j0);
+      for (int j = 0; j < nj; ++j) {
+        out[j * 4] = row0[j0 + j];
+        out[j * 4 + 1] = row1[j0 + j];
+        out[j * 4 + 2] = row2[j0 + j];
+        out[j * 4 + 3] = row3[j0 + j];
+      }
+    }
+  }
+}
+
 template <typename Dtype>
 inline void im2col_nd_core_cpu(const Dtype* data_input, const bool im2col,
     const int num_spatial_axes, const int* im_shape, const int* col_shape,
@@ -156,34 +369,41 @@ void col2im_cpu(const Dtype* data_col, const int channels,
     const int stride_h, const int stride_w,
     const int dilation_h, const int dilation_w,
     Dtype* data_im) {
-  caffe_set(height * width * channels, Dtype(0), data_im);
   const int output_h = (height + 2 * pad_h -
     (dilation_h * (kernel_h - 1) + 1)) / stride_h + 1;
   const int output_w = (width + 2 * pad_w -
     (dilation_w * (kernel_w - 1) + 1)) / stride_w + 1;
   const int channel_size = height * width;
-  for (int channel = channels; channel--; data_im += channel_size) {
-    for (int kernel_row = 0; kernel_row < kernel_h; kernel_row++) {
-      for (int kernel_col = 0; kernel_col < kernel_w; kernel_col++) {
-        int input_row = -pad_h + kernel_row * dilation_h;
-        for (int output_rows = output_h; output_rows; output_rows--) {
-          if (!is_a_ge_zero_and_a_lt_b(input_row, height)) {
-            data_col += output_w;
-          } else {
-            int input_col = -pad_w + kernel_col * dilation_w;
-            for (int output_col = output_w; output_col; output_col--) {
-              if (is_a_ge_zero_and_a_lt_b(input_col, width)) {
-                data_im[input_row * width + input_col] += *data_col;
+  const int col_channel_size = kernel_h * kernel_w * output_h * output_w;
+  // channels sum into separate planes of the image
+  parallel_for(0, channels, [&](int begin, int end) {
+    Dtype* data_im_c = data_im + begin * channel_size;
+    const Dtype* data_col_c = data_col + begin * col_channel_size;
+    caffe_set((end - begin) * channel_size, Dtype(0), data_im_c);
+    for (int channel = begin; channel < end;
+         ++channel, data_im_c += channel_size) {
+      for (int kernel_row = 0; kernel_row < kernel_h; kernel_row++) {
+        for (int kernel_col = 0; kernel_col < kernel_w; kernel_col++) {
+          int input_row = -pad_h + kernel_row * dilation_h;
+          for (int output_rows = output_h; output_rows; output_rows--) {
+            if (!is_a_ge_zero_and_a_lt_b(input_row, height)) {
+              data_col_c += output_w;
+            } else {
+              int input_col = -pad_w + kernel_col * dilation_w;
+              for (int output_col = output_w; output_col; output_col--) {
+                if (is_a_ge_zero_and_a_lt_b(input_col, width)) {
+                  data_im_c[input_row * width + input_col] += *data_col_c;
+                }
+                data_col_c++;
+                input_col += stride_w;
               }
-              data_col++;
-              input_col += stride_w;
             }
+            input_row += stride_h;
           }
-          input_row += stride_h;
         }
       }
     }
-  }
+  }, parallel_grain(col_channel_size));
 }
 
 // Explicit instantiation
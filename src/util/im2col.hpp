@@ -1,6 +1,8 @@
 #ifndef _CAFFE_UTIL_IM2COL_HPP_
 #define _CAFFE_UTIL_IM2COL_HPP_
 
+#include <stdint.h>
+
 namespace caffe {
 
 template <typename Dtype>
@@ -16,6 +18,32 @@ void im2col_cpu(const Dtype* data_im, const int channels,
     const int stride_w, const int dilation_h, const int dilation_w,
     Dtype* data_col);
 
+/**
+ * @brief rows [k0, k0 + kc) and columns [n0, n1) of what im2col_cpu makes,
+ *        packed for caffe_cpu_gemm_packed in panels of nr columns, row by
+ *        row, padded with zeros, see GemmPackB. data_im is blocked in
+ *        channels of channel_block unless 0, see NetParameter.channel_block.
+ */
+template <typename Dtype>
+void im2col_pack_cpu(const Dtype* data_im, const int channels,
+    const int height, const int width, const int kernel_h, const int kernel_w,
+    const int pad_h, const int pad_w, const int stride_h,
+    const int stride_w, const int dilation_h, const int dilation_w,
+    const int k0, const int kc, const int n0, const int n1, const int nr,
+    Dtype* data_packed, const int channel_block = 0);
+
+/**
+ * @brief columns [n0, n1) of what im2col_cpu makes of a uint8 image, packed
+ *        for caffe_cpu_gemm_int8 in panels of nr columns, 4 rows at a time,
+ *        see GemmPackBInt8. Outside the image it is zero_point.
+ */
+void im2col_pack_int8(const uint8_t* data_im, const int channels,
+    const int height, const int width, const int kernel_h, const int kernel_w,
+    const int pad_h, const int pad_w, const int stride_h,
+    const int stride_w, const int dilation_h, const int dilation_w,
+    const int zero_point, const int n0, const int n1, const int nr,
+    uint8_t* data_packed);
+
 template <typename Dtype>
 void col2im_nd_cpu(const Dtype* data_col, const int num_spatial_axes,
     const int* im_shape, const int* col_shape,
@@ -0,0 +1,159 @@
+// Built with BLAS=internal only, see mini-caffe.cmake.
+#ifdef USE_INTERNAL_BLAS
+
+#include <cmath>
+
+#include "./gemm.hpp"
+#include "./thread_pool.hpp"
+
+using caffe::PackedMatrix;
+using caffe::parallel_for;
+using caffe::parallel_grain;
+
+// Y = beta * Y for rows of N elements, zeros for beta 0 whatever Y was
+static void ScaleRows(const int rows, const int N, const float beta, float* Y,
+                      const int ldy) {
+  for (int i = 0; i < rows; ++i) {
+    float* y = Y + static_cast<size_t>(i) * ldy;
+    for (int j = 0; j < N; ++j) {
+      y[j] = beta == 0 ? 0 : beta * y[j];
+    }
+  }
+}
+
+void cblas_sgemm(const CBLAS_ORDER Order, const CBLAS_TRANSPOSE TransA,
+    const CBLAS_TRANSPOSE TransB, const int M, const int N, const int K,
+    const float alpha, const float* A, const int lda, const float* B,
+    const int ldb, const float beta, float* C, const int ldc) {
+  if (Order == CblasColMajor) {
+    // C^T = op(B)^T * op(A)^T in row major
+    cblas_sgemm(CblasRowMajor, TransB, TransA, N, M, K, alpha, B, ldb, A, lda,
+                beta, C, ldc);
+    return;
+  }
+  if (M == 0 || N == 0) {
+    return;
+  }
+  if (K == 0 || alpha == 0) {
+    ScaleRows(M, N, beta, C, ldc);
+    return;
+  }
+  const bool trans_a = TransA != CblasNoTrans;
+  const bool trans_b = TransB != CblasNoTrans;
+  if (N == 1) {
+    // a column of C from the column of op(B)
+    cblas_sgemv(CblasRowMajor, TransA, trans_a ? K : M, trans_a ? M : K,
+                alpha, A, lda, B, trans_b ? 1 : ldb, beta, C, ldc);
+    return;
+  }
+  if (M == 1) {
+    // the row of C is op(B)^T times the row of op(A)
+    cblas_sgemv(CblasRowMajor, trans_b ? CblasNoTrans : CblasTrans,
+                trans_b ? N : K, trans_b ? K : N, alpha, B, ldb, A,
+                trans_a ? lda : 1, beta, C, 1);
+    return;
+  }
+  PackedMatrix packed;
+  packed.Pack(trans_a, M, K, A, lda, alpha);
+  caffe::caffe_cpu_gemm_packed(packed, TransB, N, B, ldb, beta, C, ldc);
+}
+
+void cblas_sgemv(const CBLAS_ORDER Order, const CBLAS_TRANSPOSE TransA,
+    const int M, const int N, const float alpha, const float* A, const int lda,
+    const float* X, const int incX, const float beta, float* Y,
+    const int incY) {
+  if (Order == CblasColMajor) {
+    // A in column major is A^T in row major
+    cblas_sgemv(CblasRowMajor,
+                TransA == CblasNoTrans ? CblasTrans : CblasNoTrans, N, M,
+                alpha, A, lda, X, incX, beta, Y, incY);
+    return;
+  }
+  if (TransA == CblasNoTrans) {
+    // a dot product for every element of y
+    parallel_for(0, M, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        const float dot =
+            cblas_sdot(N, A + static_cast<size_t>(i) * lda, 1, X, incX);
+        float& y = Y[static_cast<size_t>(i) * incY];
+        y = alpha * dot + (beta == 0 ? 0 : beta * y);
+      }
+    }, parallel_grain(N));
+  } else {
+    // A row by row, for a part of y on every thread
+    parallel_for(0, N, [&](int begin, int end) {
+      for (int j = begin; j < end; ++j) {
+        float& y = Y[static_cast<size_t>(j) * incY];
+        y = beta == 0 ? 0 : beta * y;
+      }
+      for (int i = 0; i < M; ++i) {
+        cblas_saxpy(end - begin, alpha * X[static_cast<size_t>(i) * incX],
+                    A + static_cast<size_t>(i) * lda + begin, 1,
+                    Y + static_cast<size_t>(begin) * incY, incY);
+      }
+    }, parallel_grain(M));
+  }
+}
+
+void cblas_saxpy(const int N, const float alpha, const float* X,
+    const int incX, float* Y, const int incY) {
+  if (incX == 1 && incY == 1) {
+    for (int i = 0; i < N; ++i) {
+      Y[i] += alpha * X[i];
+    }
+    return;
+  }
+  for (int i = 0; i < N; ++i) {
+    Y[static_cast<size_t>(i) * incY] += alpha * X[static_cast<size_t>(i) * incX];
+  }
+}
+
+void cblas_sscal(const int N, const float alpha, float* X, const int incX) {
+  for (int i = 0; i < N; ++i) {
+    X[static_cast<size_t>(i) * incX] *= alpha;
+  }
+}
+
+void cblas_scopy(const int N, const float* X, const int incX, float* Y,
+    const int incY) {
+  for (int i = 0; i < N; ++i) {
+    Y[static_cast<size_t>(i) * incY] = X[static_cast<size_t>(i) * incX];
+  }
+}
+
+float cblas_sdot(const int N, const float* X, const int incX, const float* Y,
+    const int incY) {
+  if (incX == 1 && incY == 1) {
+    // independent sums, which the compiler keeps in vector registers
+    float sums[8] = {0};
+    int i = 0;
+    for (; i + 8 <= N; i += 8) {
+      for (int j = 0; j < 8; ++j) {
+        sums[j] += X[i + j] * Y[i + j];
+      }
+    }
+    float dot = 0;
+    for (int j = 0; j < 8; ++j) {
+      dot += sums[j];
+    }
+    for (; i < N; ++i) {
+      dot += X[i] * Y[i];
+    }
+    return dot;
+  }
+  float dot = 0;
+  for (int i = 0; i < N; ++i) {
+    dot += X[static_cast<size_t>(i) * incX] * Y[static_cast<size_t>(i) * incY];
+  }
+  return dot;
+}
+
+float cblas_sasum(const int N, const float* X, const int incX) {
+  float sum = 0;
+  for (int i = 0; i < N; ++i) {
+    sum += std::fabs(X[static_cast<size_t>(i) * incX]);
+  }
+  return sum;
+}
+
+#endif  // USE_INTERNAL_BLAS
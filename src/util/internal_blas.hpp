@@ -0,0 +1,38 @@
+#ifndef CAFFE_UTIL_INTERNAL_BLAS_HPP_
+#define CAFFE_UTIL_INTERNAL_BLAS_HPP_
+
+/*!
+ * \brief The part of cblas Mini-Caffe uses, in place of a BLAS library with
+ *  BLAS=internal. gemm runs on the kernels of gemm.hpp, the rest are plain
+ *  loops. Increments must be positive. The functions have C++ linkage, so
+ *  they don't clash with a BLAS library loaded in the same process.
+ */
+enum CBLAS_ORDER { CblasRowMajor = 101, CblasColMajor = 102 };
+enum CBLAS_TRANSPOSE {
+  CblasNoTrans = 111, CblasTrans = 112, CblasConjTrans = 113
+};
+
+void cblas_sgemm(const CBLAS_ORDER Order, const CBLAS_TRANSPOSE TransA,
+    const CBLAS_TRANSPOSE TransB, const int M, const int N, const int K,
+    const float alpha, const float* A, const int lda, const float* B,
+    const int ldb, const float beta, float* C, const int ldc);
+
+void cblas_sgemv(const CBLAS_ORDER Order, const CBLAS_TRANSPOSE TransA,
+    const int M, const int N, const float alpha, const float* A, const int lda,
+    const float* X, const int incX, const float beta, float* Y,
+    const int incY);
+
+void cblas_saxpy(const int N, const float alpha, const float* X,
+    const int incX, float* Y, const int incY);
+
+void cblas_sscal(const int N, const float alpha, float* X, const int incX);
+
+void cblas_scopy(const int N, const float* X, const int incX, float* Y,
+    const int incY);
+
+float cblas_sdot(const int N, const float* X, const int incX, const float* Y,
+    const int incY);
+
+float cblas_sasum(const int N, const float* X, const int incX);
+
+#endif  // CAFFE_UTIL_INTERNAL_BLAS_HPP_
@@ -0,0 +1,113 @@
+#include <google/protobuf/text_format.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "caffe/profiler.hpp"
+#include "./layer_benchmark.hpp"
+#include "../common.hpp"
+#include "../filler.hpp"
+#include "../layer.hpp"
+
+using namespace std;
+
+namespace caffe {
+
+// Number of tops to give a layer whose parameter names none.
+static int NumTopBlobs(const Layer& layer, int num_bottom) {
+  if (layer.ExactNumTopBlobs() >= 0) {
+    return layer.ExactNumTopBlobs();
+  }
+  if (layer.EqualNumBottomTopBlobs()) {
+    return num_bottom;
+  }
+  return std::max(layer.MinTopBlobs(), 1);
+}
+
+// Fills the bottoms. The uniform and gaussian fillers of the library are
+// constant, Net has no use for random parameters, so these are drawn here.
+static void FillBottom(const FillerParameter& param, std::mt19937* rng,
+                       Blob* blob) {
+  real_t* data = blob->mutable_cpu_data();
+  const int count = blob->count();
+  if (param.type() == "uniform") {
+    std::uniform_real_distribution<real_t> uniform(param.min(), param.max());
+    for (int i = 0; i < count; ++i) {
+      data[i] = uniform(*rng);
+    }
+  } else if (param.type() == "gaussian") {
+    CHECK_GT(param.std(), 0);
+    std::normal_distribution<real_t> gaussian(param.mean(), param.std());
+    for (int i = 0; i < count; ++i) {
+      data[i] = gaussian(*rng);
+    }
+  } else {
+    shared_ptr<Filler> filler(GetFiller(param));
+    filler->Fill(blob);
+  }
+}
+
+LayerBenchmarkResult BenchmarkLayer(const string& layer_param,
+                                    const vector<vector<int> >& bottom_shapes,
+                                    int warmup, int iterations,
+                                    const string& input_filler) {
+  CHECK_GT(iterations, 0);
+  LayerParameter param;
+  CHECK(google::protobuf::TextFormat::ParseFromString(layer_param, &param))
+      << "Failed to parse LayerParameter: " << layer_param;
+  FillerParameter filler_param;
+  CHECK(google::protobuf::TextFormat::ParseFromString(input_filler,
+                                                      &filler_param))
+      << "Failed to parse FillerParameter: " << input_filler;
+  shared_ptr<Layer> layer = LayerRegistry::CreateLayer(param);
+
+  const int num_bottom = bottom_shapes.size();
+  const int num_top = param.top_size() > 0 ?
+      param.top_size() : NumTopBlobs(*layer, num_bottom);
+  vector<shared_ptr<Blob> > blobs;
+  vector<Blob*> bottom, top;
+  for (int i = 0; i < num_bottom + num_top; ++i) {
+    blobs.push_back(std::make_shared<Blob>());
+    (i < num_bottom ? bottom : top).push_back(blobs.back().get());
+  }
+  std::mt19937 rng;
+  for (int i = 0; i < num_bottom; ++i) {
+    bottom[i]->Reshape(bottom_shapes[i]);
+    FillBottom(filler_param, &rng, bottom[i]);
+  }
+  layer->SetUp(bottom, top);
+
+  LayerBenchmarkResult result;
+  result.cost = layer->GetCost(bottom, top);
+  for (int i = 0; i < num_top; ++i) {
+    result.top_shapes.push_back(top[i]->shape());
+  }
+  for (int i = 0; i < warmup; ++i) {
+    layer->Forward(bottom, top);
+  }
+  Profiler* profiler = Profiler::Get();
+  vector<double> latencies(iterations);
+  for (int i = 0; i < iterations; ++i) {
+    const uint64_t tic = profiler->Now();
+    layer->Forward(bottom, top);
+#ifdef USE_CUDA
+    // kernels run asynchronously, wait for them to time the layer
+    if (Caffe::mode() == Caffe::GPU) {
+      CUDA_CHECK(cudaDeviceSynchronize());
+    }
+#endif  // USE_CUDA
+    latencies[i] = (profiler->Now() - tic) / 1000.;
+  }
+  double sum = 0;
+  for (double latency : latencies) {
+    sum += latency;
+  }
+  result.mean_ms = sum / iterations;
+  result.min_ms = *std::min_element(latencies.begin(), latencies.end());
+  result.max_ms = *std::max_element(latencies.begin(), latencies.end());
+  return result;
+}
+
+}  // namespace caffe
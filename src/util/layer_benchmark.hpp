@@ -0,0 +1,42 @@
+#ifndef CAFFE_UTIL_LAYER_BENCHMARK_HPP_
+#define CAFFE_UTIL_LAYER_BENCHMARK_HPP_
+
+#include <string>
+#include <vector>
+
+#include "caffe/base.hpp"
+
+namespace caffe {
+
+/*! \brief timing of a single layer on one set of input shapes */
+struct LayerBenchmarkResult {
+  std::vector<std::vector<int> > top_shapes;
+  LayerCost cost;
+  double mean_ms;
+  double min_ms;
+  double max_ms;
+};
+
+/*!
+ * \brief create a registered layer on its own and time its Forward, used by
+ *  tools/layer_benchmark.cpp. Parameters keep what the layer initializes
+ *  them to. Time it again with different shapes to sweep the shapes a model
+ *  uses.
+ * \param layer_param LayerParameter in prototxt format, bottom and top names
+ *  may be left out
+ * \param bottom_shapes shape of every bottom
+ * \param warmup forward passes before timing
+ * \param iterations timed forward passes
+ * \param input_filler FillerParameter of the bottoms in prototxt format,
+ *  uniform and gaussian draw random values
+ * \return timing and cost of the layer
+ */
+CAFFE_API LayerBenchmarkResult BenchmarkLayer(
+    const std::string &layer_param,
+    const std::vector<std::vector<int> > &bottom_shapes,
+    int warmup, int iterations,
+    const std::string &input_filler = "type: \"uniform\" min: -1 max: 1");
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_LAYER_BENCHMARK_HPP_
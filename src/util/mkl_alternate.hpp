@@ -1,9 +1,13 @@
 #ifndef CAFFE_UTIL_MKL_ALTERNATE_H_
 #define CAFFE_UTIL_MKL_ALTERNATE_H_
 
+#ifdef USE_INTERNAL_BLAS
+#include "./internal_blas.hpp"
+#else
 extern "C" {
 #include <cblas.h>
 }
+#endif  // USE_INTERNAL_BLAS
 #include <math.h>
 
 // A simple way to define the vsl unary functions. The operation should
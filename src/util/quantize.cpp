@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+#include "./quantize.hpp"
+#include "./gemm.hpp"
+#include "./thread_pool.hpp"
+#include "../syncedmem.hpp"
+
+namespace caffe {
+
+// largest tile of a GemmKernelInt8
+static const int kGemmMaxTileInt8 = 256;
+
+void QuantizeUint8(int n, const real_t* x, real_t scale, int zero_point,
+                   uint8_t* q) {
+  const GemmKernelInt8* kernel = GetGemmKernelInt8();
+  const real_t inv_scale = 1 / scale;
+  parallel_for(0, n, [&](int begin, int end) {
+    kernel->quantize(end - begin, x + begin, inv_scale, zero_point, q + begin);
+  }, parallel_grain(1));
+}
+
+//// QuantizedMatrix
+
+// round(a / scale) of the cols values at(p) of a row into q, with the scale
+// max |a| / 127 of the row, which it returns
+template <typename At>
+static real_t QuantizeRow(int cols, const At& at, int8_t* q) {
+  real_t max_abs = 0;
+  for (int p = 0; p < cols; ++p) {
+    max_abs = std::max(max_abs, std::fabs(at(p)));
+  }
+  // an all zero row stays zero with any scale
+  const real_t scale = max_abs > 0 ? max_abs / 127 : 1;
+  for (int p = 0; p < cols; ++p) {
+    q[p] = static_cast<int8_t>(std::round(at(p) / scale));
+  }
+  return scale;
+}
+
+void QuantizedMatrix::Pack(bool trans, int rows, int cols, const real_t* A) {
+  Pack(rows, cols, [&](int i, int8_t* q) {
+    return QuantizeRow(cols, [&](int p) {
+      return trans ? A[static_cast<size_t>(p) * rows + i]
+                   : A[static_cast<size_t>(i) * cols + p];
+    }, q);
+  });
+}
+
+void QuantizedMatrix::Pack(int rows, int cols, const int8_t* A,
+                           const real_t* scales) {
+  Pack(rows, cols, [&](int i, int8_t* q) {
+    std::memcpy(q, A + static_cast<size_t>(i) * cols, cols);
+    return scales[i];
+  });
+}
+
+void QuantizedMatrix::Pack(
+    int rows, int cols, const std::function<real_t(int, int8_t*)>& row) {
+  kernel_ = GetGemmKernelInt8();
+  CHECK_LE(kernel_->mr * kernel_->nr, kGemmMaxTileInt8);
+  rows_ = rows;
+  cols_ = cols;
+  depth_ = (cols + 3) / 4 * 4;
+  const int mr = kernel_->mr;
+  padded_rows_ = (rows + mr - 1) / mr * mr;
+  // panels of mr rows, 4 columns at a time, zeros past the end
+  data_.assign(static_cast<size_t>(padded_rows_) * depth_, 0);
+  scales_.assign(rows, 0);
+  sums_.assign(rows, 0);
+  parallel_for(0, rows, [&](int begin, int end) {
+    std::vector<int8_t> q(cols);
+    for (int i = begin; i < end; ++i) {
+      scales_[i] = row(i, q.data());
+      int8_t* out = &data_[static_cast<size_t>(i - i % mr) * depth_ +
+                           i % mr * 4];
+      int32_t sum = 0;
+      for (int p = 0; p < cols; ++p) {
+        out[p / 4 * mr * 4 + p % 4] = q[p];
+        sum += q[p];
+      }
+      sums_[i] = sum;
+    }
+  }, parallel_grain(cols));
+}
+
+void QuantizeWeights(const Blob& weights, BlobProto* proto) {
+  CHECK_GT(weights.num_axes(), 0);
+  const int rows = weights.shape(0), cols = weights.count(1);
+  const real_t* data = weights.cpu_data();
+  std::string values(weights.count(), 0);
+  proto->Clear();
+  for (int i = 0; i < weights.num_axes(); ++i) {
+    proto->mutable_shape()->add_dim(weights.shape(i));
+  }
+  for (int i = 0; i < rows; ++i) {
+    const real_t* row = data + static_cast<size_t>(i) * cols;
+    proto->add_int8_scale(QuantizeRow(cols, [row](int p) { return row[p]; },
+        reinterpret_cast<int8_t*>(&values[static_cast<size_t>(i) * cols])));
+  }
+  proto->set_int8_data(values);
+}
+
+//// caffe_cpu_gemm_int8
+
+void caffe_cpu_gemm_int8(const QuantizedMatrix& A, const int N,
+    const GemmPackBInt8& pack_b, const real_t b_scale, const int b_zero_point,
+    const real_t* bias, const bool accumulate, real_t* C, const bool trans_c) {
+  const GemmKernelInt8* kernel = A.kernel();
+  CHECK(kernel) << "Matrix not quantized";
+  const int M = A.rows(), depth = A.depth();
+  const int mr = kernel->mr, nr = kernel->nr;
+  const int row_panels = (M + mr - 1) / mr;
+  const int col_panels = (N + nr - 1) / nr;
+  // all of B packed at once, a quarter of the col buffer of float
+  static thread_local std::vector<uint8_t> packed_b;
+  const size_t b_size = static_cast<size_t>(col_panels) * nr * depth;
+  packed_b.resize(std::max(packed_b.size(), b_size));
+  uint8_t* b = packed_b.data();
+  parallel_for(0, col_panels, [&](int begin, int end) {
+    pack_b(begin * nr, std::min(end * nr, N), nr,
+           b + static_cast<size_t>(begin) * nr * depth);
+  }, parallel_grain(static_cast<int64_t>(nr) * depth));
+  // the tiles a column panel of B at a time, which stays in cache for all of
+  // the rows of A, and no blocks of the depth, the int32 sums don't overflow
+  // below 2^31 / 255 / 128 of it
+  parallel_for(0, row_panels * col_panels, [&](int begin, int end) {
+    int32_t tile[kGemmMaxTileInt8];
+    for (int t = begin; t < end; ++t) {
+      const int i0 = t % row_panels * mr;
+      const int j0 = t / row_panels * nr;
+      kernel->tile(depth, A.panel(i0), b + static_cast<size_t>(j0) * depth,
+                   tile, nr);
+      const int mi = std::min(mr, M - i0), nj = std::min(nr, N - j0);
+      for (int i = 0; i < mi; ++i) {
+        const real_t scale = A.scales()[i0 + i] * b_scale;
+        const int32_t offset = b_zero_point * A.sums()[i0 + i];
+        const real_t shift = bias ? bias[i0 + i] : 0;
+        const int32_t* in = tile + i * nr;
+        if (trans_c) {
+          real_t* out = C + static_cast<size_t>(j0) * M + i0 + i;
+          for (int j = 0; j < nj; ++j) {
+            const real_t value = (in[j] - offset) * scale + shift;
+            out[j * M] = accumulate ? out[j * M] + value : value;
+          }
+        } else {
+          // the common case, a row of C that vectorizes
+          real_t* out = C + static_cast<size_t>(i0 + i) * N + j0;
+          if (accumulate) {
+            for (int j = 0; j < nj; ++j) {
+              out[j] += (in[j] - offset) * scale + shift;
+            }
+          } else {
+            for (int j = 0; j < nj; ++j) {
+              out[j] = (in[j] - offset) * scale + shift;
+            }
+          }
+        }
+      }
+    }
+  }, parallel_grain(static_cast<int64_t>(mr) * nr * depth));
+}
+
+void PackTransposedUint8(const uint8_t* B, int cols, int n0, int n1, int nr,
+                         uint8_t* out) {
+  const int depth = (cols + 3) / 4 * 4;
+  for (int j0 = n0; j0 < n1; j0 += nr) {
+    const int nj = std::min(nr, n1 - j0);
+    for (int j = 0; j < nj; ++j) {
+      const uint8_t* in = B + static_cast<size_t>(j0 + j) * cols;
+      uint8_t* column = out + j * 4;
+      for (int p = 0; p < cols; p += 4) {
+        std::memcpy(column + p * nr, in + p, std::min(4, cols - p));
+      }
+    }
+    out += static_cast<size_t>(nr) * depth;
+  }
+}
+
+//// QuantizedWeights
+
+const std::vector<QuantizedMatrix>& QuantizedWeights::Get(
+    const Blob& weights, int groups, bool trans, int rows, int cols) {
+  const int layout[] = {groups, trans, rows, cols};
+  return cache_.Get(weights, std::vector<int>(layout, layout + 4),
+      [&](const Blob& weights, std::vector<QuantizedMatrix>* quantized) {
+        CHECK_EQ(weights.count(), groups * rows * cols);
+        quantized->resize(groups);
+        if (weights.is_int8()) {
+          // loaded quantized a row of op(A) per slice of the first axis
+          CHECK(!trans) << "int8 weights of a transposed gemm";
+          for (int g = 0; g < groups; ++g) {
+            (*quantized)[g].Pack(rows, cols,
+                weights.cpu_int8_data() + g * rows * cols,
+                weights.cpu_int8_scale() + g * rows);
+          }
+          return;
+        }
+        const real_t* data = weights.cpu_data();
+        for (int g = 0; g < groups; ++g) {
+          (*quantized)[g].Pack(trans, rows, cols, data + g * rows * cols);
+        }
+      });
+}
+
+}  // namespace caffe
@@ -0,0 +1,140 @@
+#ifndef CAFFE_UTIL_QUANTIZE_HPP_
+#define CAFFE_UTIL_QUANTIZE_HPP_
+
+#include <stdint.h>
+
+#include <functional>
+#include <vector>
+
+#include "caffe/blob.hpp"
+#include "./gemm_kernel.hpp"
+#include "./weights_cache.hpp"
+#include "../common.hpp"
+#include "../proto/caffe.pb.h"
+
+namespace caffe {
+
+/*!
+ * \brief whether the layer runs in int8, see QuantizationParameter, on CPU
+ *  only
+ */
+inline bool IsQuantized(const LayerParameter& param) {
+  return param.quantization_param().bottom_scale() > 0 &&
+         Caffe::mode() == Caffe::CPU;
+}
+
+/*!
+ * \brief round(x / scale) + zero_point clamped to uint8 for n values, on the
+ *  threads of the pool with the quantize of GetGemmKernelInt8
+ */
+void QuantizeUint8(int n, const real_t* x, real_t scale, int zero_point,
+                   uint8_t* q);
+
+/*!
+ * \brief op(A) of a gemm quantized to int8 row by row, round(a / scale) with
+ *  the scale max |a| / 127 of the row, and packed in the layout of the
+ *  GemmKernelInt8, so weights are quantized once per output channel
+ */
+class QuantizedMatrix {
+ public:
+  QuantizedMatrix()
+      : kernel_(NULL), rows_(0), cols_(0), depth_(0), padded_rows_(0) {}
+  /*!
+   * \brief quantize and pack op(A) of rows x cols with the kernel of
+   *  GetGemmKernelInt8. A is row major, cols x rows if trans.
+   */
+  void Pack(bool trans, int rows, int cols, const real_t* A);
+  /*!
+   * \brief pack A of rows x cols quantized already, row major, with the
+   *  scale of each row
+   */
+  void Pack(int rows, int cols, const int8_t* A, const real_t* scales);
+  const GemmKernelInt8* kernel() const { return kernel_; }
+  int rows() const { return rows_; }
+  int cols() const { return cols_; }
+  /*! \brief cols rounded up to 4, the depth of the gemm */
+  int depth() const { return depth_; }
+  /*! \brief panel of the rows from row */
+  const int8_t* panel(int row) const {
+    return &data_[static_cast<size_t>(row) * depth_];
+  }
+  /*! \brief quantized value of (row, col) */
+  int value(int row, int col) const {
+    const int mr = kernel_->mr;
+    return panel(row - row % mr)[(col / 4 * mr + row % mr) * 4 + col % 4];
+  }
+  /*! \brief scale of each row */
+  const real_t* scales() const { return &scales_[0]; }
+  /*! \brief sum of the quantized values of each row */
+  const int32_t* sums() const { return &sums_[0]; }
+
+ private:
+  /*! \brief pack the rows quantized by row, which returns their scale */
+  void Pack(int rows, int cols,
+            const std::function<real_t(int row, int8_t* q)>& row);
+
+  const GemmKernelInt8* kernel_;
+  int rows_;
+  int cols_;
+  int depth_;
+  /*! \brief rows rounded up to the rows of a kernel tile */
+  int padded_rows_;
+  std::vector<int8_t> data_;
+  std::vector<real_t> scales_;
+  std::vector<int32_t> sums_;
+};
+
+/*!
+ * \brief packs columns [n0, n1) of the uint8 B of caffe_cpu_gemm_int8 in
+ *  panels of nr columns, depth rows each, see GemmKernelInt8. Rows past the
+ *  end of B and columns past n1 may hold anything.
+ */
+typedef std::function<void(int n0, int n1, int nr, uint8_t* out)>
+    GemmPackBInt8;
+
+/*!
+ * \brief C (+)= A * B in float for B of depth x N in uint8, the quantization
+ *  of a matrix of scale b_scale and zero point b_zero_point: the int32
+ *  products less the zero point are scaled by b_scale and the scale of their
+ *  row of A, with bias[i] added to row i unless bias is NULL. C is row major,
+ *  N x M if trans_c. B is packed by pack_b on the threads of the pool.
+ */
+void caffe_cpu_gemm_int8(const QuantizedMatrix& A, const int N,
+    const GemmPackBInt8& pack_b, const real_t b_scale, const int b_zero_point,
+    const real_t* bias, const bool accumulate, real_t* C, const bool trans_c);
+
+/*!
+ * \brief GemmPackBInt8 of rows [n0, n1) of a row major uint8 matrix of cols
+ *  columns, for a B which is its transpose
+ */
+void PackTransposedUint8(const uint8_t* B, int cols, int n0, int n1, int nr,
+                         uint8_t* out);
+
+/*!
+ * \brief write weights to proto quantized to int8 a slice of the first axis
+ *  at a time, like the rows of a QuantizedMatrix, so they load as an int8
+ *  Blob without float data, see BlobProto.int8_data
+ */
+void QuantizeWeights(const Blob& weights, BlobProto* proto);
+
+/*!
+ * \brief the weights of a layer quantized for caffe_cpu_gemm_int8 on first
+ *  use, shared like PackedWeights. Weights loaded in int8 are only packed,
+ *  their slices of the first axis are the rows of op(A), so not trans.
+ */
+class QuantizedWeights {
+ public:
+  /*!
+   * \brief op(A) of rows x cols for each of groups, the A of group g at
+   *  g * rows * cols in weights
+   */
+  const std::vector<QuantizedMatrix>& Get(const Blob& weights, int groups,
+                                          bool trans, int rows, int cols);
+
+ private:
+  WeightsCache<std::vector<QuantizedMatrix> > cache_;
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_QUANTIZE_HPP_
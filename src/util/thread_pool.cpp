@@ -0,0 +1,128 @@
+#include <algorithm>
+
+#include "./thread_pool.hpp"
+#include "../common.hpp"
+
+namespace caffe {
+
+// Whether the calling thread runs a chunk of a job, jobs can't nest.
+static THREAD_LOCAL bool in_parallel = false;
+
+// Polls of a worker for the next job before going to sleep.
+static const int kSpinCount = 20000;
+// Chunks per thread, more chunks balance the load better.
+static const int kChunksPerThread = 4;
+
+ThreadPool::ThreadPool(int num_threads)
+    : parts_(new Part[num_threads]), fn_(NULL), chunk_(1), generation_(0),
+      pending_(0), stop_(false) {
+  CHECK_GE(num_threads, 1);
+  for (int i = 0; i < num_threads; ++i) {
+    parts_[i].next = 0;
+    parts_[i].end = 0;
+  }
+  for (int i = 1; i < num_threads; ++i) {
+    workers_.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::Run(int begin, int end, int grain,
+                     const std::function<void(int, int)>& fn) {
+  const int n = end - begin;
+  const int num_threads = std::max(std::min(this->num_threads(), n / grain), 1);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    fn_ = &fn;
+    chunk_ = std::max(grain, (n + num_threads * kChunksPerThread - 1) /
+                             (num_threads * kChunksPerThread));
+    error_ = NULL;
+    for (int i = 0; i < this->num_threads(); ++i) {
+      const int part = std::min(i, num_threads);
+      parts_[i].next = begin + static_cast<int64_t>(n) * part / num_threads;
+      parts_[i].end = begin + static_cast<int64_t>(n) *
+                      std::min(i + 1, num_threads) / num_threads;
+    }
+    pending_ = static_cast<int>(workers_.size());
+    ++generation_;
+  }
+  cv_.notify_all();
+  in_parallel = true;
+  Work(0);
+  in_parallel = false;
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    std::this_thread::yield();
+  }
+  fn_ = NULL;
+  if (error_) {
+    std::rethrow_exception(error_);
+  }
+}
+
+void ThreadPool::WorkerLoop(int id) {
+  in_parallel = true;
+  int generation = 0;
+  while (true) {
+    for (int i = 0; i < kSpinCount; ++i) {
+      if (generation_.load(std::memory_order_acquire) != generation) break;
+    }
+    if (generation_.load(std::memory_order_acquire) == generation) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+    }
+    if (stop_) return;
+    generation = generation_;
+    Work(id);
+    pending_.fetch_sub(1, std::memory_order_release);
+  }
+}
+
+void ThreadPool::Work(int id) {
+  const int num_threads = this->num_threads();
+  // run the own part first, then steal from the others
+  for (int i = 0; i < num_threads; ++i) {
+    Part& part = parts_[(id + i) % num_threads];
+    while (true) {
+      const int b = part.next.fetch_add(chunk_);
+      if (b >= part.end) break;
+      try {
+        (*fn_)(b, std::min(b + chunk_, part.end));
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) {
+          error_ = std::current_exception();
+        }
+      }
+    }
+  }
+}
+
+void parallel_for(int begin, int end, const std::function<void(int, int)>& fn,
+                  int grain) {
+  grain = std::max(grain, 1);
+  if (end - begin <= grain || in_parallel) {
+    if (begin < end) {
+      fn(begin, end);
+    }
+    return;
+  }
+  ThreadPool* pool = Caffe::thread_pool();
+  if (pool == NULL) {
+    fn(begin, end);
+    return;
+  }
+  pool->Run(begin, end, grain, fn);
+}
+
+}  // namespace caffe
@@ -0,0 +1,105 @@
+#ifndef CAFFE_UTIL_THREAD_POOL_HPP_
+#define CAFFE_UTIL_THREAD_POOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "caffe/base.hpp"
+
+namespace caffe {
+
+/*!
+ * \brief Threads running the CPU layers of the thread that owns the pool.
+ *  Every thread of the pool, the owner included, starts on a contiguous
+ *  part of the range and steals chunks of the other parts once it is done.
+ *  Workers spin for a while after a job, as the next layer usually comes
+ *  soon, then sleep until the owner runs another job.
+ *
+ *  A chunk sees the thread local state of whichever thread runs it, the
+ *  owner or a worker:
+ *  - the memory pool, so a chunk must not allocate or free blob memory, the
+ *    owner does that before the job;
+ *  - Caffe::Get(), which on a worker is CPU mode without a pool of its own,
+ *    so parallel_for inside a chunk runs serially;
+ *  - the Profiler, which records the scopes of a chunk on that thread;
+ *  - `static thread_local` scratch, like the packed panels of the gemm,
+ *    which is the chunk's own while it runs but not kept for the next
+ *    chunk, that may run elsewhere. Scratch the owner filled before the
+ *    job, like the quantized input of an int8 layer, is read by the chunks
+ *    through a pointer to it.
+ */
+class ThreadPool {
+ public:
+  /*! \param num_threads threads running a job, the owner included */
+  explicit ThreadPool(int num_threads);
+  ~ThreadPool();
+  int num_threads() const { return static_cast<int>(workers_.size()) + 1; }
+  /*!
+   * \brief call fn(b, e) on chunks [b, e) covering [begin, end) in parallel
+   *  and wait for all of them, rethrow the first error of the chunks
+   * \param grain minimum number of iterations of a chunk
+   */
+  void Run(int begin, int end, int grain,
+           const std::function<void(int, int)>& fn);
+
+ private:
+  /*! \brief part of the range of a job, owned by one thread */
+  struct Part {
+    std::atomic<int> next;
+    int end;
+    // keep the counters of threads out of one cache line
+    char padding[64 - sizeof(std::atomic<int>) - sizeof(int)];
+  };
+  void WorkerLoop(int id);
+  void Work(int id);
+
+  std::vector<std::thread> workers_;
+  std::unique_ptr<Part[]> parts_;
+  /*! \brief the job */
+  const std::function<void(int, int)>* fn_;
+  int chunk_;
+  /*! \brief the first error thrown by the job */
+  std::exception_ptr error_;
+  std::mutex error_mutex_;
+  /*! \brief increased for every job */
+  std::atomic<int> generation_;
+  /*! \brief workers still running the job */
+  std::atomic<int> pending_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_;
+
+  DISABLE_COPY_AND_ASSIGN(ThreadPool);
+};
+
+/*!
+ * \brief call fn(b, e) on chunks [b, e) covering [begin, end), in parallel on
+ *  the thread pool of the calling thread, see SetNumThreads. Chunks may run
+ *  on other threads, see ThreadPool for the thread local state they see.
+ *  They must not call BLAS, which may run threads of its own. parallel_for
+ *  inside a chunk runs serially.
+ * \param grain minimum number of iterations worth running on another thread
+ */
+void parallel_for(int begin, int end, const std::function<void(int, int)>& fn,
+                  int grain = 1);
+
+/*!
+ * \brief grain of a loop whose iterations touch about work elements each, a
+ *  chunk of it is then worth waking another thread for
+ */
+inline int parallel_grain(int64_t work) {
+  const int64_t kMinWork = 16384;
+  return static_cast<int>(std::max<int64_t>(
+      kMinWork / std::max<int64_t>(work, 1), 1));
+}
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_THREAD_POOL_HPP_
@@ -0,0 +1,88 @@
+#ifndef CAFFE_UTIL_WEIGHTS_CACHE_HPP_
+#define CAFFE_UTIL_WEIGHTS_CACHE_HPP_
+
+#include <stdint.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "caffe/blob.hpp"
+#include "../syncedmem.hpp"
+
+namespace caffe {
+
+/*!
+ * \brief data derived from the weights of a layer, like the weights packed
+ *  for a gemm, derived on first use and again only after the weights were
+ *  written to, see SyncedMemory::version. Only layers whose weights are the
+ *  same memory, like those of nets sharing trained layers through
+ *  Net::ShareTrainedLayersWith, share what was derived from them while any
+ *  of them uses it. Nets loading or mapping the same flat weight file each
+ *  have their own memory and derive their own.
+ */
+template <typename T>
+class WeightsCache {
+ public:
+  /*!
+   * \brief the data derived from weights by derive, which runs if no layer
+   *  has it yet. layout tells apart everything derived into a T from the
+   *  same weights, like the shape of the packed matrices.
+   */
+  const T& Get(const Blob& weights, const std::vector<int>& layout,
+               const std::function<void(const Blob&, T*)>& derive);
+
+ private:
+  /*! \brief memory, its version, the offset of the weights in it, layout */
+  typedef std::tuple<const SyncedMemory*, uint64_t, int, std::vector<int> >
+      Key;
+  static Key MakeKey(const Blob& weights, const std::vector<int>& layout) {
+    return Key(weights.data().get(), weights.data()->version(),
+               weights.data_offset(), layout);
+  }
+
+  Key key_;
+  std::shared_ptr<const T> data_;
+};
+
+template <typename T>
+const T& WeightsCache<T>::Get(
+    const Blob& weights, const std::vector<int>& layout,
+    const std::function<void(const Blob&, T*)>& derive) {
+  Key key = MakeKey(weights, layout);
+  if (data_ && key == key_) {
+    return *data_;
+  }
+  // what the layers use, the nets of several threads may ask at once
+  static std::mutex mutex;
+  static std::map<Key, std::weak_ptr<const T> > shared;
+  std::lock_guard<std::mutex> lock(mutex);
+  typename std::map<Key, std::weak_ptr<const T> >::iterator it =
+      shared.find(key);
+  data_ = it == shared.end() ? std::shared_ptr<const T>() : it->second.lock();
+  if (!data_) {
+    std::shared_ptr<T> data = std::make_shared<T>();
+    derive(weights, data.get());
+    data_ = data;
+    // cpu_data synchronized the memory without writing to it
+    key = MakeKey(weights, layout);
+    shared[key] = data_;
+  }
+  key_ = key;
+  // forget what no layer uses any more
+  for (it = shared.begin(); it != shared.end();) {
+    if (it->second.expired()) {
+      it = shared.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return *data_;
+}
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_WEIGHTS_CACHE_HPP_
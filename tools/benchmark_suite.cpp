@@ -0,0 +1,272 @@
+#include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <caffe/net.hpp>
+#include <caffe/profiler.hpp>
+
+using namespace std;
+using caffe::real_t;
+
+struct SuiteNet {
+  string name;
+  string proto;
+  // only run at the batch size of the prototxt
+  bool fixed;
+};
+
+struct BenchmarkResult {
+  string name;
+  int batch;
+  int threads;
+  int iterations;
+  double mean_ms;
+  double p50_ms;
+  double p90_ms;
+  double p99_ms;
+  // images per second over all threads
+  double throughput;
+  // memory pool size summed over all threads, in bytes
+  int64_t cpu_mem;
+  int64_t gpu_mem;
+  string error;
+};
+
+static vector<SuiteNet> ReadSuite(const string &suite_file) {
+  ifstream in(suite_file.c_str());
+  CHECK(in.is_open()) << "Can't open suite " << suite_file;
+  const size_t slash = suite_file.find_last_of("/\\");
+  const string dir = slash == string::npos ? "" : suite_file.substr(0, slash + 1);
+  vector<SuiteNet> nets;
+  string line;
+  while (getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    istringstream fields(line);
+    SuiteNet net;
+    string option;
+    if (!(fields >> net.name >> net.proto)) continue;
+    net.proto = dir + net.proto;
+    net.fixed = (fields >> option) && option == "fixed";
+    nets.push_back(net);
+  }
+  return nets;
+}
+
+static vector<int> ParseList(const char *str) {
+  vector<int> values;
+  istringstream in(str);
+  string value;
+  while (getline(in, value, ',')) {
+    values.push_back(atoi(value.c_str()));
+    CHECK_GT(values.back(), 0) << "Invalid list " << str;
+  }
+  return values;
+}
+
+static void FillRandom(caffe::Blob *blob, std::mt19937 *rng, real_t scale) {
+  std::uniform_real_distribution<real_t> uniform(-scale, scale);
+  real_t *data = blob->mutable_cpu_data();
+  for (int i = 0; i < blob->count(); i++) {
+    data[i] = uniform(*rng);
+  }
+}
+
+static double Percentile(const vector<double> &sorted, double p) {
+  const size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+  return sorted[index];
+}
+
+// Run iterations forward passes of the net on every thread, each thread with
+// a Net of its own as a serving process does. Batch 0 keeps the shapes of the
+// prototxt.
+static BenchmarkResult RunBenchmark(const SuiteNet &suite_net, int batch,
+                                    int threads, int warmup, int iterations,
+                                    int gpu_id) {
+  BenchmarkResult result = BenchmarkResult();
+  result.name = suite_net.name;
+  result.batch = batch;
+  result.threads = threads;
+  result.iterations = iterations;
+  vector<vector<double> > latencies(threads);
+  vector<uint64_t> starts(threads), ends(threads);
+  vector<caffe::MemPoolState> states(threads);
+  vector<string> errors(threads);
+  std::atomic<int> ready(0);
+  caffe::Profiler *profiler = caffe::Profiler::Get();
+
+  auto worker = [&](int tid) {
+    try {
+      if (gpu_id >= 0) {
+        caffe::SetMode(caffe::GPU, gpu_id);
+      }
+      std::mt19937 rng(tid);
+      caffe::Net net(suite_net.proto);
+      for (auto param : net.params()) {
+        FillRandom(param.get(), &rng, 0.1);
+      }
+      if (batch > 0) {
+        for (auto input : net.input_blobs()) {
+          vector<int> shape = input->shape();
+          shape[0] = batch;
+          input->Reshape(shape);
+        }
+        net.Reshape();
+      }
+      if (tid == 0) {
+        result.batch = net.input_blobs()[0]->shape(0);
+      }
+      for (auto input : net.input_blobs()) {
+        FillRandom(input, &rng, 1);
+      }
+      for (int i = 0; i < warmup; i++) {
+        net.Forward();
+      }
+      // start timing once every thread is ready
+      ++ready;
+      while (ready < threads) {
+        std::this_thread::yield();
+      }
+      latencies[tid].reserve(iterations);
+      starts[tid] = profiler->Now();
+      for (int i = 0; i < iterations; i++) {
+        uint64_t tic = profiler->Now();
+        const vector<caffe::Blob*> &outputs = net.Forward();
+        // wait for the device in GPU mode
+        for (auto output : outputs) {
+          output->cpu_data();
+        }
+        uint64_t toc = profiler->Now();
+        latencies[tid].push_back((toc - tic) / 1000.);
+      }
+      ends[tid] = profiler->Now();
+      states[tid] = caffe::MemPoolGetState();
+    }
+    catch (caffe::Error &e) {
+      errors[tid] = e.what();
+      ++ready;
+    }
+    // the pool of a thread lives until exit, give the memory of the net back
+    caffe::MemPoolClear();
+  };
+  vector<std::thread> workers;
+  for (int tid = 0; tid < threads; tid++) {
+    workers.push_back(std::thread(worker, tid));
+  }
+  for (auto &t : workers) {
+    t.join();
+  }
+  for (int tid = 0; tid < threads; tid++) {
+    if (!errors[tid].empty()) {
+      result.error = errors[tid];
+      return result;
+    }
+  }
+
+  vector<double> all;
+  for (int tid = 0; tid < threads; tid++) {
+    all.insert(all.end(), latencies[tid].begin(), latencies[tid].end());
+    result.cpu_mem += states[tid].cpu_mem;
+    result.gpu_mem += states[tid].gpu_mem;
+  }
+  std::sort(all.begin(), all.end());
+  double sum = 0;
+  for (double latency : all) {
+    sum += latency;
+  }
+  result.mean_ms = sum / all.size();
+  result.p50_ms = Percentile(all, 0.5);
+  result.p90_ms = Percentile(all, 0.9);
+  result.p99_ms = Percentile(all, 0.99);
+  const uint64_t start = *std::min_element(starts.begin(), starts.end());
+  const uint64_t end = *std::max_element(ends.begin(), ends.end());
+  result.throughput = static_cast<double>(result.batch) * all.size() * 1e6 /
+                      std::max<uint64_t>(end - start, 1);
+  return result;
+}
+
+static void WriteJson(const string &fn, const vector<BenchmarkResult> &results) {
+  ofstream file(fn.c_str());
+  CHECK(file.is_open()) << "Can't write " << fn;
+  file << "{" << endl;
+  file << "  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); i++) {
+    const BenchmarkResult &r = results[i];
+    file << (i == 0 ? "" : ",") << endl;
+    file << "    {\"name\": \"" << r.name << "\", \"batch\": " << r.batch
+         << ", \"threads\": " << r.threads;
+    if (!r.error.empty()) {
+      string error = r.error;
+      std::replace(error.begin(), error.end(), '"', '\'');
+      std::replace(error.begin(), error.end(), '\\', '/');
+      std::replace(error.begin(), error.end(), '\n', ' ');
+      file << ", \"error\": \"" << error << "\"}";
+      continue;
+    }
+    file << ", \"iterations\": " << r.iterations
+         << ", \"mean_ms\": " << r.mean_ms << ", \"p50_ms\": " << r.p50_ms
+         << ", \"p90_ms\": " << r.p90_ms << ", \"p99_ms\": " << r.p99_ms
+         << ", \"throughput\": " << r.throughput
+         << ", \"cpu_mem\": " << r.cpu_mem << ", \"gpu_mem\": " << r.gpu_mem
+         << "}";
+  }
+  file << endl << "  ]" << endl;
+  file << "}" << endl;
+}
+
+int main(int argc, char *argv[]) {
+  const char *usage =
+      "[Usage]: ./benchmark_suite suite.txt [-batch 1,4] [-threads 1,2]"
+      " [-warmup 5] [-iterations 50] [-gpu gpu_id] [-json result.json]";
+  CHECK_GE(argc, 2) << usage;
+  vector<int> batches(1, 1), threads(1, 1);
+  int warmup = 5, iterations = 50, gpu_id = -1;
+  string json = "benchmark.json";
+  for (int i = 2; i < argc; i += 2) {
+    CHECK_LT(i + 1, argc) << usage;
+    const string flag = argv[i];
+    if (flag == "-batch") batches = ParseList(argv[i + 1]);
+    else if (flag == "-threads") threads = ParseList(argv[i + 1]);
+    else if (flag == "-warmup") warmup = atoi(argv[i + 1]);
+    else if (flag == "-iterations") iterations = atoi(argv[i + 1]);
+    else if (flag == "-gpu") gpu_id = atoi(argv[i + 1]);
+    else if (flag == "-json") json = argv[i + 1];
+    else LOG(FATAL) << usage;
+  }
+  CHECK_GT(iterations, 0) << usage;
+  if (gpu_id >= 0 && !caffe::GPUAvailable()) {
+    LOG(INFO) << "GPU is not available, run on CPU";
+    gpu_id = -1;
+  }
+
+  vector<BenchmarkResult> results;
+  for (const SuiteNet &suite_net : ReadSuite(argv[1])) {
+    const vector<int> net_batches = suite_net.fixed ? vector<int>(1, 0) : batches;
+    for (int batch : net_batches) {
+      for (int num_threads : threads) {
+        BenchmarkResult result = RunBenchmark(suite_net, batch, num_threads,
+                                              warmup, iterations, gpu_id);
+        if (!result.error.empty()) {
+          LOG(ERROR) << result.name << " batch " << result.batch << " threads "
+                     << num_threads << " failed: " << result.error;
+        }
+        else {
+          LOG(INFO) << result.name << " batch " << result.batch << " threads "
+                    << num_threads << ": p50 " << result.p50_ms << " ms, p90 "
+                    << result.p90_ms << " ms, p99 " << result.p99_ms << " ms, "
+                    << result.throughput << " images/s, "
+                    << result.cpu_mem + result.gpu_mem << " bytes";
+        }
+        results.push_back(result);
+      }
+    }
+  }
+  WriteJson(json, results);
+  LOG(INFO) << "Write results to " << json;
+  return 0;
+}
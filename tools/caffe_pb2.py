@@ -0,0 +1,189 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: caffe.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0b\x63\x61\x66\x66\x65.proto\x12\x05\x63\x61\x66\x66\x65\"\x1c\n\tBlobShape\x12\x0f\n\x03\x64im\x18\x01 \x03(\x03\x42\x02\x10\x01\"\xcc\x01\n\tBlobProto\x12\x1f\n\x05shape\x18\x07 \x01(\x0b\x32\x10.caffe.BlobShape\x12\x10\n\x04\x64\x61ta\x18\x05 \x03(\x02\x42\x02\x10\x01\x12\x10\n\x04\x64iff\x18\x06 \x03(\x02\x42\x02\x10\x01\x12\x17\n\x0b\x64ouble_data\x18\x08 \x03(\x01\x42\x02\x10\x01\x12\x17\n\x0b\x64ouble_diff\x18\t \x03(\x01\x42\x02\x10\x01\x12\x0e\n\x03num\x18\x01 \x01(\x05:\x01\x30\x12\x13\n\x08\x63hannels\x18\x02 \x01(\x05:\x01\x30\x12\x11\n\x06height\x18\x03 \x01(\x05:\x01\x30\x12\x10\n\x05width\x18\x04 \x01(\x05:\x01\x30\"2\n\x0f\x42lobProtoVector\x12\x1f\n\x05\x62lobs\x18\x01 \x03(\x0b\x32\x10.caffe.BlobProto\"\x87\x01\n\x0eNormalizedBBox\x12\x0c\n\x04xmin\x18\x01 \x01(\x02\x12\x0c\n\x04ymin\x18\x02 \x01(\x02\x12\x0c\n\x04xmax\x18\x03 \x01(\x02\x12\x0c\n\x04ymax\x18\x04 \x01(\x02\x12\r\n\x05label\x18\x05 \x01(\x05\x12\x11\n\tdifficult\x18\x06 \x01(\x08\x12\r\n\x05score\x18\x07 \x01(\x02\x12\x0c\n\x04size\x18\x08 \x01(\x02\"\x8a\x02\n\x0f\x46illerParameter\x12\x16\n\x04type\x18\x01 \x01(\t:\x08\x63onstant\x12\x10\n\x05value\x18\x02 \x01(\x02:\x01\x30\x12\x0e\n\x03min\x18\x03 \x01(\x02:\x01\x30\x12\x0e\n\x03max\x18\x04 \x01(\x02:\x01\x31\x12\x0f\n\x04mean\x18\x05 \x01(\x02:\x01\x30\x12\x0e\n\x03std\x18\x06 \x01(\x02:\x01\x31\x12\x12\n\x06sparse\x18\x07 \x01(\x05:\x02-1\x12\x42\n\rvariance_norm\x18\x08 \x01(\x0e\x32#.caffe.FillerParameter.VarianceNorm:\x06\x46\x41N_IN\"4\n\x0cVarianceNorm\x12\n\n\x06\x46\x41N_IN\x10\x00\x12\x0b\n\x07\x46\x41N_OUT\x10\x01\x12\x0b\n\x07\x41VERAGE\x10\x02\"\xea\x02\n\x0cNetParameter\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\r\n\x05input\x18\x03 \x03(\t\x12%\n\x0binput_shape\x18\x08 \x03(\x0b\x32\x10.caffe.BlobShape\x12\x11\n\tinput_dim\x18\x04 \x03(\x05\x12\x1d\n\x0e\x66orce_backward\x18\x05 \x01(\x08:\x05\x66\x61lse\x12\x1e\n\x05state\x18\x06 \x01(\x0b\x32\x0f.caffe.NetState\x12\x19\n\ndebug_info\x18\x07 \x01(\x08:\x05\x66\x61lse\x12\x1e\n\x0foptimize_memory\x18\t \x01(\x08:\x05\x66\x61lse\x12 \n\x11parallel_branches\x18\n \x01(\x08:\x05\x66\x61lse\x12\x18\n\rchannel_block\x18\x0b \x01(\r:\x01\x30\x12$\n\x05layer\x18\x64 \x03(\x0b\x32\x15.caffe.LayerParameter\x12\'\n\x06layers\x18\x02 \x03(\x0b\x32\x17.caffe.V1LayerParameter\"N\n\x08NetState\x12!\n\x05phase\x18\x01 \x01(\x0e\x32\x0c.caffe.Phase:\x04TEST\x12\x10\n\x05level\x18\x02 \x01(\x05:\x01\x30\x12\r\n\x05stage\x18\x03 \x03(\t\"s\n\x0cNetStateRule\x12\x1b\n\x05phase\x18\x01 \x01(\x0e\x32\x0c.caffe.Phase\x12\x11\n\tmin_level\x18\x02 \x01(\x05\x12\x11\n\tmax_level\x18\x03 \x01(\x05\x12\r\n\x05stage\x18\x04 \x03(\t\x12\x11\n\tnot_stage\x18\x05 \x03(\t\"\xa3\x01\n\tParamSpec\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x31\n\nshare_mode\x18\x02 \x01(\x0e\x32\x1d.caffe.ParamSpec.DimCheckMode\x12\x12\n\x07lr_mult\x18\x03 \x01(\x02:\x01\x31\x12\x15\n\ndecay_mult\x18\x04 \x01(\x02:\x01\x31\"*\n\x0c\x44imCheckMode\x12\n\n\x06STRICT\x10\x00\x12\x0e\n\nPERMISSIVE\x10\x01\"\xf7\x12\n\x0eLayerParameter\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04type\x18\x02 \x01(\t\x12\x0e\n\x06\x62ottom\x18\x03 \x03(\t\x12\x0b\n\x03top\x18\x04 \x03(\t\x12\x1b\n\x05phase\x18\n \x01(\x0e\x32\x0c.caffe.Phase\x12\x13\n\x0bloss_weight\x18\x05 \x03(\x02\x12\x1f\n\x05param\x18\x06 \x03(\x0b\x32\x10.caffe.ParamSpec\x12\x1f\n\x05\x62lobs\x18\x07 \x03(\x0b\x32\x10.caffe.BlobProto\x12\x16\n\x0epropagate_down\x18\x0b \x03(\x08\x12$\n\x07include\x18\x08 \x03(\x0b\x32\x13.caffe.NetStateRule\x12$\n\x07\x65xclude\x18\t \x03(\x0b\x32\x13.caffe.NetStateRule\x12)\n\nloss_param\x18\xc8\x01 \x01(\x0b\x32\x14.caffe.LossParameter\x12-\n\x0c\x61rgmax_param\x18\xc9\x01 \x01(\x0b\x32\x16.caffe.ArgMaxParameter\x12\x34\n\x10\x62\x61tch_norm_param\x18\xca\x01 \x01(\x0b\x32\x19.caffe.BatchNormParameter\x12)\n\nbias_param\x18\xcb\x01 \x01(\x0b\x32\x14.caffe.BiasParameter\x12%\n\x08\x62n_param\x18\xcc\x01 \x01(\x0b\x32\x12.caffe.BNParameter\x12-\n\x0c\x63oncat_param\x18\xcd\x01 \x01(\x0b\x32\x16.caffe.ConcatParameter\x12\x37\n\x11\x63onvolution_param\x18\xce\x01 \x01(\x0b\x32\x1b.caffe.ConvolutionParameter\x12)\n\ncrop_param\x18\xcf\x01 \x01(\x0b\x32\x14.caffe.CropParameter\x12/\n\rdropout_param\x18\xd0\x01 \x01(\x0b\x32\x17.caffe.DropoutParameter\x12/\n\reltwise_param\x18\xd1\x01 \x01(\x0b\x32\x17.caffe.EltwiseParameter\x12\'\n\telu_param\x18\xd2\x01 \x01(\x0b\x32\x13.caffe.ELUParameter\x12+\n\x0b\x65mbed_param\x18\xd3\x01 \x01(\x0b\x32\x15.caffe.EmbedParameter\x12\'\n\texp_param\x18\xd4\x01 \x01(\x0b\x32\x13.caffe.ExpParameter\x12/\n\rflatten_param\x18\xd5\x01 \x01(\x0b\x32\x17.caffe.FlattenParameter\x12:\n\x13inner_product_param\x18\xd6\x01 \x01(\x0b\x32\x1c.caffe.InnerProductParameter\x12+\n\x0binput_param\x18\xd7\x01 \x01(\x0b\x32\x15.caffe.InputParameter\x12\'\n\tlog_param\x18\xd8\x01 \x01(\x0b\x32\x13.caffe.LogParameter\x12\'\n\tlrn_param\x18\xd9\x01 \x01(\x0b\x32\x13.caffe.LRNParameter\x12\'\n\tmvn_param\x18\xda\x01 \x01(\x0b\x32\x13.caffe.MVNParameter\x12\x33\n\x0fparameter_param\x18\xdb\x01 \x01(\x0b\x32\x19.caffe.ParameterParameter\x12/\n\rpooling_param\x18\xdc\x01 \x01(\x0b\x32\x17.caffe.PoolingParameter\x12+\n\x0bpower_param\x18\xde\x01 \x01(\x0b\x32\x15.caffe.PowerParameter\x12+\n\x0bprelu_param\x18\xdf\x01 \x01(\x0b\x32\x15.caffe.PReLUParameter\x12\x31\n\x0eproposal_param\x18\xe0\x01 \x01(\x0b\x32\x18.caffe.ProposalParameter\x12:\n\x13psroi_pooling_param\x18\xe1\x01 \x01(\x0b\x32\x1c.caffe.PSROIPoolingParameter\x12\x33\n\x0freduction_param\x18\xe2\x01 \x01(\x0b\x32\x19.caffe.ReductionParameter\x12)\n\nrelu_param\x18\xe3\x01 \x01(\x0b\x32\x14.caffe.ReLUParameter\x12/\n\rreshape_param\x18\xe4\x01 \x01(\x0b\x32\x17.caffe.ReshapeParameter\x12\x36\n\x11roi_pooling_param\x18\xe5\x01 \x01(\x0b\x32\x1a.caffe.ROIPoolingParameter\x12+\n\x0bscale_param\x18\xe6\x01 \x01(\x0b\x32\x15.caffe.ScaleParameter\x12/\n\rsigmoid_param\x18\xe7\x01 \x01(\x0b\x32\x17.caffe.SigmoidParameter\x12/\n\rsoftmax_param\x18\xe8\x01 \x01(\x0b\x32\x17.caffe.SoftmaxParameter\x12\'\n\tspp_param\x18\xe9\x01 \x01(\x0b\x32\x13.caffe.SPPParameter\x12+\n\x0bslice_param\x18\xea\x01 \x01(\x0b\x32\x15.caffe.SliceParameter\x12)\n\ntanh_param\x18\xeb\x01 \x01(\x0b\x32\x14.caffe.TanHParameter\x12\x33\n\x0fthreshold_param\x18\xec\x01 \x01(\x0b\x32\x19.caffe.ThresholdParameter\x12)\n\ntile_param\x18\xed\x01 \x01(\x0b\x32\x14.caffe.TileParameter\x12@\n\x16\x64\x65tection_output_param\x18\xee\x01 \x01(\x0b\x32\x1f.caffe.DetectionOutputParameter\x12/\n\rpermute_param\x18\xef\x01 \x01(\x0b\x32\x17.caffe.PermuteParameter\x12\x32\n\x0fprior_box_param\x18\xf0\x01 \x01(\x0b\x32\x18.caffe.PriorBoxParameter\x12>\n\x15shuffle_channel_param\x18\xf1\x01 \x01(\x0b\x32\x1e.caffe.ShuffleChannelParameter\x12.\n\nnorm_param\x18\xf2\x01 \x01(\x0b\x32\x19.caffe.NormalizeParameter\x12/\n\rreorder_param\x18\xf3\x01 \x01(\x0b\x32\x17.caffe.ReorderParameter\x12\x39\n\x12quantization_param\x18\xf4\x01 \x01(\x0b\x32\x1c.caffe.QuantizationParameter\"\xc2\x01\n\rLossParameter\x12\x14\n\x0cignore_label\x18\x01 \x01(\x05\x12\x44\n\rnormalization\x18\x03 \x01(\x0e\x32&.caffe.LossParameter.NormalizationMode:\x05VALID\x12\x11\n\tnormalize\x18\x02 \x01(\x08\"B\n\x11NormalizationMode\x12\x08\n\x04\x46ULL\x10\x00\x12\t\n\x05VALID\x10\x01\x12\x0e\n\nBATCH_SIZE\x10\x02\x12\x08\n\x04NONE\x10\x03\"M\n\x0f\x41rgMaxParameter\x12\x1a\n\x0bout_max_val\x18\x01 \x01(\x08:\x05\x66\x61lse\x12\x10\n\x05top_k\x18\x02 \x01(\r:\x01\x31\x12\x0c\n\x04\x61xis\x18\x03 \x01(\x05\"9\n\x0f\x43oncatParameter\x12\x0f\n\x04\x61xis\x18\x02 \x01(\x05:\x01\x31\x12\x15\n\nconcat_dim\x18\x01 \x01(\r:\x01\x31\"j\n\x12\x42\x61tchNormParameter\x12\x18\n\x10use_global_stats\x18\x01 \x01(\x08\x12&\n\x17moving_average_fraction\x18\x02 \x01(\x02:\x05\x30.999\x12\x12\n\x03\x65ps\x18\x03 \x01(\x02:\x05\x31\x65-05\"]\n\rBiasParameter\x12\x0f\n\x04\x61xis\x18\x01 \x01(\x05:\x01\x31\x12\x13\n\x08num_axes\x18\x02 \x01(\x05:\x01\x31\x12&\n\x06\x66iller\x18\x03 \x01(\x0b\x32\x16.caffe.FillerParameter\"\x8b\x02\n\x0b\x42NParameter\x12,\n\x0cslope_filler\x18\x01 \x01(\x0b\x32\x16.caffe.FillerParameter\x12+\n\x0b\x62ias_filler\x18\x02 \x01(\x0b\x32\x16.caffe.FillerParameter\x12\x15\n\x08momentum\x18\x03 \x01(\x02:\x03\x30.9\x12\x12\n\x03\x65ps\x18\x04 \x01(\x02:\x05\x31\x65-05\x12\x15\n\x06\x66rozen\x18\x05 \x01(\x08:\x05\x66\x61lse\x12\x32\n\x06\x65ngine\x18\x06 \x01(\x0e\x32\x19.caffe.BNParameter.Engine:\x07\x44\x45\x46\x41ULT\"+\n\x06\x45ngine\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\t\n\x05\x43\x41\x46\x46\x45\x10\x01\x12\t\n\x05\x43UDNN\x10\x02\"\xa4\x04\n\x14\x43onvolutionParameter\x12\x12\n\nnum_output\x18\x01 \x01(\r\x12\x17\n\tbias_term\x18\x02 \x01(\x08:\x04true\x12\x0b\n\x03pad\x18\x03 \x03(\r\x12\x13\n\x0bkernel_size\x18\x04 \x03(\r\x12\x0e\n\x06stride\x18\x06 \x03(\r\x12\x10\n\x08\x64ilation\x18\x12 \x03(\r\x12\x10\n\x05pad_h\x18\t \x01(\r:\x01\x30\x12\x10\n\x05pad_w\x18\n \x01(\r:\x01\x30\x12\x10\n\x08kernel_h\x18\x0b \x01(\r\x12\x10\n\x08kernel_w\x18\x0c \x01(\r\x12\x10\n\x08stride_h\x18\r \x01(\r\x12\x10\n\x08stride_w\x18\x0e \x01(\r\x12\x10\n\x05group\x18\x05 \x01(\r:\x01\x31\x12-\n\rweight_filler\x18\x07 \x01(\x0b\x32\x16.caffe.FillerParameter\x12+\n\x0b\x62ias_filler\x18\x08 \x01(\x0b\x32\x16.caffe.FillerParameter\x12;\n\x06\x65ngine\x18\x0f \x01(\x0e\x32\".caffe.ConvolutionParameter.Engine:\x07\x44\x45\x46\x41ULT\x12\x18\n\rwinograd_tile\x18\x13 \x01(\r:\x01\x30\x12\x0f\n\x04\x61xis\x18\x10 \x01(\x05:\x01\x31\x12\x1e\n\x0f\x66orce_nd_im2col\x18\x11 \x01(\x08:\x05\x66\x61lse\"9\n\x06\x45ngine\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\t\n\x05\x43\x41\x46\x46\x45\x10\x01\x12\t\n\x05\x43UDNN\x10\x02\x12\x0c\n\x08WINOGRAD\x10\x03\"0\n\rCropParameter\x12\x0f\n\x04\x61xis\x18\x01 \x01(\x05:\x01\x32\x12\x0e\n\x06offset\x18\x02 \x03(\r\".\n\x10\x44ropoutParameter\x12\x1a\n\rdropout_ratio\x18\x01 \x01(\x02:\x03\x30.5\"\xa5\x01\n\x10\x45ltwiseParameter\x12\x39\n\toperation\x18\x01 \x01(\x0e\x32!.caffe.EltwiseParameter.EltwiseOp:\x03SUM\x12\r\n\x05\x63oeff\x18\x02 \x03(\x02\x12\x1e\n\x10stable_prod_grad\x18\x03 \x01(\x08:\x04true\"\'\n\tEltwiseOp\x12\x08\n\x04PROD\x10\x00\x12\x07\n\x03SUM\x10\x01\x12\x07\n\x03MAX\x10\x02\" \n\x0c\x45LUParameter\x12\x10\n\x05\x61lpha\x18\x01 \x01(\x02:\x01\x31\"\xac\x01\n\x0e\x45mbedParameter\x12\x12\n\nnum_output\x18\x01 \x01(\r\x12\x11\n\tinput_dim\x18\x02 \x01(\r\x12\x17\n\tbias_term\x18\x03 \x01(\x08:\x04true\x12-\n\rweight_filler\x18\x04 \x01(\x0b\x32\x16.caffe.FillerParameter\x12+\n\x0b\x62ias_filler\x18\x05 \x01(\x0b\x32\x16.caffe.FillerParameter\"D\n\x0c\x45xpParameter\x12\x10\n\x04\x62\x61se\x18\x01 \x01(\x02:\x02-1\x12\x10\n\x05scale\x18\x02 \x01(\x02:\x01\x31\x12\x10\n\x05shift\x18\x03 \x01(\x02:\x01\x30\"9\n\x10\x46lattenParameter\x12\x0f\n\x04\x61xis\x18\x01 \x01(\x05:\x01\x31\x12\x14\n\x08\x65nd_axis\x18\x02 \x01(\x05:\x02-1\"\xcb\x01\n\x15InnerProductParameter\x12\x12\n\nnum_output\x18\x01 \x01(\r\x12\x17\n\tbias_term\x18\x02 \x01(\x08:\x04true\x12-\n\rweight_filler\x18\x03 \x01(\x0b\x32\x16.caffe.FillerParameter\x12+\n\x0b\x62ias_filler\x18\x04 \x01(\x0b\x32\x16.caffe.FillerParameter\x12\x0f\n\x04\x61xis\x18\x05 \x01(\x05:\x01\x31\x12\x18\n\ttranspose\x18\x06 \x01(\x08:\x05\x66\x61lse\"1\n\x0eInputParameter\x12\x1f\n\x05shape\x18\x01 \x03(\x0b\x32\x10.caffe.BlobShape\"D\n\x0cLogParameter\x12\x10\n\x04\x62\x61se\x18\x01 \x01(\x02:\x02-1\x12\x10\n\x05scale\x18\x02 \x01(\x02:\x01\x31\x12\x10\n\x05shift\x18\x03 \x01(\x02:\x01\x30\"\xb8\x02\n\x0cLRNParameter\x12\x15\n\nlocal_size\x18\x01 \x01(\r:\x01\x35\x12\x10\n\x05\x61lpha\x18\x02 \x01(\x02:\x01\x31\x12\x12\n\x04\x62\x65ta\x18\x03 \x01(\x02:\x04\x30.75\x12\x44\n\x0bnorm_region\x18\x04 \x01(\x0e\x32\x1e.caffe.LRNParameter.NormRegion:\x0f\x41\x43ROSS_CHANNELS\x12\x0c\n\x01k\x18\x05 \x01(\x02:\x01\x31\x12\x33\n\x06\x65ngine\x18\x06 \x01(\x0e\x32\x1a.caffe.LRNParameter.Engine:\x07\x44\x45\x46\x41ULT\"5\n\nNormRegion\x12\x13\n\x0f\x41\x43ROSS_CHANNELS\x10\x00\x12\x12\n\x0eWITHIN_CHANNEL\x10\x01\"+\n\x06\x45ngine\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\t\n\x05\x43\x41\x46\x46\x45\x10\x01\x12\t\n\x05\x43UDNN\x10\x02\"d\n\x0cMVNParameter\x12 \n\x12normalize_variance\x18\x01 \x01(\x08:\x04true\x12\x1e\n\x0f\x61\x63ross_channels\x18\x02 \x01(\x08:\x05\x66\x61lse\x12\x12\n\x03\x65ps\x18\x03 \x01(\x02:\x05\x31\x65-09\"5\n\x12ParameterParameter\x12\x1f\n\x05shape\x18\x01 \x01(\x0b\x32\x10.caffe.BlobShape\"\x92\x03\n\x10PoolingParameter\x12\x35\n\x04pool\x18\x01 \x01(\x0e\x32\".caffe.PoolingParameter.PoolMethod:\x03MAX\x12\x0e\n\x03pad\x18\x04 \x01(\r:\x01\x30\x12\x10\n\x05pad_h\x18\t \x01(\r:\x01\x30\x12\x10\n\x05pad_w\x18\n \x01(\r:\x01\x30\x12\x13\n\x0bkernel_size\x18\x02 \x01(\r\x12\x10\n\x08kernel_h\x18\x05 \x01(\r\x12\x10\n\x08kernel_w\x18\x06 \x01(\r\x12\x11\n\x06stride\x18\x03 \x01(\r:\x01\x31\x12\x10\n\x08stride_h\x18\x07 \x01(\r\x12\x10\n\x08stride_w\x18\x08 \x01(\r\x12\x37\n\x06\x65ngine\x18\x0b \x01(\x0e\x32\x1e.caffe.PoolingParameter.Engine:\x07\x44\x45\x46\x41ULT\x12\x1d\n\x0eglobal_pooling\x18\x0c \x01(\x08:\x05\x66\x61lse\"\x1e\n\nPoolMethod\x12\x07\n\x03MAX\x10\x00\x12\x07\n\x03\x41VE\x10\x01\"+\n\x06\x45ngine\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\t\n\x05\x43\x41\x46\x46\x45\x10\x01\x12\t\n\x05\x43UDNN\x10\x02\"F\n\x0ePowerParameter\x12\x10\n\x05power\x18\x01 \x01(\x02:\x01\x31\x12\x10\n\x05scale\x18\x02 \x01(\x02:\x01\x31\x12\x10\n\x05shift\x18\x03 \x01(\x02:\x01\x30\"W\n\x0ePReLUParameter\x12&\n\x06\x66iller\x18\x01 \x01(\x0b\x32\x16.caffe.FillerParameter\x12\x1d\n\x0e\x63hannel_shared\x18\x02 \x01(\x08:\x05\x66\x61lse\"\xc8\x01\n\x11ProposalParameter\x12\x17\n\x0b\x66\x65\x61t_stride\x18\x01 \x01(\r:\x02\x31\x36\x12\x15\n\tbase_size\x18\x02 \x01(\r:\x02\x31\x36\x12\x14\n\x08min_size\x18\x03 \x01(\r:\x02\x31\x36\x12\r\n\x05ratio\x18\x04 \x03(\x02\x12\r\n\x05scale\x18\x05 \x03(\x02\x12\x1a\n\x0cpre_nms_topn\x18\x06 \x01(\r:\x04\x36\x30\x30\x30\x12\x1a\n\rpost_nms_topn\x18\x07 \x01(\r:\x03\x33\x30\x30\x12\x17\n\nnms_thresh\x18\x08 \x01(\x02:\x03\x30.7\"V\n\x15PSROIPoolingParameter\x12\x15\n\rspatial_scale\x18\x01 \x02(\x02\x12\x12\n\noutput_dim\x18\x02 \x02(\x05\x12\x12\n\ngroup_size\x18\x03 \x02(\x05\"P\n\x15QuantizationParameter\x12\x17\n\x0c\x62ottom_scale\x18\x01 \x01(\x02:\x01\x30\x12\x1e\n\x11\x62ottom_zero_point\x18\x02 \x01(\r:\x03\x31\x32\x38\"\xad\x01\n\x12ReductionParameter\x12=\n\toperation\x18\x01 \x01(\x0e\x32%.caffe.ReductionParameter.ReductionOp:\x03SUM\x12\x0f\n\x04\x61xis\x18\x02 \x01(\x05:\x01\x30\x12\x10\n\x05\x63oeff\x18\x03 \x01(\x02:\x01\x31\"5\n\x0bReductionOp\x12\x07\n\x03SUM\x10\x01\x12\x08\n\x04\x41SUM\x10\x02\x12\t\n\x05SUMSQ\x10\x03\x12\x08\n\x04MEAN\x10\x04\"\x8d\x01\n\rReLUParameter\x12\x19\n\x0enegative_slope\x18\x01 \x01(\x02:\x01\x30\x12\x34\n\x06\x65ngine\x18\x02 \x01(\x0e\x32\x1b.caffe.ReLUParameter.Engine:\x07\x44\x45\x46\x41ULT\"+\n\x06\x45ngine\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\t\n\x05\x43\x41\x46\x46\x45\x10\x01\x12\t\n\x05\x43UDNN\x10\x02\"Q\n\x10ReorderParameter\x12\x1f\n\x14\x62ottom_channel_block\x18\x01 \x01(\r:\x01\x30\x12\x1c\n\x11top_channel_block\x18\x02 \x01(\r:\x01\x30\"Z\n\x10ReshapeParameter\x12\x1f\n\x05shape\x18\x01 \x01(\x0b\x32\x10.caffe.BlobShape\x12\x0f\n\x04\x61xis\x18\x02 \x01(\x05:\x01\x30\x12\x14\n\x08num_axes\x18\x03 \x01(\x05:\x02-1\"Y\n\x13ROIPoolingParameter\x12\x13\n\x08pooled_h\x18\x01 \x01(\r:\x01\x30\x12\x13\n\x08pooled_w\x18\x02 \x01(\r:\x01\x30\x12\x18\n\rspatial_scale\x18\x03 \x01(\x02:\x01\x31\"\xa5\x01\n\x0eScaleParameter\x12\x0f\n\x04\x61xis\x18\x01 \x01(\x05:\x01\x31\x12\x13\n\x08num_axes\x18\x02 \x01(\x05:\x01\x31\x12&\n\x06\x66iller\x18\x03 \x01(\x0b\x32\x16.caffe.FillerParameter\x12\x18\n\tbias_term\x18\x04 \x01(\x08:\x05\x66\x61lse\x12+\n\x0b\x62ias_filler\x18\x05 \x01(\x0b\x32\x16.caffe.FillerParameter\"x\n\x10SigmoidParameter\x12\x37\n\x06\x65ngine\x18\x01 \x01(\x0e\x32\x1e.caffe.SigmoidParameter.Engine:\x07\x44\x45\x46\x41ULT\"+\n\x06\x45ngine\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\t\n\x05\x43\x41\x46\x46\x45\x10\x01\x12\t\n\x05\x43UDNN\x10\x02\"L\n\x0eSliceParameter\x12\x0f\n\x04\x61xis\x18\x03 \x01(\x05:\x01\x31\x12\x13\n\x0bslice_point\x18\x02 \x03(\r\x12\x14\n\tslice_dim\x18\x01 \x01(\r:\x01\x31\"\x89\x01\n\x10SoftmaxParameter\x12\x37\n\x06\x65ngine\x18\x01 \x01(\x0e\x32\x1e.caffe.SoftmaxParameter.Engine:\x07\x44\x45\x46\x41ULT\x12\x0f\n\x04\x61xis\x18\x02 \x01(\x05:\x01\x31\"+\n\x06\x45ngine\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\t\n\x05\x43\x41\x46\x46\x45\x10\x01\x12\t\n\x05\x43UDNN\x10\x02\"r\n\rTanHParameter\x12\x34\n\x06\x65ngine\x18\x01 \x01(\x0e\x32\x1b.caffe.TanHParameter.Engine:\x07\x44\x45\x46\x41ULT\"+\n\x06\x45ngine\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\t\n\x05\x43\x41\x46\x46\x45\x10\x01\x12\t\n\x05\x43UDNN\x10\x02\"/\n\rTileParameter\x12\x0f\n\x04\x61xis\x18\x01 \x01(\x05:\x01\x31\x12\r\n\x05tiles\x18\x02 \x01(\x05\"*\n\x12ThresholdParameter\x12\x14\n\tthreshold\x18\x01 \x01(\x02:\x01\x30\"\xdb\x01\n\x0cSPPParameter\x12\x16\n\x0epyramid_height\x18\x01 \x01(\r\x12\x31\n\x04pool\x18\x02 \x01(\x0e\x32\x1e.caffe.SPPParameter.PoolMethod:\x03MAX\x12\x33\n\x06\x65ngine\x18\x06 \x01(\x0e\x32\x1a.caffe.SPPParameter.Engine:\x07\x44\x45\x46\x41ULT\"\x1e\n\nPoolMethod\x12\x07\n\x03MAX\x10\x00\x12\x07\n\x03\x41VE\x10\x01\"+\n\x06\x45ngine\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\t\n\x05\x43\x41\x46\x46\x45\x10\x01\x12\t\n\x05\x43UDNN\x10\x02\"[\n\x1eNonMaximumSuppressionParameter\x12\x1a\n\rnms_threshold\x18\x01 \x01(\x02:\x03\x30.3\x12\r\n\x05top_k\x18\x02 \x01(\x05\x12\x0e\n\x03\x65ta\x18\x03 \x01(\x02:\x01\x31\"\xaa\x01\n\x13SaveOutputParameter\x12\x18\n\x10output_directory\x18\x01 \x01(\t\x12\x1a\n\x12output_name_prefix\x18\x02 \x01(\t\x12\x15\n\routput_format\x18\x03 \x01(\t\x12\x16\n\x0elabel_map_file\x18\x04 \x01(\t\x12\x16\n\x0ename_size_file\x18\x05 \x01(\t\x12\x16\n\x0enum_test_image\x18\x06 \x01(\r\"\xc7\x03\n\x18\x44\x65tectionOutputParameter\x12\x13\n\x0bnum_classes\x18\x01 \x01(\r\x12\x1c\n\x0eshare_location\x18\x02 \x01(\x08:\x04true\x12\x1e\n\x13\x62\x61\x63kground_label_id\x18\x03 \x01(\x05:\x01\x30\x12\x38\n\tnms_param\x18\x04 \x01(\x0b\x32%.caffe.NonMaximumSuppressionParameter\x12\x35\n\x11save_output_param\x18\x05 \x01(\x0b\x32\x1a.caffe.SaveOutputParameter\x12<\n\tcode_type\x18\x06 \x01(\x0e\x32!.caffe.PriorBoxParameter.CodeType:\x06\x43ORNER\x12)\n\x1avariance_encoded_in_target\x18\x08 \x01(\x08:\x05\x66\x61lse\x12\x16\n\nkeep_top_k\x18\x07 \x01(\x05:\x02-1\x12\x1c\n\x14\x63onfidence_threshold\x18\t \x01(\x02\x12\x18\n\tvisualize\x18\n \x01(\x08:\x05\x66\x61lse\x12\x1b\n\x13visualize_threshold\x18\x0b \x01(\x02\x12\x11\n\tsave_file\x18\x0c \x01(\t\"!\n\x10PermuteParameter\x12\r\n\x05order\x18\x01 \x03(\r\"\xb5\x02\n\x11PriorBoxParameter\x12\x10\n\x08min_size\x18\x01 \x03(\x02\x12\x10\n\x08max_size\x18\x02 \x03(\x02\x12\x14\n\x0c\x61spect_ratio\x18\x03 \x03(\x02\x12\x12\n\x04\x66lip\x18\x04 \x01(\x08:\x04true\x12\x13\n\x04\x63lip\x18\x05 \x01(\x08:\x05\x66\x61lse\x12\x10\n\x08variance\x18\x06 \x03(\x02\x12\x10\n\x08img_size\x18\x07 \x01(\r\x12\r\n\x05img_h\x18\x08 \x01(\r\x12\r\n\x05img_w\x18\t \x01(\r\x12\x0c\n\x04step\x18\n \x01(\x02\x12\x0e\n\x06step_h\x18\x0b \x01(\x02\x12\x0e\n\x06step_w\x18\x0c \x01(\x02\x12\x13\n\x06offset\x18\r \x01(\x02:\x03\x30.5\"8\n\x08\x43odeType\x12\n\n\x06\x43ORNER\x10\x01\x12\x0f\n\x0b\x43\x45NTER_SIZE\x10\x02\x12\x0f\n\x0b\x43ORNER_SIZE\x10\x03\"+\n\x17ShuffleChannelParameter\x12\x10\n\x05group\x18\x01 \x01(\r:\x01\x31\"\x92\x01\n\x12NormalizeParameter\x12\x1c\n\x0e\x61\x63ross_spatial\x18\x01 \x01(\x08:\x04true\x12,\n\x0cscale_filler\x18\x02 \x01(\x0b\x32\x16.caffe.FillerParameter\x12\x1c\n\x0e\x63hannel_shared\x18\x03 \x01(\x08:\x04true\x12\x12\n\x03\x65ps\x18\x04 \x01(\x02:\x05\x31\x65-10\"\xc5\x0b\n\x10V1LayerParameter\x12\x0e\n\x06\x62ottom\x18\x02 \x03(\t\x12\x0b\n\x03top\x18\x03 \x03(\t\x12\x0c\n\x04name\x18\x04 \x01(\t\x12$\n\x07include\x18  \x03(\x0b\x32\x13.caffe.NetStateRule\x12$\n\x07\x65xclude\x18! \x03(\x0b\x32\x13.caffe.NetStateRule\x12/\n\x04type\x18\x05 \x01(\x0e\x32!.caffe.V1LayerParameter.LayerType\x12\x1f\n\x05\x62lobs\x18\x06 \x03(\x0b\x32\x10.caffe.BlobProto\x12\x0e\n\x05param\x18\xe9\x07 \x03(\t\x12>\n\x0f\x62lob_share_mode\x18\xea\x07 \x03(\x0e\x32$.caffe.V1LayerParameter.DimCheckMode\x12\x10\n\x08\x62lobs_lr\x18\x07 \x03(\x02\x12\x14\n\x0cweight_decay\x18\x08 \x03(\x02\x12\x13\n\x0bloss_weight\x18# \x03(\x02\x12,\n\x0c\x63oncat_param\x18\t \x01(\x0b\x32\x16.caffe.ConcatParameter\x12\x36\n\x11\x63onvolution_param\x18\n \x01(\x0b\x32\x1b.caffe.ConvolutionParameter\x12.\n\rdropout_param\x18\x0c \x01(\x0b\x32\x17.caffe.DropoutParameter\x12.\n\reltwise_param\x18\x18 \x01(\x0b\x32\x17.caffe.EltwiseParameter\x12&\n\texp_param\x18) \x01(\x0b\x32\x13.caffe.ExpParameter\x12\x39\n\x13inner_product_param\x18\x11 \x01(\x0b\x32\x1c.caffe.InnerProductParameter\x12&\n\tlrn_param\x18\x12 \x01(\x0b\x32\x13.caffe.LRNParameter\x12&\n\tmvn_param\x18\" \x01(\x0b\x32\x13.caffe.MVNParameter\x12.\n\rpooling_param\x18\x13 \x01(\x0b\x32\x17.caffe.PoolingParameter\x12*\n\x0bpower_param\x18\x15 \x01(\x0b\x32\x15.caffe.PowerParameter\x12(\n\nrelu_param\x18\x1e \x01(\x0b\x32\x14.caffe.ReLUParameter\x12.\n\rsigmoid_param\x18& \x01(\x0b\x32\x17.caffe.SigmoidParameter\x12.\n\rsoftmax_param\x18\' \x01(\x0b\x32\x17.caffe.SoftmaxParameter\x12*\n\x0bslice_param\x18\x1f \x01(\x0b\x32\x15.caffe.SliceParameter\x12(\n\ntanh_param\x18% \x01(\x0b\x32\x14.caffe.TanHParameter\x12\x32\n\x0fthreshold_param\x18\x19 \x01(\x0b\x32\x19.caffe.ThresholdParameter\x12(\n\nloss_param\x18* \x01(\x0b\x32\x14.caffe.LossParameter\"\x9b\x02\n\tLayerType\x12\x08\n\x04NONE\x10\x00\x12\n\n\x06\x41\x42SVAL\x10#\x12\x08\n\x04\x42NLL\x10\x02\x12\n\n\x06\x43ONCAT\x10\x03\x12\x0f\n\x0b\x43ONVOLUTION\x10\x04\x12\x11\n\rDECONVOLUTION\x10\'\x12\x0b\n\x07\x44ROPOUT\x10\x06\x12\x0b\n\x07\x45LTWISE\x10\x19\x12\x07\n\x03\x45XP\x10&\x12\x0b\n\x07\x46LATTEN\x10\x08\x12\x11\n\rINNER_PRODUCT\x10\x0e\x12\x07\n\x03LRN\x10\x0f\x12\x07\n\x03MVN\x10\"\x12\x0b\n\x07POOLING\x10\x11\x12\t\n\x05POWER\x10\x1a\x12\x08\n\x04RELU\x10\x12\x12\x0b\n\x07SIGMOID\x10\x13\x12\x0b\n\x07SOFTMAX\x10\x14\x12\t\n\x05SPLIT\x10\x16\x12\t\n\x05SLICE\x10!\x12\x08\n\x04TANH\x10\x17\x12\r\n\tTHRESHOLD\x10\x1f\"*\n\x0c\x44imCheckMode\x12\n\n\x06STRICT\x10\x00\x12\x0e\n\nPERMISSIVE\x10\x01*\x1c\n\x05Phase\x12\t\n\x05TRAIN\x10\x00\x12\x08\n\x04TEST\x10\x01')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'caffe_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _BLOBSHAPE.fields_by_name['dim']._options = None
+  _BLOBSHAPE.fields_by_name['dim']._serialized_options = b'\020\001'
+  _BLOBPROTO.fields_by_name['data']._options = None
+  _BLOBPROTO.fields_by_name['data']._serialized_options = b'\020\001'
+  _BLOBPROTO.fields_by_name['diff']._options = None
+  _BLOBPROTO.fields_by_name['diff']._serialized_options = b'\020\001'
+  _BLOBPROTO.fields_by_name['double_data']._options = None
+  _BLOBPROTO.fields_by_name['double_data']._serialized_options = b'\020\001'
+  _BLOBPROTO.fields_by_name['double_diff']._options = None
+  _BLOBPROTO.fields_by_name['double_diff']._serialized_options = b'\020\001'
+  _PHASE._serialized_start=11843
+  _PHASE._serialized_end=11871
+  _BLOBSHAPE._serialized_start=22
+  _BLOBSHAPE._serialized_end=50
+  _BLOBPROTO._serialized_start=53
+  _BLOBPROTO._serialized_end=257
+  _BLOBPROTOVECTOR._serialized_start=259
+  _BLOBPROTOVECTOR._serialized_end=309
+  _NORMALIZEDBBOX._serialized_start=312
+  _NORMALIZEDBBOX._serialized_end=447
+  _FILLERPARAMETER._serialized_start=450
+  _FILLERPARAMETER._serialized_end=716
+  _FILLERPARAMETER_VARIANCENORM._serialized_start=664
+  _FILLERPARAMETER_VARIANCENORM._serialized_end=716
+  _NETPARAMETER._serialized_start=719
+  _NETPARAMETER._serialized_end=1081
+  _NETSTATE._serialized_start=1083
+  _NETSTATE._serialized_end=1161
+  _NETSTATERULE._serialized_start=1163
+  _NETSTATERULE._serialized_end=1278
+  _PARAMSPEC._serialized_start=1281
+  _PARAMSPEC._serialized_end=1444
+  _PARAMSPEC_DIMCHECKMODE._serialized_start=1402
+  _PARAMSPEC_DIMCHECKMODE._serialized_end=1444
+  _LAYERPARAMETER._serialized_start=1447
+  _LAYERPARAMETER._serialized_end=3870
+  _LOSSPARAMETER._serialized_start=3873
+  _LOSSPARAMETER._serialized_end=4067
+  _LOSSPARAMETER_NORMALIZATIONMODE._serialized_start=4001
+  _LOSSPARAMETER_NORMALIZATIONMODE._serialized_end=4067
+  _ARGMAXPARAMETER._serialized_start=4069
+  _ARGMAXPARAMETER._serialized_end=4146
+  _CONCATPARAMETER._serialized_start=4148
+  _CONCATPARAMETER._serialized_end=4205
+  _BATCHNORMPARAMETER._serialized_start=4207
+  _BATCHNORMPARAMETER._serialized_end=4313
+  _BIASPARAMETER._serialized_start=4315
+  _BIASPARAMETER._serialized_end=4408
+  _BNPARAMETER._serialized_start=4411
+  _BNPARAMETER._serialized_end=4678
+  _BNPARAMETER_ENGINE._serialized_start=4635
+  _BNPARAMETER_ENGINE._serialized_end=4678
+  _CONVOLUTIONPARAMETER._serialized_start=4681
+  _CONVOLUTIONPARAMETER._serialized_end=5229
+  _CONVOLUTIONPARAMETER_ENGINE._serialized_start=5172
+  _CONVOLUTIONPARAMETER_ENGINE._serialized_end=5229
+  _CROPPARAMETER._serialized_start=5231
+  _CROPPARAMETER._serialized_end=5279
+  _DROPOUTPARAMETER._serialized_start=5281
+  _DROPOUTPARAMETER._serialized_end=5327
+  _ELTWISEPARAMETER._serialized_start=5330
+  _ELTWISEPARAMETER._serialized_end=5495
+  _ELTWISEPARAMETER_ELTWISEOP._serialized_start=5456
+  _ELTWISEPARAMETER_ELTWISEOP._serialized_end=5495
+  _ELUPARAMETER._serialized_start=5497
+  _ELUPARAMETER._serialized_end=5529
+  _EMBEDPARAMETER._serialized_start=5532
+  _EMBEDPARAMETER._serialized_end=5704
+  _EXPPARAMETER._serialized_start=5706
+  _EXPPARAMETER._serialized_end=5774
+  _FLATTENPARAMETER._serialized_start=5776
+  _FLATTENPARAMETER._serialized_end=5833
+  _INNERPRODUCTPARAMETER._serialized_start=5836
+  _INNERPRODUCTPARAMETER._serialized_end=6039
+  _INPUTPARAMETER._serialized_start=6041
+  _INPUTPARAMETER._serialized_end=6090
+  _LOGPARAMETER._serialized_start=6092
+  _LOGPARAMETER._serialized_end=6160
+  _LRNPARAMETER._serialized_start=6163
+  _LRNPARAMETER._serialized_end=6475
+  _LRNPARAMETER_NORMREGION._serialized_start=6377
+  _LRNPARAMETER_NORMREGION._serialized_end=6430
+  _LRNPARAMETER_ENGINE._serialized_start=4635
+  _LRNPARAMETER_ENGINE._serialized_end=4678
+  _MVNPARAMETER._serialized_start=6477
+  _MVNPARAMETER._serialized_end=6577
+  _PARAMETERPARAMETER._serialized_start=6579
+  _PARAMETERPARAMETER._serialized_end=6632
+  _POOLINGPARAMETER._serialized_start=6635
+  _POOLINGPARAMETER._serialized_end=7037
+  _POOLINGPARAMETER_POOLMETHOD._serialized_start=6962
+  _POOLINGPARAMETER_POOLMETHOD._serialized_end=6992
+  _POOLINGPARAMETER_ENGINE._serialized_start=4635
+  _POOLINGPARAMETER_ENGINE._serialized_end=4678
+  _POWERPARAMETER._serialized_start=7039
+  _POWERPARAMETER._serialized_end=7109
+  _PRELUPARAMETER._serialized_start=7111
+  _PRELUPARAMETER._serialized_end=7198
+  _PROPOSALPARAMETER._serialized_start=7201
+  _PROPOSALPARAMETER._serialized_end=7401
+  _PSROIPOOLINGPARAMETER._serialized_start=7403
+  _PSROIPOOLINGPARAMETER._serialized_end=7489
+  _QUANTIZATIONPARAMETER._serialized_start=7491
+  _QUANTIZATIONPARAMETER._serialized_end=7571
+  _REDUCTIONPARAMETER._serialized_start=7574
+  _REDUCTIONPARAMETER._serialized_end=7747
+  _REDUCTIONPARAMETER_REDUCTIONOP._serialized_start=7694
+  _REDUCTIONPARAMETER_REDUCTIONOP._serialized_end=7747
+  _RELUPARAMETER._serialized_start=7750
+  _RELUPARAMETER._serialized_end=7891
+  _RELUPARAMETER_ENGINE._serialized_start=4635
+  _RELUPARAMETER_ENGINE._serialized_end=4678
+  _REORDERPARAMETER._serialized_start=7893
+  _REORDERPARAMETER._serialized_end=7974
+  _RESHAPEPARAMETER._serialized_start=7976
+  _RESHAPEPARAMETER._serialized_end=8066
+  _ROIPOOLINGPARAMETER._serialized_start=8068
+  _ROIPOOLINGPARAMETER._serialized_end=8157
+  _SCALEPARAMETER._serialized_start=8160
+  _SCALEPARAMETER._serialized_end=8325
+  _SIGMOIDPARAMETER._serialized_start=8327
+  _SIGMOIDPARAMETER._serialized_end=8447
+  _SIGMOIDPARAMETER_ENGINE._serialized_start=4635
+  _SIGMOIDPARAMETER_ENGINE._serialized_end=4678
+  _SLICEPARAMETER._serialized_start=8449
+  _SLICEPARAMETER._serialized_end=8525
+  _SOFTMAXPARAMETER._serialized_start=8528
+  _SOFTMAXPARAMETER._serialized_end=8665
+  _SOFTMAXPARAMETER_ENGINE._serialized_start=4635
+  _SOFTMAXPARAMETER_ENGINE._serialized_end=4678
+  _TANHPARAMETER._serialized_start=8667
+  _TANHPARAMETER._serialized_end=8781
+  _TANHPARAMETER_ENGINE._serialized_start=4635
+  _TANHPARAMETER_ENGINE._serialized_end=4678
+  _TILEPARAMETER._serialized_start=8783
+  _TILEPARAMETER._serialized_end=8830
+  _THRESHOLDPARAMETER._serialized_start=8832
+  _THRESHOLDPARAMETER._serialized_end=8874
+  _SPPPARAMETER._serialized_start=8877
+  _SPPPARAMETER._serialized_end=9096
+  _SPPPARAMETER_POOLMETHOD._serialized_start=6962
+  _SPPPARAMETER_POOLMETHOD._serialized_end=6992
+  _SPPPARAMETER_ENGINE._serialized_start=4635
+  _SPPPARAMETER_ENGINE._serialized_end=4678
+  _NONMAXIMUMSUPPRESSIONPARAMETER._serialized_start=9098
+  _NONMAXIMUMSUPPRESSIONPARAMETER._serialized_end=9189
+  _SAVEOUTPUTPARAMETER._serialized_start=9192
+  _SAVEOUTPUTPARAMETER._serialized_end=9362
+  _DETECTIONOUTPUTPARAMETER._serialized_start=9365
+  _DETECTIONOUTPUTPARAMETER._serialized_end=9820
+  _PERMUTEPARAMETER._serialized_start=9822
+  _PERMUTEPARAMETER._serialized_end=9855
+  _PRIORBOXPARAMETER._serialized_start=9858
+  _PRIORBOXPARAMETER._serialized_end=10167
+  _PRIORBOXPARAMETER_CODETYPE._serialized_start=10111
+  _PRIORBOXPARAMETER_CODETYPE._serialized_end=10167
+  _SHUFFLECHANNELPARAMETER._serialized_start=10169
+  _SHUFFLECHANNELPARAMETER._serialized_end=10212
+  _NORMALIZEPARAMETER._serialized_start=10215
+  _NORMALIZEPARAMETER._serialized_end=10361
+  _V1LAYERPARAMETER._serialized_start=10364
+  _V1LAYERPARAMETER._serialized_end=11841
+  _V1LAYERPARAMETER_LAYERTYPE._serialized_start=11514
+  _V1LAYERPARAMETER_LAYERTYPE._serialized_end=11797
+  _V1LAYERPARAMETER_DIMCHECKMODE._serialized_start=1402
+  _V1LAYERPARAMETER_DIMCHECKMODE._serialized_end=1444
+# @@protoc_insertion_point(module_scope)
@@ -0,0 +1,29 @@
+#include <string>
+#include <vector>
+
+#include <caffe/net.hpp>
+
+// net.prototxt -> net_int8.prototxt, net.caffemodel -> net_int8.caffemodel
+static std::string Int8Path(const std::string& path) {
+  size_t dot = path.rfind('.');
+  if (dot == std::string::npos || dot < path.find_last_of("/\\") + 1) {
+    dot = path.size();
+  }
+  return path.substr(0, dot) + "_int8" + path.substr(dot);
+}
+
+int main(int argc, char *argv[]) {
+  CHECK(argc >= 4) << "[Usage]: ./calibrate net.prototxt net.caffemodel "
+                   << "input.binaryproto...";
+  std::string proto = argv[1];
+  std::string model = argv[2];
+  std::vector<std::string> inputs(argv + 3, argv + argc);
+  std::string out_proto = Int8Path(proto);
+  std::string out_model = Int8Path(model);
+  LOG(INFO) << "net prototxt: " << proto;
+  LOG(INFO) << "net caffemodel: " << model;
+  LOG(INFO) << "calibrate over " << inputs.size() << " inputs";
+  caffe::CalibrateInt8(proto, model, inputs, out_proto, out_model);
+  LOG(INFO) << "write int8 net to " << out_proto << " and " << out_model;
+  return 0;
+}
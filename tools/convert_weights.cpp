@@ -0,0 +1,24 @@
+#include <string>
+
+#include <caffe/net.hpp>
+
+// net.caffemodel -> net.flat
+static std::string FlatPath(const std::string& path) {
+  size_t dot = path.rfind('.');
+  if (dot == std::string::npos || dot < path.find_last_of("/\\") + 1) {
+    dot = path.size();
+  }
+  return path.substr(0, dot) + ".flat";
+}
+
+int main(int argc, char *argv[]) {
+  CHECK(argc == 2 || argc == 3) << "[Usage]: ./convert_weights net.caffemodel "
+                                << "[out.flat]";
+  std::string model = argv[1];
+  std::string out_model = argc == 3 ? argv[2] : FlatPath(model);
+  LOG(INFO) << "net caffemodel: " << model;
+  caffe::ConvertToFlatWeights(model, out_model);
+  LOG(INFO) << "write flat weights to " << out_model
+            << ", load it like a caffemodel";
+  return 0;
+}
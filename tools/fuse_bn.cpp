@@ -0,0 +1,33 @@
+#include <string>
+
+#include <caffe/net.hpp>
+
+// net.prototxt -> net_nobn.prototxt
+static std::string NoBNPath(const std::string& path) {
+  size_t dot = path.rfind('.');
+  if (dot == std::string::npos || dot < path.find_last_of("/\\") + 1) {
+    dot = path.size();
+  }
+  return path.substr(0, dot) + "_nobn" + path.substr(dot);
+}
+
+int main(int argc, char *argv[]) {
+  CHECK(argc == 3 || argc == 5) << "[Usage]: ./fuse_bn net.prototxt net.caffemodel "
+                                << "[out.prototxt out.caffemodel]";
+  std::string proto = argv[1];
+  std::string model = argv[2];
+  std::string out_proto, out_model;
+  if (argc == 5) {
+    out_proto = argv[3];
+    out_model = argv[4];
+  }
+  else {
+    out_proto = NoBNPath(proto);
+    out_model = NoBNPath(model);
+  }
+  LOG(INFO) << "net prototxt: " << proto;
+  LOG(INFO) << "net caffemodel: " << model;
+  caffe::FoldBatchNorm(proto, model, out_proto, out_model);
+  LOG(INFO) << "write folded net to " << out_proto << " and " << out_model;
+  return 0;
+}
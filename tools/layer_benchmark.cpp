@@ -0,0 +1,93 @@
+#include <stdlib.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <caffe/net.hpp>
+#include "../src/util/layer_benchmark.hpp"
+
+using namespace std;
+
+// "1x3x224x224" -> {1, 3, 224, 224}
+static vector<int> ParseShape(const string &str) {
+  vector<int> shape;
+  istringstream in(str);
+  string dim;
+  while (getline(in, dim, 'x')) {
+    shape.push_back(atoi(dim.c_str()));
+    CHECK_GT(shape.back(), 0) << "Invalid shape " << str;
+  }
+  return shape;
+}
+
+// "1x64x56x56,1x64x56x56" -> shapes of two bottoms
+static vector<vector<int> > ParseShapes(const string &str) {
+  vector<vector<int> > shapes;
+  istringstream in(str);
+  string shape;
+  while (getline(in, shape, ',')) {
+    shapes.push_back(ParseShape(shape));
+  }
+  return shapes;
+}
+
+static string ShapeString(const vector<int> &shape) {
+  ostringstream out;
+  for (size_t i = 0; i < shape.size(); i++) {
+    out << (i == 0 ? "" : "x") << shape[i];
+  }
+  return out.str();
+}
+
+int main(int argc, char *argv[]) {
+  const char *usage =
+      "[Usage]: ./layer_benchmark layer_param shapes [shapes ...]"
+      " [-warmup 5] [-iterations 50] [-threads 1] [-gpu gpu_id]\n"
+      "  layer_param: LayerParameter in prototxt format, like"
+      " 'type: \"Pooling\" pooling_param { pool: MAX kernel_size: 2 stride: 2 }'\n"
+      "  shapes: bottom shapes of one run separated by ',', like 1x64x56x56";
+  CHECK_GE(argc, 3) << usage;
+  const string layer_param = argv[1];
+  vector<vector<vector<int> > > sweep;
+  int warmup = 5, iterations = 50, num_threads = 1, gpu_id = -1;
+  for (int i = 2; i < argc; i++) {
+    const string arg = argv[i];
+    if (arg[0] != '-') {
+      sweep.push_back(ParseShapes(arg));
+      continue;
+    }
+    CHECK_LT(i + 1, argc) << usage;
+    if (arg == "-warmup") warmup = atoi(argv[i + 1]);
+    else if (arg == "-iterations") iterations = atoi(argv[i + 1]);
+    else if (arg == "-threads") num_threads = atoi(argv[i + 1]);
+    else if (arg == "-gpu") gpu_id = atoi(argv[i + 1]);
+    else LOG(FATAL) << usage;
+    i++;
+  }
+  CHECK(!sweep.empty()) << usage;
+  CHECK_GT(iterations, 0) << usage;
+  if (gpu_id >= 0 && caffe::GPUAvailable()) {
+    caffe::SetMode(caffe::GPU, gpu_id);
+  }
+  caffe::SetNumThreads(num_threads);
+
+  for (const vector<vector<int> > &bottom_shapes : sweep) {
+    caffe::LayerBenchmarkResult result =
+        caffe::BenchmarkLayer(layer_param, bottom_shapes, warmup, iterations);
+    string bottoms, tops;
+    for (const vector<int> &shape : bottom_shapes) {
+      bottoms += (bottoms.empty() ? "" : ",") + ShapeString(shape);
+    }
+    for (const vector<int> &shape : result.top_shapes) {
+      tops += (tops.empty() ? "" : ",") + ShapeString(shape);
+    }
+    ostringstream rate;
+    if (result.cost.macs > 0 && result.mean_ms > 0) {
+      rate << ", " << result.cost.macs / (result.mean_ms * 1e6) << " GMAC/s";
+    }
+    LOG(INFO) << bottoms << " -> " << tops << ": mean " << result.mean_ms
+              << " ms, min " << result.min_ms << " ms, max " << result.max_ms
+              << " ms" << rate.str();
+  }
+  return 0;
+}
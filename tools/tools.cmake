@@ -1,3 +1,23 @@
 # benchmark
 add_executable(benchmark ${CMAKE_CURRENT_LIST_DIR}/benchmark.cpp)
 target_link_libraries(benchmark caffe)
+
+# benchmark suite over the nets in tools/benchmark/suite.txt
+add_executable(benchmark_suite ${CMAKE_CURRENT_LIST_DIR}/benchmark_suite.cpp)
+target_link_libraries(benchmark_suite caffe)
+
+# fold batchnorm into convolution
+add_executable(fuse_bn ${CMAKE_CURRENT_LIST_DIR}/fuse_bn.cpp)
+target_link_libraries(fuse_bn caffe)
+
+# time a single layer over a sweep of input shapes
+add_executable(layer_benchmark ${CMAKE_CURRENT_LIST_DIR}/layer_benchmark.cpp)
+target_link_libraries(layer_benchmark caffe)
+
+# convert a caffemodel to flat weights mapped into memory when loaded
+add_executable(convert_weights ${CMAKE_CURRENT_LIST_DIR}/convert_weights.cpp)
+target_link_libraries(convert_weights caffe)
+
+# calibrate the int8 inference of a net over sample inputs
+add_executable(calibrate ${CMAKE_CURRENT_LIST_DIR}/calibrate.cpp)
+target_link_libraries(calibrate caffe)